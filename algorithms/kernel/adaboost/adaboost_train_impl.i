@@ -45,6 +45,7 @@
 
 #include "weak_learner_model.h"
 #include "adaboost_model.h"
+#include "stump_train_kernel.h"
 
 using namespace daal::data_management;
 
@@ -118,7 +119,9 @@ void AdaBoostTrainKernel<method, algorithmFPType, cpu>::adaBoostFreundKernel(
         w[i] = invNVectors;
     }
 
-    services::SharedPtr<weak_learner::training::Batch>   learnerTrain   = parameter->weakLearnerTraining;
+    /* Copy of the weak learner keeps the data prepared for the training data set between the iterations */
+    services::SharedPtr<weak_learner::training::Batch>   learnerTrain   = parameter->weakLearnerTraining->clone();
+    stump::training::internal::enableSortedFeaturesReuse(learnerTrain.get());
     learnerTrain->getErrors()->setCanThrow(false);
     learnerTrain->input.set(classifier::training::data,    weakLearnerInputTables[0]);
     learnerTrain->input.set(classifier::training::labels,  weakLearnerInputTables[1]);
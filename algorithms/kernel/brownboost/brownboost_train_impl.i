@@ -42,6 +42,7 @@
 
 #include "weak_learner_model.h"
 #include "brownboost_model.h"
+#include "stump_train_kernel.h"
 
 using namespace daal::data_management;
 
@@ -154,7 +155,9 @@ void BrownBoostTrainKernel<method, algorithmFPType, cpu>::brownBoostFreundKernel
     r = daal::services::internal::service_calloc<algorithmFPType, cpu>(nVectors);
     if (!r) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
 
-    services::SharedPtr<weak_learner::training::Batch>   learnerTrain   = parameter->weakLearnerTraining;
+    /* Copy of the weak learner keeps the data prepared for the training data set between the iterations */
+    services::SharedPtr<weak_learner::training::Batch>   learnerTrain   = parameter->weakLearnerTraining->clone();
+    stump::training::internal::enableSortedFeaturesReuse(learnerTrain.get());
     learnerTrain->getErrors()->setCanThrow(false);
     learnerTrain->input.set(classifier::training::data,    weakLearnerInputTables[0]);
     learnerTrain->input.set(classifier::training::labels,  weakLearnerInputTables[1]);
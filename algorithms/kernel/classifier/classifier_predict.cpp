@@ -135,6 +135,8 @@ void Input::checkImpl(const daal::algorithms::Parameter *parameter) const
 }
 Result::Result() : daal::algorithms::Result(1) {}
 
+Result::Result(const size_t nElements) : daal::algorithms::Result(nElements) {}
+
 /**
  * Returns the prediction result of the classification algorithm
  * \param[in] id   Identifier of the prediction result, \ref ResultId
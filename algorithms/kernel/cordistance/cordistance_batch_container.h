@@ -59,10 +59,8 @@ void BatchContainer<algorithmFPType, method, cpu>::compute()
     size_t na = input->size();
     size_t nr = result->size();
 
-    NumericTable *a0 = static_cast<NumericTable *>(input->get(data).get());
-    NumericTable **a = &a0;
-    NumericTable *r0 = static_cast<NumericTable *>(result->get(correlationDistance).get());
-    NumericTable **r = &r0;
+    NumericTable *a[] = { input->get(data).get(), input->get(referenceData).get() };
+    NumericTable *r[] = { result->get(correlationDistance).get(), result->get(indices).get(), result->get(distances).get() };
     daal::algorithms::Parameter *par = _par;
     daal::services::Environment::env &env = *_env;
 
@@ -41,7 +41,20 @@ template <typename algorithmFPType>
 DAAL_EXPORT void Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method)
 {
     Input *algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
+    const Parameter *algParameter = static_cast<const Parameter *>(par);
+    if (method == (int)tiledDense && algParameter && algParameter->rowBlockProcessor) { return; }
+
     size_t dim = algInput->get(data)->getNumberOfRows();
+    if (method == (int)topKDense)
+    {
+        const size_t k = algParameter->k;
+        Argument::set(indices, data_management::SerializationIfacePtr(
+                          new data_management::HomogenNumericTable<int>(k, dim, data_management::NumericTable::doAllocate)));
+        Argument::set(distances, data_management::SerializationIfacePtr(
+                          new data_management::HomogenNumericTable<algorithmFPType>(k, dim, data_management::NumericTable::doAllocate)));
+        return;
+    }
+
     Argument::set(correlationDistance, data_management::SerializationIfacePtr(
                       new data_management::PackedSymmetricMatrix<data_management::NumericTableIface::lowerPackedSymmetricMatrix>(
                           dim, data_management::NumericTable::doAllocate)));
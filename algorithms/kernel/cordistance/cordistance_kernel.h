@@ -47,6 +47,22 @@ public:
                  const daal::algorithms::Parameter *par);
 };
 
+template<typename algorithmFPType, CpuType cpu>
+class DistanceKernel<algorithmFPType, tiledDense, cpu> : public Kernel
+{
+public:
+    void compute(const size_t na, const NumericTable *const *a, const size_t nr, NumericTable *r[],
+                 const daal::algorithms::Parameter *par);
+};
+
+template<typename algorithmFPType, CpuType cpu>
+class DistanceKernel<algorithmFPType, topKDense, cpu> : public Kernel
+{
+public:
+    void compute(const size_t na, const NumericTable *const *a, const size_t nr, NumericTable *r[],
+                 const daal::algorithms::Parameter *par);
+};
+
 } // namespace internal
 
 } // namespace correlation_distance
@@ -0,0 +1,92 @@
+/* file: cordistance_tiled_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of correlation distance computed by tiles.
+//--
+*/
+
+#include "daal_defines.h"
+#include "service_micro_table.h"
+#include "service_numeric_table.h"
+#include "service_distance_tiles.h"
+
+using namespace daal::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace correlation_distance
+{
+namespace internal
+{
+
+/**
+ *  \brief Kernel for correlation distances calculation by tiles
+ */
+template<typename algorithmFPType, CpuType cpu>
+void DistanceKernel<algorithmFPType, tiledDense, cpu>::compute(const size_t na, const NumericTable *const *a,
+                                                               const size_t nr, NumericTable *r[], const daal::algorithms::Parameter *par)
+{
+    NumericTable *xTable = const_cast<NumericTable *>( a[0] );  /* Input data */
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+
+    DistanceTiles<algorithmFPType, cpu> tiles(xTable, xTable, true);
+    bool isOk = true;
+
+    if (parameter->rowBlockProcessor)
+    {
+        RowBlockProcessorIface &processor = *parameter->rowBlockProcessor;
+        const size_t n = xTable->getNumberOfRows();
+        isOk = computeDistanceByRowBlocks<algorithmFPType, cpu>(tiles, parameter->nRowsInBlock,
+            [ =, &processor ](size_t startRow, size_t nRows, algorithmFPType *block)
+        {
+            NumericTablePtr blockTable(new HomogenNumericTableCPU<algorithmFPType, cpu>(block, n, nRows));
+            processor(startRow, blockTable);
+        } );
+    }
+    else
+    {
+        const NumericTableIface::StorageLayout rLayout = r[0]->getDataLayout();
+        const bool isLower = (rLayout == NumericTableIface::lowerPackedSymmetricMatrix);
+        if (!isLower && rLayout != NumericTableIface::upperPackedSymmetricMatrix)
+        {
+            this->_errors->add(services::ErrorIncorrectTypeOfOutputNumericTable); return;
+        }
+
+        algorithmFPType *rArray;
+        PackedArrayMicroTable<algorithmFPType, writeOnly, cpu> rPackedMicroTable( r[0] );
+        rPackedMicroTable.getPackedArray(&rArray);
+        isOk = computePackedDistance<algorithmFPType, cpu>(tiles, rArray, isLower);
+        rPackedMicroTable.release();
+    }
+
+    if (!isOk)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+}
+
+} // namespace internal
+
+} // namespace correlation_distance
+
+} // namespace algorithms
+
+} // namespace daal
@@ -36,7 +36,16 @@ namespace cosine_distance
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_COSINE_DISTANCE_RESULT_ID);
-Input::Input() : daal::algorithms::Input(1) {}
+
+Parameter::Parameter() : k(1), nRowsInBlock(128) {}
+
+void Parameter::check() const
+{
+    DAAL_CHECK_EX(k > 0, ErrorIncorrectParameter, ParameterName, kStr());
+    DAAL_CHECK_EX(nRowsInBlock > 0, ErrorIncorrectParameter, ParameterName, nRowsInBlockStr());
+}
+
+Input::Input() : daal::algorithms::Input(2) {}
 
 /**
 * Returns the input object of the cosine distance algorithm
@@ -66,9 +75,21 @@ void Input::set(InputId id, const data_management::NumericTablePtr &ptr)
 void Input::check(const daal::algorithms::Parameter *par, int method) const
 {
     if (!data_management::checkNumericTable(get(data).get(), this->_errors.get(), dataStr())) { return; }
+    if (method != (int)topKDense) { return; }
+
+    const size_t nFeatures = get(data)->getNumberOfColumns();
+    size_t nCandidates = get(data)->getNumberOfRows() - 1;
+    if (get(referenceData))
+    {
+        if (!data_management::checkNumericTable(get(referenceData).get(), this->_errors.get(), referenceDataStr(), 0, 0, nFeatures)) { return; }
+        nCandidates = get(referenceData)->getNumberOfRows();
+    }
+
+    const Parameter *algParameter = static_cast<const Parameter *>(par);
+    DAAL_CHECK_EX(algParameter->k <= nCandidates, ErrorIncorrectParameter, ParameterName, kStr());
 }
 
-Result::Result() : daal::algorithms::Result(1) {}
+Result::Result() : daal::algorithms::Result(3) {}
 
 
 /**
@@ -100,8 +121,20 @@ void Result::set(ResultId id, const data_management::NumericTablePtr &ptr)
 void Result::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const
 {
     const Input *algInput = static_cast<const Input *>(input);
+    const Parameter *algParameter = static_cast<const Parameter *>(par);
+
+    /* the distance matrix is passed to the row block processor instead of the result */
+    if (method == (int)tiledDense && algParameter && algParameter->rowBlockProcessor) { return; }
 
     size_t nVectors  = algInput->get(data)->getNumberOfRows();
+    if (method == (int)topKDense)
+    {
+        const size_t k = algParameter->k;
+        if (!data_management::checkNumericTable(get(indices).get(), this->_errors.get(), indicesStr(), 0, 0, k, nVectors)) { return; }
+        if (!data_management::checkNumericTable(get(distances).get(), this->_errors.get(), distancesStr(), 0, 0, k, nVectors)) { return; }
+        return;
+    }
+
     int unexpectedLayouts = (int)data_management::NumericTableIface::csrArray |
                             (int)data_management::NumericTableIface::upperPackedTriangularMatrix |
                             (int)data_management::NumericTableIface::lowerPackedTriangularMatrix;
@@ -0,0 +1,84 @@
+/* file: cosdistance_topk_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the search of k nearest neighbors by the cosine distance.
+//--
+*/
+
+#include "daal_defines.h"
+#include "service_micro_table.h"
+#include "service_numeric_table.h"
+#include "service_distance_tiles.h"
+
+using namespace daal::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace cosine_distance
+{
+namespace internal
+{
+
+/**
+ *  \brief Kernel for the search of k nearest neighbors by the cosine distance
+ */
+template<typename algorithmFPType, CpuType cpu>
+void DistanceKernel<algorithmFPType, topKDense, cpu>::compute(const size_t na, const NumericTable *const *a,
+                                                              const size_t nr, NumericTable *r[], const daal::algorithms::Parameter *par)
+{
+    NumericTable *xTable = const_cast<NumericTable *>( a[0] );  /* Input data */
+    NumericTable *yTable = const_cast<NumericTable *>( a[1] );  /* Reference data */
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+
+    const bool excludeSelf = (yTable == 0);
+    if (excludeSelf) { yTable = xTable; }
+
+    const size_t n = xTable->getNumberOfRows();
+    const size_t k = parameter->k;
+
+    BlockMicroTable<int, writeOnly, cpu> idxTable(r[1]);
+    BlockMicroTable<algorithmFPType, writeOnly, cpu> distTable(r[2]);
+    int *idx;
+    algorithmFPType *dist;
+    idxTable.getBlockOfRows(0, n, &idx);
+    distTable.getBlockOfRows(0, n, &dist);
+    if (!idx || !dist)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed); return;
+    }
+
+    DistanceTiles<algorithmFPType, cpu> tiles(xTable, yTable, false);
+    if (!computeNearestNeighbors<algorithmFPType, cpu>(tiles, k, excludeSelf, idx, dist))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+
+    idxTable.release();
+    distTable.release();
+}
+
+} // namespace internal
+
+} // namespace cosine_distance
+
+} // namespace algorithms
+
+} // namespace daal
@@ -48,23 +48,26 @@
     }
 
 #undef  __DAAL_COVARIANCE_BATCH_CONTAINER_COMPUTE
-#define __DAAL_COVARIANCE_BATCH_CONTAINER_COMPUTE(ComputeMethod, KernelClass)       \
-    template<typename algorithmFPType, CpuType cpu>                                 \
-    void BatchContainer<algorithmFPType, ComputeMethod, cpu>::compute()             \
-    {                                                                               \
-        Result *result = static_cast<Result *>(_res);                               \
-        Input *input = static_cast<Input *>(_in);                                   \
-                                                                                    \
-        NumericTable *dataTable = input->get(data).get();                           \
-        NumericTable *covTable  = result->get(covariance).get();                    \
-        NumericTable *meanTable = result->get(mean).get();                          \
-                                                                                    \
-        Parameter *parameter = static_cast<Parameter *>(_par);                      \
-        daal::services::Environment::env &env = *_env;                              \
-                                                                                    \
-         __DAAL_CALL_KERNEL(env, KernelClass,                                       \
-                    __DAAL_KERNEL_ARGUMENTS(algorithmFPType, ComputeMethod),        \
-                    compute, dataTable, covTable, meanTable, parameter);            \
+#define __DAAL_COVARIANCE_BATCH_CONTAINER_COMPUTE(ComputeMethod, KernelClass)           \
+    template<typename algorithmFPType, CpuType cpu>                                     \
+    void BatchContainer<algorithmFPType, ComputeMethod, cpu>::compute()                 \
+    {                                                                                   \
+        Result *result = static_cast<Result *>(_res);                                   \
+        Input *input = static_cast<Input *>(_in);                                       \
+                                                                                        \
+        NumericTable *dataTable          = input->get(data).get();                      \
+        NumericTable *weightsTable       = input->get(weights).get();                   \
+        NumericTable *covTable           = result->get(covariance).get();               \
+        NumericTable *meanTable          = result->get(mean).get();                     \
+        NumericTable *nObsPerFeatureTable = result->get(nObservationsPerFeature).get(); \
+                                                                                        \
+        Parameter *parameter = static_cast<Parameter *>(_par);                          \
+        daal::services::Environment::env &env = *_env;                                  \
+                                                                                        \
+         __DAAL_CALL_KERNEL(env, KernelClass,                                           \
+                    __DAAL_KERNEL_ARGUMENTS(algorithmFPType, ComputeMethod),            \
+                    compute, dataTable, weightsTable, covTable, meanTable,              \
+                    nObsPerFeatureTable, parameter);                                    \
     }
 
 
@@ -86,51 +89,61 @@
     }
 
 #undef  __DAAL_COVARIANCE_ONLINE_CONTAINER_COMPUTE
-#define __DAAL_COVARIANCE_ONLINE_CONTAINER_COMPUTE(ComputeMethod, KernelClass)          \
-    template<typename algorithmFPType, CpuType cpu>                                     \
-    void OnlineContainer<algorithmFPType, ComputeMethod, cpu>::compute()                \
-    {                                                                                   \
-        PartialResult *partialResult = static_cast<PartialResult *>(_pres);             \
-        Input *input = static_cast<Input *>(_in);                                       \
-                                                                                        \
-        NumericTable *dataTable = input->get(data).get();                           \
-                                                                                        \
-        NumericTable *nObsTable         = partialResult->get(nObservations).get();  \
-        NumericTable *crossProductTable = partialResult->get(crossProduct).get();   \
-        NumericTable *sumTable          = partialResult->get(sum).get();            \
-                                                                                        \
-        Parameter *parameter = static_cast<Parameter *>(_par);                          \
-        daal::services::Environment::env &env = *_env;                                  \
-                                                                                        \
-                                                                                        \
-         __DAAL_CALL_KERNEL(env, KernelClass,                                           \
-                   __DAAL_KERNEL_ARGUMENTS(algorithmFPType, ComputeMethod),             \
-                   compute, dataTable, nObsTable, crossProductTable, sumTable,          \
-                   parameter);                                                          \
+#define __DAAL_COVARIANCE_ONLINE_CONTAINER_COMPUTE(ComputeMethod, KernelClass)                      \
+    template<typename algorithmFPType, CpuType cpu>                                                 \
+    void OnlineContainer<algorithmFPType, ComputeMethod, cpu>::compute()                            \
+    {                                                                                               \
+        PartialResult *partialResult = static_cast<PartialResult *>(_pres);                         \
+        Input *input = static_cast<Input *>(_in);                                                   \
+                                                                                                    \
+        NumericTable *dataTable    = input->get(data).get();                                        \
+        NumericTable *weightsTable = input->get(weights).get();                                     \
+                                                                                                    \
+        NumericTable *nObsTable             = partialResult->get(nObservations).get();              \
+        NumericTable *crossProductTable     = partialResult->get(crossProduct).get();               \
+        NumericTable *sumTable              = partialResult->get(sum).get();                        \
+        NumericTable *pairwiseNObsTable     = partialResult->get(pairwiseNObservations).get();      \
+        NumericTable *pairwiseSumTable      = partialResult->get(pairwiseSum).get();                \
+        NumericTable *pairwiseSumSqCenTable = partialResult->get(pairwiseSumSquaresCentered).get(); \
+                                                                                                    \
+        Parameter *parameter = static_cast<Parameter *>(_par);                                      \
+        daal::services::Environment::env &env = *_env;                                              \
+                                                                                                    \
+                                                                                                    \
+         __DAAL_CALL_KERNEL(env, KernelClass,                                                       \
+                   __DAAL_KERNEL_ARGUMENTS(algorithmFPType, ComputeMethod),                         \
+                   compute, dataTable, weightsTable, nObsTable, crossProductTable,                  \
+                   sumTable, pairwiseNObsTable, pairwiseSumTable, pairwiseSumSqCenTable,            \
+                   parameter);                                                                      \
     }
 
 #undef  __DAAL_COVARIANCE_ONLINE_CONTAINER_FINALIZECOMPUTE
-#define __DAAL_COVARIANCE_ONLINE_CONTAINER_FINALIZECOMPUTE(ComputeMethod, KernelClass)  \
-    template<typename algorithmFPType, CpuType cpu>                                     \
-    void OnlineContainer<algorithmFPType, ComputeMethod, cpu>::finalizeCompute()        \
-    {                                                                                   \
-        PartialResult *partialResult = static_cast<PartialResult *>(_pres);             \
-        Result *result = static_cast<Result *>(_res);                                   \
-                                                                                        \
-        NumericTable *nObsTable         = partialResult->get(nObservations).get();  \
-        NumericTable *crossProductTable = partialResult->get(crossProduct).get();   \
-        NumericTable *sumTable          = partialResult->get(sum).get();            \
-                                                                                        \
-        NumericTable *covTable  = result->get(covariance).get();                    \
-        NumericTable *meanTable = result->get(mean).get();                          \
-                                                                                        \
-        Parameter *parameter = static_cast<Parameter *>(_par);                          \
-        daal::services::Environment::env &env = *_env;                                  \
-                                                                                        \
-         __DAAL_CALL_KERNEL(env, KernelClass,                                           \
-                   __DAAL_KERNEL_ARGUMENTS(algorithmFPType, ComputeMethod),             \
-                   finalizeCompute, nObsTable, crossProductTable,                       \
-                   sumTable, covTable, meanTable, parameter);                           \
+#define __DAAL_COVARIANCE_ONLINE_CONTAINER_FINALIZECOMPUTE(ComputeMethod, KernelClass)              \
+    template<typename algorithmFPType, CpuType cpu>                                                 \
+    void OnlineContainer<algorithmFPType, ComputeMethod, cpu>::finalizeCompute()                    \
+    {                                                                                               \
+        PartialResult *partialResult = static_cast<PartialResult *>(_pres);                         \
+        Result *result = static_cast<Result *>(_res);                                               \
+                                                                                                    \
+        NumericTable *nObsTable             = partialResult->get(nObservations).get();              \
+        NumericTable *crossProductTable     = partialResult->get(crossProduct).get();               \
+        NumericTable *sumTable              = partialResult->get(sum).get();                        \
+        NumericTable *pairwiseNObsTable     = partialResult->get(pairwiseNObservations).get();      \
+        NumericTable *pairwiseSumTable      = partialResult->get(pairwiseSum).get();                \
+        NumericTable *pairwiseSumSqCenTable = partialResult->get(pairwiseSumSquaresCentered).get(); \
+                                                                                                    \
+        NumericTable *covTable            = result->get(covariance).get();                          \
+        NumericTable *meanTable           = result->get(mean).get();                                \
+        NumericTable *nObsPerFeatureTable = result->get(nObservationsPerFeature).get();             \
+                                                                                                    \
+        Parameter *parameter = static_cast<Parameter *>(_par);                                      \
+        daal::services::Environment::env &env = *_env;                                              \
+                                                                                                    \
+         __DAAL_CALL_KERNEL(env, KernelClass,                                                       \
+                   __DAAL_KERNEL_ARGUMENTS(algorithmFPType, ComputeMethod),                         \
+                   finalizeCompute, nObsTable, crossProductTable, sumTable,                         \
+                   pairwiseNObsTable, pairwiseSumTable, pairwiseSumSqCenTable,                      \
+                   covTable, meanTable, nObsPerFeatureTable, parameter);                            \
     }
 
 namespace daal
@@ -210,16 +223,20 @@ void DistributedContainer<step2Master, algorithmFPType, method, cpu>::compute()
     DistributedInput<step2Master> *input = static_cast<DistributedInput<step2Master> *>(_in);
     DataCollection *collection = input->get(partialResults).get();
 
-    NumericTable *nObsTable         = partialResult->get(nObservations).get();
-    NumericTable *crossProductTable = partialResult->get(crossProduct).get();
-    NumericTable *sumTable          = partialResult->get(sum).get();
+    NumericTable *nObsTable             = partialResult->get(nObservations).get();
+    NumericTable *crossProductTable     = partialResult->get(crossProduct).get();
+    NumericTable *sumTable              = partialResult->get(sum).get();
+    NumericTable *pairwiseNObsTable     = partialResult->get(pairwiseNObservations).get();
+    NumericTable *pairwiseSumTable      = partialResult->get(pairwiseSum).get();
+    NumericTable *pairwiseSumSqCenTable = partialResult->get(pairwiseSumSquaresCentered).get();
 
     Parameter *parameter = static_cast<Parameter *>(_par);
     daal::services::Environment::env &env = *_env;
 
      __DAAL_CALL_KERNEL(env, internal::CovarianceDistributedKernel,
                        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),
-                       compute, collection, nObsTable, crossProductTable, sumTable, parameter);
+                       compute, collection, nObsTable, crossProductTable, sumTable,
+                       pairwiseNObsTable, pairwiseSumTable, pairwiseSumSqCenTable, parameter);
 
     collection->clear();
 }
@@ -230,19 +247,25 @@ void DistributedContainer<step2Master, algorithmFPType, method, cpu>::finalizeCo
     Result *result = static_cast<Result *>(_res);
     PartialResult *partialResult = static_cast<PartialResult *>(_pres);
 
-    NumericTable *nObsTable         = partialResult->get(nObservations).get();
-    NumericTable *crossProductTable = partialResult->get(crossProduct).get();
-    NumericTable *sumTable          = partialResult->get(sum).get();
+    NumericTable *nObsTable             = partialResult->get(nObservations).get();
+    NumericTable *crossProductTable     = partialResult->get(crossProduct).get();
+    NumericTable *sumTable              = partialResult->get(sum).get();
+    NumericTable *pairwiseNObsTable     = partialResult->get(pairwiseNObservations).get();
+    NumericTable *pairwiseSumTable      = partialResult->get(pairwiseSum).get();
+    NumericTable *pairwiseSumSqCenTable = partialResult->get(pairwiseSumSquaresCentered).get();
 
-    NumericTable *covTable  = result->get(covariance).get();
-    NumericTable *meanTable = result->get(mean).get();
+    NumericTable *covTable            = result->get(covariance).get();
+    NumericTable *meanTable           = result->get(mean).get();
+    NumericTable *nObsPerFeatureTable = result->get(nObservationsPerFeature).get();
 
     Parameter *parameter = static_cast<Parameter *>(_par);
     daal::services::Environment::env &env = *_env;
 
      __DAAL_CALL_KERNEL(env, internal::CovarianceDistributedKernel,
                        __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),
-                       finalizeCompute, nObsTable, crossProductTable, sumTable, covTable, meanTable, parameter);
+                       finalizeCompute, nObsTable, crossProductTable, sumTable,
+                       pairwiseNObsTable, pairwiseSumTable, pairwiseSumSqCenTable,
+                       covTable, meanTable, nObsPerFeatureTable, parameter);
 }
 
 }
@@ -26,6 +26,7 @@
 
 #include "covariance_kernel.h"
 #include "covariance_impl.i"
+#include "covariance_pairwise_impl.i"
 
 #include "service_numeric_table.h"
 
@@ -40,16 +41,24 @@ namespace internal
 
 template<typename algorithmFPType, Method method, CpuType cpu>
 void CovarianceDenseBatchKernel<algorithmFPType, method, cpu>::compute(
-            NumericTable *dataTable, NumericTable *covTable,
-            NumericTable *meanTable, const Parameter *parameter)
+            NumericTable *dataTable, NumericTable *weightsTable, NumericTable *covTable,
+            NumericTable *meanTable, NumericTable *nObsPerFeatureTable, const Parameter *parameter)
 {
+    if (weightsTable || parameter->skipMissingValues)
+    {
+        computePairwiseCovariance<algorithmFPType, cpu>(dataTable, weightsTable, covTable, meanTable, nObsPerFeatureTable,
+            parameter, this->_errors.get());
+        return;
+    }
+
     algorithmFPType nObservationsValue = 0.0;
     NumericTablePtr nObservationsTable(
         new daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>(&nObservationsValue, 1, 1));
     bool isOnline = false;
     updateDensePartialResults<algorithmFPType, method, cpu>(dataTable,
         covTable, meanTable, nObservationsTable.get(), isOnline, this->_errors.get());
-    finalizeCovariance<algorithmFPType, cpu>(covTable, meanTable, nObservationsTable.get(), parameter, this->_errors.get());
+    finalizeCovariance<algorithmFPType, cpu>(covTable, meanTable, nObservationsTable.get(), nObsPerFeatureTable,
+        parameter, this->_errors.get());
 }
 
 }
@@ -26,6 +26,7 @@
 
 #include "covariance_kernel.h"
 #include "covariance_impl.i"
+#include "covariance_pairwise_impl.i"
 
 namespace daal
 {
@@ -38,12 +39,20 @@ namespace internal
 
 template<typename algorithmFPType, Method method, CpuType cpu>
 void CovarianceDenseOnlineKernel<algorithmFPType, method, cpu>::compute(
-            NumericTable *dataTable, NumericTable *nObservationsTable,
+            NumericTable *dataTable, NumericTable *weightsTable, NumericTable *nObservationsTable,
             NumericTable *crossProductTable, NumericTable *sumTable,
+            NumericTable *pairwiseNObsTable, NumericTable *pairwiseSumTable, NumericTable *pairwiseSumSqCenTable,
             const Parameter *parameter)
 {
+    if (pairwiseNObsTable)
+    {
+        updatePairwisePartialResults<algorithmFPType, cpu>(dataTable, weightsTable, nObservationsTable, crossProductTable, sumTable,
+            pairwiseNObsTable, pairwiseSumTable, pairwiseSumSqCenTable, parameter, this->_errors.get());
+        return;
+    }
+
     bool isOnline = true;
-    if (method != sumDense)
+    if (method != sumDense || isLowerPackedMatrix(crossProductTable))
     {
         updateDensePartialResults<algorithmFPType, method, cpu>(dataTable,
             crossProductTable, sumTable, nObservationsTable, isOnline, this->_errors.get());
@@ -95,11 +104,20 @@ void CovarianceDenseOnlineKernel<algorithmFPType, method, cpu>::compute(
 template<typename algorithmFPType, Method method, CpuType cpu>
 void CovarianceDenseOnlineKernel<algorithmFPType, method, cpu>::finalizeCompute(
             NumericTable *nObservationsTable, NumericTable *crossProductTable,
-            NumericTable *sumTable, NumericTable *covTable,
-            NumericTable *meanTable, const Parameter *parameter)
+            NumericTable *sumTable, NumericTable *pairwiseNObsTable, NumericTable *pairwiseSumTable,
+            NumericTable *pairwiseSumSqCenTable, NumericTable *covTable,
+            NumericTable *meanTable, NumericTable *nObsPerFeatureTable, const Parameter *parameter)
 {
+    if (pairwiseNObsTable)
+    {
+        finalizePairwiseCovariance<algorithmFPType, cpu>(nObservationsTable, crossProductTable,
+            pairwiseNObsTable, pairwiseSumTable, pairwiseSumSqCenTable, covTable, meanTable, nObsPerFeatureTable,
+            parameter, this->_errors.get());
+        return;
+    }
+
     finalizeCovariance<algorithmFPType, cpu>(crossProductTable, sumTable, nObservationsTable,
-        covTable, meanTable, parameter, this->_errors.get());
+        covTable, meanTable, nObsPerFeatureTable, parameter, this->_errors.get());
 }
 
 }
@@ -26,6 +26,7 @@
 
 #include "covariance_kernel.h"
 #include "covariance_impl.i"
+#include "covariance_pairwise_impl.i"
 
 namespace daal
 {
@@ -40,55 +41,77 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 void CovarianceDistributedKernel<algorithmFPType, method, cpu>::compute(
             DataCollection *partialResultsCollection,
             NumericTable *nObservationsTable, NumericTable *crossProductTable,
-            NumericTable *sumTable, const Parameter *parameter)
+            NumericTable *sumTable, NumericTable *pairwiseNObsTable, NumericTable *pairwiseSumTable,
+            NumericTable *pairwiseSumSqCenTable, const Parameter *parameter)
 {
+    if (pairwiseNObsTable)
+    {
+        mergePairwisePartialResults<algorithmFPType, cpu>(partialResultsCollection, nObservationsTable, crossProductTable, sumTable,
+            pairwiseNObsTable, pairwiseSumTable, pairwiseSumSqCenTable, this->_errors.get());
+        return;
+    }
+
     size_t collectionSize = partialResultsCollection->size();
 
     size_t nFeatures = crossProductTable->getNumberOfColumns();
 
-    BlockDescriptor<algorithmFPType> crossProductBD, sumBD, nObservationsBD;
-    algorithmFPType *crossProduct, *sums, *nObservations;
-    getDenseCrossProductAndSums<algorithmFPType, cpu>(writeOnly,
-        crossProductTable, crossProductBD, &crossProduct, sumTable, sumBD, &sums,
-        nObservationsTable, nObservationsBD, &nObservations);
+    BlockDescriptor<algorithmFPType> sumBD, nObservationsBD;
+    algorithmFPType *sums, *nObservations;
+    SymmetricMatrixData<algorithmFPType, cpu> crossProduct(crossProductTable, writeOnly);
+    getTableData<algorithmFPType, cpu>(writeOnly, sumTable,           sumBD,           &sums);
+    getTableData<algorithmFPType, cpu>(writeOnly, nObservationsTable, nObservationsBD, &nObservations);
 
     algorithmFPType zero = 0.0;
-    daal::services::internal::service_memset<algorithmFPType, cpu>(crossProduct, zero, nFeatures * nFeatures);
+    const SymmetricMatrixView<algorithmFPType> &crossProductView = crossProduct.view();
+    daal::threader_for( nFeatures, nFeatures, [ = ](size_t i)
+    {
+        daal::services::internal::service_memset<algorithmFPType, cpu>(crossProductView.row(i), zero, i + 1);
+    } );
     daal::services::internal::service_memset<algorithmFPType, cpu>(sums, zero, nFeatures);
     *nObservations = zero;
 
-    NumericTable *partialCrossProductTable, *partialSumsTable, *partialNObservationsTable;
-    BlockDescriptor<algorithmFPType> partialCrossProductBD, partialSumBD, partialNObservationsBD;
-    algorithmFPType *partialCrossProduct, *partialSums, *partialNObservations;
+    NumericTable *partialSumsTable, *partialNObservationsTable;
+    BlockDescriptor<algorithmFPType> partialSumBD, partialNObservationsBD;
+    algorithmFPType *partialSums, *partialNObservations;
     for (size_t i = 0; i < collectionSize; i++)
     {
         PartialResult* patrialResult = static_cast<PartialResult*>((*partialResultsCollection)[i].get());
-        partialCrossProductTable  = patrialResult->get(covariance::crossProduct).get();
         partialSumsTable          = patrialResult->get(covariance::sum).get();
         partialNObservationsTable = patrialResult->get(covariance::nObservations).get();
-        getDenseCrossProductAndSums<algorithmFPType, cpu>(readOnly,
-            partialCrossProductTable, partialCrossProductBD, &partialCrossProduct,
-            partialSumsTable, partialSumBD, &partialSums,
-            partialNObservationsTable, partialNObservationsBD, &partialNObservations);
 
-        mergeCrossProductAndSums<algorithmFPType, cpu>(nFeatures, partialCrossProduct,
-            partialSums, partialNObservations, crossProduct, sums, nObservations);
+        SymmetricMatrixData<algorithmFPType, cpu> partialCrossProduct(patrialResult->get(covariance::crossProduct).get(), readOnly);
+        getTableData<algorithmFPType, cpu>(readOnly, partialSumsTable,          partialSumBD,           &partialSums);
+        getTableData<algorithmFPType, cpu>(readOnly, partialNObservationsTable, partialNObservationsBD, &partialNObservations);
+
+        mergeCrossProductAndSums<algorithmFPType, cpu>(nFeatures, partialCrossProduct.view(),
+            partialSums, partialNObservations, crossProductView, sums, nObservations);
 
-        releaseDenseCrossProductAndSums<algorithmFPType, cpu>(partialCrossProductTable, partialCrossProductBD,
-            partialSumsTable, partialSumBD, partialNObservationsTable, partialNObservationsBD);
+        partialSumsTable->releaseBlockOfRows(partialSumBD);
+        partialNObservationsTable->releaseBlockOfRows(partialNObservationsBD);
     }
-    releaseDenseCrossProductAndSums<algorithmFPType, cpu>(crossProductTable, crossProductBD, sumTable, sumBD,
-        nObservationsTable, nObservationsBD);
+    copyLowerToUpper<algorithmFPType, cpu>(crossProductView);
+
+    sumTable->releaseBlockOfRows(sumBD);
+    nObservationsTable->releaseBlockOfRows(nObservationsBD);
 }
 
 template<typename algorithmFPType, Method method, CpuType cpu>
 void CovarianceDistributedKernel<algorithmFPType, method, cpu>::finalizeCompute(
             NumericTable *nObservationsTable, NumericTable *crossProductTable,
-            NumericTable *sumTable, NumericTable *covTable,
-            NumericTable *meanTable, const Parameter *parameter)
+            NumericTable *sumTable, NumericTable *pairwiseNObsTable, NumericTable *pairwiseSumTable,
+            NumericTable *pairwiseSumSqCenTable, NumericTable *covTable,
+            NumericTable *meanTable, NumericTable *nObsPerFeatureTable, const Parameter *parameter)
 {
+    if (pairwiseNObsTable)
+    {
+        finalizePairwiseCovariance<algorithmFPType, cpu>(nObservationsTable, crossProductTable,
+            pairwiseNObsTable, pairwiseSumTable, pairwiseSumSqCenTable, covTable, meanTable, nObsPerFeatureTable,
+            parameter, this->_errors.get());
+        return;
+    }
+
     finalizeCovariance<algorithmFPType, cpu>(crossProductTable, sumTable, nObservationsTable,
-        covTable, meanTable, parameter, this->_errors.get());
+        covTable, meanTable, nObsPerFeatureTable, parameter, this->_errors.get());
 }
 
 }
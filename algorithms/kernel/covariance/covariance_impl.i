@@ -27,11 +27,13 @@
 #include "numeric_table.h"
 #include "csr_numeric_table.h"
 #include "service_memory.h"
+#include "service_numeric_table.h"
 #include "service_math.h"
 #include "service_blas.h"
 #include "service_spblas.h"
 #include "service_stat.h"
 #include "threading.h"
+#include "symmetric_matrix.h"
 
 
 
@@ -148,6 +150,91 @@ void releaseDenseCrossProductAndSums( NumericTable                     *covTable
 }
 
 
+/*********************** SymmetricMatrixView *****************************************************/
+/* Lower triangle of the symmetric p x p matrix stored in the full or in the lower packed layout.
+   The elements (i, 0), ..., (i, i) of the row i are contiguous in both layouts */
+template<typename algorithmFPType>
+struct SymmetricMatrixView
+{
+    SymmetricMatrixView(algorithmFPType *data = 0, size_t nFeatures = 0, bool isPacked = false) :
+        data(data), nFeatures(nFeatures), isPacked(isPacked) {}
+
+    algorithmFPType *row(size_t i) const
+    {
+        return data + (isPacked ? i * (i + 1) / 2 : i * nFeatures);
+    }
+
+    algorithmFPType *data;
+    size_t nFeatures;
+    bool isPacked;
+};
+
+/*********************** copyLowerToUpper ********************************************************/
+/* Copies the lower triangle of the matrix in the full layout into its upper triangle */
+template<typename algorithmFPType, CpuType cpu>
+void copyLowerToUpper(const SymmetricMatrixView<algorithmFPType> &matrix)
+{
+    if (matrix.isPacked) { return; }
+
+    const size_t nFeatures = matrix.nFeatures;
+    algorithmFPType *data = matrix.data;
+    daal::threader_for( nFeatures, nFeatures, [ = ](size_t i)
+    {
+        for (size_t j = i + 1; j < nFeatures; j++)
+        {
+            data[i * nFeatures + j] = data[j * nFeatures + i];
+        }
+    } );
+}
+
+/*********************** isLowerPackedMatrix *****************************************************/
+inline bool isLowerPackedMatrix(NumericTable *table)
+{
+    return (table->getDataLayout() == NumericTableIface::lowerPackedSymmetricMatrix);
+}
+
+/*********************** SymmetricMatrixData *****************************************************/
+/* Provides the cross-product or the covariance table as SymmetricMatrixView.
+   The tables in the lower packed layout are accessed as packed arrays, so the full matrix is never formed,
+   all other tables are accessed as the blocks of all rows */
+template<typename algorithmFPType, CpuType cpu>
+class SymmetricMatrixData
+{
+public:
+    SymmetricMatrixData(NumericTable *table, ReadWriteMode rwMode) : _table(table), _packedTable(0)
+    {
+        const size_t nFeatures = table->getNumberOfColumns();
+        if (isLowerPackedMatrix(table))
+        {
+            _packedTable = dynamic_cast<PackedArrayNumericTableIface *>(table);
+        }
+
+        if (_packedTable)
+        {
+            _packedTable->getPackedArray(rwMode, _bd);
+        }
+        else
+        {
+            table->getBlockOfRows(0, nFeatures, rwMode, _bd);
+        }
+        _view = SymmetricMatrixView<algorithmFPType>(_bd.getBlockPtr(), nFeatures, _packedTable != 0);
+    }
+
+    ~SymmetricMatrixData()
+    {
+        if (_packedTable) { _packedTable->releasePackedArray(_bd); }
+        else              { _table->releaseBlockOfRows(_bd); }
+    }
+
+    const SymmetricMatrixView<algorithmFPType> &view() const { return _view; }
+
+private:
+    NumericTable *_table;
+    PackedArrayNumericTableIface *_packedTable;
+    BlockDescriptor<algorithmFPType> _bd;
+    SymmetricMatrixView<algorithmFPType> _view;
+};
+
 /********************* tls_data_t class *******************************************************/
 template<typename algorithmFPType, CpuType cpu> struct tls_data_t
 {
@@ -335,6 +422,255 @@ void updateDenseCrossProductAndSums(bool            isNormalized,
     *nObservations += (algorithmFPType)nVectors;
 }
 
+/* Number of features in the square tiles of the cross-product */
+const size_t covarianceTileSize = 128;
+
+/*********************** getNumberOfLowerTiles ***************************************************/
+inline size_t getNumberOfLowerTiles(size_t nFeatures)
+{
+    const size_t nTileRows = nFeatures / covarianceTileSize + !!(nFeatures % covarianceTileSize);
+    return nTileRows * (nTileRows + 1) / 2;
+}
+
+/*********************** computeBlockSums ********************************************************/
+template<typename algorithmFPType, CpuType cpu>
+void computeBlockSums(size_t nFeatures, size_t nVectors, const algorithmFPType *dataBlock, algorithmFPType *blockSums)
+{
+    const size_t nColumnBlocks = nFeatures / covarianceTileSize + !!(nFeatures % covarianceTileSize);
+    daal::threader_for( nColumnBlocks, nColumnBlocks, [ = ](size_t iBlock)
+    {
+        const size_t startCol = iBlock * covarianceTileSize;
+        const size_t endCol = (startCol + covarianceTileSize < nFeatures ? startCol + covarianceTileSize : nFeatures);
+        for (size_t j = startCol; j < endCol; j++)
+        {
+            blockSums[j] = 0.0;
+        }
+        for (size_t i = 0; i < nVectors; i++)
+        {
+            const algorithmFPType *row = dataBlock + i * nFeatures;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = startCol; j < endCol; j++)
+            {
+                blockSums[j] += row[j];
+            }
+        }
+    } );
+}
+
+/*********************** updateDenseCrossProductByTiles ******************************************/
+/* Updates the lower triangle of the cross-product with the block of nVectors observations.
+   The lower triangle is split into square tiles. Each tile is computed by one thread with a single gemm call,
+   or syrk call for the tiles on the diagonal, over all observations of the block, so the threads write
+   disjoint parts of the cross-product and no thread local copies of the p x p matrix are needed.
+   If blockSums is NULL, the observations are not centered.
+   Otherwise, the cross-product of the block centered by its means replaces the cross-product if nObservations is zero,
+   or is merged with the cross-product of nObservations observations with the sums of features equal to sums */
+template<typename algorithmFPType, CpuType cpu>
+bool updateDenseCrossProductByTiles(size_t nFeatures,
+                                    size_t nVectors,
+                                    const algorithmFPType *dataBlock,
+                                    const algorithmFPType *blockSums,
+                                    const algorithmFPType *sums,
+                                    algorithmFPType nObservations,
+                                    const SymmetricMatrixView<algorithmFPType> &crossProduct)
+{
+    const bool isMerged = (blockSums && nObservations > 0);
+    const algorithmFPType invNVectors = 1.0 / (algorithmFPType)nVectors;
+
+    /* Differences of the means of the block and of the observations processed so far */
+    TArray<algorithmFPType, cpu> deltaArray(isMerged ? nFeatures : 0);
+    algorithmFPType *delta = deltaArray.get();
+    algorithmFPType mergeCoeff = 0.0;
+    if (isMerged)
+    {
+        if (!delta) { return false; }
+        const algorithmFPType invNObservations = 1.0 / nObservations;
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            delta[i] = blockSums[i] * invNVectors - sums[i] * invNObservations;
+        }
+        mergeCoeff = nObservations * (algorithmFPType)nVectors / (nObservations + (algorithmFPType)nVectors);
+    }
+
+    const size_t nTileRows = nFeatures / covarianceTileSize + !!(nFeatures % covarianceTileSize);
+    const size_t nTiles = nTileRows * (nTileRows + 1) / 2;
+
+    daal::tls<algorithmFPType *> tlsTile([ = ]()
+    {
+        return service_malloc<algorithmFPType, cpu>(covarianceTileSize * covarianceTileSize);
+    });
+
+    bool bMemoryAllocationFailed = false;
+    daal::threader_for( nTiles, nTiles, [ =, &tlsTile, &bMemoryAllocationFailed ](size_t iTile)
+    {
+        algorithmFPType *tile = tlsTile.local();
+        if (!tile)
+        {
+            bMemoryAllocationFailed = true;
+            return;
+        }
+
+        /* tile iTile is in the row of tiles iRowTile: iRowTile * (iRowTile + 1) / 2 <= iTile */
+        size_t iRowTile = (size_t)((Math<double, cpu>::sSqrt(8.0 * (double)iTile + 1.0) - 1.0) / 2.0);
+        while (iRowTile * (iRowTile + 1) / 2 > iTile) { iRowTile--; }
+        while ((iRowTile + 1) * (iRowTile + 2) / 2 <= iTile) { iRowTile++; }
+        const size_t iColTile = iTile - iRowTile * (iRowTile + 1) / 2;
+
+        const size_t startRow = iRowTile * covarianceTileSize;
+        const size_t startCol = iColTile * covarianceTileSize;
+        const size_t nRows = (startRow + covarianceTileSize < nFeatures ? covarianceTileSize : nFeatures - startRow);
+        const size_t nCols = (startCol + covarianceTileSize < nFeatures ? covarianceTileSize : nFeatures - startCol);
+
+        /* The data block is the column-major nFeatures x nVectors matrix, so tile[i * nCols + j] is
+           the sum over the observations of x(startRow + i) * x(startCol + j) */
+        algorithmFPType alpha = 1.0, beta = 0.0;
+        DAAL_INT nRowsLocal = nRows, nColsLocal = nCols, nVectorsLocal = nVectors, ld = nFeatures;
+        algorithmFPType *rowData = const_cast<algorithmFPType *>(dataBlock) + startRow;
+        algorithmFPType *colData = const_cast<algorithmFPType *>(dataBlock) + startCol;
+        if (iRowTile == iColTile)
+        {
+            char uplo = 'U', trans = 'N';
+            Blas<algorithmFPType, cpu>::xxsyrk(&uplo, &trans, &nRowsLocal, &nVectorsLocal, &alpha, rowData, &ld,
+                                               &beta, tile, &nRowsLocal);
+        }
+        else
+        {
+            char transa = 'N', transb = 'T';
+            Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &nColsLocal, &nRowsLocal, &nVectorsLocal, &alpha, colData, &ld,
+                                               rowData, &ld, &beta, tile, &nColsLocal);
+        }
+
+        for (size_t i = 0; i < nRows; i++)
+        {
+            const size_t iFeature = startRow + i;
+            const size_t nColsInRow = (iRowTile == iColTile ? i + 1 : nCols);
+            const algorithmFPType *tileRow = tile + i * nCols;
+            algorithmFPType *cpRow = crossProduct.row(iFeature) + startCol;
+
+            if (!blockSums)
+            {
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nColsInRow; j++)
+                {
+                    cpRow[j] = tileRow[j];
+                }
+            }
+            else if (!isMerged)
+            {
+                const algorithmFPType sumI = blockSums[iFeature] * invNVectors;
+                const algorithmFPType *sumsJ = blockSums + startCol;
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nColsInRow; j++)
+                {
+                    cpRow[j] = tileRow[j] - sumI * sumsJ[j];
+                }
+            }
+            else
+            {
+                const algorithmFPType sumI = blockSums[iFeature] * invNVectors;
+                const algorithmFPType *sumsJ = blockSums + startCol;
+                const algorithmFPType deltaI = delta[iFeature] * mergeCoeff;
+                const algorithmFPType *deltaJ = delta + startCol;
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nColsInRow; j++)
+                {
+                    cpRow[j] += tileRow[j] - sumI * sumsJ[j] + deltaI * deltaJ[j];
+                }
+            }
+        }
+    } );
+
+    tlsTile.reduce([ = ](algorithmFPType *tile) { service_free<algorithmFPType, cpu>(tile); });
+    return !bMemoryAllocationFailed;
+}
+
+/*********************** updateDensePartialResultsByTiles ****************************************/
+template<typename algorithmFPType, Method method, CpuType cpu>
+void updateDensePartialResultsByTiles( NumericTable *dataTable,
+                                       NumericTable *crossProductTable,
+                                       NumericTable *sumTable,
+                                       NumericTable *nObservationsTable,
+                                       bool         isOnline,
+                                       services::KernelErrorCollection *_errors)
+{
+    size_t nFeatures = dataTable->getNumberOfColumns();
+    size_t nVectors  = dataTable->getNumberOfRows();
+    bool isNormalized = dataTable->isNormalized(NumericTableIface::standardScoreNormalized);
+    ReadWriteMode rwMode = (isOnline ? readWrite : writeOnly);
+
+    NumericTable *userSumsTable = 0;
+    if (method == sumDense)
+    {
+        userSumsTable = dataTable->basicStatistics.get(NumericTable::sum).get();
+        if (!userSumsTable) { _errors->add(services::ErrorPrecomputedSumNotAvailable); return; }
+    }
+
+    SymmetricMatrixData<algorithmFPType, cpu> crossProduct(crossProductTable, rwMode);
+
+    BlockDescriptor<algorithmFPType> sumBD, nObservationsBD, userSumsBD, dataBD;
+    algorithmFPType *sums, *nObservations, *userSums = 0, *dataBlock;
+    getTableData<algorithmFPType, cpu>(rwMode, sumTable,           sumBD,           &sums);
+    getTableData<algorithmFPType, cpu>(rwMode, nObservationsTable, nObservationsBD, &nObservations);
+    if (userSumsTable)
+    {
+        getTableData<algorithmFPType, cpu>(readOnly, userSumsTable, userSumsBD, &userSums);
+    }
+
+    if (!isOnline)
+    {
+        *nObservations = 0.0;
+        daal::services::internal::service_memset<algorithmFPType, cpu>(sums, (algorithmFPType)0.0, nFeatures);
+    }
+
+    getTableData<algorithmFPType, cpu>(readOnly, dataTable, dataBD, &dataBlock);
+
+    /* The normalized data is not centered in the batch mode, the precomputed sums are used if available */
+    TArray<algorithmFPType, cpu> blockSumsArray((isOnline || !isNormalized) && !userSums ? nFeatures : 0);
+    const algorithmFPType *blockSums = 0;
+    if (isOnline || !isNormalized)
+    {
+        if (userSums)
+        {
+            blockSums = userSums;
+        }
+        else if (blockSumsArray.get())
+        {
+            computeBlockSums<algorithmFPType, cpu>(nFeatures, nVectors, dataBlock, blockSumsArray.get());
+            blockSums = blockSumsArray.get();
+        }
+    }
+
+    if (((isOnline || !isNormalized) && !blockSums) ||
+        !updateDenseCrossProductByTiles<algorithmFPType, cpu>(nFeatures, nVectors, dataBlock, blockSums,
+                                                              sums, *nObservations, crossProduct.view()))
+    {
+        _errors->add(services::ErrorMemoryAllocationFailed);
+    }
+    else
+    {
+        copyLowerToUpper<algorithmFPType, cpu>(crossProduct.view());
+
+        const algorithmFPType *addedSums = (userSums ? userSums : blockSums);
+        if (addedSums)
+        {
+            for (size_t i = 0; i < nFeatures; i++)
+            {
+                sums[i] += addedSums[i];
+            }
+        }
+        *nObservations += (algorithmFPType)nVectors;
+    }
+
+    dataTable->releaseBlockOfRows(dataBD);
+    if (userSumsTable) { userSumsTable->releaseBlockOfRows(userSumsBD); }
+    sumTable->releaseBlockOfRows(sumBD);
+    nObservationsTable->releaseBlockOfRows(nObservationsBD);
+}
+
 /****************************** updateDensePartialResults ****************************************/
 template<typename algorithmFPType, Method method, CpuType cpu>
 void updateDensePartialResults( NumericTable *dataTable,
@@ -348,6 +684,17 @@ void updateDensePartialResults( NumericTable *dataTable,
     size_t nVectors  = dataTable->getNumberOfRows();
     bool isNormalized = dataTable->isNormalized(NumericTableIface::standardScoreNormalized);
 
+    /* The cross-product in the packed layout is always updated by tiles. In the full layout the tiles are used
+       instead of the thread local cross-products if there are enough tiles to load all the threads */
+    bool isSyrkPath = (!isOnline) && (isNormalized || method == defaultDense);
+    if (isLowerPackedMatrix(crossProductTable) ||
+        (isSyrkPath && getNumberOfLowerTiles(nFeatures) >= 2 * threader_get_threads_number()))
+    {
+        updateDensePartialResultsByTiles<algorithmFPType, method, cpu>(dataTable, crossProductTable, sumTable,
+                                                                       nObservationsTable, isOnline, _errors);
+        return;
+    }
+
     BlockDescriptor<algorithmFPType> crossProductBD, sumBD, nObservationsBD;
     algorithmFPType *crossProduct, *sums, *nObservations;
     ReadWriteMode rwMode = (isOnline ? readWrite : writeOnly);
@@ -462,14 +809,14 @@ void updateCSRCrossProductAndSums( size_t           nFeatures,
 /*********************** mergeCrossProductAndSums ************************************************/
 template<typename algorithmFPType, CpuType cpu>
 void mergeCrossProductAndSums( size_t nFeatures,
-                               const algorithmFPType *partialCrossProduct,
+                               const SymmetricMatrixView<algorithmFPType> &partialCrossProduct,
                                const algorithmFPType *partialSums,
                                const algorithmFPType *partialNObservations,
-                               algorithmFPType *crossProduct,
+                               const SymmetricMatrixView<algorithmFPType> &crossProduct,
                                algorithmFPType *sums,
                                algorithmFPType *nObservations)
 {
-    /* Merge cross-products */
+    /* Merge lower triangles of cross-products */
     algorithmFPType partialNObsValue = partialNObservations[0];
 
     if (partialNObsValue != 0)
@@ -480,12 +827,13 @@ void mergeCrossProductAndSums( size_t nFeatures,
         {
             daal::threader_for( nFeatures, nFeatures, [ = ](size_t i)
             {
+                algorithmFPType *cpRow = crossProduct.row(i);
+                const algorithmFPType *partialCpRow = partialCrossProduct.row(i);
               PRAGMA_IVDEP
               PRAGMA_VECTOR_ALWAYS
                 for (size_t j = 0; j <= i; j++)
                 {
-                    crossProduct[i * nFeatures + j] += partialCrossProduct[i * nFeatures + j];
-                    crossProduct[j * nFeatures + i]  = crossProduct[i * nFeatures + j];
+                    cpRow[j] += partialCpRow[j];
                 }
             } );
         }
@@ -497,15 +845,16 @@ void mergeCrossProductAndSums( size_t nFeatures,
 
             daal::threader_for( nFeatures, nFeatures, [ = ](size_t i)
             {
+                algorithmFPType *cpRow = crossProduct.row(i);
+                const algorithmFPType *partialCpRow = partialCrossProduct.row(i);
               PRAGMA_IVDEP
               PRAGMA_VECTOR_ALWAYS
                 for (size_t j = 0; j <= i; j++)
                 {
-                    crossProduct[i * nFeatures + j] += partialCrossProduct[i * nFeatures + j];
-                    crossProduct[i * nFeatures + j] += partialSums[i] * partialSums[j] * invPartialNObs;
-                    crossProduct[i * nFeatures + j] += sums[i] * sums[j] * invNObs;
-                    crossProduct[i * nFeatures + j] -= (partialSums[i] + sums[i]) * (partialSums[j] + sums[j]) * invNewNObs;
-                    crossProduct[j * nFeatures + i]  = crossProduct[i * nFeatures + j];
+                    cpRow[j] += partialCpRow[j];
+                    cpRow[j] += partialSums[i] * partialSums[j] * invPartialNObs;
+                    cpRow[j] += sums[i] * sums[j] * invNObs;
+                    cpRow[j] -= (partialSums[i] + sums[i]) * (partialSums[j] + sums[j]) * invNewNObs;
                 }
             } );
         }
@@ -521,13 +870,31 @@ void mergeCrossProductAndSums( size_t nFeatures,
     }
 }
 
+/*********************** mergeCrossProductAndSums ************************************************/
+template<typename algorithmFPType, CpuType cpu>
+void mergeCrossProductAndSums( size_t nFeatures,
+                               const algorithmFPType *partialCrossProduct,
+                               const algorithmFPType *partialSums,
+                               const algorithmFPType *partialNObservations,
+                               algorithmFPType *crossProduct,
+                               algorithmFPType *sums,
+                               algorithmFPType *nObservations)
+{
+    SymmetricMatrixView<algorithmFPType> partialCrossProductView(const_cast<algorithmFPType *>(partialCrossProduct), nFeatures);
+    SymmetricMatrixView<algorithmFPType> crossProductView(crossProduct, nFeatures);
+
+    mergeCrossProductAndSums<algorithmFPType, cpu>(nFeatures, partialCrossProductView, partialSums, partialNObservations,
+                                                   crossProductView, sums, nObservations);
+    copyLowerToUpper<algorithmFPType, cpu>(crossProductView);
+}
+
 /*********************** finalizeCovariance ******************************************************/
 template<typename algorithmFPType, CpuType cpu>
 void finalizeCovariance( size_t          nFeatures,
                          algorithmFPType nObservations,
-                         algorithmFPType *crossProduct,
+                         const SymmetricMatrixView<algorithmFPType> &crossProduct,
                          algorithmFPType *sums,
-                         algorithmFPType *cov,
+                         const SymmetricMatrixView<algorithmFPType> &cov,
                          algorithmFPType *mean,
                          const Parameter *parameter,
                          services::KernelErrorCollection *_errors)
@@ -554,39 +921,53 @@ void finalizeCovariance( size_t          nFeatures,
 
         for (size_t i = 0; i < nFeatures; i++)
         {
-            diagInvSqrts[i] = 1.0 / daal::internal::Math<algorithmFPType,cpu>::sSqrt(crossProduct[i * nFeatures + i]);
+            diagInvSqrts[i] = 1.0 / daal::internal::Math<algorithmFPType,cpu>::sSqrt(crossProduct.row(i)[i]);
         }
 
-        for (size_t i = 0; i < nFeatures; i++)
+        daal::threader_for( nFeatures, nFeatures, [ = ](size_t i)
         {
+            const algorithmFPType *cpRow = crossProduct.row(i);
+            algorithmFPType *covRow = cov.row(i);
             for (size_t j = 0; j < i; j++)
             {
-                cov[i * nFeatures + j] = crossProduct[i * nFeatures + j] * diagInvSqrts[i] * diagInvSqrts[j];
+                covRow[j] = cpRow[j] * diagInvSqrts[i] * diagInvSqrts[j];
             }
-            cov[i * nFeatures + i] = 1.0; //diagonal element
-        }
+            covRow[i] = 1.0; //diagonal element
+        } );
 
         daal::services::daal_free(diagInvSqrts);
     }
     else
     {
         /* Calculate resulting covariance matrix */
-        for (size_t i = 0; i < nFeatures; i++)
+        daal::threader_for( nFeatures, nFeatures, [ = ](size_t i)
         {
+            const algorithmFPType *cpRow = crossProduct.row(i);
+            algorithmFPType *covRow = cov.row(i);
             for (size_t j = 0; j <= i; j++)
             {
-                cov[i * nFeatures + j] = crossProduct[i * nFeatures + j] * invNObservationsM1;
+                covRow[j] = cpRow[j] * invNObservationsM1;
             }
-        }
+        } );
     }
 
     /* Copy results into symmetric upper triangle */
+    copyLowerToUpper<algorithmFPType, cpu>(cov);
+}
+
+/*********************** setNObservationsPerFeature **********************************************/
+/* Without the missing values every feature is observed in all observations */
+template<typename algorithmFPType, CpuType cpu>
+void setNObservationsPerFeature(NumericTable *nObservationsPerFeatureTable, algorithmFPType nObservations)
+{
+    if (!nObservationsPerFeatureTable) { return; }
+
+    const size_t nFeatures = nObservationsPerFeatureTable->getNumberOfColumns();
+    WriteOnlyRows<algorithmFPType, cpu> nObsBlock(nObservationsPerFeatureTable, 0, 1);
+    algorithmFPType *nObservationsPerFeature = nObsBlock.get();
     for (size_t i = 0; i < nFeatures; i++)
     {
-        for (size_t j = 0; j < i; j++)
-        {
-            cov[j * nFeatures + i] = cov[i * nFeatures + j];
-        }
+        nObservationsPerFeature[i] = nObservations;
     }
 }
 
@@ -595,13 +976,14 @@ template<typename algorithmFPType, CpuType cpu>
 void finalizeCovariance( NumericTable *covTable,
                          NumericTable *meanTable,
                          NumericTable *nObservationsTable,
+                         NumericTable *nObservationsPerFeatureTable,
                          const Parameter         *parameter,
                          services::KernelErrorCollection *_errors)
 {
-    BlockDescriptor<algorithmFPType> covBD, meanBD, nObservationsBD;
-    algorithmFPType *cov, *mean, *nObservations;
+    BlockDescriptor<algorithmFPType> meanBD, nObservationsBD;
+    algorithmFPType *mean, *nObservations;
 
-    getTableData<algorithmFPType, cpu>(readWrite, covTable,           covBD,           &cov);
+    SymmetricMatrixData<algorithmFPType, cpu> cov(covTable, readWrite);
     getTableData<algorithmFPType, cpu>(readWrite, meanTable,          meanBD,          &mean);
     getTableData<algorithmFPType, cpu>(readOnly,  nObservationsTable, nObservationsBD, &nObservations);
 
@@ -609,14 +991,14 @@ void finalizeCovariance( NumericTable *covTable,
 
     finalizeCovariance<algorithmFPType, cpu>( nFeatures,
                                               *nObservations,
-                                              cov,
+                                              cov.view(),
                                               mean,
-                                              cov,
+                                              cov.view(),
                                               mean,
                                               parameter,
                                               _errors);
+    setNObservationsPerFeature<algorithmFPType, cpu>(nObservationsPerFeatureTable, *nObservations);
 
-    covTable->releaseBlockOfRows(covBD);
     meanTable->releaseBlockOfRows(meanBD);
     nObservationsTable->releaseBlockOfRows(nObservationsBD);
 }
@@ -628,47 +1010,36 @@ void finalizeCovariance( NumericTable *crossProductTable,
                          NumericTable *nObservationsTable,
                          NumericTable *covTable,
                          NumericTable *meanTable,
+                         NumericTable *nObservationsPerFeatureTable,
                          const Parameter         *parameter,
                          services::KernelErrorCollection *_errors)
 {
     size_t nFeatures = covTable->getNumberOfColumns();
 
-    BlockDescriptor<algorithmFPType> crossProductBD, sumBD, nObservationsBD;
-    algorithmFPType *crossProduct, *sums, *nObservations;
+    BlockDescriptor<algorithmFPType> sumBD, nObservationsBD;
+    algorithmFPType *sums, *nObservations;
+
+    SymmetricMatrixData<algorithmFPType, cpu> crossProduct(crossProductTable, readOnly);
+    getTableData<algorithmFPType, cpu>(readOnly, sumTable,           sumBD,           &sums);
+    getTableData<algorithmFPType, cpu>(readOnly, nObservationsTable, nObservationsBD, &nObservations);
 
-    getDenseCrossProductAndSums<algorithmFPType, cpu>( readOnly,
-                                                       crossProductTable,
-                                                       crossProductBD,
-                                                       &crossProduct,
-                                                       sumTable,
-                                                       sumBD,
-                                                       &sums,
-                                                       nObservationsTable,
-                                                       nObservationsBD,
-                                                       &nObservations);
-
-    BlockDescriptor<algorithmFPType> covBD, meanBD;
-    algorithmFPType *cov, *mean;
-    getTableData<algorithmFPType, cpu>(writeOnly, covTable,  covBD,  &cov);
+    BlockDescriptor<algorithmFPType> meanBD;
+    algorithmFPType *mean;
+    SymmetricMatrixData<algorithmFPType, cpu> cov(covTable, writeOnly);
     getTableData<algorithmFPType, cpu>(writeOnly, meanTable, meanBD, &mean);
 
     finalizeCovariance<algorithmFPType, cpu>( nFeatures,
                                               *nObservations,
-                                              crossProduct,
+                                              crossProduct.view(),
                                               sums,
-                                              cov,
+                                              cov.view(),
                                               mean,
                                               parameter,
                                               _errors);
+    setNObservationsPerFeature<algorithmFPType, cpu>(nObservationsPerFeatureTable, *nObservations);
 
-    releaseDenseCrossProductAndSums<algorithmFPType, cpu>( crossProductTable,
-                                                           crossProductBD,
-                                                           sumTable,
-                                                           sumBD,
-                                                           nObservationsTable,
-                                                           nObservationsBD);
-
-    covTable->releaseBlockOfRows(covBD);
+    sumTable->releaseBlockOfRows(sumBD);
+    nObservationsTable->releaseBlockOfRows(nObservationsBD);
     meanTable->releaseBlockOfRows(meanBD);
 }
 
@@ -35,7 +35,7 @@ namespace covariance
 namespace interface1
 {
 
-Input::Input() : InputIface(1)
+Input::Input() : InputIface(2)
     {}
 
 /**
@@ -99,6 +99,12 @@ void Input::check(const daal::algorithms::Parameter *parameter, int method) cons
         if (!checkNumericTable(get(data)->basicStatistics.get(NumericTableIface::sum).get(),
             this->_errors.get(), sumStr(), 0, 0, nFeatures, 1)) { return; }
     }
+
+    NumericTablePtr weightsTable = get(weights);
+    if (weightsTable)
+    {
+        if (!checkNumericTable(weightsTable.get(), this->_errors.get(), weightsStr(), 0, 0, 1, get(data)->getNumberOfRows())) { return; }
+    }
 }
 
 }//namespace interface1
@@ -45,42 +45,46 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 class CovarianceDenseBatchKernel : public daal::algorithms::Kernel
 {
 public:
-    void compute(NumericTable *dataTable, NumericTable *covTable,
-            NumericTable *meanTable, const Parameter *parameter);
+    void compute(NumericTable *dataTable, NumericTable *weightsTable, NumericTable *covTable,
+            NumericTable *meanTable, NumericTable *nObsPerFeatureTable, const Parameter *parameter);
 };
 
 template<typename algorithmFPType, Method method, CpuType cpu>
 class CovarianceCSRBatchKernel : public daal::algorithms::Kernel
 {
 public:
-    void compute(NumericTable *dataTable, NumericTable *covTable,
-            NumericTable *meanTable, const Parameter *parameter);
+    void compute(NumericTable *dataTable, NumericTable *weightsTable, NumericTable *covTable,
+            NumericTable *meanTable, NumericTable *nObsPerFeatureTable, const Parameter *parameter);
 };
 
 template<typename algorithmFPType, Method method, CpuType cpu>
 class CovarianceDenseOnlineKernel : public daal::algorithms::Kernel
 {
 public:
-    void compute(NumericTable *dataTable, NumericTable *nObsTable,
+    void compute(NumericTable *dataTable, NumericTable *weightsTable, NumericTable *nObsTable,
             NumericTable *crossProductTable, NumericTable *sumTable,
+            NumericTable *pairwiseNObsTable, NumericTable *pairwiseSumTable, NumericTable *pairwiseSumSqCenTable,
             const Parameter *parameter);
 
     void finalizeCompute(NumericTable *nObsTable, NumericTable *crossProductTable,
-            NumericTable *sumTable, NumericTable *covTable,
-            NumericTable *meanTable, const Parameter *parameter);
+            NumericTable *sumTable, NumericTable *pairwiseNObsTable, NumericTable *pairwiseSumTable,
+            NumericTable *pairwiseSumSqCenTable, NumericTable *covTable,
+            NumericTable *meanTable, NumericTable *nObsPerFeatureTable, const Parameter *parameter);
 };
 
 template<typename algorithmFPType, Method method, CpuType cpu>
 class CovarianceCSROnlineKernel : public daal::algorithms::Kernel
 {
 public:
-    void compute(NumericTable *dataTable, NumericTable *nObsTable,
+    void compute(NumericTable *dataTable, NumericTable *weightsTable, NumericTable *nObsTable,
             NumericTable *crossProductTable, NumericTable *sumTable,
+            NumericTable *pairwiseNObsTable, NumericTable *pairwiseSumTable, NumericTable *pairwiseSumSqCenTable,
             const Parameter *parameter);
 
     void finalizeCompute(NumericTable *nObsTable, NumericTable *crossProductTable,
-            NumericTable *sumTable, NumericTable *covTable,
-            NumericTable *meanTable, const Parameter *parameter);
+            NumericTable *sumTable, NumericTable *pairwiseNObsTable, NumericTable *pairwiseSumTable,
+            NumericTable *pairwiseSumSqCenTable, NumericTable *covTable,
+            NumericTable *meanTable, NumericTable *nObsPerFeatureTable, const Parameter *parameter);
 };
 
 template<typename algorithmFPType, Method method, CpuType cpu>
@@ -89,11 +93,13 @@ class CovarianceDistributedKernel : public daal::algorithms::Kernel
 public:
     void compute(DataCollection *partialResultsCollection,
             NumericTable *nObsTable, NumericTable *crossProductTable,
-            NumericTable *sumTable, const Parameter *parameter);
+            NumericTable *sumTable, NumericTable *pairwiseNObsTable, NumericTable *pairwiseSumTable,
+            NumericTable *pairwiseSumSqCenTable, const Parameter *parameter);
 
     void finalizeCompute(NumericTable *nObsTable, NumericTable *crossProductTable,
-            NumericTable *sumTable, NumericTable *covTable,
-            NumericTable *meanTable, const Parameter *parameter);
+            NumericTable *sumTable, NumericTable *pairwiseNObsTable, NumericTable *pairwiseSumTable,
+            NumericTable *pairwiseSumSqCenTable, NumericTable *covTable,
+            NumericTable *meanTable, NumericTable *nObsPerFeatureTable, const Parameter *parameter);
 };
 
 } // namespace internal
@@ -0,0 +1,507 @@
+/* file: covariance_pairwise_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the correlation or variance-covariance matrix with the weights of observations and missing values.
+//  The element (j, k) of the matrix is computed over the observations with non-missing values of the features j and k
+//  (pairwise deletion). Every block of rows is processed with two matrix products
+//  of the masks, the weighted masks and the shifted values of the features, the pairwise statistics of the blocks
+//  are merged with the pairwise update of the centered sums.
+//--
+*/
+
+#ifndef __COVARIANCE_PAIRWISE_IMPL_I__
+#define __COVARIANCE_PAIRWISE_IMPL_I__
+
+#include "covariance_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace covariance
+{
+namespace internal
+{
+
+/*********************** PairwiseMoments *********************************************************/
+/* Pairwise statistics of the part of the data set stored in the full p x p matrices:
+   nObservations(j, k) - sum of the weights of the observations with non-missing values of the features j and k,
+   sums(j, k)          - sum of the feature j over these observations,
+   sumSqCen(j, k)      - sum of squared differences of the feature j from its mean over these observations,
+   crossProduct(j, k)  - cross-product of the features j and k centered on their means over these observations */
+template<typename algorithmFPType, CpuType cpu>
+struct PairwiseMoments
+{
+    PairwiseMoments(size_t nFeatures) : nFeatures(nFeatures), nRows(0)
+    {
+        const size_t size = nFeatures * nFeatures;
+        nObservations = service_scalable_calloc<algorithmFPType, cpu>(4 * size);
+        sums          = nObservations + size;
+        sumSqCen      = sums + size;
+        crossProduct  = sumSqCen + size;
+        isValid = (nObservations != 0);
+    }
+
+    ~PairwiseMoments()
+    {
+        if (nObservations) { service_scalable_free<algorithmFPType, cpu>(nObservations); }
+    }
+
+    void reset()
+    {
+        service_memset<algorithmFPType, cpu>(nObservations, (algorithmFPType)0.0, 4 * nFeatures * nFeatures);
+        nRows = 0;
+    }
+
+    /* Merges the pairwise statistics of another part of the data set into these statistics */
+    void merge(size_t nRowsB, const algorithmFPType *nObservationsB, const algorithmFPType *sumsB,
+               const algorithmFPType *sumSqCenB, const algorithmFPType *crossProductB)
+    {
+        const algorithmFPType zero(0.0);
+        const size_t p = nFeatures;
+        for (size_t j = 0; j < p; j++)
+        {
+            for (size_t k = 0; k <= j; k++)
+            {
+                const size_t jk = j * p + k, kj = k * p + j;
+                const algorithmFPType nB = nObservationsB[jk];
+                if (!(nB > zero)) { continue; }
+
+                const algorithmFPType nA = nObservations[jk];
+                if (nA > zero)
+                {
+                    const algorithmFPType coeff  = nA * nB / (nA + nB);
+                    const algorithmFPType deltaJ = sumsB[jk] / nB - sums[jk] / nA;
+                    const algorithmFPType deltaK = sumsB[kj] / nB - sums[kj] / nA;
+                    crossProduct[jk] += crossProductB[jk] + coeff * deltaJ * deltaK;
+                    sumSqCen[jk]     += sumSqCenB[jk]     + coeff * deltaJ * deltaJ;
+                    if (j != k)
+                    {
+                        crossProduct[kj] = crossProduct[jk];
+                        sumSqCen[kj]    += sumSqCenB[kj] + coeff * deltaK * deltaK;
+                    }
+                }
+                else
+                {
+                    crossProduct[jk] = crossProductB[jk];
+                    sumSqCen[jk]     = sumSqCenB[jk];
+                    crossProduct[kj] = crossProductB[kj];
+                    sumSqCen[kj]     = sumSqCenB[kj];
+                }
+                sums[jk] += sumsB[jk];
+                nObservations[jk] = nA + nB;
+                if (j != k)
+                {
+                    sums[kj] += sumsB[kj];
+                    nObservations[kj] = nA + nB;
+                }
+            }
+        }
+        nRows += nRowsB;
+    }
+
+    void merge(const PairwiseMoments &other)
+    {
+        merge(other.nRows, other.nObservations, other.sums, other.sumSqCen, other.crossProduct);
+    }
+
+    size_t nFeatures;
+    size_t nRows;                       /* Number of rows including the ones with missing values */
+    algorithmFPType *nObservations;
+    algorithmFPType *sums;
+    algorithmFPType *sumSqCen;
+    algorithmFPType *crossProduct;
+    bool isValid;
+};
+
+/*********************** PairwiseBlockTask *******************************************************/
+/* Computes the pairwise statistics of the block of rows. Per thread data:
+   the statistics accumulated by the thread, the statistics of the current block and the work arrays */
+template<typename algorithmFPType, CpuType cpu>
+struct PairwiseBlockTask
+{
+    PairwiseBlockTask(size_t nFeatures, size_t blockSize) : accumulated(nFeatures), block(nFeatures), nFeatures(nFeatures)
+    {
+        const size_t p = nFeatures;
+        shift       = service_scalable_calloc<algorithmFPType, cpu>(2 * p + 5 * blockSize * p + 4 * p * p);
+        shiftWeight = shift + p;
+        weightedMask = shiftWeight + p;
+        weightedData = weightedMask + blockSize * p;
+        maskedData   = weightedData + blockSize * p;
+        products     = maskedData + 3 * blockSize * p;
+        rawProducts  = products + 3 * p * p;
+        isValid = (shift != 0 && accumulated.isValid && block.isValid);
+        if (isValid) { accumulated.reset(); }
+    }
+
+    ~PairwiseBlockTask()
+    {
+        if (shift) { service_scalable_free<algorithmFPType, cpu>(shift); }
+    }
+
+    /* Computes the pairwise statistics of the block and merges them into the accumulated statistics */
+    void update(const algorithmFPType *data, const algorithmFPType *weights, size_t nRows, bool skipMissingValues)
+    {
+        const algorithmFPType zero(0.0);
+        const algorithmFPType one(1.0);
+        const size_t p = nFeatures;
+
+        /* The values are shifted by the weighted means of the features in the block */
+        for (size_t j = 0; j < p; j++) { shift[j] = zero; shiftWeight[j] = zero; }
+        for (size_t i = 0; i < nRows; i++)
+        {
+            const algorithmFPType w = (weights ? weights[i] : one);
+            if (!(w > zero)) { continue; }
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                const algorithmFPType x = data[i * p + j];
+                const bool isObserved = (!skipMissingValues || x == x);
+                shift[j]       += (isObserved ? w * x : zero);
+                shiftWeight[j] += (isObserved ? w : zero);
+            }
+        }
+        for (size_t j = 0; j < p; j++)
+        {
+            shift[j] = (shiftWeight[j] > zero ? shift[j] / shiftWeight[j] : zero);
+        }
+
+        /* maskedData row is (xs, xs^2, m): shifted values and their squares, zero if missing, and the mask */
+        for (size_t i = 0; i < nRows; i++)
+        {
+            algorithmFPType w = (weights ? weights[i] : one);
+            w = (w > zero ? w : zero);
+            const algorithmFPType *row = data + i * p;
+            algorithmFPType *wm = weightedMask + i * p;
+            algorithmFPType *wx = weightedData + i * p;
+            algorithmFPType *xs = maskedData + i * 3 * p;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                const algorithmFPType x = row[j];
+                const bool isObserved = (w > zero) && (!skipMissingValues || x == x);
+                const algorithmFPType shifted = (isObserved ? x - shift[j] : zero);
+                xs[j]         = shifted;
+                xs[p + j]     = shifted * shifted;
+                xs[2 * p + j] = (isObserved ? one : zero);
+                wm[j] = (isObserved ? w : zero);
+                wx[j] = w * shifted;
+            }
+        }
+
+        /* products is the row-major 3p x p matrix (S, Q, W): S(j, k) and Q(j, k) are the sums of the shifted feature j
+           and of its squares over the rows with non-missing features j and k, W(j, k) is the sum of the weights of these rows */
+        char transa = 'N', transb = 'T';
+        algorithmFPType alpha = 1.0, beta = 0.0;
+        DAAL_INT pLocal = p, p3Local = 3 * p, nRowsLocal = nRows;
+        Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &pLocal, &p3Local, &nRowsLocal, &alpha, weightedMask, &pLocal,
+                                           maskedData, &p3Local, &beta, products, &pLocal);
+
+        /* rawProducts(j, k) is the weighted sum of the products of the shifted features j and k */
+        Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &pLocal, &pLocal, &nRowsLocal, &alpha, weightedData, &pLocal,
+                                           maskedData, &p3Local, &beta, rawProducts, &pLocal);
+
+        const algorithmFPType *s = products;
+        const algorithmFPType *q = products + p * p;
+        const algorithmFPType *n = products + 2 * p * p;
+        for (size_t j = 0; j < p; j++)
+        {
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t k = 0; k < p; k++)
+            {
+                const size_t jk = j * p + k, kj = k * p + j;
+                const algorithmFPType nObs = n[jk];
+                const algorithmFPType invNObs = (nObs > zero ? one / nObs : zero);
+                block.nObservations[jk] = nObs;
+                block.sums[jk]          = s[jk] + shift[j] * nObs;
+                block.sumSqCen[jk]      = q[jk] - s[jk] * s[jk] * invNObs;
+                block.crossProduct[jk]  = rawProducts[jk] - s[jk] * s[kj] * invNObs;
+            }
+        }
+        block.nRows = nRows;
+
+        accumulated.merge(block);
+    }
+
+    PairwiseMoments<algorithmFPType, cpu> accumulated;
+    PairwiseMoments<algorithmFPType, cpu> block;
+    bool isValid;
+
+private:
+    size_t nFeatures;
+    algorithmFPType *shift;
+    algorithmFPType *shiftWeight;
+    algorithmFPType *weightedMask;
+    algorithmFPType *weightedData;
+    algorithmFPType *maskedData;
+    algorithmFPType *products;
+    algorithmFPType *rawProducts;
+};
+
+/*********************** updatePairwiseMoments ***************************************************/
+/* Merges the pairwise statistics of all rows of the dense or CSR table into moments.
+   The rows of CSR tables are read as dense blocks, the values that are not stored are zeros */
+template<typename algorithmFPType, CpuType cpu>
+void updatePairwiseMoments(NumericTable *dataTable, NumericTable *weightsTable, bool skipMissingValues,
+                           PairwiseMoments<algorithmFPType, cpu> &moments, services::KernelErrorCollection *_errors)
+{
+    const size_t blockSize = 256;
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t nVectors  = dataTable->getNumberOfRows();
+
+    size_t nBlocks = nVectors / blockSize;
+    if (nBlocks * blockSize < nVectors) { nBlocks++; }
+
+    typedef PairwiseBlockTask<algorithmFPType, cpu> TlsTask;
+    daal::tls<TlsTask *> tlsTask([ = ]()
+    {
+        return new TlsTask(nFeatures, blockSize);
+    } );
+
+    daal::threader_for( nBlocks, nBlocks, [ & ](int iBlock)
+    {
+        TlsTask *task = tlsTask.local();
+        if (!task->isValid) { return; }
+
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows = (startRow + blockSize < nVectors ? blockSize : nVectors - startRow);
+
+        ReadRows<algorithmFPType, cpu> dataRows(dataTable, startRow, nRows);
+        ReadRows<algorithmFPType, cpu> weightsRows(weightsTable, startRow, nRows);
+        task->update(dataRows.get(), weightsRows.get(), nRows, skipMissingValues);
+    } );
+
+    bool isValid = true;
+    tlsTask.reduce( [ & ](TlsTask *task)
+    {
+        isValid = isValid && task->isValid;
+        if (task->isValid) { moments.merge(task->accumulated); }
+        delete task;
+    } );
+    if (!isValid) { _errors->add(services::ErrorMemoryAllocationFailed); }
+}
+
+/*********************** readPairwisePartialResults **********************************************/
+template<typename algorithmFPType, CpuType cpu>
+void readPairwisePartialResults(NumericTable *nObservationsTable, NumericTable *crossProductTable,
+                                NumericTable *pairwiseNObservationsTable, NumericTable *pairwiseSumTable,
+                                NumericTable *pairwiseSumSqCenTable, PairwiseMoments<algorithmFPType, cpu> &moments)
+{
+    const size_t nFeatures = moments.nFeatures;
+    const size_t size = nFeatures * nFeatures * sizeof(algorithmFPType);
+
+    ReadRows<algorithmFPType, cpu> nRowsBlock   (nObservationsTable,         0, 1);
+    ReadRows<algorithmFPType, cpu> nObsBlock    (pairwiseNObservationsTable, 0, nFeatures);
+    ReadRows<algorithmFPType, cpu> sumBlock     (pairwiseSumTable,           0, nFeatures);
+    ReadRows<algorithmFPType, cpu> sumSqCenBlock(pairwiseSumSqCenTable,      0, nFeatures);
+    SymmetricMatrixData<algorithmFPType, cpu> crossProduct(crossProductTable, readOnly);
+    const SymmetricMatrixView<algorithmFPType> &crossProductView = crossProduct.view();
+
+    moments.nRows = (size_t)(nRowsBlock.get()[0]);
+    daal_memcpy_s(moments.nObservations, size, nObsBlock.get(),     size);
+    daal_memcpy_s(moments.sums,          size, sumBlock.get(),      size);
+    daal_memcpy_s(moments.sumSqCen,      size, sumSqCenBlock.get(), size);
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        const algorithmFPType *cpRow = crossProductView.row(j);
+        for (size_t k = 0; k <= j; k++)
+        {
+            moments.crossProduct[j * nFeatures + k] = cpRow[k];
+            moments.crossProduct[k * nFeatures + j] = cpRow[k];
+        }
+    }
+}
+
+/*********************** writePairwisePartialResults *********************************************/
+/* Stores the pairwise statistics in the partial results. The cross-product is the centered cross-product
+   over the pairs of non-missing values, the sums are the sums of the non-missing values of the features */
+template<typename algorithmFPType, CpuType cpu>
+void writePairwisePartialResults(const PairwiseMoments<algorithmFPType, cpu> &moments,
+                                 NumericTable *nObservationsTable, NumericTable *crossProductTable, NumericTable *sumTable,
+                                 NumericTable *pairwiseNObservationsTable, NumericTable *pairwiseSumTable,
+                                 NumericTable *pairwiseSumSqCenTable)
+{
+    const size_t nFeatures = moments.nFeatures;
+    const size_t size = nFeatures * nFeatures * sizeof(algorithmFPType);
+
+    WriteOnlyRows<algorithmFPType, cpu> nRowsBlock   (nObservationsTable,         0, 1);
+    WriteOnlyRows<algorithmFPType, cpu> sumBlock     (sumTable,                   0, 1);
+    WriteOnlyRows<algorithmFPType, cpu> nObsBlock    (pairwiseNObservationsTable, 0, nFeatures);
+    WriteOnlyRows<algorithmFPType, cpu> pairSumBlock (pairwiseSumTable,           0, nFeatures);
+    WriteOnlyRows<algorithmFPType, cpu> sumSqCenBlock(pairwiseSumSqCenTable,      0, nFeatures);
+    SymmetricMatrixData<algorithmFPType, cpu> crossProduct(crossProductTable, writeOnly);
+    const SymmetricMatrixView<algorithmFPType> &crossProductView = crossProduct.view();
+
+    nRowsBlock.get()[0] = (algorithmFPType)moments.nRows;
+    daal_memcpy_s(nObsBlock.get(),     size, moments.nObservations, size);
+    daal_memcpy_s(pairSumBlock.get(),  size, moments.sums,          size);
+    daal_memcpy_s(sumSqCenBlock.get(), size, moments.sumSqCen,      size);
+
+    algorithmFPType *sums = sumBlock.get();
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        sums[j] = moments.sums[j * nFeatures + j];
+        algorithmFPType *cpRow = crossProductView.row(j);
+        for (size_t k = 0; k <= j; k++)
+        {
+            cpRow[k] = moments.crossProduct[j * nFeatures + k];
+        }
+    }
+    copyLowerToUpper<algorithmFPType, cpu>(crossProductView);
+}
+
+/*********************** finalizePairwiseCovariance **********************************************/
+template<typename algorithmFPType, CpuType cpu>
+void finalizePairwiseCovariance(const PairwiseMoments<algorithmFPType, cpu> &moments,
+                                NumericTable *covTable, NumericTable *meanTable, NumericTable *nObservationsPerFeatureTable,
+                                const Parameter *parameter)
+{
+    const size_t p = moments.nFeatures;
+    const algorithmFPType one(1.0);
+
+    WriteOnlyRows<algorithmFPType, cpu> meanBlock(meanTable, 0, 1);
+    WriteOnlyRows<algorithmFPType, cpu> nObsBlock(nObservationsPerFeatureTable, 0, 1);
+    SymmetricMatrixData<algorithmFPType, cpu> cov(covTable, writeOnly);
+    const SymmetricMatrixView<algorithmFPType> &covView = cov.view();
+
+    algorithmFPType *mean = meanBlock.get();
+    algorithmFPType *nObservationsPerFeature = nObsBlock.get();
+    for (size_t j = 0; j < p; j++)
+    {
+        const algorithmFPType nObs = moments.nObservations[j * p + j];
+        mean[j] = moments.sums[j * p + j] / nObs;
+        if (nObservationsPerFeature) { nObservationsPerFeature[j] = nObs; }
+    }
+
+    const bool isCorrelation = (parameter->outputMatrixType == correlationMatrix);
+    daal::threader_for( p, p, [ & ](size_t j)
+    {
+        algorithmFPType *covRow = covView.row(j);
+        for (size_t k = 0; k < j; k++)
+        {
+            const size_t jk = j * p + k, kj = k * p + j;
+            if (isCorrelation)
+            {
+                covRow[k] = moments.crossProduct[jk] /
+                            daal::internal::Math<algorithmFPType, cpu>::sSqrt(moments.sumSqCen[jk] * moments.sumSqCen[kj]);
+            }
+            else
+            {
+                const algorithmFPType nObs = moments.nObservations[jk];
+                covRow[k] = moments.crossProduct[jk] * (nObs > one ? one / (nObs - one) : one);
+            }
+        }
+        const algorithmFPType nObs = moments.nObservations[j * p + j];
+        covRow[j] = (isCorrelation ? one : moments.crossProduct[j * p + j] * (nObs > one ? one / (nObs - one) : one));
+    } );
+    copyLowerToUpper<algorithmFPType, cpu>(covView);
+}
+
+/*********************** computePairwiseCovariance ***********************************************/
+/* Computes the correlation or variance-covariance matrix in the batch processing mode */
+template<typename algorithmFPType, CpuType cpu>
+void computePairwiseCovariance(NumericTable *dataTable, NumericTable *weightsTable,
+                               NumericTable *covTable, NumericTable *meanTable, NumericTable *nObservationsPerFeatureTable,
+                               const Parameter *parameter, services::KernelErrorCollection *_errors)
+{
+    PairwiseMoments<algorithmFPType, cpu> moments(dataTable->getNumberOfColumns());
+    if (!moments.isValid) { _errors->add(services::ErrorMemoryAllocationFailed); return; }
+    moments.reset();
+
+    updatePairwiseMoments<algorithmFPType, cpu>(dataTable, weightsTable, parameter->skipMissingValues, moments, _errors);
+    if (_errors->size() != 0) { return; }
+
+    finalizePairwiseCovariance<algorithmFPType, cpu>(moments, covTable, meanTable, nObservationsPerFeatureTable, parameter);
+}
+
+/*********************** updatePairwisePartialResults ********************************************/
+/* Updates the partial results with the block of the data set in the online processing mode */
+template<typename algorithmFPType, CpuType cpu>
+void updatePairwisePartialResults(NumericTable *dataTable, NumericTable *weightsTable,
+                                  NumericTable *nObservationsTable, NumericTable *crossProductTable, NumericTable *sumTable,
+                                  NumericTable *pairwiseNObservationsTable, NumericTable *pairwiseSumTable,
+                                  NumericTable *pairwiseSumSqCenTable, const Parameter *parameter,
+                                  services::KernelErrorCollection *_errors)
+{
+    PairwiseMoments<algorithmFPType, cpu> moments(dataTable->getNumberOfColumns());
+    if (!moments.isValid) { _errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+    readPairwisePartialResults<algorithmFPType, cpu>(nObservationsTable, crossProductTable,
+        pairwiseNObservationsTable, pairwiseSumTable, pairwiseSumSqCenTable, moments);
+
+    updatePairwiseMoments<algorithmFPType, cpu>(dataTable, weightsTable, parameter->skipMissingValues, moments, _errors);
+    if (_errors->size() != 0) { return; }
+
+    writePairwisePartialResults<algorithmFPType, cpu>(moments, nObservationsTable, crossProductTable, sumTable,
+        pairwiseNObservationsTable, pairwiseSumTable, pairwiseSumSqCenTable);
+}
+
+/*********************** mergePairwisePartialResults *********************************************/
+/* Merges the partial results computed on local nodes */
+template<typename algorithmFPType, CpuType cpu>
+void mergePairwisePartialResults(DataCollection *partialResultsCollection,
+                                 NumericTable *nObservationsTable, NumericTable *crossProductTable, NumericTable *sumTable,
+                                 NumericTable *pairwiseNObservationsTable, NumericTable *pairwiseSumTable,
+                                 NumericTable *pairwiseSumSqCenTable, services::KernelErrorCollection *_errors)
+{
+    const size_t nFeatures = crossProductTable->getNumberOfColumns();
+    PairwiseMoments<algorithmFPType, cpu> moments(nFeatures), localMoments(nFeatures);
+    if (!moments.isValid || !localMoments.isValid) { _errors->add(services::ErrorMemoryAllocationFailed); return; }
+    moments.reset();
+
+    for (size_t i = 0; i < partialResultsCollection->size(); i++)
+    {
+        PartialResult *partialResult = static_cast<PartialResult *>((*partialResultsCollection)[i].get());
+        readPairwisePartialResults<algorithmFPType, cpu>(partialResult->get(covariance::nObservations).get(),
+            partialResult->get(covariance::crossProduct).get(), partialResult->get(covariance::pairwiseNObservations).get(),
+            partialResult->get(covariance::pairwiseSum).get(), partialResult->get(covariance::pairwiseSumSquaresCentered).get(),
+            localMoments);
+        moments.merge(localMoments);
+    }
+
+    writePairwisePartialResults<algorithmFPType, cpu>(moments, nObservationsTable, crossProductTable, sumTable,
+        pairwiseNObservationsTable, pairwiseSumTable, pairwiseSumSqCenTable);
+}
+
+/*********************** finalizePairwiseCovariance **********************************************/
+template<typename algorithmFPType, CpuType cpu>
+void finalizePairwiseCovariance(NumericTable *nObservationsTable, NumericTable *crossProductTable,
+                                NumericTable *pairwiseNObservationsTable, NumericTable *pairwiseSumTable,
+                                NumericTable *pairwiseSumSqCenTable, NumericTable *covTable, NumericTable *meanTable,
+                                NumericTable *nObservationsPerFeatureTable, const Parameter *parameter,
+                                services::KernelErrorCollection *_errors)
+{
+    PairwiseMoments<algorithmFPType, cpu> moments(crossProductTable->getNumberOfColumns());
+    if (!moments.isValid) { _errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+    readPairwisePartialResults<algorithmFPType, cpu>(nObservationsTable, crossProductTable,
+        pairwiseNObservationsTable, pairwiseSumTable, pairwiseSumSqCenTable, moments);
+
+    finalizePairwiseCovariance<algorithmFPType, cpu>(moments, covTable, meanTable, nObservationsPerFeatureTable, parameter);
+}
+
+} // namespace internal
+} // namespace covariance
+} // namespace algorithms
+} // namespace daal
+
+#endif
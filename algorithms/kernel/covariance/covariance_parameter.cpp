@@ -36,7 +36,8 @@ namespace interface1
 {
 
 /** Default constructor */
-Parameter::Parameter() : daal::algorithms::Parameter(), outputMatrixType(covarianceMatrix) {}
+Parameter::Parameter() : daal::algorithms::Parameter(), outputMatrixType(covarianceMatrix), outputMatrixLayout(fullMatrix),
+    skipMissingValues(false) {}
 
 }//namespace interface1
 }//namespace covariance
@@ -22,6 +22,8 @@
 */
 
 #include "covariance_types.h"
+#include "covariance_partialresult.h"
+#include "symmetric_matrix.h"
 #include "serialization_utils.h"
 
 using namespace daal::data_management;
@@ -33,11 +35,34 @@ namespace algorithms
 {
 namespace covariance
 {
+
+bool hasPairwisePartialResults(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter)
+{
+    const Input *algInput = dynamic_cast<const Input *>(input);
+    if (algInput)
+    {
+        const Parameter *algParameter = static_cast<const Parameter *>(parameter);
+        return (algInput->get(weights) || algParameter->skipMissingValues);
+    }
+
+    const DistributedInput<step2Master> *masterInput = dynamic_cast<const DistributedInput<step2Master> *>(input);
+    if (masterInput)
+    {
+        DataCollectionPtr collection = masterInput->get(partialResults);
+        if (collection && collection->size() > 0)
+        {
+            PartialResult *partialResult = dynamic_cast<PartialResult *>((*collection)[0].get());
+            return (partialResult && partialResult->get(pairwiseNObservations));
+        }
+    }
+    return false;
+}
+
 namespace interface1
 {
 
 __DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_COVARIANCE_PARTIAL_RESULT_ID);
-PartialResult::PartialResult() : daal::algorithms::PartialResult(3)
+PartialResult::PartialResult() : daal::algorithms::PartialResult(6)
     {}
 
 /**
@@ -88,7 +113,7 @@ void PartialResult::check(const daal::algorithms::Input *input, const daal::algo
 {
     const InputIface *algInput = static_cast<const InputIface *>(input);
     size_t nFeatures = algInput->getNumberOfFeatures();
-    checkImpl(nFeatures);
+    checkImpl(nFeatures, hasPairwisePartialResults(input, parameter));
 }
 
 /**
@@ -99,10 +124,10 @@ void PartialResult::check(const daal::algorithms::Input *input, const daal::algo
 void PartialResult::check(const daal::algorithms::Parameter *parameter, int method) const
 {
     size_t nFeatures = getNumberOfFeatures();
-    checkImpl(nFeatures);
+    checkImpl(nFeatures, false);
 }
 
-void PartialResult::checkImpl(size_t nFeatures) const
+void PartialResult::checkImpl(size_t nFeatures, bool isPairwiseRequired) const
 {
     int unexpectedLayouts;
 
@@ -119,6 +144,16 @@ void PartialResult::checkImpl(size_t nFeatures) const
                          (int)NumericTableIface::lowerPackedSymmetricMatrix;
     if (!checkNumericTable(get(sum).get(), this->_errors.get(),
                                             sumStr(), unexpectedLayouts, 0, nFeatures, 1)) { return; }
+
+    /* The pairwise matrices are checked if they are required or set by the user */
+    if (!isPairwiseRequired && !get(pairwiseNObservations)) { return; }
+
+    if (!checkNumericTable(get(pairwiseNObservations).get(), this->_errors.get(),
+                                            pairwiseNObservationsStr(), unexpectedLayouts, 0, nFeatures, nFeatures)) { return; }
+    if (!checkNumericTable(get(pairwiseSum).get(), this->_errors.get(),
+                                            pairwiseSumStr(), unexpectedLayouts, 0, nFeatures, nFeatures)) { return; }
+    if (!checkNumericTable(get(pairwiseSumSquaresCentered).get(), this->_errors.get(),
+                                            pairwiseSumSquaresCenteredStr(), unexpectedLayouts, 0, nFeatures, nFeatures)) { return; }
 }
 
 void PartialResultsInitIface::setToZero(data_management::NumericTable *table)
@@ -127,6 +162,21 @@ void PartialResultsInitIface::setToZero(data_management::NumericTable *table)
     size_t nCols = table->getNumberOfColumns();
     size_t nRows = table->getNumberOfRows();
 
+    /* Packed matrices are set to zero without unpacking */
+    data_management::PackedArrayNumericTableIface *packedTable = dynamic_cast<data_management::PackedArrayNumericTableIface *>(table);
+    if (packedTable)
+    {
+        packedTable->getPackedArray(data_management::writeOnly, block);
+        double *packedData = block.getBlockPtr();
+        size_t packedSize = block.getNumberOfColumns() * block.getNumberOfRows();
+        for(size_t i = 0; i < packedSize; i++)
+        {
+            packedData[i] = 0.0;
+        }
+        packedTable->releasePackedArray(block);
+        return;
+    }
+
     double *data;
     table->getBlockOfRows(0, nRows, data_management::writeOnly, block);
     data = block.getBlockPtr();
@@ -149,6 +199,12 @@ void DefaultPartialResultsInit::operator()(const Input &input, services::SharedP
     setToZero(pres->get(nObservations).get());
     setToZero(pres->get(crossProduct).get());
     setToZero(pres->get(sum).get());
+
+    for (size_t i = (size_t)pairwiseNObservations; i <= (size_t)pairwiseSumSquaresCentered; i++)
+    {
+        NumericTable *pairwiseTable = pres->get((PartialResultId)i).get();
+        if (pairwiseTable) { setToZero(pairwiseTable); }
+    }
 }
 
 }//namespace interface1
@@ -24,7 +24,7 @@
 #ifndef __COVARIANCE_PARTIALRESULT_
 #define __COVARIANCE_PARTIALRESULT_
 
-#include "covariance_types.h"
+#include "covariance_result.h"
 
 namespace daal
 {
@@ -33,6 +33,16 @@ namespace algorithms
 namespace covariance
 {
 
+/**
+ * Checks if the partial results of the correlation or variance-covariance matrix algorithm
+ * include the pairwise matrices used with the weights of observations and the missing values
+ * \param[in] input     %Input objects of the algorithm
+ * \param[in] parameter Parameters of the algorithm
+ * \return True if the weights are provided or the missing values are skipped,
+ *         on the master node if the partial results computed on local nodes include the pairwise matrices
+ */
+bool hasPairwisePartialResults(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter);
+
 /**
  * Allocates memory to store partial results of the correlation or variance-covariance matrix algorithm
  * \param[in] input     %Input objects of the algorithm
@@ -43,14 +53,23 @@ template <typename algorithmFPType>
 DAAL_EXPORT void PartialResult::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
 {
     const InputIface *algInput = static_cast<const InputIface *>(input);
+    const Parameter *algParameter = static_cast<const Parameter *>(parameter);
     size_t nColumns = algInput->getNumberOfFeatures();
 
     Argument::set(nObservations, data_management::NumericTablePtr(
                       new data_management::HomogenNumericTable<size_t>(1, 1, data_management::NumericTable::doAllocate)));
-    Argument::set(crossProduct, data_management::NumericTablePtr(
-                      new data_management::HomogenNumericTable<algorithmFPType>(nColumns, nColumns, data_management::NumericTable::doAllocate)));
+    Argument::set(crossProduct, allocateMatrix<algorithmFPType>(nColumns, algParameter->outputMatrixLayout));
     Argument::set(sum, data_management::NumericTablePtr(
                       new data_management::HomogenNumericTable<algorithmFPType>(nColumns, 1, data_management::NumericTable::doAllocate)));
+
+    if (hasPairwisePartialResults(input, parameter))
+    {
+        for (size_t i = (size_t)pairwiseNObservations; i <= (size_t)pairwiseSumSquaresCentered; i++)
+        {
+            Argument::set(i, data_management::NumericTablePtr(
+                              new data_management::HomogenNumericTable<algorithmFPType>(nColumns, nColumns, data_management::NumericTable::doAllocate)));
+        }
+    }
 }
 
 } // namespace covariance
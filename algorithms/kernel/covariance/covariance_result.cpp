@@ -37,7 +37,7 @@ namespace interface1
 {
 
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_COVARIANCE_RESULT_ID);
-Result::Result() : daal::algorithms::Result(2)
+Result::Result() : daal::algorithms::Result(3)
     {}
 
 /**
@@ -117,6 +117,13 @@ void Result::checkImpl(size_t nFeatures, OutputMatrixType outputMatrixType) cons
     /* Check mean vector */
     if (!checkNumericTable(get(mean).get(), this->_errors.get(),
         meanStr(), unexpectedLayouts, 0, nFeatures, 1)) { return; }
+
+    /* Check the optional vector of the numbers of observations of the features */
+    if (get(nObservationsPerFeature))
+    {
+        if (!checkNumericTable(get(nObservationsPerFeature).get(), this->_errors.get(),
+            nObservationsPerFeatureStr(), unexpectedLayouts, 0, nFeatures, 1)) { return; }
+    }
 }
 
 }//namespace interface1
@@ -25,6 +25,7 @@
 #define __COVARIANCE_RESULT_
 
 #include "covariance_types.h"
+#include "symmetric_matrix.h"
 
 namespace daal
 {
@@ -33,6 +34,25 @@ namespace algorithms
 namespace covariance
 {
 
+/**
+ * Allocates the p x p matrix of the correlation or variance-covariance matrix algorithm
+ * \param[in] nColumns  Number of features p
+ * \param[in] layout    Storage layout of the matrix
+ * \return Allocated matrix
+ */
+template <typename algorithmFPType>
+data_management::NumericTablePtr allocateMatrix(size_t nColumns, OutputMatrixLayout layout)
+{
+    if (layout == packedMatrix)
+    {
+        return data_management::NumericTablePtr(
+                   new data_management::PackedSymmetricMatrix<data_management::NumericTableIface::lowerPackedSymmetricMatrix, algorithmFPType>(
+                       nColumns, data_management::NumericTable::doAllocate));
+    }
+    return data_management::NumericTablePtr(
+               new data_management::HomogenNumericTable<algorithmFPType>(nColumns, nColumns, data_management::NumericTable::doAllocate));
+}
+
 /**
  * Allocates memory to store final results of the correlation or variance-covariance matrix algorithm
  * \param[in] input     %Input objects of the algorithm
@@ -43,12 +63,14 @@ template <typename algorithmFPType>
 DAAL_EXPORT void Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
 {
     const Input *algInput = static_cast<const Input *>(input);
+    const Parameter *algParameter = static_cast<const Parameter *>(parameter);
     size_t nColumns = algInput->getNumberOfFeatures();
 
-    Argument::set(covariance, data_management::SerializationIfacePtr(
-                      new data_management::HomogenNumericTable<algorithmFPType>(nColumns, nColumns, data_management::NumericTable::doAllocate)));
+    Argument::set(covariance, allocateMatrix<algorithmFPType>(nColumns, algParameter->outputMatrixLayout));
     Argument::set(mean, data_management::SerializationIfacePtr(
                       new data_management::HomogenNumericTable<algorithmFPType>(nColumns, 1, data_management::NumericTable::doAllocate)));
+    Argument::set(nObservationsPerFeature, data_management::SerializationIfacePtr(
+                      new data_management::HomogenNumericTable<algorithmFPType>(nColumns, 1, data_management::NumericTable::doAllocate)));
 }
 
 /**
@@ -61,12 +83,14 @@ template <typename algorithmFPType>
 DAAL_EXPORT void Result::allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method)
 {
     const PartialResult *pres = static_cast<const PartialResult *>(partialResult);
+    const Parameter *algParameter = static_cast<const Parameter *>(parameter);
     size_t nColumns = pres->getNumberOfFeatures();
 
-    Argument::set(covariance, data_management::SerializationIfacePtr(
-                      new data_management::HomogenNumericTable<algorithmFPType>(nColumns, nColumns, data_management::NumericTable::doAllocate)));
+    Argument::set(covariance, allocateMatrix<algorithmFPType>(nColumns, algParameter->outputMatrixLayout));
     Argument::set(mean, data_management::SerializationIfacePtr(
                       new data_management::HomogenNumericTable<algorithmFPType>(nColumns, 1, data_management::NumericTable::doAllocate)));
+    Argument::set(nObservationsPerFeature, data_management::SerializationIfacePtr(
+                      new data_management::HomogenNumericTable<algorithmFPType>(nColumns, 1, data_management::NumericTable::doAllocate)));
 }
 
 } // namespace covariance
@@ -89,6 +89,11 @@ void DistributedInput<step2Master>::check(const daal::algorithms::Parameter *par
                                        (int)NumericTableIface::upperPackedTriangularMatrix |
                                        (int)NumericTableIface::lowerPackedTriangularMatrix;
 
+    /* The pairwise matrices are computed on all local nodes or on none of them */
+    SharedPtr<PartialResult> firstPartialResult =
+        staticPointerCast<PartialResult, SerializationIface>((*collection)[0]);
+    DAAL_CHECK_EX(firstPartialResult, ErrorIncorrectElementInPartialResultCollection, ArgumentName, partialResultsStr());
+    bool isPairwise = (firstPartialResult->get(pairwiseNObservations).get() != NULL);
 
     for(size_t j = 0; j < nBlocks; j++)
     {
@@ -111,6 +116,19 @@ void DistributedInput<step2Master>::check(const daal::algorithms::Parameter *par
         /* Check partial sums */
         NumericTable *sumTable = static_cast<NumericTable *>(partialResult->get(sum).get());
         if(!checkNumericTable(sumTable, this->_errors.get(), sumStr(), packedLayouts, 0, nFeatures, 1)) { return; }
+
+        /* Check partial pairwise matrices */
+        if(!isPairwise)
+        {
+            DAAL_CHECK_EX(!partialResult->get(pairwiseNObservations), ErrorIncorrectOptionalInput, ArgumentName, pairwiseNObservationsStr());
+            continue;
+        }
+        if(!checkNumericTable(partialResult->get(pairwiseNObservations).get(), this->_errors.get(), pairwiseNObservationsStr(),
+                              packedLayouts, 0, nFeatures, nFeatures)) { return; }
+        if(!checkNumericTable(partialResult->get(pairwiseSum).get(), this->_errors.get(), pairwiseSumStr(),
+                              packedLayouts, 0, nFeatures, nFeatures)) { return; }
+        if(!checkNumericTable(partialResult->get(pairwiseSumSquaresCentered).get(), this->_errors.get(), pairwiseSumSquaresCenteredStr(),
+                              packedLayouts, 0, nFeatures, nFeatures)) { return; }
     }
 }
 
@@ -28,6 +28,7 @@
 #include "csr_numeric_table.h"
 #include "merged_numeric_table.h"
 #include "row_merged_numeric_table.h"
+#include "algorithms/normalization/normalized_numeric_table.h"
 #include "symmetric_matrix.h"
 #include "matrix.h"
 #include "data_collection.h"
@@ -154,6 +155,7 @@ Factory::Factory() : _impl(nullptr)
     registerObject(new Creator<SOANumericTable>());
     registerObject(new Creator<MergedNumericTable>());
     registerObject(new Creator<RowMergedNumericTable>());
+    registerObject(new Creator<algorithms::normalization::NormalizedNumericTable>());
     registerObject(new Creator<NumericTableDictionary>());
     registerObject(new Creator<data_management::DataCollection >());
     registerObject(new Creator<data_management::KeyValueDataCollection >());
@@ -0,0 +1,69 @@
+/* file: gbt_predict_batch_container.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the gradient boosted trees prediction algorithm container.
+//--
+*/
+
+#include "gbt_predict.h"
+#include "gbt_predict_kernel.h"
+#include "classifier_predict_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace prediction
+{
+/**
+*  \brief Initialize list of the gradient boosted trees prediction kernels with implementations for supported architectures
+*/
+template<typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::GBTPredictKernel, method, algorithmFPType);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void BatchContainer<algorithmFPType, method, cpu>::compute()
+{
+    gbt::prediction::Input *input = static_cast<gbt::prediction::Input *>(_in);
+    classifier::prediction::Result *result = static_cast<classifier::prediction::Result *>(_res);
+
+    const NumericTable *x = input->get(classifier::prediction::data).get();
+    const gbt::Model *m = input->get(classifier::prediction::model).get();
+    NumericTable *r = result->get(classifier::prediction::prediction).get();
+    const gbt::Parameter *par = static_cast<const gbt::Parameter *>(_par);
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::GBTPredictKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, x, m, r, par);
+}
+
+} // namespace prediction
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
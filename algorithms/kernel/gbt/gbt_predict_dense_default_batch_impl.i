@@ -0,0 +1,147 @@
+/* file: gbt_predict_dense_default_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the gradient boosted trees prediction.
+//
+//  The observations are processed in blocks in parallel. Every tree is
+//  traversed for all observations of the block before the next tree, so the
+//  nodes of the tree stay in the cache while the block is processed.
+//--
+*/
+
+#ifndef __GBT_PREDICT_DENSE_DEFAULT_BATCH_IMPL_I__
+#define __GBT_PREDICT_DENSE_DEFAULT_BATCH_IMPL_I__
+
+#include "service_numeric_table.h"
+#include "threading.h"
+#include "service_utils.h"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace prediction
+{
+namespace internal
+{
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+void GBTPredictKernel<method, algorithmFPType, cpu>::compute(const NumericTable *x, const gbt::Model *m, NumericTable *r,
+                                                             const gbt::Parameter *par)
+{
+    const size_t nRows = x->getNumberOfRows();
+    const size_t nFeatures = x->getNumberOfColumns();
+    const size_t nTrees = m->getNumberOfTrees();
+    const size_t nTreesPerIteration = m->getNumberOfTreesPerIteration();
+    const LossFunction lossFunction = m->getLossFunction();
+    const size_t nNodes = m->getSplitFeatures()->getNumberOfRows();
+
+    ReadRows<int, cpu> splitFeaturesRows(m->getSplitFeatures().get(), 0, nNodes);
+    ReadRows<algorithmFPType, cpu> nodeValuesRows(m->getNodeValues().get(), 0, nNodes);
+    ReadRows<int, cpu> leftChildrenRows(m->getLeftChildren().get(), 0, nNodes);
+    ReadRows<int, cpu> treeOffsetsRows(m->getTreeOffsets().get(), 0, nTrees + 1);
+    ReadRows<algorithmFPType, cpu> initialScoresRows(m->getInitialScores().get(), 0, nTreesPerIteration);
+    const int * const splitFeatures = splitFeaturesRows.get();
+    const algorithmFPType * const nodeValues = nodeValuesRows.get();
+    const int * const leftChildren = leftChildrenRows.get();
+    const int * const treeOffsets = treeOffsetsRows.get();
+    const algorithmFPType * const initialScores = initialScoresRows.get();
+    if (!splitFeatures || !nodeValues || !leftChildren || !treeOffsets || !initialScores)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    const size_t blockSize = __GBT_PREDICT_BLOCK_SIZE;
+    const size_t nBlocks = (nRows + blockSize - 1) / blockSize;
+    bool isOk = true;
+    daal::threader_for(nBlocks, nBlocks, [=, &isOk](size_t iBlock)
+    {
+        const size_t first = iBlock * blockSize;
+        const size_t last = min<cpu>(first + blockSize, nRows);
+        const size_t n = last - first;
+
+        ReadRows<algorithmFPType, cpu> xRows(const_cast<NumericTable *>(x), first, n);
+        WriteOnlyRows<algorithmFPType, cpu> rRows(r, first, n);
+        TArray<algorithmFPType, cpu> scoresArray(n * nTreesPerIteration);
+        const algorithmFPType * const dx = xRows.get();
+        algorithmFPType * const dr = rRows.get();
+        algorithmFPType * const scores = scoresArray.get();
+        if (!dx || !dr || !scores)
+        {
+            isOk = false;
+            return;
+        }
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            for (size_t k = 0; k < nTreesPerIteration; ++k) { scores[i * nTreesPerIteration + k] = initialScores[k]; }
+        }
+
+        for (size_t t = 0; t < nTrees; ++t)
+        {
+            const size_t k = t % nTreesPerIteration;
+            const int * const treeFeatures = splitFeatures + treeOffsets[t];
+            const algorithmFPType * const treeValues = nodeValues + treeOffsets[t];
+            const int * const treeLeft = leftChildren + treeOffsets[t];
+            for (size_t i = 0; i < n; ++i)
+            {
+                const algorithmFPType * const row = dx + i * nFeatures;
+                size_t node = 0;
+                while (treeFeatures[node] >= 0)
+                {
+                    node = treeLeft[node] + (row[treeFeatures[node]] > treeValues[node]);
+                }
+                scores[i * nTreesPerIteration + k] += treeValues[node];
+            }
+        }
+
+        /* The estimate of the dependent variable, or the class with the largest score */
+        for (size_t i = 0; i < n; ++i)
+        {
+            const algorithmFPType * const s = scores + i * nTreesPerIteration;
+            if (lossFunction == squared) { dr[i] = s[0]; }
+            else if (nTreesPerIteration == 1) { dr[i] = (s[0] > 0 ? 1 : 0); }
+            else
+            {
+                size_t best = 0;
+                for (size_t k = 1; k < nTreesPerIteration; ++k)
+                {
+                    if (s[k] > s[best]) { best = k; }
+                }
+                dr[i] = (algorithmFPType)best;
+            }
+        }
+    } );
+
+    if (!isOk) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
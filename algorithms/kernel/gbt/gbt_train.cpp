@@ -0,0 +1,85 @@
+/* file: gbt_train.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the gradient boosted trees training algorithm and types methods.
+//--
+*/
+
+#include "gbt_training_types.h"
+#include "serialization_utils.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Model, SERIALIZATION_GBT_MODEL_ID);
+}
+
+namespace training
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_GBT_TRAINING_RESULT_ID);
+Result::Result() : classifier::training::Result() {}
+
+/**
+ * Returns the model trained with the gradient boosted trees algorithm
+ * \param[in] id    Identifier of the result, \ref classifier::training::ResultId
+ * \return          Model trained with the gradient boosted trees algorithm
+ */
+services::SharedPtr<daal::algorithms::gbt::Model> Result::get(classifier::training::ResultId id) const
+{
+    return services::staticPointerCast<daal::algorithms::gbt::Model, data_management::SerializationIface>(Argument::get(id));
+}
+
+void Result::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const
+{
+    classifier::training::Result::check(input, parameter, method);
+    if(this->_errors->size() != 0) { return; }
+    services::SharedPtr<daal::algorithms::gbt::Model> m = get(classifier::training::model);
+    if(!m->getSplitFeatures() || !m->getNodeValues() || !m->getLeftChildren())
+    {
+        this->_errors->add(services::Error::create(services::ErrorModelNotFullInitialized, services::ArgumentName, splitFeaturesStr()));
+        return;
+    }
+    if(!m->getTreeOffsets())
+    {
+        this->_errors->add(services::Error::create(services::ErrorModelNotFullInitialized, services::ArgumentName, treeOffsetsStr()));
+        return;
+    }
+    if(!m->getInitialScores())
+    {
+        this->_errors->add(services::Error::create(services::ErrorModelNotFullInitialized, services::ArgumentName, initialScoresStr()));
+        return;
+    }
+}
+
+}// namespace interface1
+}// namespace training
+}// namespace gbt
+}// namespace algorithms
+}// namespace daal
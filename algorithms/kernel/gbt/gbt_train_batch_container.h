@@ -0,0 +1,71 @@
+/* file: gbt_train_batch_container.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the gradient boosted trees training algorithm container.
+//--
+*/
+
+#include "gbt_training_batch.h"
+#include "gbt_train_kernel.h"
+#include "classifier_training_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace training
+{
+/**
+*  \brief Initialize list of the gradient boosted trees training kernels with implementations for supported architectures
+*/
+template <typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::GBTTrainKernel, method, algorithmFPType);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+void BatchContainer<algorithmFPType, method, cpu>::compute()
+{
+    classifier::training::Input *input = static_cast<classifier::training::Input *>(_in);
+    gbt::training::Result *result = static_cast<gbt::training::Result *>(_res);
+
+    const NumericTable *x = input->get(classifier::training::data).get();
+    const NumericTable *y = input->get(classifier::training::labels).get();
+    const NumericTable *w = input->get(classifier::training::weights).get();
+
+    gbt::Model *m = result->get(classifier::training::model).get();
+    const gbt::Parameter *par = static_cast<const gbt::Parameter *>(_par);
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::GBTTrainKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, x, y, w, m, par);
+}
+
+} // namespace training
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
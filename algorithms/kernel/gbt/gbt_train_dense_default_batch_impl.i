@@ -0,0 +1,910 @@
+/* file: gbt_train_dense_default_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the gradient boosted trees training on the quantized feature values.
+//
+//  The values of every feature are replaced by the indices of the bins, the bin
+//  borders are the quantiles of the feature values. Every tree is grown on the
+//  histograms of the gradients and the hessians over the bins: the histogram of
+//  the node is accumulated over the blocks of its rows in parallel, and the
+//  histogram of the larger child is computed as the difference of the parent
+//  and the smaller child histograms. The best splits of the features are
+//  searched in parallel.
+//--
+*/
+
+#ifndef __GBT_TRAIN_DENSE_DEFAULT_BATCH_IMPL_I__
+#define __GBT_TRAIN_DENSE_DEFAULT_BATCH_IMPL_I__
+
+#include "service_numeric_table.h"
+#include "service_memory.h"
+#include "service_math.h"
+#include "service_sort.h"
+#include "threading.h"
+#include "service_utils.h"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace training
+{
+namespace internal
+{
+
+/* Node of the tree being grown */
+template <typename algorithmFPType>
+struct TreeNode
+{
+    size_t begin;               /* First row of the node in the array of row indices */
+    size_t end;                 /* Row after the last row of the node */
+    size_t depth;
+    algorithmFPType sumG;       /* Sums of the gradients and the hessians over the rows of the node */
+    algorithmFPType sumH;
+    algorithmFPType *hist;      /* Histogram of the node while the node is a candidate for the split */
+    int left;                   /* Index of the left child, -1 for the leaf */
+    int splitFeature;           /* Best split of the node */
+    size_t splitBin;            /* Rows with the bins not greater than splitBin go to the left child */
+    algorithmFPType gain;
+    algorithmFPType leftG;
+    algorithmFPType leftH;
+    size_t leftCount;
+};
+
+/* Best split of one feature */
+template <typename algorithmFPType>
+struct FeatureSplit
+{
+    algorithmFPType gain;
+    size_t bin;
+    algorithmFPType leftG;
+    algorithmFPType leftH;
+    size_t leftCount;
+};
+
+/* Histogram of the thread used to accumulate the histogram of the large node */
+template <typename algorithmFPType>
+struct LocalHistogram
+{
+    algorithmFPType *hist;
+    size_t generation;
+};
+
+/*
+ * Computes the bin borders of every feature: all distinct values if there are not more than maxBins of them,
+ * the maxBins quantiles otherwise. The value falls into the first bin with the border not less than the value
+ */
+template <typename algorithmFPType, CpuType cpu>
+bool computeBinBorders(const NumericTable &x, size_t maxBins, TArray<size_t, cpu> &binOffsets, TArray<algorithmFPType, cpu> &borders)
+{
+    const size_t nRows = x.getNumberOfRows();
+    const size_t nFeatures = x.getNumberOfColumns();
+
+    TArray<algorithmFPType, cpu> featureBordersArray(nFeatures * maxBins);
+    TArray<size_t, cpu> nBinsArray(nFeatures);
+    algorithmFPType * const featureBorders = featureBordersArray.get();
+    size_t * const nBins = nBinsArray.get();
+    binOffsets.reset(nFeatures + 1);
+    if (!featureBorders || !nBins || !binOffsets.get()) { return false; }
+
+    bool isOk = true;
+    daal::threader_for(nFeatures, nFeatures, [=, &x, &isOk](size_t j)
+    {
+        TArray<algorithmFPType, cpu> columnArray(nRows);
+        algorithmFPType * const column = columnArray.get();
+        if (!column)
+        {
+            isOk = false;
+            return;
+        }
+        BlockDescriptor<algorithmFPType> bd;
+        const_cast<NumericTable &>(x).getBlockOfColumnValues(j, 0, nRows, readOnly, bd);
+        const algorithmFPType * const values = bd.getBlockPtr();
+        for (size_t i = 0; i < nRows; ++i) { column[i] = values[i]; }
+        const_cast<NumericTable &>(x).releaseBlockOfColumnValues(bd);
+
+        daal::algorithms::internal::qSort<algorithmFPType, cpu>(nRows, column);
+
+        size_t nUnique = 1;
+        for (size_t i = 1; i < nRows; ++i) { nUnique += (column[i] != column[i - 1]); }
+
+        algorithmFPType * const dst = featureBorders + j * maxBins;
+        size_t nDst = 0;
+        if (nUnique <= maxBins)
+        {
+            dst[nDst++] = column[0];
+            for (size_t i = 1; i < nRows; ++i)
+            {
+                if (column[i] != column[i - 1]) { dst[nDst++] = column[i]; }
+            }
+        }
+        else
+        {
+            for (size_t b = 1; b <= maxBins; ++b)
+            {
+                const algorithmFPType value = column[b * nRows / maxBins - 1];
+                if (!nDst || value > dst[nDst - 1]) { dst[nDst++] = value; }
+            }
+        }
+        nBins[j] = nDst;
+    } );
+    if (!isOk) { return false; }
+
+    binOffsets[0] = 0;
+    for (size_t j = 0; j < nFeatures; ++j) { binOffsets[j + 1] = binOffsets[j] + nBins[j]; }
+    borders.reset(binOffsets[nFeatures]);
+    if (!borders.get()) { return false; }
+    for (size_t j = 0; j < nFeatures; ++j)
+    {
+        for (size_t b = 0; b < nBins[j]; ++b) { borders[binOffsets[j] + b] = featureBorders[j * maxBins + b]; }
+    }
+    return true;
+}
+
+/* Replaces the feature values with the indices of their bins, the result is stored row by row */
+template <typename algorithmFPType, typename BinType, CpuType cpu>
+void quantizeData(const NumericTable &x, const size_t *binOffsets, const algorithmFPType *borders, BinType *bins)
+{
+    const size_t nRows = x.getNumberOfRows();
+    const size_t nFeatures = x.getNumberOfColumns();
+    const size_t blockSize = __GBT_ROW_BLOCK_SIZE;
+    const size_t nBlocks = (nRows + blockSize - 1) / blockSize;
+
+    daal::threader_for(nBlocks, nBlocks, [=, &x](size_t iBlock)
+    {
+        const size_t first = iBlock * blockSize;
+        const size_t last = min<cpu>(first + blockSize, nRows);
+        ReadRows<algorithmFPType, cpu> rows(const_cast<NumericTable &>(x), first, last - first);
+        const algorithmFPType * const values = rows.get();
+
+        for (size_t i = 0; i < last - first; ++i)
+        {
+            for (size_t j = 0; j < nFeatures; ++j)
+            {
+                const algorithmFPType value = values[i * nFeatures + j];
+                const algorithmFPType * const featureBorders = borders + binOffsets[j];
+                size_t lo = 0;
+                size_t hi = binOffsets[j + 1] - binOffsets[j] - 1;
+                while (lo < hi)
+                {
+                    const size_t mid = (lo + hi) / 2;
+                    if (featureBorders[mid] < value) { lo = mid + 1; }
+                    else { hi = mid; }
+                }
+                bins[(first + i) * nFeatures + j] = (BinType)lo;
+            }
+        }
+    } );
+}
+
+/*
+ * Computes the gradients and the hessians of the loss function for every tree of the iteration,
+ * the values of the tree k are stored in g[k * nRows + i] and h[k * nRows + i]
+ */
+template <typename algorithmFPType, CpuType cpu>
+bool computeGradients(LossFunction lossFunction, size_t nRows, size_t nTrees, const algorithmFPType *labels, const int *classes,
+                      const algorithmFPType *weights, const algorithmFPType *scores, algorithmFPType *g, algorithmFPType *h)
+{
+    const algorithmFPType minHessian = 1e-16;
+    const size_t blockSize = __GBT_ROW_BLOCK_SIZE;
+    const size_t nBlocks = (nRows + blockSize - 1) / blockSize;
+
+    bool isOk = true;
+    daal::threader_for(nBlocks, nBlocks, [=, &isOk](size_t iBlock)
+    {
+        const size_t first = iBlock * blockSize;
+        const size_t last = min<cpu>(first + blockSize, nRows);
+
+        if (lossFunction == squared)
+        {
+            for (size_t i = first; i < last; ++i)
+            {
+                const algorithmFPType weight = weights ? weights[i] : 1;
+                g[i] = weight * (scores[i] - labels[i]);
+                h[i] = weight;
+            }
+            return;
+        }
+
+        TArray<algorithmFPType, cpu> expArray((last - first) * nTrees);
+        algorithmFPType * const e = expArray.get();
+        if (!e)
+        {
+            isOk = false;
+            return;
+        }
+
+        if (nTrees == 1)
+        {
+            /* Logistic loss, the score is the log-odds of the class 1 */
+            for (size_t i = first; i < last; ++i) { e[i - first] = -scores[i]; }
+            daal::internal::Math<algorithmFPType, cpu>::vExp(last - first, e, e);
+            for (size_t i = first; i < last; ++i)
+            {
+                const algorithmFPType weight = weights ? weights[i] : 1;
+                const algorithmFPType p = 1 / (1 + e[i - first]);
+                g[i] = weight * (p - (classes[i] == 1));
+                h[i] = weight * max<cpu>(p * (1 - p), minHessian);
+            }
+            return;
+        }
+
+        /* Softmax loss */
+        for (size_t i = first; i < last; ++i)
+        {
+            const algorithmFPType * const s = scores + i * nTrees;
+            algorithmFPType maxScore = s[0];
+            for (size_t k = 1; k < nTrees; ++k) { maxScore = max<cpu>(maxScore, s[k]); }
+            for (size_t k = 0; k < nTrees; ++k) { e[(i - first) * nTrees + k] = s[k] - maxScore; }
+        }
+        daal::internal::Math<algorithmFPType, cpu>::vExp((last - first) * nTrees, e, e);
+        for (size_t i = first; i < last; ++i)
+        {
+            const algorithmFPType weight = weights ? weights[i] : 1;
+            const algorithmFPType * const ei = e + (i - first) * nTrees;
+            algorithmFPType sum = 0;
+            for (size_t k = 0; k < nTrees; ++k) { sum += ei[k]; }
+            const algorithmFPType invSum = 1 / sum;
+            for (size_t k = 0; k < nTrees; ++k)
+            {
+                const algorithmFPType p = ei[k] * invSum;
+                g[k * nRows + i] = weight * (p - (classes[i] == (int)k));
+                h[k * nRows + i] = weight * max<cpu>(p * (1 - p), minHessian);
+            }
+        }
+    } );
+    return isOk;
+}
+
+/* Grows the trees on the histograms of the gradients over the quantized data */
+template <typename algorithmFPType, typename BinType, CpuType cpu>
+class TreeBuilder
+{
+public:
+    typedef TreeNode<algorithmFPType> Node;
+    typedef daal::tls<LocalHistogram<algorithmFPType> *> LocalHistograms;
+
+    TreeBuilder(const Parameter &par, size_t nRows, size_t nFeatures, const BinType *bins, const size_t *binOffsets,
+                LocalHistograms &localHistograms) :
+        _par(par), _nRows(nRows), _nFeatures(nFeatures), _bins(bins), _binOffsets(binOffsets), _histSize(3 * binOffsets[nFeatures]),
+        _localHistograms(localHistograms), _generation(0), _nNodes(0), _nFreeHistograms(0), _nAllocatedHistograms(0)
+    {
+        /* Every leaf contains at least minObservationsInLeaf rows */
+        size_t maxLeaves = max<cpu>(nRows / par.minObservationsInLeaf, (size_t)1);
+        if (par.maxLeaves) { maxLeaves = min<cpu>(maxLeaves, par.maxLeaves); }
+        if (par.maxTreeDepth && par.maxTreeDepth < 8 * sizeof(size_t) - 1)
+        {
+            maxLeaves = min<cpu>(maxLeaves, (size_t)1 << par.maxTreeDepth);
+        }
+        _maxNodes = 2 * maxLeaves - 1;
+    }
+
+    ~TreeBuilder()
+    {
+        for (size_t i = 0; i < _nAllocatedHistograms; ++i) { service_free<algorithmFPType, cpu>(_allHistograms[i]); }
+    }
+
+    bool init()
+    {
+        _nodes.reset(_maxNodes);
+        _openNodes.reset(_maxNodes);
+        _allHistograms.reset(_maxNodes);
+        _freeHistograms.reset(_maxNodes);
+        _rows.reset(_nRows);
+        _rowsBuffer.reset(_nRows);
+        _featureSplits.reset(_nFeatures);
+        return _nodes.get() && _openNodes.get() && _allHistograms.get() && _freeHistograms.get() && _rows.get() && _rowsBuffer.get() &&
+               _featureSplits.get();
+    }
+
+    /* Grows the tree on the gradients g and the hessians h */
+    bool build(const algorithmFPType *g, const algorithmFPType *h);
+
+    /* Adds the responses of the leaves to the scores of the rows, the score of the row i is scores[i * nTrees] */
+    void updateScores(algorithmFPType *scores, size_t nTrees) const;
+
+    size_t getNumberOfNodes() const { return _nNodes; }
+    const Node *getNodes() const { return _nodes.get(); }
+
+    algorithmFPType getLeafValue(const Node &node) const
+    {
+        return -_par.learningRate * node.sumG / (node.sumH + _par.lambda);
+    }
+
+private:
+    bool canGrow(size_t depth) const { return !_par.maxTreeDepth || depth < _par.maxTreeDepth; }
+
+    void initNode(Node &node, size_t begin, size_t end, size_t depth, algorithmFPType sumG, algorithmFPType sumH)
+    {
+        node.begin = begin;
+        node.end = end;
+        node.depth = depth;
+        node.sumG = sumG;
+        node.sumH = sumH;
+        node.hist = NULL;
+        node.left = -1;
+        node.splitFeature = -1;
+    }
+
+    algorithmFPType *getHistogram();
+    void releaseHistogram(algorithmFPType *hist) { _freeHistograms[_nFreeHistograms++] = hist; }
+
+    bool buildHistogram(Node &node);
+    void accumulateHistogram(algorithmFPType *hist, size_t first, size_t last) const;
+    void findSplit(Node &node);
+    bool splitNode(size_t iNode);
+
+    const Parameter &_par;
+    const size_t _nRows;
+    const size_t _nFeatures;
+    const BinType *_bins;
+    const size_t *_binOffsets;
+    const size_t _histSize;
+    LocalHistograms &_localHistograms;
+    size_t _generation;
+    size_t _maxNodes;
+
+    const algorithmFPType *_g;
+    const algorithmFPType *_h;
+
+    TArray<Node, cpu> _nodes;
+    size_t _nNodes;
+    TArray<size_t, cpu> _openNodes;                 /* Nodes that can be split */
+    size_t _nOpenNodes;
+    TArray<algorithmFPType *, cpu> _allHistograms;
+    TArray<algorithmFPType *, cpu> _freeHistograms;
+    size_t _nFreeHistograms;
+    size_t _nAllocatedHistograms;
+    TArray<int, cpu> _rows;                         /* Indices of the rows, the rows of every node are contiguous */
+    TArray<int, cpu> _rowsBuffer;
+    TArray<FeatureSplit<algorithmFPType>, cpu> _featureSplits;
+};
+
+template <typename algorithmFPType, typename BinType, CpuType cpu>
+algorithmFPType *TreeBuilder<algorithmFPType, BinType, cpu>::getHistogram()
+{
+    if (_nFreeHistograms) { return _freeHistograms[--_nFreeHistograms]; }
+    algorithmFPType * const hist = service_malloc<algorithmFPType, cpu>(_histSize);
+    if (hist) { _allHistograms[_nAllocatedHistograms++] = hist; }
+    return hist;
+}
+
+template <typename algorithmFPType, typename BinType, CpuType cpu>
+void TreeBuilder<algorithmFPType, BinType, cpu>::accumulateHistogram(algorithmFPType *hist, size_t first, size_t last) const
+{
+    const size_t nFeatures = _nFeatures;
+    const size_t * const binOffsets = _binOffsets;
+    for (size_t i = first; i < last; ++i)
+    {
+        const size_t row = _rows[i];
+        const algorithmFPType g = _g[row];
+        const algorithmFPType h = _h[row];
+        const BinType * const rowBins = _bins + row * nFeatures;
+        for (size_t j = 0; j < nFeatures; ++j)
+        {
+            algorithmFPType * const entry = hist + 3 * (binOffsets[j] + rowBins[j]);
+            entry[0] += g;
+            entry[1] += h;
+            entry[2] += 1;
+        }
+    }
+}
+
+template <typename algorithmFPType, typename BinType, CpuType cpu>
+bool TreeBuilder<algorithmFPType, BinType, cpu>::buildHistogram(Node &node)
+{
+    algorithmFPType * const hist = node.hist;
+    const size_t histSize = _histSize;
+  PRAGMA_IVDEP
+  PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < histSize; ++i) { hist[i] = 0; }
+
+    const size_t nRows = node.end - node.begin;
+    const size_t blockSize = __GBT_HISTOGRAM_BLOCK_SIZE;
+    if (nRows <= blockSize)
+    {
+        accumulateHistogram(hist, node.begin, node.end);
+        return true;
+    }
+
+    /* The threads accumulate the blocks of rows into their own histograms, the histograms of the threads
+       that took part in this node are summed up */
+    const size_t generation = ++_generation;
+    const size_t nBlocks = (nRows + blockSize - 1) / blockSize;
+    const size_t begin = node.begin;
+    const size_t end = node.end;
+    bool isOk = true;
+    daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
+    {
+        LocalHistogram<algorithmFPType> * const local = _localHistograms.local();
+        if (!local)
+        {
+            isOk = false;
+            return;
+        }
+        if (local->generation != generation)
+        {
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < histSize; ++i) { local->hist[i] = 0; }
+            local->generation = generation;
+        }
+        const size_t first = begin + iBlock * blockSize;
+        accumulateHistogram(local->hist, first, min<cpu>(first + blockSize, end));
+    } );
+
+    _localHistograms.reduce([=](LocalHistogram<algorithmFPType> *local) -> void
+    {
+        if (!local || local->generation != generation) { return; }
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < histSize; ++i) { hist[i] += local->hist[i]; }
+    } );
+    return isOk;
+}
+
+template <typename algorithmFPType, typename BinType, CpuType cpu>
+void TreeBuilder<algorithmFPType, BinType, cpu>::findSplit(Node &node)
+{
+    node.splitFeature = -1;
+    const size_t nNodeRows = node.end - node.begin;
+    const size_t minCount = _par.minObservationsInLeaf;
+    if (nNodeRows < 2 * minCount) { return; }
+
+    const algorithmFPType lambda = _par.lambda;
+    const algorithmFPType sumG = node.sumG;
+    const algorithmFPType sumH = node.sumH;
+    const algorithmFPType * const hist = node.hist;
+    const size_t * const binOffsets = _binOffsets;
+    FeatureSplit<algorithmFPType> * const featureSplits = _featureSplits.get();
+
+    daal::threader_for(_nFeatures, _nFeatures, [=](size_t j)
+    {
+        FeatureSplit<algorithmFPType> &best = featureSplits[j];
+        best.gain = 0;
+        best.leftCount = 0;
+        bool found = false;
+
+        const algorithmFPType * const featureHist = hist + 3 * binOffsets[j];
+        const size_t nBins = binOffsets[j + 1] - binOffsets[j];
+        algorithmFPType leftG = 0;
+        algorithmFPType leftH = 0;
+        size_t leftCount = 0;
+        for (size_t b = 0; b + 1 < nBins; ++b)
+        {
+            leftG += featureHist[3 * b];
+            leftH += featureHist[3 * b + 1];
+            leftCount += (size_t)featureHist[3 * b + 2];
+            if (leftCount < minCount) { continue; }
+            if (nNodeRows - leftCount < minCount) { break; }
+
+            const algorithmFPType rightG = sumG - leftG;
+            const algorithmFPType rightH = sumH - leftH;
+            const algorithmFPType score = leftG * leftG / (leftH + lambda) + rightG * rightG / (rightH + lambda);
+            if (!found || score > best.gain)
+            {
+                found = true;
+                best.gain = score;
+                best.bin = b;
+                best.leftG = leftG;
+                best.leftH = leftH;
+                best.leftCount = leftCount;
+            }
+        }
+        if (!found) { best.leftCount = 0; }
+    } );
+
+    /* Loss reduction of the split, the first feature wins the ties */
+    const algorithmFPType parentScore = sumG * sumG / (sumH + lambda);
+    const algorithmFPType minGain = _par.minSplitLoss;
+    algorithmFPType bestGain = 0;
+    for (size_t j = 0; j < _nFeatures; ++j)
+    {
+        const FeatureSplit<algorithmFPType> &split = featureSplits[j];
+        if (!split.leftCount) { continue; }
+        const algorithmFPType gain = 0.5 * (split.gain - parentScore);
+        if (gain > minGain && gain > bestGain)
+        {
+            bestGain = gain;
+            node.gain = gain;
+            node.splitFeature = (int)j;
+            node.splitBin = split.bin;
+            node.leftG = split.leftG;
+            node.leftH = split.leftH;
+            node.leftCount = split.leftCount;
+        }
+    }
+}
+
+template <typename algorithmFPType, typename BinType, CpuType cpu>
+bool TreeBuilder<algorithmFPType, BinType, cpu>::splitNode(size_t iNode)
+{
+    Node &node = _nodes[iNode];
+    const size_t nFeatures = _nFeatures;
+    const size_t feature = node.splitFeature;
+    const BinType splitBin = (BinType)node.splitBin;
+
+    /* Stable partition of the rows of the node */
+    int * const rows = _rows.get();
+    int * const buffer = _rowsBuffer.get();
+    size_t nLeft = node.begin;
+    size_t nRight = 0;
+    for (size_t i = node.begin; i < node.end; ++i)
+    {
+        const int row = rows[i];
+        if (_bins[row * nFeatures + feature] <= splitBin) { rows[nLeft++] = row; }
+        else { buffer[nRight++] = row; }
+    }
+    for (size_t i = 0; i < nRight; ++i) { rows[nLeft + i] = buffer[i]; }
+
+    const size_t iLeft = _nNodes;
+    _nNodes += 2;
+    node.left = (int)iLeft;
+    Node &left = _nodes[iLeft];
+    Node &right = _nodes[iLeft + 1];
+    initNode(left, node.begin, nLeft, node.depth + 1, node.leftG, node.leftH);
+    initNode(right, nLeft, node.end, node.depth + 1, node.sumG - node.leftG, node.sumH - node.leftH);
+
+    algorithmFPType * const parentHist = node.hist;
+    node.hist = NULL;
+    if (!canGrow(node.depth + 1))
+    {
+        releaseHistogram(parentHist);
+        return true;
+    }
+
+    /* The histogram of the smaller child is accumulated, the larger child reuses the memory of the parent histogram */
+    const bool isLeftSmaller = (left.end - left.begin) <= (right.end - right.begin);
+    Node &smaller = isLeftSmaller ? left : right;
+    Node &larger = isLeftSmaller ? right : left;
+    smaller.hist = getHistogram();
+    if (!smaller.hist)
+    {
+        releaseHistogram(parentHist);
+        return false;
+    }
+    if (!buildHistogram(smaller)) { return false; }
+    larger.hist = parentHist;
+    const algorithmFPType * const smallerHist = smaller.hist;
+  PRAGMA_IVDEP
+  PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < _histSize; ++i) { parentHist[i] -= smallerHist[i]; }
+
+    for (size_t iChild = iLeft; iChild < iLeft + 2; ++iChild)
+    {
+        Node &child = _nodes[iChild];
+        findSplit(child);
+        if (child.splitFeature >= 0) { _openNodes[_nOpenNodes++] = iChild; }
+        else
+        {
+            releaseHistogram(child.hist);
+            child.hist = NULL;
+        }
+    }
+    return true;
+}
+
+template <typename algorithmFPType, typename BinType, CpuType cpu>
+bool TreeBuilder<algorithmFPType, BinType, cpu>::build(const algorithmFPType *g, const algorithmFPType *h)
+{
+    _g = g;
+    _h = h;
+    _nOpenNodes = 0;
+
+    algorithmFPType sumG = 0;
+    algorithmFPType sumH = 0;
+    for (size_t i = 0; i < _nRows; ++i)
+    {
+        _rows[i] = (int)i;
+        sumG += g[i];
+        sumH += h[i];
+    }
+    _nNodes = 1;
+    initNode(_nodes[0], 0, _nRows, 0, sumG, sumH);
+
+    bool isOk = true;
+    if (canGrow(0))
+    {
+        Node &root = _nodes[0];
+        root.hist = getHistogram();
+        isOk = root.hist && buildHistogram(root);
+        if (isOk)
+        {
+            findSplit(root);
+            if (root.splitFeature >= 0) { _openNodes[_nOpenNodes++] = 0; }
+            else
+            {
+                releaseHistogram(root.hist);
+                root.hist = NULL;
+            }
+        }
+    }
+
+    size_t nLeaves = 1;
+    while (isOk && _nOpenNodes && (!_par.maxLeaves || nLeaves < _par.maxLeaves))
+    {
+        /* The depth-wise growth splits the nodes in the order they are created, the leaf-wise growth
+           splits the node with the largest loss reduction */
+        size_t iOpen = 0;
+        if (_par.growthPolicy == leafWise)
+        {
+            for (size_t i = 1; i < _nOpenNodes; ++i)
+            {
+                if (_nodes[_openNodes[i]].gain > _nodes[_openNodes[iOpen]].gain) { iOpen = i; }
+            }
+        }
+        const size_t iNode = _openNodes[iOpen];
+        for (size_t i = iOpen + 1; i < _nOpenNodes; ++i) { _openNodes[i - 1] = _openNodes[i]; }
+        --_nOpenNodes;
+
+        isOk = splitNode(iNode);
+        ++nLeaves;
+    }
+
+    /* The nodes that are not split become the leaves */
+    for (size_t i = 0; i < _nNodes; ++i)
+    {
+        Node &node = _nodes[i];
+        if (node.hist)
+        {
+            releaseHistogram(node.hist);
+            node.hist = NULL;
+        }
+    }
+    return isOk;
+}
+
+template <typename algorithmFPType, typename BinType, CpuType cpu>
+void TreeBuilder<algorithmFPType, BinType, cpu>::updateScores(algorithmFPType *scores, size_t nTrees) const
+{
+    for (size_t i = 0; i < _nNodes; ++i)
+    {
+        const Node &node = _nodes[i];
+        if (node.left >= 0) { continue; }
+        const algorithmFPType value = getLeafValue(node);
+        for (size_t j = node.begin; j < node.end; ++j) { scores[_rows[j] * nTrees] += value; }
+    }
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+void GBTTrainKernel<method, algorithmFPType, cpu>::compute(const NumericTable *x, const NumericTable *y, const NumericTable *w,
+                                                           gbt::Model *m, const Parameter *par)
+{
+    if (par->maxBins <= 256) { train<unsigned char>(x, y, w, m, par); }
+    else { train<unsigned short>(x, y, w, m, par); }
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+template <typename BinType>
+void GBTTrainKernel<method, algorithmFPType, cpu>::train(const NumericTable *x, const NumericTable *y, const NumericTable *w,
+                                                         gbt::Model *m, const Parameter *par)
+{
+    typedef TreeBuilder<algorithmFPType, BinType, cpu> Builder;
+    typedef typename Builder::Node Node;
+
+    const size_t nRows = x->getNumberOfRows();
+    const size_t nFeatures = x->getNumberOfColumns();
+    const LossFunction lossFunction = par->lossFunction;
+    const size_t nTrees = (lossFunction == crossEntropy && par->nClasses > 2) ? par->nClasses : 1;
+
+    ReadRows<algorithmFPType, cpu> labelsRows(const_cast<NumericTable *>(y), 0, nRows);
+    ReadRows<algorithmFPType, cpu> weightsRows(const_cast<NumericTable *>(w), 0, nRows);
+    const algorithmFPType * const labels = labelsRows.get();
+    const algorithmFPType * const weights = weightsRows.get();
+
+    TArray<int, cpu> classesArray(lossFunction == crossEntropy ? nRows : 0);
+    TArray<algorithmFPType, cpu> scoresArray(nRows * nTrees);
+    TArray<algorithmFPType, cpu> gArray(nRows * nTrees);
+    TArray<algorithmFPType, cpu> hArray(nRows * nTrees);
+    TArray<algorithmFPType, cpu> initialScoresArray(nTrees);
+    TArray<BinType, cpu> binsArray(nRows * nFeatures);
+    TArray<size_t, cpu> binOffsets;
+    TArray<algorithmFPType, cpu> borders;
+    int * const classes = classesArray.get();
+    algorithmFPType * const scores = scoresArray.get();
+    algorithmFPType * const g = gArray.get();
+    algorithmFPType * const h = hArray.get();
+    algorithmFPType * const initialScores = initialScoresArray.get();
+    BinType * const bins = binsArray.get();
+    if ((lossFunction == crossEntropy && !classes) || !scores || !g || !h || !initialScores || !bins)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    /* Initial scores: the mean of the dependent variable, the log-odds or the logarithms of the class frequencies */
+    algorithmFPType sumWeights = 0;
+    for (size_t i = 0; i < nRows; ++i) { sumWeights += weights ? weights[i] : 1; }
+    if (lossFunction == squared)
+    {
+        algorithmFPType sum = 0;
+        for (size_t i = 0; i < nRows; ++i) { sum += (weights ? weights[i] : 1) * labels[i]; }
+        initialScores[0] = sum / sumWeights;
+    }
+    else
+    {
+        const size_t nClasses = par->nClasses;
+        TArray<algorithmFPType, cpu> frequenciesArray(nClasses);
+        algorithmFPType * const frequencies = frequenciesArray.get();
+        if (!frequencies)
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+        for (size_t k = 0; k < nClasses; ++k) { frequencies[k] = 0; }
+        for (size_t i = 0; i < nRows; ++i)
+        {
+            classes[i] = (int)labels[i];
+            if (classes[i] < 0 || classes[i] >= (int)nClasses || (algorithmFPType)classes[i] != labels[i])
+            {
+                this->_errors->add(services::ErrorIncorrectClassLabels);
+                return;
+            }
+            frequencies[classes[i]] += weights ? weights[i] : 1;
+        }
+        const algorithmFPType minFrequency = 1e-6;
+        for (size_t k = 0; k < nClasses; ++k)
+        {
+            frequencies[k] = max<cpu>(frequencies[k] / sumWeights, minFrequency);
+        }
+        if (nTrees == 1)
+        {
+            initialScores[0] = daal::internal::Math<algorithmFPType, cpu>::sLog(frequencies[1] / frequencies[0]);
+        }
+        else
+        {
+            for (size_t k = 0; k < nTrees; ++k) { initialScores[k] = daal::internal::Math<algorithmFPType, cpu>::sLog(frequencies[k]); }
+        }
+    }
+    for (size_t i = 0; i < nRows; ++i)
+    {
+        for (size_t k = 0; k < nTrees; ++k) { scores[i * nTrees + k] = initialScores[k]; }
+    }
+
+    if (!computeBinBorders<algorithmFPType, cpu>(*x, par->maxBins, binOffsets, borders))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    quantizeData<algorithmFPType, BinType, cpu>(*x, binOffsets.get(), borders.get(), bins);
+
+    const size_t histSize = 3 * binOffsets[nFeatures];
+    typename Builder::LocalHistograms localHistograms([=]()-> LocalHistogram<algorithmFPType> *
+    {
+        LocalHistogram<algorithmFPType> * const ptr = service_scalable_calloc<LocalHistogram<algorithmFPType>, cpu>(1);
+        if (ptr)
+        {
+            ptr->hist = service_scalable_malloc<algorithmFPType, cpu>(histSize);
+            if (ptr->hist) { return ptr; }
+            service_scalable_free<LocalHistogram<algorithmFPType>, cpu>(ptr);
+        }
+        return nullptr;
+    } );
+
+    Builder builder(*par, nRows, nFeatures, bins, binOffsets.get(), localHistograms);
+    services::Collection<int> splitFeatures;
+    services::Collection<algorithmFPType> nodeValues;
+    services::Collection<int> leftChildren;
+    services::Collection<int> treeOffsets;
+    treeOffsets.push_back(0);
+
+    bool isOk = builder.init();
+    for (size_t iteration = 0; iteration < par->maxIterations && isOk; ++iteration)
+    {
+        isOk = computeGradients<algorithmFPType, cpu>(lossFunction, nRows, nTrees, labels, classes, weights, scores, g, h);
+        for (size_t k = 0; k < nTrees && isOk; ++k)
+        {
+            isOk = builder.build(g + k * nRows, h + k * nRows);
+            if (!isOk) { break; }
+            builder.updateScores(scores + k, nTrees);
+
+            const Node * const nodes = builder.getNodes();
+            for (size_t i = 0; i < builder.getNumberOfNodes(); ++i)
+            {
+                const Node &node = nodes[i];
+                if (node.left >= 0)
+                {
+                    splitFeatures.push_back(node.splitFeature);
+                    nodeValues.push_back(borders[binOffsets[node.splitFeature] + node.splitBin]);
+                    leftChildren.push_back(node.left);
+                }
+                else
+                {
+                    splitFeatures.push_back(-1);
+                    nodeValues.push_back(builder.getLeafValue(node));
+                    leftChildren.push_back(-1);
+                }
+            }
+            treeOffsets.push_back((int)splitFeatures.size());
+        }
+    }
+
+    localHistograms.reduce([=](LocalHistogram<algorithmFPType> *ptr) -> void
+    {
+        if (ptr)
+        {
+            service_scalable_free<algorithmFPType, cpu>(ptr->hist);
+            service_scalable_free<LocalHistogram<algorithmFPType>, cpu>(ptr);
+        }
+    } );
+
+    if (!isOk)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    /* Store the trees in the model */
+    m->setNFeatures(nFeatures);
+    m->setLossFunction(lossFunction, nTrees);
+
+    const size_t nNodes = splitFeatures.size();
+    NumericTablePtr splitFeaturesTable = m->getSplitFeatures();
+    NumericTablePtr nodeValuesTable = m->getNodeValues();
+    NumericTablePtr leftChildrenTable = m->getLeftChildren();
+    NumericTablePtr treeOffsetsTable = m->getTreeOffsets();
+    NumericTablePtr initialScoresTable = m->getInitialScores();
+    splitFeaturesTable->setNumberOfRows(nNodes);
+    splitFeaturesTable->allocateDataMemory();
+    nodeValuesTable->setNumberOfRows(nNodes);
+    nodeValuesTable->allocateDataMemory();
+    leftChildrenTable->setNumberOfRows(nNodes);
+    leftChildrenTable->allocateDataMemory();
+    treeOffsetsTable->setNumberOfRows(treeOffsets.size());
+    treeOffsetsTable->allocateDataMemory();
+    initialScoresTable->setNumberOfRows(nTrees);
+    initialScoresTable->allocateDataMemory();
+
+    WriteOnlyRows<int, cpu> splitFeaturesRows(*splitFeaturesTable, 0, nNodes);
+    WriteOnlyRows<algorithmFPType, cpu> nodeValuesRows(*nodeValuesTable, 0, nNodes);
+    WriteOnlyRows<int, cpu> leftChildrenRows(*leftChildrenTable, 0, nNodes);
+    WriteOnlyRows<int, cpu> treeOffsetsRows(*treeOffsetsTable, 0, treeOffsets.size());
+    WriteOnlyRows<algorithmFPType, cpu> initialScoresRows(*initialScoresTable, 0, nTrees);
+    int * const dstSplitFeatures = splitFeaturesRows.get();
+    algorithmFPType * const dstNodeValues = nodeValuesRows.get();
+    int * const dstLeftChildren = leftChildrenRows.get();
+    int * const dstTreeOffsets = treeOffsetsRows.get();
+    algorithmFPType * const dstInitialScores = initialScoresRows.get();
+    if (!dstSplitFeatures || !dstNodeValues || !dstLeftChildren || !dstTreeOffsets || !dstInitialScores)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    for (size_t i = 0; i < nNodes; ++i)
+    {
+        dstSplitFeatures[i] = splitFeatures[i];
+        dstNodeValues[i] = nodeValues[i];
+        dstLeftChildren[i] = leftChildren[i];
+    }
+    for (size_t i = 0; i < treeOffsets.size(); ++i) { dstTreeOffsets[i] = treeOffsets[i]; }
+    for (size_t k = 0; k < nTrees; ++k) { dstInitialScores[k] = initialScores[k]; }
+}
+
+} // namespace internal
+} // namespace training
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,65 @@
+/* file: gbt_train_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that contain the gradient boosted trees training functions.
+//--
+*/
+
+#ifndef __GBT_TRAIN_KERNEL_H__
+#define __GBT_TRAIN_KERNEL_H__
+
+#include "numeric_table.h"
+#include "model.h"
+#include "daal_defines.h"
+#include "gbt_training_types.h"
+#include "kernel.h"
+
+#define __GBT_ROW_BLOCK_SIZE 1024          // Rows per task of the parallel quantization and gradient computation.
+#define __GBT_HISTOGRAM_BLOCK_SIZE 4096    // Rows per task of the parallel histogram building, smaller nodes are processed in one task.
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace training
+{
+namespace internal
+{
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+struct GBTTrainKernel : public Kernel
+{
+    void compute(const NumericTable *x, const NumericTable *y, const NumericTable *w, gbt::Model *m, const Parameter *par);
+
+private:
+    template <typename BinType>
+    void train(const NumericTable *x, const NumericTable *y, const NumericTable *w, gbt::Model *m, const Parameter *par);
+};
+
+} // namespace internal
+} // namespace training
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -47,13 +47,13 @@ Model::~Model()
 void Model::serializeImpl(data_management::InputDataArchive  * arch)
 {
     daal::algorithms::Model::serialImpl<data_management::InputDataArchive, false>(arch);
-    _impl->serialImpl<data_management::InputDataArchive, false>(arch);
+    _impl->serialImpl<data_management::InputDataArchive, false>(arch, _nFeatures);
 }
 
 void Model::deserializeImpl(data_management::OutputDataArchive * arch)
 {
     daal::algorithms::Model::serialImpl<data_management::OutputDataArchive, true>(arch);
-    _impl->serialImpl<data_management::OutputDataArchive, true>(arch);
+    _impl->serialImpl<data_management::OutputDataArchive, true>(arch, _nFeatures);
 }
 
 } // namespace interface1
@@ -35,6 +35,14 @@ namespace kdtree_knn_classification
 namespace interface1
 {
 
+/* The short layout of the model archive holds the KD-tree, the training data and the training labels only,
+   and starts with the index of the root node. The extended layout starts with the marker that is never a valid
+   index of the node followed by the version of the layout, and holds the number of features, the inverted file index
+   and the leaf blocks after the members of the short layout */
+const size_t modelLayoutMarker = (size_t)-1;
+const size_t shortModelLayoutVersion = 0;
+const size_t extendedModelLayoutVersion = 1;
+
 struct KDTreeNode
 {
     size_t dimension;
@@ -62,7 +70,8 @@ public:
     /**
      * Empty constructor for deserialization
      */
-    ModelImpl() : _kdTreeTable(), _rootNodeIndex(0), _lastNodeIndex(0), _data(), _labels() {}
+    ModelImpl() : _kdTreeTable(), _rootNodeIndex(0), _lastNodeIndex(0), _data(), _labels(), _ivfCentroids(), _ivfListOffsets(), _indices(),
+        _leafBlocks(), _leafBlockOffsets() {}
 
     /**
      * Returns the KD-tree table
@@ -118,14 +127,45 @@ public:
      */
     data_management::NumericTablePtr getData() { return _data; }
 
+    /**
+     * Serializes the model implementation
+     * \param[in] arch           Data archive
+     * \param[in] nFeatures      Number of features in the training data
+     */
     template<typename Archive, bool onDeserialize>
-    void serialImpl(Archive * arch)
+    void serialImpl(Archive * arch, size_t & nFeatures)
     {
-        arch->set(_rootNodeIndex);
+        /* The archive of the short layout starts with the index of the root node */
+        size_t layoutVersion = extendedModelLayoutVersion;
+        size_t markerOrRootNodeIndex = modelLayoutMarker;
+        arch->set(markerOrRootNodeIndex);
+        if (markerOrRootNodeIndex == modelLayoutMarker)
+        {
+            arch->set(layoutVersion);
+            arch->set(_rootNodeIndex);
+        }
+        else
+        {
+            _rootNodeIndex = markerOrRootNodeIndex;
+            layoutVersion = shortModelLayoutVersion;
+        }
         arch->set(_lastNodeIndex);
         arch->setSharedPtrObj(_kdTreeTable);
         arch->setSharedPtrObj(_data);
         arch->setSharedPtrObj(_labels);
+
+        if (layoutVersion == shortModelLayoutVersion)
+        {
+            nFeatures = (_data ? _data->getNumberOfColumns() : 0);
+            return;
+        }
+
+        arch->set(nFeatures);
+        arch->setSharedPtrObj(_ivfCentroids);
+        arch->setSharedPtrObj(_ivfListOffsets);
+        arch->setSharedPtrObj(_indices);
+        arch->setSharedPtrObj(_leafBlocks);
+        arch->setSharedPtrObj(_leafBlockOffsets);
     }
 
     /**
@@ -206,12 +246,79 @@ public:
         }
     }
 
+    /**
+     * Returns the centroids of the clusters of the inverted file index
+     * \return Centroids of the clusters, one centroid per row
+     */
+    data_management::NumericTableConstPtr getIVFCentroids() const { return _ivfCentroids; }
+
+    /**
+    *  Sets the centroids of the clusters of the inverted file index
+    *  \param[in]  value  Centroids of the clusters, one centroid per row
+    */
+    void setIVFCentroids(const data_management::NumericTablePtr & value) { _ivfCentroids = value; }
+
+    /**
+     * Returns the offsets of the clusters of the inverted file index
+     * \return Table of the number of clusters plus one rows. The training observations of the cluster i are stored
+     *         in the rows from the value in the row i to the value in the row i + 1 of the training data
+     */
+    data_management::NumericTableConstPtr getIVFListOffsets() const { return _ivfListOffsets; }
+
+    /**
+    *  Sets the offsets of the clusters of the inverted file index
+    *  \param[in]  value  Offsets of the clusters in the training data
+    */
+    void setIVFListOffsets(const data_management::NumericTablePtr & value) { _ivfListOffsets = value; }
+
+    /**
+     * Returns the indices of the training observations in the input training data
+     * \return Table with the index of the input observation stored in the row i of the training data in the row i,
+     *         or an empty pointer if the training data keeps the order of the input
+     */
+    data_management::NumericTableConstPtr getIndices() const { return _indices; }
+
+    /**
+    *  Sets the indices of the training observations in the input training data
+    *  \param[in]  value  Indices of the training observations
+    */
+    void setIndices(const data_management::NumericTablePtr & value) { _indices = value; }
+
+    /**
+     * Returns the training observations of the leaves of the KD-tree packed into blocks
+     * \return Table with one block per row, the values of one feature are contiguous within the block
+     */
+    data_management::NumericTableConstPtr getLeafBlocks() const { return _leafBlocks; }
+
+    /**
+    *  Sets the training observations of the leaves of the KD-tree packed into blocks
+    *  \param[in]  value  Table with one block per row
+    */
+    void setLeafBlocks(const data_management::NumericTablePtr & value) { _leafBlocks = value; }
+
+    /**
+     * Returns the rows of the first blocks of the leaves of the KD-tree
+     * \return Table with the row of the leaf blocks table that holds the first block of the leaf per KD-tree node
+     */
+    data_management::NumericTableConstPtr getLeafBlockOffsets() const { return _leafBlockOffsets; }
+
+    /**
+    *  Sets the rows of the first blocks of the leaves of the KD-tree
+    *  \param[in]  value  Rows of the first blocks of the leaves per KD-tree node
+    */
+    void setLeafBlockOffsets(const data_management::NumericTablePtr & value) { _leafBlockOffsets = value; }
+
 private:
     services::SharedPtr<KDTreeTable> _kdTreeTable;
     size_t _rootNodeIndex;
     size_t _lastNodeIndex;
     data_management::NumericTablePtr _data;
     data_management::NumericTablePtr _labels;
+    data_management::NumericTablePtr _ivfCentroids;
+    data_management::NumericTablePtr _ivfListOffsets;
+    data_management::NumericTablePtr _indices;
+    data_management::NumericTablePtr _leafBlocks;
+    data_management::NumericTablePtr _leafBlockOffsets;
 };
 
 } // namespace interface1
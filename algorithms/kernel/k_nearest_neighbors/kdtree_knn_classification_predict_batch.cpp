@@ -23,6 +23,7 @@
 
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_predict_types.h"
 #include "kdtree_knn_classification_model_impl.h"
+#include "serialization_utils.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -37,6 +38,7 @@ namespace prediction
 {
 namespace interface1
 {
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_K_NEAREST_NEIGHBOR_PREDICTION_RESULT_ID);
 
 /** Default constructor */
 Input::Input() : classifier::prediction::Input() {}
@@ -86,6 +88,28 @@ void Input::check(const daal::algorithms::Parameter *parameter, int method) cons
     errors.setCanThrow(false);
     DAAL_CHECK(checkNumericTable(m->impl()->getData().get(), &errors, dataStr()), ErrorModelNotFullInitialized);
     DAAL_CHECK(checkNumericTable(m->impl()->getLabels().get(), &errors, labelsStr()), ErrorModelNotFullInitialized);
+
+    /* Exactly k neighbors are reported for every observation */
+    const kdtree_knn_classification::Parameter *const par = static_cast<const kdtree_knn_classification::Parameter *>(parameter);
+    if (par->resultsToCompute & (computeIndicesOfNeighbors | computeDistances))
+    {
+        DAAL_CHECK_EX(par->k <= m->impl()->getData()->getNumberOfRows(), ErrorIncorrectParameter, ParameterName, kStr());
+    }
+
+    if (method == ivfDense)
+    {
+        const size_t nLists = (m->impl()->getIVFCentroids() ? m->impl()->getIVFCentroids()->getNumberOfRows() : 0);
+        DAAL_CHECK(nLists > 0, ErrorModelNotFullInitialized);
+        DAAL_CHECK(checkNumericTable(m->impl()->getIVFCentroids().get(), &errors, ivfCentroidsStr(), 0, 0,
+                                     m->impl()->getData()->getNumberOfColumns(), nLists), ErrorModelNotFullInitialized);
+        DAAL_CHECK(checkNumericTable(m->impl()->getIVFListOffsets().get(), &errors, ivfListOffsetsStr(), 0, 0, 1, nLists + 1),
+                   ErrorModelNotFullInitialized);
+        return;
+    }
+
+    /* The KD-tree is optional for the brute force search */
+    if (method != defaultDense && !m->impl()->getKDTreeTable()) { return; }
+
     DAAL_CHECK(checkNumericTable(m->impl()->getKDTreeTable().get(), &errors, kdTreeTableStr(), 0, NumericTableIface::aos, 4),
                ErrorModelNotFullInitialized);
     const auto kdTreeNumberOfRows = m->impl()->getKDTreeTable()->getNumberOfRows();
@@ -93,6 +117,55 @@ void Input::check(const daal::algorithms::Parameter *parameter, int method) cons
     DAAL_CHECK(m->impl()->getRootNodeIndex() < kdTreeNumberOfRows, ErrorModelNotFullInitialized);
 }
 
+Result::Result() : classifier::prediction::Result(3) {}
+
+/**
+ * Returns the result of the KD-tree based kNN model-based prediction
+ * \param[in] id   Identifier of the result
+ * \return         Result that corresponds to the given identifier
+ */
+NumericTablePtr Result::get(ResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the result of the KD-tree based kNN model-based prediction
+ * \param[in] id       Identifier of the result
+ * \param[in] value    Pointer to the result
+ */
+void Result::set(ResultId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the results of the KD-tree based kNN model-based prediction
+ * \param[in] input       Pointer to the input objects of the algorithm
+ * \param[in] parameter   Pointer to the parameters of the algorithm
+ * \param[in] method      Computation method
+ */
+void Result::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const
+{
+    const kdtree_knn_classification::Parameter *const par = static_cast<const kdtree_knn_classification::Parameter *>(parameter);
+    if (par->resultsToCompute & (computeClassLabels | computeResponses))
+    {
+        classifier::prediction::Result::check(input, parameter, method);
+        if(this->_errors->size() != 0) { return; }
+    }
+
+    const size_t nRows = (static_cast<const classifier::prediction::InputIface *>(input))->getNumberOfRows();
+    const int unexpectedLayouts = (int)NumericTableIface::csrArray;
+    if (par->resultsToCompute & computeIndicesOfNeighbors)
+    {
+        if (!checkNumericTable(get(indices).get(), this->_errors.get(), indicesStr(), unexpectedLayouts, 0, par->k, nRows)) { return; }
+    }
+    if (par->resultsToCompute & computeDistances)
+    {
+        if (!checkNumericTable(get(distances).get(), this->_errors.get(), distancesStr(), unexpectedLayouts, 0, par->k, nRows)) { return; }
+    }
+}
+
 } // namespace interface1
 } // namespace prediction
 } // namespace kdtree_knn_classification
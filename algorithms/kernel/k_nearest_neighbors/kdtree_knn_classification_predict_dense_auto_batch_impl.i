@@ -0,0 +1,66 @@
+/* file: kdtree_knn_classification_predict_dense_auto_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of K-Nearest Neighbors prediction with the automatic choice between the KD-tree and brute force search.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_PREDICT_DENSE_AUTO_BATCH_IMPL_I__
+#define __KDTREE_KNN_CLASSIFICATION_PREDICT_DENSE_AUTO_BATCH_IMPL_I__
+
+#include "kdtree_knn_classification_predict_dense_brute_force_batch_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+
+template<typename algorithmFpType, CpuType cpu>
+void KNNClassificationPredictKernel<algorithmFpType, autoDense, cpu>::
+    compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, NumericTable * indices, NumericTable * distances,
+            const daal::algorithms::Parameter * par)
+{
+    const kdtree_knn_classification::Parameter * const parameter = static_cast<const kdtree_knn_classification::Parameter *>(par);
+    const Model * const model = static_cast<const Model *>(m);
+    const NumericTable & data = *(model->impl()->getData());
+
+    const bool hasKDTree = model->impl()->getKDTreeTable() && (model->impl()->getKDTreeTable()->getNumberOfRows() > 0);
+    if (hasKDTree && isKDTreeSearchPreferable(data.getNumberOfRows(), data.getNumberOfColumns(), parameter->k))
+    {
+        KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::compute(x, m, y, indices, distances, par);
+    }
+    else
+    {
+        KNNClassificationPredictKernel<algorithmFpType, bruteForceDense, cpu>::compute(x, m, y, indices, distances, par);
+    }
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,245 @@
+/* file: kdtree_knn_classification_predict_dense_brute_force_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the brute force search of K-Nearest Neighbors.
+//
+//  The squared distances between a block of input observations and a block
+//  of training observations are computed as (x,x) + (y,y) - 2(x,y) with a
+//  single gemm call. The rows of the block of distances are pushed into the
+//  heaps of the nearest neighbors right after the block is computed.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_PREDICT_DENSE_BRUTE_FORCE_BATCH_IMPL_I__
+#define __KDTREE_KNN_CLASSIFICATION_PREDICT_DENSE_BRUTE_FORCE_BATCH_IMPL_I__
+
+#include "service_blas.h"
+#include "service_numeric_table.h"
+#include "kdtree_knn_classification_predict_dense_default_batch_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+
+template<typename algorithmFpType, CpuType cpu>
+void KNNClassificationPredictKernel<algorithmFpType, bruteForceDense, cpu>::
+    compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, NumericTable * indices, NumericTable * distances,
+            const daal::algorithms::Parameter * par)
+{
+    typedef GlobalNeighbors<algorithmFpType, cpu> Neighbors;
+    typedef Heap<Neighbors, cpu> MaxHeap;
+
+    const kdtree_knn_classification::Parameter * const parameter = static_cast<const kdtree_knn_classification::Parameter *>(par);
+    const Model * const model = static_cast<const Model *>(m);
+    const size_t k = parameter->k;
+    const NumericTable & data = *(model->impl()->getData());
+    const NumericTable & labels = *(model->impl()->getLabels());
+
+    /* Indices of the training observations in the input training data, absent if the training keeps the order of the input */
+    NumericTable * const dataIndicesTable = const_cast<NumericTable *>(model->impl()->getIndices().get());
+    ReadRows<int, cpu> dataIndicesRows(dataIndicesTable, 0, (dataIndicesTable ? dataIndicesTable->getNumberOfRows() : 0));
+    const int * const dataIndices = dataIndicesRows.get();
+
+    size_t iSize = 1;
+    while (iSize < k) { iSize *= 2; }
+    const size_t heapSize = (iSize / 16 + 1) * 16;
+
+    const size_t xRowCount = x->getNumberOfRows();
+    const size_t xColumnCount = x->getNumberOfColumns();
+    const size_t yColumnCount = (y ? y->getNumberOfColumns() : 0);
+    const size_t dataRowCount = data.getNumberOfRows();
+
+    const size_t xBlockSize = __BRUTE_FORCE_QUERY_BLOCK_SIZE;
+    const size_t dataBlockSize = __BRUTE_FORCE_REFERENCE_BLOCK_SIZE;
+    const size_t xBlockCount = (xRowCount + xBlockSize - 1) / xBlockSize;
+    const size_t dataBlockCount = (dataRowCount + dataBlockSize - 1) / dataBlockSize;
+
+    /* Squared norms of the training observations */
+    TArray<algorithmFpType, cpu> dataNormsArray(dataRowCount);
+    algorithmFpType * const dataNorms = dataNormsArray.get();
+    if (!dataNorms)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    daal::threader_for(dataBlockCount, dataBlockCount, [=, &data](size_t iBlock)
+    {
+        const size_t first = iBlock * dataBlockSize;
+        const size_t last = min<cpu>(first + dataBlockSize, dataRowCount);
+
+        data_management::BlockDescriptor<algorithmFpType> dataBD;
+        const_cast<NumericTable &>(data).getBlockOfRows(first, last - first, readOnly, dataBD);
+        const algorithmFpType * const dx = dataBD.getBlockPtr();
+        for (size_t i = 0; i < last - first; ++i)
+        {
+            algorithmFpType sum = 0;
+            for (size_t j = 0; j < xColumnCount; ++j)
+            {
+                sum += dx[i * xColumnCount + j] * dx[i * xColumnCount + j];
+            }
+            dataNorms[first + i] = sum;
+        }
+        const_cast<NumericTable &>(data).releaseBlockOfRows(dataBD);
+    } );
+
+    struct Local
+    {
+        MaxHeap * heaps;
+        algorithmFpType * distances;
+    };
+    daal::tls<Local *> localTLS([=]()-> Local *
+    {
+        Local * const ptr = service_scalable_calloc<Local, cpu>(1);
+        if (ptr)
+        {
+            ptr->heaps = service_scalable_calloc<MaxHeap, cpu>(xBlockSize);
+            ptr->distances = service_scalable_malloc<algorithmFpType, cpu>(xBlockSize * dataBlockSize);
+            bool isOk = (ptr->heaps && ptr->distances);
+            for (size_t i = 0; isOk && i < xBlockSize; ++i)
+            {
+                isOk = ptr->heaps[i].init(heapSize);
+            }
+            if (isOk) { return ptr; }
+
+            if (ptr->heaps)
+            {
+                for (size_t i = 0; i < xBlockSize; ++i) { ptr->heaps[i].clear(); }
+                service_scalable_free<MaxHeap, cpu>(ptr->heaps);
+            }
+            service_scalable_free<algorithmFpType, cpu>(ptr->distances);
+            service_scalable_free<Local, cpu>(ptr);
+        }
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return nullptr;
+    } );
+
+    daal::threader_for(xBlockCount, xBlockCount, [=, &localTLS, &data, &labels](size_t iBlock)
+    {
+        Local * const local = localTLS.local();
+        if (!local) { return; }
+
+        const size_t first = iBlock * xBlockSize;
+        const size_t last = min<cpu>(first + xBlockSize, xRowCount);
+        const size_t xBlockRowCount = last - first;
+
+        data_management::BlockDescriptor<algorithmFpType> xBD;
+        const_cast<NumericTable &>(*x).getBlockOfRows(first, xBlockRowCount, readOnly, xBD);
+        const algorithmFpType * const dx = xBD.getBlockPtr();
+
+        algorithmFpType xNorms[xBlockSize];
+        for (size_t i = 0; i < xBlockRowCount; ++i)
+        {
+            algorithmFpType sum = 0;
+            for (size_t j = 0; j < xColumnCount; ++j)
+            {
+                sum += dx[i * xColumnCount + j] * dx[i * xColumnCount + j];
+            }
+            xNorms[i] = sum;
+            local->heaps[i].reset();
+        }
+
+        for (size_t iDataBlock = 0; iDataBlock < dataBlockCount; ++iDataBlock)
+        {
+            const size_t dataFirst = iDataBlock * dataBlockSize;
+            const size_t dataBlockRowCount = min<cpu>(dataFirst + dataBlockSize, dataRowCount) - dataFirst;
+
+            data_management::BlockDescriptor<algorithmFpType> dataBD;
+            const_cast<NumericTable &>(data).getBlockOfRows(dataFirst, dataBlockRowCount, readOnly, dataBD);
+
+            /* distances = -2 * x * data^T, stored by rows of x */
+            char transa = 'T', transb = 'N';
+            DAAL_INT mm = dataBlockRowCount, nn = xBlockRowCount, kk = xColumnCount;
+            DAAL_INT lda = xColumnCount, ldb = xColumnCount, ldc = dataBlockRowCount;
+            algorithmFpType alpha = -2.0, beta = 0.0;
+            Blas<algorithmFpType, cpu>::xxgemm(&transa, &transb, &mm, &nn, &kk, &alpha, dataBD.getBlockPtr(), &lda,
+                                               const_cast<algorithmFpType *>(dx), &ldb, &beta, local->distances, &ldc);
+            const_cast<NumericTable &>(data).releaseBlockOfRows(dataBD);
+
+            for (size_t i = 0; i < xBlockRowCount; ++i)
+            {
+                MaxHeap & heap = local->heaps[i];
+                algorithmFpType * const distances = local->distances + i * dataBlockRowCount;
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < dataBlockRowCount; ++j)
+                {
+                    const algorithmFpType distance = distances[j] + xNorms[i] + dataNorms[dataFirst + j];
+                    distances[j] = (distance > 0 ? distance : 0);
+                }
+
+                Neighbors curNeighbor;
+                for (size_t j = 0; j < dataBlockRowCount; ++j)
+                {
+                    if (heap.size() < k)
+                    {
+                        curNeighbor.distance = distances[j];
+                        curNeighbor.index = dataFirst + j;
+                        heap.push(curNeighbor, k);
+                    }
+                    else if (heap.getMax()->distance > distances[j])
+                    {
+                        curNeighbor.distance = distances[j];
+                        curNeighbor.index = dataFirst + j;
+                        heap.replaceMax(curNeighbor);
+                    }
+                }
+            }
+        }
+        const_cast<NumericTable &>(*x).releaseBlockOfRows(xBD);
+
+        WriteOnlyRows<algorithmFpType, cpu> yRows(y, first, xBlockRowCount);
+        WriteOnlyRows<int, cpu> indicesRows(indices, first, xBlockRowCount);
+        WriteOnlyRows<algorithmFpType, cpu> distancesRows(distances, first, xBlockRowCount);
+        algorithmFpType * const dy = yRows.get();
+        int * const di = indicesRows.get();
+        algorithmFpType * const dd = distancesRows.get();
+        for (size_t i = 0; i < xBlockRowCount; ++i)
+        {
+            this->predict(dy ? dy + i * yColumnCount : nullptr, di ? di + i * k : nullptr, dd ? dd + i * k : nullptr, local->heaps[i],
+                          dataIndices, labels, *parameter);
+        }
+    } );
+
+    localTLS.reduce([=](Local * ptr) -> void
+    {
+        if (ptr)
+        {
+            for (size_t i = 0; i < xBlockSize; ++i) { ptr->heaps[i].clear(); }
+            service_scalable_free<MaxHeap, cpu>(ptr->heaps);
+            service_scalable_free<algorithmFpType, cpu>(ptr->distances);
+            service_scalable_free<Local, cpu>(ptr);
+        }
+    } );
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
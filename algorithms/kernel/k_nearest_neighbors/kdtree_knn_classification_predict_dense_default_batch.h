@@ -53,6 +53,7 @@ using namespace daal::data_management;
 template <typename algorithmFpType, CpuType cpu> struct GlobalNeighbors;
 template <typename T, CpuType cpu> class Heap;
 template <typename algorithmFpType> struct SearchNode;
+template <typename algorithmFpType, CpuType cpu> class LeafBlocks;
 
 template <typename algorithmFpType, prediction::Method method, CpuType cpu>
 class KNNClassificationPredictKernel : public daal::algorithms::Kernel
@@ -62,15 +63,47 @@ template <typename algorithmFpType, CpuType cpu>
 class KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu> : public daal::algorithms::Kernel
 {
 public:
-    void compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, const daal::algorithms::Parameter * par);
+    void compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, NumericTable * indices, NumericTable * distances,
+                 const daal::algorithms::Parameter * par);
 
 protected:
     void findNearestNeighbors(const algorithmFpType * query, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
                               kdtree_knn_classification::internal::Stack<SearchNode<algorithmFpType>, cpu> & stack, size_t k, algorithmFpType radius,
-                              const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex, const NumericTable & data);
+                              const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex, const LeafBlocks<algorithmFpType, cpu> & leafBlocks);
 
-    void predict(algorithmFpType & predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, const NumericTable & labels,
-                 size_t k);
+    void predict(algorithmFpType * predictedClass, int * indices, algorithmFpType * distances, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
+                 const int * dataIndices, const NumericTable & labels, const kdtree_knn_classification::Parameter & parameter);
+};
+
+template <typename algorithmFpType, CpuType cpu>
+class KNNClassificationPredictKernel<algorithmFpType, bruteForceDense, cpu> :
+    public KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>
+{
+public:
+    void compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, NumericTable * indices, NumericTable * distances,
+                 const daal::algorithms::Parameter * par);
+};
+
+template <typename algorithmFpType, CpuType cpu>
+class KNNClassificationPredictKernel<algorithmFpType, ivfDense, cpu> :
+    public KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>
+{
+public:
+    void compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, NumericTable * indices, NumericTable * distances,
+                 const daal::algorithms::Parameter * par);
+
+protected:
+    void scanList(const algorithmFpType * query, const algorithmFpType * const * columns, size_t columnCount, size_t first, size_t last,
+                  Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, size_t k);
+};
+
+template <typename algorithmFpType, CpuType cpu>
+class KNNClassificationPredictKernel<algorithmFpType, autoDense, cpu> :
+    public KNNClassificationPredictKernel<algorithmFpType, bruteForceDense, cpu>
+{
+public:
+    void compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, NumericTable * indices, NumericTable * distances,
+                 const daal::algorithms::Parameter * par);
 };
 
 } // namespace internal
@@ -50,17 +50,24 @@ template <typename algorithmFpType, Method method, CpuType cpu>
 void BatchContainer<algorithmFpType, method, cpu>::compute()
 {
     const classifier::prediction::Input * const input = static_cast<const classifier::prediction::Input *>(_in);
-    classifier::prediction::Result * const result = static_cast<classifier::prediction::Result *>(_res);
+    Result * const result = static_cast<Result *>(_res);
 
     const data_management::NumericTableConstPtr a = input->get(classifier::prediction::data);
     const services::SharedPtr<const classifier::Model> m = input->get(classifier::prediction::model);
-    const data_management::NumericTablePtr r = result->get(classifier::prediction::prediction);
-
     const daal::algorithms::Parameter * const par = _par;
+    const DAAL_UINT64 resultsToCompute = static_cast<const kdtree_knn_classification::Parameter *>(par)->resultsToCompute;
+
+    /* Only the requested results are passed to the kernel */
+    const data_management::NumericTablePtr r = (resultsToCompute & (computeClassLabels | computeResponses)) ?
+                                               result->get(classifier::prediction::prediction) : data_management::NumericTablePtr();
+    const data_management::NumericTablePtr indices = (resultsToCompute & computeIndicesOfNeighbors) ?
+                                                     result->get(prediction::indices) : data_management::NumericTablePtr();
+    const data_management::NumericTablePtr distances = (resultsToCompute & computeDistances) ?
+                                                       result->get(prediction::distances) : data_management::NumericTablePtr();
     daal::services::Environment::env & env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::KNNClassificationPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFpType, method), \
-                       compute, a.get(), m.get(), r.get(), par);
+                       compute, a.get(), m.get(), r.get(), indices.get(), distances.get(), par);
 }
 
 } // namespace prediction
@@ -34,6 +34,7 @@
 #include "service_rng.h"
 #include "service_sort.h"
 #include "numeric_table.h"
+#include "service_numeric_table.h"
 #include "kdtree_knn_classification_predict_dense_default_batch.h"
 #include "kdtree_knn_classification_model_impl.h"
 #include "kdtree_knn_impl.i"
@@ -68,11 +69,12 @@ void pushMaxHeap(RandomAccessIterator first, RandomAccessIterator last, Compare
         if (i > 0)
         {
             const auto newItem = *last; // It can be moved instead.
-            auto prev = i;
-            for (i = heapParentIndex<cpu>(i); i && compare(*(first + i), newItem); i = heapParentIndex<cpu>(i))
+            while (i > 0)
             {
-                *(first + prev) = *(first + i); // It can be moved instead.
-                prev = i;
+                const auto parent = heapParentIndex<cpu>(i);
+                if (!compare(*(first + parent), newItem)) { break; }
+                *(first + i) = *(first + parent); // It can be moved instead.
+                i = parent;
             }
             *(first + i) = newItem; // It can be moved instead.
         }
@@ -89,11 +91,12 @@ void pushMaxHeap(RandomAccessIterator first, RandomAccessIterator last)
         if (i > 0)
         {
             const auto newItem = *last; // It can be moved instead.
-            auto prev = i;
-            for (i = heapParentIndex<cpu>(i); i && (*(first + i) < newItem); i = heapParentIndex<cpu>(i))
+            while (i > 0)
             {
-                *(first + prev) = *(first + i); // It can be moved instead.
-                prev = i;
+                const auto parent = heapParentIndex<cpu>(i);
+                if (!(*(first + parent) < newItem)) { break; }
+                *(first + i) = *(first + parent); // It can be moved instead.
+                i = parent;
             }
             *(first + i) = newItem; // It can be moved instead.
         }
@@ -266,6 +269,13 @@ public:
         --_count;
     }
 
+    /* Sorts the elements in ascending order. The heap has to be reset before the next use */
+    void sort()
+    {
+        makeMaxHeap<cpu>(_elements, _elements + _count);
+        for (size_t i = _count; i > 1; --i) { popMaxHeap<cpu>(_elements, _elements + i); }
+    }
+
     size_t size() const { return _count; }
 
     T * getMax() { return _elements; }
@@ -295,9 +305,62 @@ struct SearchNode
     algorithmFpType minDistance;
 };
 
+/**
+ *  Training observations of the leaves of the KD-tree packed into blocks by the training, see buildLeafBlocks()
+ */
+template <typename algorithmFpType, CpuType cpu>
+class LeafBlocks
+{
+public:
+    static const size_t blockSize = __KDTREE_LEAF_BLOCK_SIZE;
+
+    LeafBlocks() : _blocks(nullptr), _offsets(nullptr), _columnCount(0) {}
+
+    bool init(const Model & model)
+    {
+        _blocksTable = model.impl()->getLeafBlocks();
+        _offsetsTable = model.impl()->getLeafBlockOffsets();
+        if (!_blocksTable || !_offsetsTable)
+        {
+            /* The models archived before the leaf blocks were kept in the model */
+            NumericTablePtr blocksTable, offsetsTable;
+            if (!buildLeafBlocks<algorithmFpType, cpu>(*(model.impl()->getKDTreeTable()), model.impl()->getRootNodeIndex(),
+                                                       *(model.impl()->getData()), blocksTable, offsetsTable))
+            {
+                return false;
+            }
+            _blocksTable = blocksTable;
+            _offsetsTable = offsetsTable;
+        }
+
+        _columnCount = _blocksTable->getNumberOfColumns() / blockSize;
+        _blocks = _blocksRows.set(const_cast<NumericTable *>(_blocksTable.get()), 0, _blocksTable->getNumberOfRows());
+        _offsets = _offsetsRows.set(const_cast<NumericTable *>(_offsetsTable.get()), 0, _offsetsTable->getNumberOfRows());
+        return (_blocks && _offsets);
+    }
+
+    /* Returns the first block of the leaf */
+    const algorithmFpType * get(size_t leafNodeIndex) const
+    {
+        return _blocks + static_cast<size_t>(_offsets[leafNodeIndex]) * blockSize * _columnCount;
+    }
+
+    size_t getNumberOfColumns() const { return _columnCount; }
+
+private:
+    NumericTableConstPtr _blocksTable;
+    NumericTableConstPtr _offsetsTable;
+    ReadRows<algorithmFpType, cpu> _blocksRows;
+    ReadRows<int, cpu> _offsetsRows;
+    const algorithmFpType * _blocks;
+    const int * _offsets;
+    size_t _columnCount;
+};
+
 template<typename algorithmFpType, CpuType cpu>
 void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
-    compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, const daal::algorithms::Parameter * par)
+    compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, NumericTable * indices, NumericTable * distances,
+            const daal::algorithms::Parameter * par)
 {
     typedef GlobalNeighbors<algorithmFpType, cpu> Neighbors;
     typedef Heap<Neighbors, cpu> MaxHeap;
@@ -310,9 +373,20 @@ void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
     const auto k = parameter->k;
     const auto & kdTreeTable = *(model->impl()->getKDTreeTable());
     const auto rootTreeNodeIndex = model->impl()->getRootNodeIndex();
-    const NumericTable & data = *(model->impl()->getData());
     const NumericTable & labels = *(model->impl()->getLabels());
 
+    /* Indices of the training observations in the input training data, absent if the training keeps the order of the input */
+    NumericTable * const dataIndicesTable = const_cast<NumericTable *>(model->impl()->getIndices().get());
+    ReadRows<int, cpu> dataIndicesRows(dataIndicesTable, 0, (dataIndicesTable ? dataIndicesTable->getNumberOfRows() : 0));
+    const int * const dataIndices = dataIndicesRows.get();
+
+    LeafBlocks<algorithmFpType, cpu> leafBlocks;
+    if (!leafBlocks.init(*model))
+    {
+        _errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
     size_t iSize = 1;
     while (iSize < k) { iSize *= 2; }
     const size_t heapSize = (iSize / 16 + 1) * 16;
@@ -351,10 +425,10 @@ void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
 
     const auto maxThreads = threader_get_threads_number();
     const size_t xColumnCount = x->getNumberOfColumns();
-    const size_t yColumnCount = y->getNumberOfColumns();
+    const size_t yColumnCount = (y ? y->getNumberOfColumns() : 0);
     const auto rowsPerBlock = (xRowCount + maxThreads - 1) / maxThreads;
     const auto blockCount = (xRowCount + rowsPerBlock - 1) / rowsPerBlock;
-    daal::threader_for(blockCount, blockCount, [=, &localTLS, &kdTreeTable, &data, &labels, &rowsPerBlock, &k](int iBlock)
+    daal::threader_for(blockCount, blockCount, [=, &localTLS, &kdTreeTable, &leafBlocks, &labels, &rowsPerBlock, &k](int iBlock)
     {
         Local * const local = localTLS.local();
         if (local)
@@ -366,15 +440,18 @@ void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
             data_management::BlockDescriptor<algorithmFpType> xBD;
             const_cast<NumericTable &>(*x).getBlockOfRows(first, last - first, readOnly, xBD);
             const algorithmFpType * const dx = xBD.getBlockPtr();
-            data_management::BlockDescriptor<algorithmFpType> yBD;
-            y->getBlockOfRows(first, last - first, writeOnly, yBD);
-            auto * const dy = yBD.getBlockPtr();
+            WriteOnlyRows<algorithmFpType, cpu> yRows(y, first, last - first);
+            WriteOnlyRows<int, cpu> indicesRows(indices, first, last - first);
+            WriteOnlyRows<algorithmFpType, cpu> distancesRows(distances, first, last - first);
+            algorithmFpType * const dy = yRows.get();
+            int * const di = indicesRows.get();
+            algorithmFpType * const dd = distancesRows.get();
             for (size_t i = 0; i < last - first; ++i)
             {
-                findNearestNeighbors(&dx[i * xColumnCount], local->heap, local->stack, k, radius, kdTreeTable, rootTreeNodeIndex, data);
-                predict(dy[i * yColumnCount], local->heap, labels, k);
+                findNearestNeighbors(&dx[i * xColumnCount], local->heap, local->stack, k, radius, kdTreeTable, rootTreeNodeIndex, leafBlocks);
+                predict(dy ? dy + i * yColumnCount : nullptr, di ? di + i * k : nullptr, dd ? dd + i * k : nullptr, local->heap, dataIndices,
+                        labels, *parameter);
             }
-            y->releaseBlockOfRows(yBD);
             const_cast<NumericTable &>(*x).releaseBlockOfRows(xBD);
         }
     } );
@@ -394,90 +471,75 @@ template<typename algorithmFpType, CpuType cpu>
 void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
     findNearestNeighbors(const algorithmFpType * query, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
                          kdtree_knn_classification::internal::Stack<SearchNode<algorithmFpType>, cpu> & stack, size_t k, algorithmFpType radius,
-                         const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex, const NumericTable & data)
+                         const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex, const LeafBlocks<algorithmFpType, cpu> & leafBlocks)
 {
+    const size_t blockSize = LeafBlocks<algorithmFpType, cpu>::blockSize;
+
     heap.reset();
     stack.reset();
     GlobalNeighbors<algorithmFpType, cpu> curNeighbor;
     size_t i, j;
-    SearchNode<algorithmFpType> cur, toPush, interCur;
+    SearchNode<algorithmFpType> cur, toPush;
     const KDTreeNode * node;
     cur.nodeIndex = rootTreeNodeIndex;
     cur.minDistance = 0;
 
-    const size_t xRowCount = data.getNumberOfRows();
-    const size_t xColumnCount = data.getNumberOfColumns();
+    const size_t xColumnCount = leafBlocks.getNumberOfColumns();
 
-    DAAL_ALIGNAS(256) algorithmFpType distance[__KDTREE_LEAF_BUCKET_SIZE + 1];
-    size_t start, end;
-    algorithmFpType dist, diff, val;
+    DAAL_ALIGNAS(64) algorithmFpType distance[blockSize];
+    algorithmFpType diff, val;
 
-    data_management::BlockDescriptor<algorithmFpType> xBD[2];
-    size_t curBDIdx, nextBDIdx;
     for (;;)
     {
         node = static_cast<const KDTreeNode *>(kdTreeTable.getArray()) + cur.nodeIndex;
         if (node->dimension == __KDTREE_NULLDIMENSION)
         {
-            start = node->leftIndex;
-            end = node->rightIndex;
-
-            for (i = start; i < end; ++i)
-            {
-                distance[i - start] = 0;
-            }
-
-            curBDIdx = 0;
-            nextBDIdx = 1;
-            const_cast<NumericTable &>(data).getBlockOfColumnValues(0, start, end - start, readOnly, xBD[curBDIdx]);
-            for (j = 1; j < xColumnCount; ++j)
+            const algorithmFpType * block = leafBlocks.get(cur.nodeIndex);
+            for (size_t first = node->leftIndex; first < node->rightIndex; first += blockSize, block += blockSize * xColumnCount)
             {
-                const algorithmFpType * const dx = xBD[curBDIdx].getBlockPtr();
+                DAAL_PREFETCH_READ_T0(block + blockSize * xColumnCount);
 
-                const_cast<NumericTable &>(data).getBlockOfColumnValues(j, start, end - start, readOnly, xBD[nextBDIdx]);
-                const algorithmFpType * const nx = xBD[nextBDIdx].getBlockPtr();
-                DAAL_PREFETCH_READ_T0(nx);
-                DAAL_PREFETCH_READ_T0(nx + 16);
-
-                for (i = 0; i < end - start; ++i)
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (i = 0; i < blockSize; ++i)
                 {
-                    distance[i] += (query[j - 1] - dx[i]) * (query[j - 1] - dx[i]);
+                    distance[i] = 0;
                 }
-
-                const_cast<NumericTable &>(data).releaseBlockOfColumnValues(xBD[curBDIdx]);
-
-                const auto tempBDIdx = curBDIdx; curBDIdx = nextBDIdx; nextBDIdx = tempBDIdx;
-            }
-            {
-                const algorithmFpType * const dx = xBD[curBDIdx].getBlockPtr();
-                for (i = 0; i < end - start; ++i)
+                for (j = 0; j < xColumnCount; ++j)
                 {
-                    distance[i] += (query[j - 1] - dx[i]) * (query[j - 1] - dx[i]);
+                    const algorithmFpType q = query[j];
+                    const algorithmFpType * const column = block + j * blockSize;
+                  PRAGMA_IVDEP
+                  PRAGMA_VECTOR_ALWAYS
+                    for (i = 0; i < blockSize; ++i)
+                    {
+                        distance[i] += (q - column[i]) * (q - column[i]);
+                    }
                 }
-                const_cast<NumericTable &>(data).releaseBlockOfColumnValues(xBD[curBDIdx]);
-            }
 
-            for (i = start; i < end; ++i)
-            {
-                if (distance[i - start] <= radius)
+                const size_t count = min<cpu>(blockSize, node->rightIndex - first);
+                for (i = 0; i < count; ++i)
                 {
-                    curNeighbor.distance = distance[i - start];
-                    curNeighbor.index = i;
-                    if (heap.size() < k)
+                    if (distance[i] <= radius)
                     {
-                        heap.push(curNeighbor, k);
-
-                        if (heap.size() == k)
+                        curNeighbor.distance = distance[i];
+                        curNeighbor.index = first + i;
+                        if (heap.size() < k)
                         {
-                            radius = heap.getMax()->distance;
+                            heap.push(curNeighbor, k);
+
+                            if (heap.size() == k)
+                            {
+                                radius = heap.getMax()->distance;
+                            }
                         }
-                    }
-                    else
-                    {
-                        if (heap.getMax()->distance > curNeighbor.distance)
+                        else
                         {
-                            heap.replaceMax(curNeighbor);
-                            radius = heap.getMax()->distance;
+                            if (heap.getMax()->distance > curNeighbor.distance)
+                            {
+                                heap.replaceMax(curNeighbor);
+                                radius = heap.getMax()->distance;
+                            }
                         }
                     }
                 }
@@ -516,49 +578,91 @@ void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
 
 template<typename algorithmFpType, CpuType cpu>
 void KNNClassificationPredictKernel<algorithmFpType, defaultDense, cpu>::
-    predict(algorithmFpType & predictedClass, const Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, const NumericTable & labels, size_t k)
+    predict(algorithmFpType * predictedClass, int * indices, algorithmFpType * distances, Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap,
+            const int * dataIndices, const NumericTable & labels, const kdtree_knn_classification::Parameter & parameter)
 {
+    typedef daal::internal::Math<algorithmFpType, cpu> Math;
+
     const size_t heapSize = heap.size();
     if (heapSize < 1) { return; }
 
-    struct Voting
+    if (indices || distances)
     {
-        algorithmFpType predictedClass;
-        size_t weight;
-
-        bool operator< (const Voting & rhs) { return (weight < rhs.weight); }
-    };
+        heap.sort();
+        for (size_t i = 0; i < heapSize; ++i)
+        {
+            if (indices) { indices[i] = (dataIndices ? dataIndices[heap[i].index] : static_cast<int>(heap[i].index)); }
+            if (distances) { distances[i] = Math::sSqrt(heap[i].distance); }
+        }
+    }
+    if (!predictedClass) { return; }
 
     data_management::BlockDescriptor<algorithmFpType> labelBD;
-    algorithmFpType * const classes = static_cast<algorithmFpType *>(daal_malloc(heapSize * sizeof(*classes)));
+    algorithmFpType * const classes = static_cast<algorithmFpType *>(daal_malloc(2 * heapSize * sizeof(*classes)));
+    algorithmFpType * const weights = classes + heapSize;
     for (size_t i = 0; i < heapSize; ++i)
     {
         const_cast<NumericTable &>(labels).getBlockOfColumnValues(0, heap[i].index, 1, readOnly, labelBD);
         classes[i] = *(labelBD.getBlockPtr());
         const_cast<NumericTable &>(labels).releaseBlockOfColumnValues(labelBD);
     }
-    daal::algorithms::internal::qSort<algorithmFpType, cpu>(heapSize, classes);
+
+    if (parameter.voteWeights == voteDistance)
+    {
+        /* The neighbors that coincide with the observation outweigh all the others */
+        bool hasExactMatch = false;
+        for (size_t i = 0; i < heapSize; ++i)
+        {
+            hasExactMatch |= (heap[i].distance == 0);
+        }
+        for (size_t i = 0; i < heapSize; ++i)
+        {
+            if (hasExactMatch) { weights[i] = (heap[i].distance == 0 ? 1 : 0); }
+            else { weights[i] = 1 / Math::sSqrt(heap[i].distance); }
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < heapSize; ++i) { weights[i] = 1; }
+    }
+
+    if (parameter.resultsToCompute & computeResponses)
+    {
+        algorithmFpType sum = 0;
+        algorithmFpType weightSum = 0;
+        for (size_t i = 0; i < heapSize; ++i)
+        {
+            sum += weights[i] * classes[i];
+            weightSum += weights[i];
+        }
+        *predictedClass = sum / weightSum;
+        daal_free(classes);
+        return;
+    }
+
+    daal::algorithms::internal::qSort<algorithmFpType, algorithmFpType, cpu>(heapSize, classes, weights);
     algorithmFpType currentClass = classes[0];
     algorithmFpType winnerClass = currentClass;
-    size_t currentWeight = 1;
-    size_t winnerWeight = currentWeight;
+    algorithmFpType currentWeight = weights[0];
+    algorithmFpType winnerWeight = currentWeight;
     for (size_t i = 1; i < heapSize; ++i)
     {
         if (classes[i] == currentClass)
         {
-            if((++currentWeight) > winnerWeight)
-            {
-                winnerWeight = currentWeight;
-                winnerClass = currentClass;
-            }
+            currentWeight += weights[i];
         }
         else
         {
-            currentWeight = 1;
+            currentWeight = weights[i];
             currentClass = classes[i];
         }
+        if (currentWeight > winnerWeight)
+        {
+            winnerWeight = currentWeight;
+            winnerClass = currentClass;
+        }
     }
-    predictedClass = winnerClass;
+    *predictedClass = winnerClass;
     daal_free(classes);
 }
 
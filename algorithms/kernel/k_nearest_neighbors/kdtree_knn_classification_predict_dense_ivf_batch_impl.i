@@ -0,0 +1,283 @@
+/* file: kdtree_knn_classification_predict_dense_ivf_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the approximate search of K-Nearest Neighbors in the inverted file index.
+//
+//  For every input observation the nProbes clusters with the nearest centroids
+//  are selected, and the training observations of these clusters are scanned.
+//  The observations of one cluster are stored in the contiguous rows of the
+//  training data, so the scan reads the contiguous ranges of every column and
+//  computes the distances for blocks of observations with vector instructions.
+//  If the selected clusters contain less than k observations, the remaining
+//  clusters are scanned in the order of the distance to their centroids.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_PREDICT_DENSE_IVF_BATCH_IMPL_I__
+#define __KDTREE_KNN_CLASSIFICATION_PREDICT_DENSE_IVF_BATCH_IMPL_I__
+
+#include "service_numeric_table.h"
+#include "service_sort.h"
+#include "kdtree_knn_classification_predict_dense_default_batch_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace prediction
+{
+namespace internal
+{
+
+template<typename algorithmFpType, CpuType cpu>
+void KNNClassificationPredictKernel<algorithmFpType, ivfDense, cpu>::
+    compute(const NumericTable * x, const classifier::Model * m, NumericTable * y, NumericTable * indices, NumericTable * distances,
+            const daal::algorithms::Parameter * par)
+{
+    typedef GlobalNeighbors<algorithmFpType, cpu> Neighbors;
+    typedef Heap<Neighbors, cpu> MaxHeap;
+
+    const kdtree_knn_classification::Parameter * const parameter = static_cast<const kdtree_knn_classification::Parameter *>(par);
+    const Model * const model = static_cast<const Model *>(m);
+    const size_t k = parameter->k;
+    const NumericTable & data = *(model->impl()->getData());
+    const NumericTable & labels = *(model->impl()->getLabels());
+
+    /* Indices of the training observations in the input training data, absent if the training keeps the order of the input */
+    NumericTable * const dataIndicesTable = const_cast<NumericTable *>(model->impl()->getIndices().get());
+    ReadRows<int, cpu> dataIndicesRows(dataIndicesTable, 0, (dataIndicesTable ? dataIndicesTable->getNumberOfRows() : 0));
+    const int * const dataIndices = dataIndicesRows.get();
+    NumericTable & centroidsTable = const_cast<NumericTable &>(*(model->impl()->getIVFCentroids()));
+    NumericTable & offsetsTable = const_cast<NumericTable &>(*(model->impl()->getIVFListOffsets()));
+
+    const size_t nLists = centroidsTable.getNumberOfRows();
+    const size_t nProbes = min<cpu>(parameter->nProbes, nLists);
+    const size_t xRowCount = x->getNumberOfRows();
+    const size_t xColumnCount = x->getNumberOfColumns();
+    const size_t yColumnCount = (y ? y->getNumberOfColumns() : 0);
+    const size_t dataRowCount = data.getNumberOfRows();
+
+    ReadRows<algorithmFpType, cpu> centroidsRows(centroidsTable, 0, nLists);
+    ReadRows<int, cpu> offsetsRows(offsetsTable, 0, nLists + 1);
+    const algorithmFpType * const centroids = centroidsRows.get();
+    const int * const offsets = offsetsRows.get();
+
+    /* Columns of the training data, the clusters are the contiguous ranges of rows */
+    TArray<data_management::BlockDescriptor<algorithmFpType>, cpu> columnBDs(xColumnCount);
+    TArray<const algorithmFpType *, cpu> columnsArray(xColumnCount);
+    const algorithmFpType ** const columns = columnsArray.get();
+    if (!columnBDs.get() || !columns)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    for (size_t j = 0; j < xColumnCount; ++j)
+    {
+        const_cast<NumericTable &>(data).getBlockOfColumnValues(j, 0, dataRowCount, readOnly, columnBDs[j]);
+        columns[j] = columnBDs[j].getBlockPtr();
+    }
+
+    size_t iSize = 1;
+    while (iSize < k) { iSize *= 2; }
+    const size_t heapSize = (iSize / 16 + 1) * 16;
+    const size_t probeHeapSize = (nProbes / 16 + 1) * 16;
+
+    struct Local
+    {
+        MaxHeap heap;
+        MaxHeap probeHeap;
+        algorithmFpType * centroidDistances;
+        int * listIndices;
+    };
+    daal::tls<Local *> localTLS([=]()-> Local *
+    {
+        Local * const ptr = service_scalable_calloc<Local, cpu>(1);
+        if (ptr)
+        {
+            ptr->centroidDistances = service_scalable_malloc<algorithmFpType, cpu>(nLists);
+            ptr->listIndices = service_scalable_malloc<int, cpu>(nLists);
+            if (ptr->centroidDistances && ptr->listIndices && ptr->heap.init(heapSize) && ptr->probeHeap.init(probeHeapSize))
+            {
+                return ptr;
+            }
+            ptr->heap.clear();
+            ptr->probeHeap.clear();
+            service_scalable_free<int, cpu>(ptr->listIndices);
+            service_scalable_free<algorithmFpType, cpu>(ptr->centroidDistances);
+            service_scalable_free<Local, cpu>(ptr);
+        }
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return nullptr;
+    } );
+
+    const size_t xBlockSize = __IVF_QUERY_BLOCK_SIZE;
+    const size_t xBlockCount = (xRowCount + xBlockSize - 1) / xBlockSize;
+    daal::threader_for(xBlockCount, xBlockCount, [=, &localTLS, &labels](size_t iBlock)
+    {
+        Local * const local = localTLS.local();
+        if (!local) { return; }
+
+        const size_t first = iBlock * xBlockSize;
+        const size_t last = min<cpu>(first + xBlockSize, xRowCount);
+
+        ReadRows<algorithmFpType, cpu> xRows(const_cast<NumericTable *>(x), first, last - first);
+        WriteOnlyRows<algorithmFpType, cpu> yRows(y, first, last - first);
+        WriteOnlyRows<int, cpu> indicesRows(indices, first, last - first);
+        WriteOnlyRows<algorithmFpType, cpu> distancesRows(distances, first, last - first);
+        const algorithmFpType * const dx = xRows.get();
+        algorithmFpType * const dy = yRows.get();
+        int * const di = indicesRows.get();
+        algorithmFpType * const dd = distancesRows.get();
+
+        algorithmFpType * const centroidDistances = local->centroidDistances;
+        int * const listIndices = local->listIndices;
+        MaxHeap & heap = local->heap;
+        MaxHeap & probeHeap = local->probeHeap;
+
+        for (size_t i = 0; i < last - first; ++i)
+        {
+            const algorithmFpType * const query = dx + i * xColumnCount;
+
+            /* Select the clusters with the nearest centroids */
+            probeHeap.reset();
+            Neighbors curList;
+            for (size_t l = 0; l < nLists; ++l)
+            {
+                const algorithmFpType * const centroid = centroids + l * xColumnCount;
+                algorithmFpType sum = 0;
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < xColumnCount; ++j)
+                {
+                    sum += (query[j] - centroid[j]) * (query[j] - centroid[j]);
+                }
+                centroidDistances[l] = sum;
+
+                curList.distance = sum;
+                curList.index = l;
+                if (probeHeap.size() < nProbes)
+                {
+                    probeHeap.push(curList, nProbes);
+                }
+                else if (probeHeap.getMax()->distance > sum)
+                {
+                    probeHeap.replaceMax(curList);
+                }
+            }
+
+            heap.reset();
+            for (size_t p = 0; p < probeHeap.size(); ++p)
+            {
+                const size_t l = probeHeap[p].index;
+                scanList(query, columns, xColumnCount, offsets[l], offsets[l + 1], heap, k);
+            }
+
+            /* The selected clusters are too small, continue with the rest ones */
+            if (heap.size() < k && nProbes < nLists)
+            {
+                for (size_t l = 0; l < nLists; ++l) { listIndices[l] = static_cast<int>(l); }
+                daal::algorithms::internal::qSort<algorithmFpType, int, cpu>(nLists, centroidDistances, listIndices);
+                for (size_t p = nProbes; p < nLists && heap.size() < k; ++p)
+                {
+                    const size_t l = listIndices[p];
+                    scanList(query, columns, xColumnCount, offsets[l], offsets[l + 1], heap, k);
+                }
+            }
+
+            this->predict(dy ? dy + i * yColumnCount : nullptr, di ? di + i * k : nullptr, dd ? dd + i * k : nullptr, heap, dataIndices,
+                          labels, *parameter);
+        }
+    } );
+
+    localTLS.reduce([=](Local * ptr) -> void
+    {
+        if (ptr)
+        {
+            ptr->heap.clear();
+            ptr->probeHeap.clear();
+            service_scalable_free<int, cpu>(ptr->listIndices);
+            service_scalable_free<algorithmFpType, cpu>(ptr->centroidDistances);
+            service_scalable_free<Local, cpu>(ptr);
+        }
+    } );
+
+    for (size_t j = 0; j < xColumnCount; ++j)
+    {
+        const_cast<NumericTable &>(data).releaseBlockOfColumnValues(columnBDs[j]);
+    }
+}
+
+template<typename algorithmFpType, CpuType cpu>
+void KNNClassificationPredictKernel<algorithmFpType, ivfDense, cpu>::
+    scanList(const algorithmFpType * query, const algorithmFpType * const * columns, size_t columnCount, size_t first, size_t last,
+             Heap<GlobalNeighbors<algorithmFpType, cpu>, cpu> & heap, size_t k)
+{
+    const size_t blockSize = __IVF_SCAN_BLOCK_SIZE;
+    DAAL_ALIGNAS(64) algorithmFpType distance[blockSize];
+    GlobalNeighbors<algorithmFpType, cpu> curNeighbor;
+
+    for (size_t start = first; start < last; start += blockSize)
+    {
+        const size_t count = min<cpu>(blockSize, last - start);
+
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < count; ++i)
+        {
+            distance[i] = 0;
+        }
+        for (size_t j = 0; j < columnCount; ++j)
+        {
+            const algorithmFpType q = query[j];
+            const algorithmFpType * const column = columns[j] + start;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < count; ++i)
+            {
+                distance[i] += (q - column[i]) * (q - column[i]);
+            }
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (heap.size() < k)
+            {
+                curNeighbor.distance = distance[i];
+                curNeighbor.index = start + i;
+                heap.push(curNeighbor, k);
+            }
+            else if (heap.getMax()->distance > distance[i])
+            {
+                curNeighbor.distance = distance[i];
+                curNeighbor.index = start + i;
+                heap.replaceMax(curNeighbor);
+            }
+        }
+    }
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,72 @@
+/* file: kdtree_knn_classification_predict_result_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the K-Nearest Neighbors (kNN) prediction Result.
+//--
+*/
+
+#include "algorithms/k_nearest_neighbors/kdtree_knn_classification_predict_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace prediction
+{
+namespace interface1
+{
+
+/**
+ * Allocates memory to store the results of the KD-tree based kNN model-based prediction
+ * \param[in] input       Pointer to the input objects of the algorithm
+ * \param[in] parameter   Pointer to the parameters of the algorithm
+ * \param[in] method      Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT void Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const kdtree_knn_classification::Parameter *const par = static_cast<const kdtree_knn_classification::Parameter *>(parameter);
+    const size_t nRows = (static_cast<const classifier::prediction::InputIface *>(input))->getNumberOfRows();
+
+    if (par->resultsToCompute & (computeClassLabels | computeResponses))
+    {
+        classifier::prediction::Result::allocate<algorithmFPType>(input, parameter, method);
+    }
+    if (par->resultsToCompute & computeIndicesOfNeighbors)
+    {
+        set(indices, data_management::NumericTablePtr(
+                new data_management::HomogenNumericTable<int>(par->k, nRows, data_management::NumericTableIface::doAllocate)));
+    }
+    if (par->resultsToCompute & computeDistances)
+    {
+        set(distances, data_management::NumericTablePtr(
+                new data_management::HomogenNumericTable<algorithmFPType>(par->k, nRows, data_management::NumericTableIface::doAllocate)));
+    }
+}
+
+template DAAL_EXPORT void Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter,
+                                                        const int method);
+
+} // namespace interface1
+} // namespace prediction
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
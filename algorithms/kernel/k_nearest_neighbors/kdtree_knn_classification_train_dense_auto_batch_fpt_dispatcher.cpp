@@ -0,0 +1,38 @@
+/* file: kdtree_knn_classification_train_dense_auto_batch_fpt_dispatcher.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of K-Nearest Neighbors container.
+//--
+*/
+
+#include "kdtree_knn_classification_train_container.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace interface1
+{
+
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER(kdtree_knn_classification::training::BatchContainer, batch, DAAL_FPTYPE, \
+                                      kdtree_knn_classification::training::autoDense)
+
+} // namespace interface1
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,51 @@
+/* file: kdtree_knn_classification_train_dense_brute_force_batch_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of K-Nearest Neighbors training functions for the brute force search.
+//--
+*/
+
+#include "kdtree_knn_classification_train_container.h"
+#include "kdtree_knn_classification_train_dense_brute_force_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace training
+{
+namespace interface1
+{
+
+template class BatchContainer<DAAL_FPTYPE, bruteForceDense, DAAL_CPU>;
+
+} // namespace interface1
+
+namespace internal
+{
+
+template class KNNClassificationTrainBatchKernel<DAAL_FPTYPE, bruteForceDense, DAAL_CPU>;
+
+} // namespace internal
+} // namespace training
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
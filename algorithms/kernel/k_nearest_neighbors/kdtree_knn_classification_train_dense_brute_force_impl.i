@@ -0,0 +1,61 @@
+/* file: kdtree_knn_classification_train_dense_brute_force_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of K-Nearest Neighbors training for the brute force search.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_TRAIN_DENSE_BRUTE_FORCE_IMPL_I__
+#define __KDTREE_KNN_CLASSIFICATION_TRAIN_DENSE_BRUTE_FORCE_IMPL_I__
+
+#include "kdtree_knn_classification_model_impl.h"
+#include "kdtree_knn_classification_train_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace training
+{
+namespace internal
+{
+
+template <typename algorithmFpType, CpuType cpu>
+void KNNClassificationTrainBatchKernel<algorithmFpType, training::bruteForceDense, cpu>::
+    compute(NumericTable * x, NumericTable * y, kdtree_knn_classification::Model * r, const daal::algorithms::Parameter * par)
+{
+    /* The brute force search needs only the training data and labels stored in the model by the container */
+    r->setNFeatures(x->getNumberOfColumns());
+    r->impl()->setKDTreeTable(SharedPtr<KDTreeTable>());
+    r->impl()->setRootNodeIndex(0);
+    r->impl()->setLastNodeIndex(0);
+    r->impl()->setIndices(NumericTablePtr());
+    r->impl()->setLeafBlocks(NumericTablePtr());
+    r->impl()->setLeafBlockOffsets(NumericTablePtr());
+}
+
+} // namespace internal
+} // namespace training
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
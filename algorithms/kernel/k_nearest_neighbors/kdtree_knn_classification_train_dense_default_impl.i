@@ -184,6 +184,19 @@ void KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense,
     buildSecondPartOfKDTree(q, bboxQ, *x, *r, indexes, parameter->seed);
     rearrangePoints(*x, indexes);
     rearrangePoints(*y, indexes);
+    storeIndices(*r, indexes, xRowCount);
+
+    NumericTablePtr leafBlocksTable, leafBlockOffsetsTable;
+    if (buildLeafBlocks<algorithmFpType, cpu>(*(r->impl()->getKDTreeTable()), r->impl()->getRootNodeIndex(), *x, leafBlocksTable,
+                                              leafBlockOffsetsTable))
+    {
+        r->impl()->setLeafBlocks(leafBlocksTable);
+        r->impl()->setLeafBlockOffsets(leafBlockOffsetsTable);
+    }
+    else
+    {
+        _errors->add(services::ErrorMemoryAllocationFailed);
+    }
 
     daal_free(bboxQ);
     daal_free(indexes);
@@ -862,6 +875,25 @@ void KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense,
     daal_free(buffer);
 }
 
+template <typename algorithmFpType, CpuType cpu>
+void KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense, cpu>::
+    storeIndices(kdtree_knn_classification::Model & r, const size_t * indexes, size_t n)
+{
+    SharedPtr<HomogenNumericTable<int> > indicesTable(new HomogenNumericTable<int>(1, n, NumericTable::doAllocate));
+    int * const indices = indicesTable->getArray();
+    if (!indices)
+    {
+        _errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        indices[i] = static_cast<int>(indexes[i]);
+    }
+    r.impl()->setIndices(indicesTable);
+}
+
 template <typename algorithmFpType, CpuType cpu>
 void KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense, cpu>::
     buildSecondPartOfKDTree(Queue<BuildNode, cpu> & q, BoundingBox<algorithmFpType> * & bboxQ, const NumericTable & x,
@@ -0,0 +1,239 @@
+/* file: kdtree_knn_classification_train_dense_ivf_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of K-Nearest Neighbors training for the approximate search in the inverted file index.
+//
+//  The centroids of the clusters are computed with the K-Means on the evenly
+//  strided subsample of the training data. Every training observation is
+//  assigned to the nearest centroid, and the training data and labels are
+//  rearranged so that the observations of one cluster are stored in the
+//  contiguous rows.
+//--
+*/
+
+#ifndef __KDTREE_KNN_CLASSIFICATION_TRAIN_DENSE_IVF_IMPL_I__
+#define __KDTREE_KNN_CLASSIFICATION_TRAIN_DENSE_IVF_IMPL_I__
+
+#include "service_numeric_table.h"
+#include "kmeans_distance_argmin_impl.i"
+#include "kdtree_knn_classification_train_dense_default_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kdtree_knn_classification
+{
+namespace training
+{
+namespace internal
+{
+
+template <typename algorithmFpType, CpuType cpu>
+void KNNClassificationTrainBatchKernel<algorithmFpType, training::ivfDense, cpu>::
+    compute(NumericTable * x, NumericTable * y, kdtree_knn_classification::Model * r, const daal::algorithms::Parameter * par)
+{
+    typedef daal::internal::Math<algorithmFpType, cpu> Math;
+
+    const kdtree_knn_classification::Parameter * const parameter = static_cast<const kdtree_knn_classification::Parameter *>(par);
+    const size_t xRowCount = x->getNumberOfRows();
+    const size_t xColumnCount = x->getNumberOfColumns();
+
+    size_t nLists = parameter->nLists ? parameter->nLists : static_cast<size_t>(Math::sSqrt(static_cast<algorithmFpType>(xRowCount)));
+    nLists = min<cpu>(max<cpu>(nLists, static_cast<size_t>(1)), xRowCount);
+
+    r->setNFeatures(xColumnCount);
+    r->impl()->setKDTreeTable(SharedPtr<KDTreeTable>());
+    r->impl()->setRootNodeIndex(0);
+    r->impl()->setLastNodeIndex(0);
+    r->impl()->setLeafBlocks(NumericTablePtr());
+    r->impl()->setLeafBlockOffsets(NumericTablePtr());
+
+    SharedPtr<HomogenNumericTable<algorithmFpType> > centroidsTable(
+        new HomogenNumericTable<algorithmFpType>(xColumnCount, nLists, NumericTable::doAllocate));
+    SharedPtr<HomogenNumericTable<int> > offsetsTable(new HomogenNumericTable<int>(1, nLists + 1, NumericTable::doAllocate));
+    TArray<int, cpu> listIdsArray(xRowCount);
+    TArray<size_t, cpu> indexesArray(xRowCount);
+    TArray<size_t, cpu> positionsArray(nLists);
+    algorithmFpType * const centroids = centroidsTable->getArray();
+    int * const offsets = offsetsTable->getArray();
+    int * const listIds = listIdsArray.get();
+    size_t * const indexes = indexesArray.get();
+    size_t * const positions = positionsArray.get();
+    if (!centroids || !offsets || !listIds || !indexes || !positions)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    if (!computeCentroids(*x, nLists, centroids) || !assignToLists(*x, nLists, centroids, listIds))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    /* Counting sort of the training observations by the clusters */
+    for (size_t l = 0; l <= nLists; ++l) { offsets[l] = 0; }
+    for (size_t i = 0; i < xRowCount; ++i) { ++offsets[listIds[i] + 1]; }
+    for (size_t l = 0; l < nLists; ++l)
+    {
+        offsets[l + 1] += offsets[l];
+        positions[l] = offsets[l];
+    }
+    for (size_t i = 0; i < xRowCount; ++i) { indexes[positions[listIds[i]]++] = i; }
+
+    this->rearrangePoints(*x, indexes);
+    this->rearrangePoints(*y, indexes);
+    this->storeIndices(*r, indexes, xRowCount);
+
+    r->impl()->setIVFCentroids(centroidsTable);
+    r->impl()->setIVFListOffsets(offsetsTable);
+}
+
+template <typename algorithmFpType, CpuType cpu>
+bool KNNClassificationTrainBatchKernel<algorithmFpType, training::ivfDense, cpu>::
+    computeCentroids(const NumericTable & x, size_t nLists, algorithmFpType * centroids)
+{
+    typedef kmeans::internal::DistanceArgmin<algorithmFpType, cpu> Argmin;
+
+    const size_t xRowCount = x.getNumberOfRows();
+    const size_t xColumnCount = x.getNumberOfColumns();
+    const size_t sampleCount = min<cpu>(xRowCount, nLists * __IVF_SAMPLES_PER_LIST);
+
+    TArray<algorithmFpType, cpu> sampleArray(sampleCount * xColumnCount);
+    TArray<int, cpu> assignmentsArray(sampleCount);
+    TArray<algorithmFpType, cpu> halfNormSqArray(nLists);
+    TArray<algorithmFpType, cpu> sumsArray(nLists * xColumnCount);
+    TArray<size_t, cpu> countsArray(nLists);
+    algorithmFpType * const sample = sampleArray.get();
+    int * const assignments = assignmentsArray.get();
+    algorithmFpType * const halfNormSq = halfNormSqArray.get();
+    algorithmFpType * const sums = sumsArray.get();
+    size_t * const counts = countsArray.get();
+    if (!sample || !assignments || !halfNormSq || !sums || !counts) { return false; }
+
+    const size_t blockSize = __IVF_ROW_BLOCK_SIZE;
+    const size_t blockCount = (sampleCount + blockSize - 1) / blockSize;
+    daal::threader_for(blockCount, blockCount, [=, &x](size_t iBlock)
+    {
+        const size_t first = iBlock * blockSize;
+        const size_t last = min<cpu>(first + blockSize, sampleCount);
+        for (size_t i = first; i < last; ++i)
+        {
+            ReadRows<algorithmFpType, cpu> row(const_cast<NumericTable &>(x), i * xRowCount / sampleCount, 1);
+            const algorithmFpType * const dx = row.get();
+            for (size_t j = 0; j < xColumnCount; ++j) { sample[i * xColumnCount + j] = dx[j]; }
+        }
+    } );
+
+    for (size_t l = 0; l < nLists; ++l)
+    {
+        const algorithmFpType * const src = sample + (l * sampleCount / nLists) * xColumnCount;
+        for (size_t j = 0; j < xColumnCount; ++j) { centroids[l * xColumnCount + j] = src[j]; }
+    }
+
+    bool isOk = true;
+    for (size_t iteration = 0; iteration < __IVF_KMEANS_ITERATIONS && isOk; ++iteration)
+    {
+        for (size_t l = 0; l < nLists; ++l)
+        {
+            algorithmFpType sum = 0;
+            for (size_t j = 0; j < xColumnCount; ++j) { sum += centroids[l * xColumnCount + j] * centroids[l * xColumnCount + j]; }
+            halfNormSq[l] = 0.5 * sum;
+        }
+
+        daal::threader_for(blockCount, blockCount, [=, &isOk](size_t iBlock)
+        {
+            const size_t first = iBlock * blockSize;
+            const size_t last = min<cpu>(first + blockSize, sampleCount);
+            TArray<algorithmFpType, cpu> tile(Argmin::getTileSize(xColumnCount));
+            if (!tile.get())
+            {
+                isOk = false;
+                return;
+            }
+            Argmin::find(last - first, xColumnCount, sample + first * xColumnCount, nLists, centroids, halfNormSq, tile.get(),
+                         assignments + first);
+        } );
+
+        for (size_t l = 0; l < nLists * xColumnCount; ++l) { sums[l] = 0; }
+        for (size_t l = 0; l < nLists; ++l) { counts[l] = 0; }
+        for (size_t i = 0; i < sampleCount; ++i)
+        {
+            const size_t l = assignments[i];
+            ++counts[l];
+            for (size_t j = 0; j < xColumnCount; ++j) { sums[l * xColumnCount + j] += sample[i * xColumnCount + j]; }
+        }
+
+        /* The centroids of the empty clusters are not changed */
+        for (size_t l = 0; l < nLists; ++l)
+        {
+            if (!counts[l]) { continue; }
+            const algorithmFpType invCount = 1.0 / counts[l];
+            for (size_t j = 0; j < xColumnCount; ++j) { centroids[l * xColumnCount + j] = sums[l * xColumnCount + j] * invCount; }
+        }
+    }
+    return isOk;
+}
+
+template <typename algorithmFpType, CpuType cpu>
+bool KNNClassificationTrainBatchKernel<algorithmFpType, training::ivfDense, cpu>::
+    assignToLists(const NumericTable & x, size_t nLists, const algorithmFpType * centroids, int * listIds)
+{
+    typedef kmeans::internal::DistanceArgmin<algorithmFpType, cpu> Argmin;
+
+    const size_t xRowCount = x.getNumberOfRows();
+    const size_t xColumnCount = x.getNumberOfColumns();
+
+    TArray<algorithmFpType, cpu> halfNormSqArray(nLists);
+    algorithmFpType * const halfNormSq = halfNormSqArray.get();
+    if (!halfNormSq) { return false; }
+    for (size_t l = 0; l < nLists; ++l)
+    {
+        algorithmFpType sum = 0;
+        for (size_t j = 0; j < xColumnCount; ++j) { sum += centroids[l * xColumnCount + j] * centroids[l * xColumnCount + j]; }
+        halfNormSq[l] = 0.5 * sum;
+    }
+
+    bool isOk = true;
+    const size_t blockSize = __IVF_ROW_BLOCK_SIZE;
+    const size_t blockCount = (xRowCount + blockSize - 1) / blockSize;
+    daal::threader_for(blockCount, blockCount, [=, &x, &isOk](size_t iBlock)
+    {
+        const size_t first = iBlock * blockSize;
+        const size_t last = min<cpu>(first + blockSize, xRowCount);
+        ReadRows<algorithmFpType, cpu> rows(const_cast<NumericTable &>(x), first, last - first);
+        TArray<algorithmFpType, cpu> tile(Argmin::getTileSize(xColumnCount));
+        if (!rows.get() || !tile.get())
+        {
+            isOk = false;
+            return;
+        }
+        Argmin::find(last - first, xColumnCount, rows.get(), nLists, centroids, halfNormSq, tile.get(), listIds + first);
+    } );
+    return isOk;
+}
+
+} // namespace internal
+} // namespace training
+} // namespace kdtree_knn_classification
+} // namespace algorithms
+} // namespace daal
+
+#endif
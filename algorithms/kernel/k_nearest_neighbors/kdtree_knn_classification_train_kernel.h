@@ -87,6 +87,8 @@ protected:
 
     void rearrangePoints(NumericTable & x, const size_t * indexes);
 
+    void storeIndices(kdtree_knn_classification::Model & r, const size_t * indexes, size_t n);
+
     void buildSecondPartOfKDTree(Queue<BuildNode, cpu> & q, BoundingBox<algorithmFpType> * & bboxQ, const NumericTable & x,
                                  kdtree_knn_classification::Model & r, size_t * indexes, int seed);
 
@@ -103,6 +105,34 @@ protected:
                                     IndexValuePair<algorithmFpType, cpu> * outValues);
 };
 
+template <typename algorithmFpType, CpuType cpu>
+class KNNClassificationTrainBatchKernel<algorithmFpType, training::bruteForceDense, cpu> : public daal::algorithms::Kernel
+{
+public:
+    void compute(NumericTable * x, NumericTable * y, kdtree_knn_classification::Model * r, const daal::algorithms::Parameter * par);
+};
+
+template <typename algorithmFpType, CpuType cpu>
+class KNNClassificationTrainBatchKernel<algorithmFpType, training::autoDense, cpu> :
+    public KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense, cpu>
+{
+public:
+    void compute(NumericTable * x, NumericTable * y, kdtree_knn_classification::Model * r, const daal::algorithms::Parameter * par);
+};
+
+template <typename algorithmFpType, CpuType cpu>
+class KNNClassificationTrainBatchKernel<algorithmFpType, training::ivfDense, cpu> :
+    public KNNClassificationTrainBatchKernel<algorithmFpType, training::defaultDense, cpu>
+{
+public:
+    void compute(NumericTable * x, NumericTable * y, kdtree_knn_classification::Model * r, const daal::algorithms::Parameter * par);
+
+protected:
+    bool computeCentroids(const NumericTable & x, size_t nLists, algorithmFpType * centroids);
+
+    bool assignToLists(const NumericTable & x, size_t nLists, const algorithmFpType * centroids, int * listIds);
+};
+
 } // namespace internal
 } // namespace training
 } // namespace kdtree_knn_classification
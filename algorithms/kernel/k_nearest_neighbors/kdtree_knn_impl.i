@@ -28,6 +28,10 @@
     #include <immintrin.h>
 #endif
 
+#include "threading.h"
+#include "homogen_numeric_table.h"
+#include "kdtree_knn_classification_model_impl.h"
+
 
 #if defined(_MSC_VER)
     #define DAAL_FORCEINLINE __forceinline
@@ -60,6 +64,7 @@ namespace internal
 
 #define __KDTREE_MAX_NODE_COUNT_MULTIPLICATION_FACTOR 3
 #define __KDTREE_LEAF_BUCKET_SIZE 31 // Must be ((power of 2) minus 1).
+#define __KDTREE_LEAF_BLOCK_SIZE (__KDTREE_LEAF_BUCKET_SIZE + 1)
 #define __KDTREE_FIRST_PART_LEAF_NODES_PER_THREAD 3
 #define __KDTREE_DIMENSION_SELECTION_SIZE 128
 #define __KDTREE_MEDIAN_RANDOM_SAMPLE_COUNT 1024
@@ -73,6 +78,25 @@ namespace internal
 
 #define __KDTREE_NULLDIMENSION (static_cast<size_t>(-1))
 
+#define __KDTREE_AUTO_MAX_DIMENSION 16     // The KD-tree search visits almost all leaves for the larger number of features.
+#define __KDTREE_AUTO_MIN_ROW_COUNT 1024   // The brute force search is faster on small training data sets.
+#define __BRUTE_FORCE_QUERY_BLOCK_SIZE 128
+#define __BRUTE_FORCE_REFERENCE_BLOCK_SIZE 512
+#define __IVF_SAMPLES_PER_LIST 64          // K-Means of the inverted file index runs on the subsample of this size per cluster.
+#define __IVF_KMEANS_ITERATIONS 10
+#define __IVF_ROW_BLOCK_SIZE 256
+#define __IVF_QUERY_BLOCK_SIZE 64
+#define __IVF_SCAN_BLOCK_SIZE 32
+
+/**
+ *  Returns true if the search of k nearest neighbors in the KD-tree is expected to be faster than the brute force search
+ *  for the training data set of the given size
+ */
+inline bool isKDTreeSearchPreferable(size_t rowCount, size_t columnCount, size_t k)
+{
+    return (columnCount <= __KDTREE_AUTO_MAX_DIMENSION && rowCount >= __KDTREE_AUTO_MIN_ROW_COUNT && 2 * k < rowCount);
+}
+
 template <CpuType cpu, typename T>
 inline const T & min(const T & a, const T & b) { return !(b < a) ? a : b; }
 
@@ -166,6 +190,101 @@ private:
     size_t _sizeMinus1;
 };
 
+/**
+ *  Packs the training observations of the leaves of the KD-tree into blocks of __KDTREE_LEAF_BLOCK_SIZE observations.
+ *  The values of one feature are contiguous within the block, so the distances from the query to all observations
+ *  of the block are computed with vector instructions over the whole block. A leaf occupies one or several
+ *  consecutive blocks, the tail of the last block is padded with zeros.
+ *
+ *  \param[in]  kdTreeTable        KD-tree
+ *  \param[in]  rootTreeNodeIndex  Index of the root node of the KD-tree
+ *  \param[in]  data               Training data in the order of the KD-tree
+ *  \param[out] blocksTable        Table with one block per row
+ *  \param[out] offsetsTable       Table with the row of the first block of each leaf per KD-tree node
+ *  \return False if the memory allocation fails
+ */
+template <typename algorithmFpType, CpuType cpu>
+bool buildLeafBlocks(const KDTreeTable & kdTreeTable, size_t rootTreeNodeIndex, const data_management::NumericTable & data,
+                     data_management::NumericTablePtr & blocksTable, data_management::NumericTablePtr & offsetsTable)
+{
+    using data_management::HomogenNumericTable;
+    using data_management::NumericTable;
+
+    const size_t blockSize = __KDTREE_LEAF_BLOCK_SIZE;
+    const size_t rowCount = data.getNumberOfRows();
+    const size_t columnCount = data.getNumberOfColumns();
+    const size_t nodeCount = kdTreeTable.getNumberOfRows();
+    const KDTreeNode * const nodes = static_cast<const KDTreeNode *>(const_cast<KDTreeTable &>(kdTreeTable).getArray());
+
+    services::SharedPtr<HomogenNumericTable<int> > offsetsTablePtr(new HomogenNumericTable<int>(1, nodeCount, NumericTable::doAllocate, 0));
+    int * const offsets = offsetsTablePtr->getArray();
+    Stack<size_t, cpu> stack;
+    if (!offsets || !stack.init(64)) { return false; }
+
+    /* Blocks of the leaves in the order of the training observations */
+    size_t blockCount = 0;
+    stack.push(rootTreeNodeIndex);
+    while (!stack.empty())
+    {
+        const size_t nodeIndex = stack.pop();
+        const KDTreeNode & node = nodes[nodeIndex];
+        if (node.dimension == __KDTREE_NULLDIMENSION)
+        {
+            offsets[nodeIndex] = static_cast<int>(blockCount);
+            blockCount += (node.rightIndex - node.leftIndex + blockSize - 1) / blockSize;
+        }
+        else
+        {
+            stack.push(node.rightIndex);
+            stack.push(node.leftIndex);
+        }
+    }
+    stack.clear();
+
+    services::SharedPtr<HomogenNumericTable<algorithmFpType> > blocksTablePtr(
+        new HomogenNumericTable<algorithmFpType>(blockSize * columnCount, blockCount, NumericTable::doAllocate));
+    algorithmFpType * const blocks = blocksTablePtr->getArray();
+    if (!blocks) { return false; }
+
+    daal::threader_for(columnCount, columnCount, [=, &data](size_t j)
+    {
+        data_management::BlockDescriptor<algorithmFpType> columnBD;
+        const_cast<NumericTable &>(data).getBlockOfColumnValues(j, 0, rowCount, data_management::readOnly, columnBD);
+        const algorithmFpType * const column = columnBD.getBlockPtr();
+
+        Stack<size_t, cpu> leafStack;
+        if (leafStack.init(64))
+        {
+            leafStack.push(rootTreeNodeIndex);
+            while (!leafStack.empty())
+            {
+                const size_t nodeIndex = leafStack.pop();
+                const KDTreeNode & node = nodes[nodeIndex];
+                if (node.dimension != __KDTREE_NULLDIMENSION)
+                {
+                    leafStack.push(node.rightIndex);
+                    leafStack.push(node.leftIndex);
+                    continue;
+                }
+
+                algorithmFpType * block = blocks + offsets[nodeIndex] * blockSize * columnCount + j * blockSize;
+                for (size_t first = node.leftIndex; first < node.rightIndex; first += blockSize, block += blockSize * columnCount)
+                {
+                    const size_t count = min<cpu>(blockSize, node.rightIndex - first);
+                    for (size_t i = 0; i < count; ++i) { block[i] = column[first + i]; }
+                    for (size_t i = count; i < blockSize; ++i) { block[i] = 0; }
+                }
+            }
+            leafStack.clear();
+        }
+        const_cast<NumericTable &>(data).releaseBlockOfColumnValues(columnBD);
+    } );
+
+    blocksTable = blocksTablePtr;
+    offsetsTable = offsetsTablePtr;
+    return true;
+}
+
 } // namespace internal
 } // namespace kdtree_knn_classification
 } // namespace algorithms
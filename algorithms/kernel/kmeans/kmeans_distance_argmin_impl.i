@@ -0,0 +1,245 @@
+/* file: kmeans_distance_argmin_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the fused search of the nearest centroids used in
+//  K-means algorithm and its initialization.
+//
+//  The nearest centroid of the observation x minimizes 0.5*(c,c) - (x,c).
+//  Observations are processed in tiles of nRowsInTile rows. The tile is
+//  transposed, so that the values of one feature are contiguous for all rows
+//  of the tile, and the dot products with a pair of centroids are accumulated
+//  in vector registers. The running minimum and its index are updated right
+//  after the pair is processed, so the matrix of distances is never stored.
+//--
+*/
+
+#ifndef __KMEANS_DISTANCE_ARGMIN_IMPL_I__
+#define __KMEANS_DISTANCE_ARGMIN_IMPL_I__
+
+#include "service_memory.h"
+#include "service_defines.h"
+#include "data_utils.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+
+/**
+ *  Number of rows in the tile processed by the fused kernel: two vector registers per centroid
+ */
+template<typename algorithmFPType, CpuType cpu>
+struct DistanceArgminTraits
+{
+    static const size_t nRowsInTile = 32 / sizeof(algorithmFPType);
+};
+
+template<typename algorithmFPType>
+struct DistanceArgminTraits<algorithmFPType, avx>
+{
+    static const size_t nRowsInTile = 64 / sizeof(algorithmFPType);
+};
+
+template<typename algorithmFPType>
+struct DistanceArgminTraits<algorithmFPType, avx2>
+{
+    static const size_t nRowsInTile = 64 / sizeof(algorithmFPType);
+};
+
+template<typename algorithmFPType>
+struct DistanceArgminTraits<algorithmFPType, avx512_mic>
+{
+    static const size_t nRowsInTile = 128 / sizeof(algorithmFPType);
+};
+
+template<typename algorithmFPType>
+struct DistanceArgminTraits<algorithmFPType, avx512>
+{
+    static const size_t nRowsInTile = 128 / sizeof(algorithmFPType);
+};
+
+template<typename algorithmFPType, CpuType cpu>
+struct DistanceArgmin
+{
+    static const size_t nRowsInTile = DistanceArgminTraits<algorithmFPType, cpu>::nRowsInTile;
+
+    /**
+     *  Returns the number of elements of the buffer used by the fused kernel
+     *  for the observations with p features
+     */
+    static size_t getTileSize(size_t p)
+    {
+        return nRowsInTile * p;
+    }
+
+    /**
+     *  Finds the nearest centroids for the observations of one tile
+     *  \param[in]  nRows       Number of rows in the tile, not greater than nRowsInTile
+     *  \param[in]  p           Number of features
+     *  \param[in]  data        Observations of the tile stored by rows
+     *  \param[in]  nClusters   Number of centroids
+     *  \param[in]  centroids   Centroids stored by rows
+     *  \param[in]  halfNormSq  Halves of the squared norms of the centroids
+     *  \param[in]  tile        Buffer of getTileSize(p) elements
+     *  \param[out] minVal      Minimal values of 0.5*(c,c) - (x,c) for every observation
+     *  \param[out] minIdx      Indices of the nearest centroids for every observation
+     */
+    static void findInTile(size_t nRows, size_t p, const algorithmFPType *data,
+                           size_t nClusters, const algorithmFPType *centroids, const algorithmFPType *halfNormSq,
+                           algorithmFPType *tile, algorithmFPType *minVal, int *minIdx)
+    {
+        for (size_t j = 0; j < p; j++)
+        {
+            algorithmFPType *tileRow = tile + j * nRowsInTile;
+          PRAGMA_IVDEP
+            for (size_t i = 0; i < nRows; i++)
+            {
+                tileRow[i] = data[i * p + j];
+            }
+            for (size_t i = nRows; i < nRowsInTile; i++)
+            {
+                tileRow[i] = (algorithmFPType)0.0;
+            }
+        }
+
+        algorithmFPType tileMinVal[nRowsInTile];
+        int tileMinIdx[nRowsInTile];
+        const algorithmFPType maxVal = data_management::data_feature_utils::getMaxVal<algorithmFPType>();
+      PRAGMA_IVDEP
+        for (size_t i = 0; i < nRowsInTile; i++)
+        {
+            tileMinVal[i] = maxVal;
+            tileMinIdx[i] = 0;
+        }
+
+        size_t k = 0;
+        for (; k + 1 < nClusters; k += 2)
+        {
+            const algorithmFPType *c0 = centroids + k * p;
+            const algorithmFPType *c1 = c0 + p;
+
+            algorithmFPType acc0[nRowsInTile];
+            algorithmFPType acc1[nRowsInTile];
+          PRAGMA_IVDEP
+            for (size_t i = 0; i < nRowsInTile; i++)
+            {
+                acc0[i] = halfNormSq[k];
+                acc1[i] = halfNormSq[k + 1];
+            }
+
+            for (size_t j = 0; j < p; j++)
+            {
+                const algorithmFPType *tileRow = tile + j * nRowsInTile;
+                const algorithmFPType v0 = c0[j];
+                const algorithmFPType v1 = c1[j];
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nRowsInTile; i++)
+                {
+                    acc0[i] -= v0 * tileRow[i];
+                    acc1[i] -= v1 * tileRow[i];
+                }
+            }
+
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nRowsInTile; i++)
+            {
+                if (acc0[i] < tileMinVal[i])
+                {
+                    tileMinVal[i] = acc0[i];
+                    tileMinIdx[i] = (int)k;
+                }
+                if (acc1[i] < tileMinVal[i])
+                {
+                    tileMinVal[i] = acc1[i];
+                    tileMinIdx[i] = (int)(k + 1);
+                }
+            }
+        }
+
+        if (k < nClusters)
+        {
+            const algorithmFPType *c0 = centroids + k * p;
+
+            algorithmFPType acc0[nRowsInTile];
+          PRAGMA_IVDEP
+            for (size_t i = 0; i < nRowsInTile; i++)
+            {
+                acc0[i] = halfNormSq[k];
+            }
+
+            for (size_t j = 0; j < p; j++)
+            {
+                const algorithmFPType *tileRow = tile + j * nRowsInTile;
+                const algorithmFPType v0 = c0[j];
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < nRowsInTile; i++)
+                {
+                    acc0[i] -= v0 * tileRow[i];
+                }
+            }
+
+          PRAGMA_IVDEP
+            for (size_t i = 0; i < nRowsInTile; i++)
+            {
+                if (acc0[i] < tileMinVal[i])
+                {
+                    tileMinVal[i] = acc0[i];
+                    tileMinIdx[i] = (int)k;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < nRows; i++)
+        {
+            minVal[i] = tileMinVal[i];
+            minIdx[i] = tileMinIdx[i];
+        }
+    }
+
+    /**
+     *  Finds the nearest centroids for the block of observations
+     *  \param[in]  tile    Buffer of getTileSize(p) elements
+     *  \param[out] minIdx  Indices of the nearest centroids for every observation of the block
+     */
+    static void find(size_t nRows, size_t p, const algorithmFPType *data,
+                     size_t nClusters, const algorithmFPType *centroids, const algorithmFPType *halfNormSq,
+                     algorithmFPType *tile, int *minIdx)
+    {
+        algorithmFPType minVal[nRowsInTile];
+        for (size_t iStart = 0; iStart < nRows; iStart += nRowsInTile)
+        {
+            const size_t nTileRows = (nRows - iStart < nRowsInTile ? nRows - iStart : nRowsInTile);
+            findInTile(nTileRows, p, data + iStart * p, nClusters, centroids, halfNormSq, tile, minVal, minIdx + iStart);
+        }
+    }
+};
+
+} // namespace daal::algorithms::kmeans::internal
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
+
+#endif
@@ -198,6 +198,9 @@ void DistributedStep3MasterPlusPlusInput::check(const daal::algorithms::Paramete
     Input::check(par, method);
     if(this->_errors->size())
         return;
+    /* Greedy selection of the candidates is not supported in the distributed processing mode */
+    const daal::algorithms::kmeans::init::Parameter* stepPar = (const daal::algorithms::kmeans::init::Parameter*)(par);
+    DAAL_CHECK_EX(stepPar->nTrials == 1, ErrorIncorrectParameter, ParameterName, nTrialsStr());
     KeyValueDataCollectionPtr pColl = get(inputOfStep3FromStep2);
     DAAL_CHECK_EX(pColl.get(), ErrorNullInputDataCollection, ArgumentName, inputOfStep3FromStep2Str());
     DAAL_CHECK_EX(pColl->size() > 0, ErrorIncorrectNumberOfElementsInInputCollection, ArgumentName, inputOfStep3FromStep2Str());
@@ -253,7 +256,7 @@ void DistributedStep4LocalPlusPlusInput::check(const daal::algorithms::Parameter
     Input::check(par, method);
     if(this->_errors->size())
         return;
-    const Parameter* stepPar = (const Parameter*)(par);
+    const daal::algorithms::kmeans::init::Parameter* stepPar = (const daal::algorithms::kmeans::init::Parameter*)(par);
     internal::checkLocalData(get(internalInput).get(), stepPar, internalInputStr(),
         get(data).get(), isParallelPlusMethod(method), this->_errors.get());
 
@@ -305,7 +308,7 @@ void DistributedStep5MasterPlusPlusInput::check(const daal::algorithms::Paramete
     Input::check(par, method);
     if(this->_errors->size())
         return;
-    const Parameter* stepPar = (const Parameter*)(par);
+    const daal::algorithms::kmeans::init::Parameter* stepPar = (const daal::algorithms::kmeans::init::Parameter*)(par);
     const size_t nMaxCandidates = size_t(stepPar->oversamplingFactor*stepPar->nClusters)*stepPar->nRounds + 1;
     for(size_t i = 0; i < 2; ++i)
     {
@@ -45,7 +45,7 @@ namespace interface1
  *  \param[in] seed           Seed for generating random numbers for the initialization
  */
 Parameter::Parameter(size_t _nClusters, size_t _offset, size_t seed) : nClusters(_nClusters), offset(_offset), nRowsTotal(0), seed(seed),
-    oversamplingFactor(0.5), nRounds(5) {}
+    oversamplingFactor(0.5), nRounds(5), nTrials(1) {}
 
 /**
  * Constructs parameters of the algorithm that computes initial clusters for the K-Means algorithm
@@ -53,11 +53,12 @@ Parameter::Parameter(size_t _nClusters, size_t _offset, size_t seed) : nClusters
  * \param[in] other    Parameters of the K-Means algorithm
  */
 Parameter::Parameter(const Parameter &other) : nClusters(other.nClusters), offset(other.offset), nRowsTotal(other.nRowsTotal), seed(other.seed),
-    oversamplingFactor(other.oversamplingFactor), nRounds(other.nRounds) {}
+    oversamplingFactor(other.oversamplingFactor), nRounds(other.nRounds), nTrials(other.nTrials) {}
 
 void Parameter::check() const
 {
     DAAL_CHECK_EX(nClusters > 0, ErrorIncorrectParameter, ParameterName, nClustersStr());
+    DAAL_CHECK_EX(nTrials > 0, ErrorIncorrectParameter, ParameterName, nTrialsStr());
 }
 
 DistributedStep2LocalPlusPlusParameter::DistributedStep2LocalPlusPlusParameter(size_t _nClusters, bool bFirstIteration) :
@@ -70,6 +71,8 @@ DistributedStep2LocalPlusPlusParameter::DistributedStep2LocalPlusPlusParameter(c
 
 void DistributedStep2LocalPlusPlusParameter::check() const
 {
+    /* Greedy selection of the candidates is not supported in the distributed processing mode */
+    DAAL_CHECK_EX(nTrials == 1, ErrorIncorrectParameter, ParameterName, nTrialsStr());
 }
 
 } // namespace interface1
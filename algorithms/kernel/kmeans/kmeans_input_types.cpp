@@ -76,7 +76,7 @@ size_t Input::getNumberOfFeatures() const
 void Input::check(const daal::algorithms::Parameter *parameter, int method) const
 {
     const Parameter *kmPar = static_cast<const Parameter *>(parameter);
-    if(method == lloydCSR)
+    if(method == lloydCSR || method == miniBatchCSR)
     {
         int expectedLayout = (int)NumericTableIface::csrArray;
         if (!checkNumericTable(get(data).get(), this->_errors.get(), dataStr(), 0, expectedLayout)) { return; }
@@ -31,6 +31,8 @@
 #include "service_spblas.h"
 #include "service_defines.h"
 
+#include "kmeans_distance_argmin_impl.i"
+
 
 // CPU intrinsics for Intel Compiler only
 #if defined (__INTEL_COMPILER) && defined(__linux__) && defined(__x86_64__)
@@ -100,7 +102,8 @@ void *kmeansInitTask(int dim, int clNum, algorithmFPType *centroids,
             return 0;
         }
 
-        tt->mkl_buff = service_calloc<algorithmFPType, cpu>(t->max_block_size * t->clNum);
+        /* The buffer keeps at least two columns: indices and values of the minimums are stored there */
+        tt->mkl_buff = service_malloc<algorithmFPType, cpu>(t->max_block_size * (t->clNum > 1 ? t->clNum : 2));
         if(!tt->mkl_buff)
         {
             _errors->add(services::ErrorMemoryAllocationFailed);
@@ -166,6 +169,26 @@ struct Fp2IntSize {};
 template<> struct Fp2IntSize<float>  { typedef int IntT;     };
 template<> struct Fp2IntSize<double> { typedef __int64 IntT; };
 
+/**
+ *  Adds the observation to the partial sums of the nearest cluster
+ *  \return Contribution of the observation to the goal function
+ */
+template<typename algorithmFPType, CpuType cpu>
+inline algorithmFPType kmeansAddRowToCluster(size_t p, const algorithmFPType *row, size_t minIdx, algorithmFPType minGoalVal,
+                                             int *cS0, algorithmFPType *cS1)
+{
+  PRAGMA_ICC_NO16(omp simd reduction(+:minGoalVal))
+    for (size_t j = 0; j < p; j++)
+    {
+        cS1[minIdx * p + j] += row[j];
+        minGoalVal += row[j] * row[j];
+    }
+
+    cS0[minIdx]++;
+
+    return minGoalVal;
+}
+
 template<typename algorithmFPType, CpuType cpu, int assignFlag>
 void addNTToTaskThreadedDense(void *task_id, const NumericTable *ntData, algorithmFPType *catCoef, NumericTable *ntAssign = 0 )
 {
@@ -211,75 +234,96 @@ void addNTToTaskThreadedDense(void *task_id, const NumericTable *ntData, algorit
             assignments = assignBlock.getBlockPtr();
         }
 
-        char transa = 't';
-        char transb = 'n';
-        DAAL_INT _m = blockSize;
-        DAAL_INT _n = nClusters;
-        DAAL_INT _k = p;
-        algorithmFPType alpha = -1.0;
-        DAAL_INT lda = p;
-        DAAL_INT ldy = p;
-        algorithmFPType beta = 1.0;
-        DAAL_INT ldaty = blockSize;
+        algorithmFPType goal = (algorithmFPType)0;
 
-      PRAGMA_IVDEP
-        for (size_t j = 0; j < nClusters; j++)
+        if( DistanceArgmin<algorithmFPType, cpu>::getTileSize(p) <= blockSizeDeafult * nClusters )
         {
-            for (size_t i = 0; i < blockSize; i++)
-            {
-                x_clusters[i + j*blockSize] = clustersSq[j];
-            }
-        }
+            /* Fused search of the nearest centroids: the matrix of distances is not stored */
+            const size_t nRowsInTile = DistanceArgmin<algorithmFPType, cpu>::nRowsInTile;
+            algorithmFPType minGoalVal[nRowsInTile];
+            int minIdx[nRowsInTile];
 
-        Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, data,
-                                           &lda, inClusters, &ldy, &beta, x_clusters, &ldaty);
+            for (size_t iStart = 0; iStart < blockSize; iStart += nRowsInTile)
+            {
+                size_t nTileRows = (blockSize - iStart < nRowsInTile ? blockSize - iStart : nRowsInTile);
+                const algorithmFPType *tileData = data + iStart * p;
 
-        typedef typename Fp2IntSize<algorithmFPType>::IntT algIntType;
+                DistanceArgmin<algorithmFPType, cpu>::findInTile(nTileRows, p, tileData, nClusters, inClusters, clustersSq,
+                                                                 x_clusters, minGoalVal, minIdx);
 
-      PRAGMA_ICC_OMP(simd simdlen(16))
-        for (algIntType i = 0; i < (algIntType)blockSize; i++)
+                for (size_t i = 0; i < nTileRows; i++)
+                {
+                    goal += kmeansAddRowToCluster<algorithmFPType, cpu>(p, tileData + i * p, minIdx[i],
+                                                                         (algorithmFPType)2.0 * minGoalVal[i], cS0, cS1);
+                    if(assignFlag)
+                    {
+                        assignments[iStart + i] = minIdx[i];
+                    }
+                }
+            }
+        }
+        else
         {
-            algorithmFPType minGoalVal = x_clusters[i];
-            algIntType minIdx = 0;
+            char transa = 't';
+            char transb = 'n';
+            DAAL_INT _m = blockSize;
+            DAAL_INT _n = nClusters;
+            DAAL_INT _k = p;
+            algorithmFPType alpha = -1.0;
+            DAAL_INT lda = p;
+            DAAL_INT ldy = p;
+            algorithmFPType beta = 1.0;
+            DAAL_INT ldaty = blockSize;
 
-            for (algIntType j = 0; j < (algIntType)nClusters; j++)
+          PRAGMA_IVDEP
+            for (size_t j = 0; j < nClusters; j++)
             {
-                algorithmFPType localGoalVal = x_clusters[i + j*blockSize];
-                if( minGoalVal > localGoalVal )
+                for (size_t i = 0; i < blockSize; i++)
                 {
-                    minGoalVal = localGoalVal;
-                    minIdx = j;
+                    x_clusters[i + j*blockSize] = clustersSq[j];
                 }
             }
 
-            minGoalVal *= 2.0;
+            Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, data,
+                                               &lda, inClusters, &ldy, &beta, x_clusters, &ldaty);
 
-            *((algIntType*)&(x_clusters[i])) = minIdx;
-            x_clusters[i+blockSize] = minGoalVal;
-        }
+            typedef typename Fp2IntSize<algorithmFPType>::IntT algIntType;
 
-        algorithmFPType goal = (algorithmFPType)0;
-        for (size_t i = 0; i < blockSize; i++)
-        {
-            size_t minIdx = *((algIntType*)&(x_clusters[i]));
-            algorithmFPType minGoalVal = x_clusters[i+blockSize];
-
-          PRAGMA_ICC_NO16(omp simd reduction(+:minGoalVal))
-            for (size_t j = 0; j < p; j++)
+          PRAGMA_ICC_OMP(simd simdlen(16))
+            for (algIntType i = 0; i < (algIntType)blockSize; i++)
             {
-                cS1[minIdx * p + j] += data[i*p + j];
-                minGoalVal += data[ i*p + j ] * data[ i*p + j ];
-            }
+                algorithmFPType minGoalVal = x_clusters[i];
+                algIntType minIdx = 0;
 
-            cS0[minIdx]++;
+                for (algIntType j = 0; j < (algIntType)nClusters; j++)
+                {
+                    algorithmFPType localGoalVal = x_clusters[i + j*blockSize];
+                    if( minGoalVal > localGoalVal )
+                    {
+                        minGoalVal = localGoalVal;
+                        minIdx = j;
+                    }
+                }
 
-            goal += minGoalVal;
+                minGoalVal *= 2.0;
 
-            if(assignFlag)
-            {
-                assignments[i] = (int)minIdx;
+                *((algIntType*)&(x_clusters[i])) = minIdx;
+                x_clusters[i+blockSize] = minGoalVal;
             }
-        } /* for (size_t i = 0; i < blockSize; i++) */
+
+            for (size_t i = 0; i < blockSize; i++)
+            {
+                size_t minIdx = *((algIntType*)&(x_clusters[i]));
+                algorithmFPType minGoalVal = x_clusters[i+blockSize];
+
+                goal += kmeansAddRowToCluster<algorithmFPType, cpu>(p, data + i * p, minIdx, minGoalVal, cS0, cS1);
+
+                if(assignFlag)
+                {
+                    assignments[i] = (int)minIdx;
+                }
+            } /* for (size_t i = 0; i < blockSize; i++) */
+        }
 
         *trg  += goal;
 
@@ -450,35 +494,42 @@ void getNTAssignmentsThreaded(void *task_id, const NumericTable *ntData, const N
         algorithmFPType *clustersSq = t->clSq;
         algorithmFPType *x_clusters = tt->mkl_buff;
 
-        char transa = 't';
-        char transb = 'n';
-        DAAL_INT _m = nClusters;
-        DAAL_INT _n = blockSize;
-        DAAL_INT _k = p;
-        algorithmFPType alpha = 1.0;
-        DAAL_INT lda = p;
-        DAAL_INT ldy = p;
-        algorithmFPType beta = 0.0;
-        DAAL_INT ldaty = nClusters;
-
-        Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, inClusters,
-                                           &lda, data, &ldy, &beta, x_clusters, &ldaty);
-
-        for (size_t i = 0; i < blockSize; i++)
+        if( DistanceArgmin<algorithmFPType, cpu>::getTileSize(p) <= blockSizeDeafult * nClusters )
         {
-            algorithmFPType minGoalVal = clustersSq[0] - x_clusters[i * nClusters];
-            size_t minIdx = 0;
+            DistanceArgmin<algorithmFPType, cpu>::find(blockSize, p, data, nClusters, inClusters, clustersSq, x_clusters, assign);
+        }
+        else
+        {
+            char transa = 't';
+            char transb = 'n';
+            DAAL_INT _m = nClusters;
+            DAAL_INT _n = blockSize;
+            DAAL_INT _k = p;
+            algorithmFPType alpha = 1.0;
+            DAAL_INT lda = p;
+            DAAL_INT ldy = p;
+            algorithmFPType beta = 0.0;
+            DAAL_INT ldaty = nClusters;
 
-            for (size_t j = 0; j < nClusters; j++)
+            Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, inClusters,
+                                               &lda, data, &ldy, &beta, x_clusters, &ldaty);
+
+            for (size_t i = 0; i < blockSize; i++)
             {
-                if( minGoalVal > clustersSq[j] - x_clusters[i*nClusters + j] )
+                algorithmFPType minGoalVal = clustersSq[0] - x_clusters[i * nClusters];
+                size_t minIdx = 0;
+
+                for (size_t j = 0; j < nClusters; j++)
                 {
-                    minGoalVal = clustersSq[j] - x_clusters[i*nClusters + j];
-                    minIdx = j;
+                    if( minGoalVal > clustersSq[j] - x_clusters[i*nClusters + j] )
+                    {
+                        minGoalVal = clustersSq[j] - x_clusters[i*nClusters + j];
+                        minIdx = j;
+                    }
                 }
-            }
 
-            assign[i] = minIdx;
+                assign[i] = minIdx;
+            }
         }
 
         mtAssign.release();
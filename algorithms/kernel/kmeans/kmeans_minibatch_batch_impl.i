@@ -0,0 +1,153 @@
+/* file: kmeans_minibatch_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the mini-batch method for K-means algorithm
+//  in the batch processing mode.
+//--
+*/
+
+#include "algorithm.h"
+#include "numeric_table.h"
+#include "threading.h"
+#include "daal_defines.h"
+#include "service_memory.h"
+#include "service_micro_table.h"
+
+#include "kmeans_minibatch_impl.i"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+
+/**
+ *  Processes maxIterations consecutive mini-batches of the input table.
+ *  The mini-batches wrap around the end of the table.
+ *  The goal function is computed on the whole input table with the final centroids
+ */
+template <Method method, typename algorithmFPType, CpuType cpu>
+void KMeansMiniBatchBatchKernel<method, algorithmFPType, cpu>::compute( size_t na, const NumericTable *const *a,
+                                                                        size_t nr, const NumericTable *const *r, const Parameter *par)
+{
+    const NumericTable *ntData = a[0];
+
+    size_t nIter = par->maxIterations;
+
+    size_t p = ntData->getNumberOfColumns();
+    size_t n = ntData->getNumberOfRows();
+    size_t nClusters = par->nClusters;
+    size_t batchSize = (par->batchSize < n ? par->batchSize : n);
+
+    algorithmFPType *nObs     = service_calloc<algorithmFPType, cpu>(nClusters);
+    algorithmFPType *sums     = service_calloc<algorithmFPType, cpu>(nClusters * p);
+    algorithmFPType *batchSum = service_calloc<algorithmFPType, cpu>(p);
+    if(!nObs || !sums || !batchSum)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        service_free<algorithmFPType, cpu>(nObs);
+        service_free<algorithmFPType, cpu>(sums);
+        service_free<algorithmFPType, cpu>(batchSum);
+        return;
+    }
+
+    BlockMicroTable<algorithmFPType, readOnly,  cpu> mtInClusters( a[1] );
+    BlockMicroTable<algorithmFPType, writeOnly, cpu> mtClusters( r[0] );
+
+    algorithmFPType *inClusters;
+    algorithmFPType *clusters;
+
+    mtInClusters.getBlockOfRows( 0, nClusters, &inClusters );
+    mtClusters  .getBlockOfRows( 0, nClusters, &clusters   );
+
+    for (size_t i = 0; i < nClusters * p; i++)
+    {
+        sums[i]     = inClusters[i];
+        clusters[i] = inClusters[i];
+    }
+
+    mtInClusters.release();
+
+    MiniBatchRows<method, algorithmFPType, cpu> batchRows( ntData );
+    size_t startRow = 0;
+    size_t kIter;
+
+    for(kIter = 0; kIter < nIter; kIter++)
+    {
+        size_t nRows = (startRow + batchSize <= n ? batchSize : n - startRow);
+
+        NumericTable *ntBatch = batchRows.get(startRow, nRows);
+        bool isOk = kmeansMiniBatchUpdate<method, algorithmFPType, cpu>(ntBatch, p, nClusters, nObs, sums, clusters,
+                                                                        batchSum, 0, this->_errors);
+        batchRows.release();
+        if(!isOk) { break; }
+
+        startRow += nRows;
+        if(startRow == n) { startRow = 0; }
+    }
+
+    service_free<algorithmFPType, cpu>(nObs);
+    service_free<algorithmFPType, cpu>(sums);
+    service_free<algorithmFPType, cpu>(batchSum);
+
+    /* The goal function is computed in the same pass that assigns the observations to the clusters */
+    algorithmFPType goalFunc = (algorithmFPType)0.0;
+    if( this->_errors->size() == 0 )
+    {
+        void *task = kmeansInitTask<algorithmFPType, cpu>(p, nClusters, clusters, this->_errors);
+        if(task)
+        {
+            if( par->assignFlag )
+            {
+                NumericTable *ntAssignments = const_cast<NumericTable *>(r[1]);
+                addNTToTaskThreaded<__DAAL_KMEANS_MINIBATCH_LLOYD_METHOD(method), algorithmFPType, cpu, 1>(task, ntData, 0, ntAssignments);
+            }
+            else
+            {
+                addNTToTaskThreaded<__DAAL_KMEANS_MINIBATCH_LLOYD_METHOD(method), algorithmFPType, cpu, 0>(task, ntData, 0);
+            }
+            kmeansClearClusters<algorithmFPType, cpu>(task, &goalFunc);
+        }
+    }
+
+    mtClusters.release();
+
+    int* nIterations;
+    BlockMicroTable<int, writeOnly, cpu> mtIterations( r[3] );
+    mtIterations.getBlockOfRows(0, 1, &nIterations);
+    *nIterations = kIter;
+    mtIterations.release();
+
+    algorithmFPType *goal;
+    BlockMicroTable<algorithmFPType, writeOnly, cpu> mtTarget( r[2] );
+    mtTarget.getBlockOfRows(0, 1, &goal);
+    *goal = goalFunc;
+    mtTarget.release();
+}
+
+} // namespace daal::algorithms::kmeans::internal
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
@@ -0,0 +1,180 @@
+/* file: kmeans_minibatch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of auxiliary functions used in the mini-batch method
+//  of K-means algorithm.
+//
+//  The per-centroid learning rate of the mini-batch K-means (D. Sculley, 2010)
+//  is the inverse number of observations assigned to the centroid so far,
+//  so every centroid is the mean of all the observations assigned to it.
+//  Hence the state of the method is kept as the number of observations and
+//  the sum of observations for each centroid. Until the first observation is
+//  assigned to a centroid, its sum holds the initial centroid itself.
+//--
+*/
+
+#include "service_numeric_table.h"
+#include "kmeans_lloyd_impl.i"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+
+/* Lloyd method that processes the data of the same layout as the given mini-batch method */
+#define __DAAL_KMEANS_MINIBATCH_LLOYD_METHOD(method) (((method) == miniBatchCSR) ? lloydCSR : lloydDense)
+
+/**
+ *  Provides rows of the input table as a numeric table that refers to the memory of the input table
+ */
+template<Method method, typename algorithmFPType, CpuType cpu>
+class MiniBatchRows
+{
+public:
+    MiniBatchRows(const NumericTable *ntData) : _mtDense(ntData), _mtCSR(ntData), _p(ntData->getNumberOfColumns()) {}
+
+    NumericTable *get(size_t startRow, size_t nRows)
+    {
+        if(method == miniBatchCSR)
+        {
+            algorithmFPType *values;
+            size_t *colIdx, *rowOffsets;
+            _mtCSR.getSparseBlock(startRow, nRows, &values, &colIdx, &rowOffsets);
+            _rows = NumericTablePtr(new CSRNumericTable(values, colIdx, rowOffsets, _p, nRows));
+        }
+        else
+        {
+            algorithmFPType *values;
+            _mtDense.getBlockOfRows(startRow, nRows, &values);
+            _rows = NumericTablePtr(new HomogenNumericTableCPU<algorithmFPType, cpu>(values, _p, nRows));
+        }
+        return _rows.get();
+    }
+
+    void release()
+    {
+        _rows = NumericTablePtr();
+        if(method == miniBatchCSR)
+        {
+            _mtCSR.release();
+        }
+        else
+        {
+            _mtDense.release();
+        }
+    }
+
+private:
+    BlockMicroTable<algorithmFPType, readOnly, cpu> _mtDense;
+    CSRBlockMicroTable<algorithmFPType, readOnly, cpu> _mtCSR;
+    NumericTablePtr _rows;
+    size_t _p;
+};
+
+/**
+ *  Computes centroids from the numbers and the sums of observations assigned to them
+ */
+template<typename algorithmFPType, CpuType cpu>
+void kmeansMiniBatchCentroids(size_t p, size_t nClusters, const algorithmFPType *nObs, const algorithmFPType *sums,
+                              algorithmFPType *centroids)
+{
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        algorithmFPType coeff = (nObs[i] > (algorithmFPType)0.0) ? (algorithmFPType)1.0 / nObs[i] : (algorithmFPType)1.0;
+
+      PRAGMA_IVDEP
+        for (size_t j = 0; j < p; j++)
+        {
+            centroids[i * p + j] = sums[i * p + j] * coeff;
+        }
+    }
+}
+
+/**
+ *  Assigns observations of the mini-batch to the nearest centroids and moves
+ *  these centroids towards the observations with per-centroid learning rates.
+ *  If goalFunc is not null, the goal function of the mini-batch is added to it
+ *  \return false if the memory allocation failed
+ */
+template<Method method, typename algorithmFPType, CpuType cpu>
+bool kmeansMiniBatchUpdate(const NumericTable *ntBatch, size_t p, size_t nClusters,
+                           algorithmFPType *nObs, algorithmFPType *sums, algorithmFPType *centroids,
+                           algorithmFPType *batchSum, algorithmFPType *goalFunc,
+                           services::SharedPtr<services::KernelErrorCollection> &errors)
+{
+    void *task = kmeansInitTask<algorithmFPType, cpu>(p, nClusters, centroids, errors);
+    if(!task) { return false; }
+
+    addNTToTaskThreaded<__DAAL_KMEANS_MINIBATCH_LLOYD_METHOD(method), algorithmFPType, cpu, 0>(task, ntBatch, 0);
+
+    for (size_t i = 0; i < nClusters; i++)
+    {
+        for (size_t j = 0; j < p; j++)
+        {
+            batchSum[j] = 0.0;
+        }
+
+        int batchNObs = kmeansUpdateCluster<algorithmFPType, cpu>( task, i, batchSum );
+        if (batchNObs == 0) { continue; }
+
+        algorithmFPType *sum = sums + i * p;
+        if (nObs[i] > (algorithmFPType)0.0)
+        {
+          PRAGMA_IVDEP
+            for (size_t j = 0; j < p; j++)
+            {
+                sum[j] += batchSum[j];
+            }
+        }
+        else
+        {
+            /* The initial centroid is replaced with the first observations assigned to it */
+          PRAGMA_IVDEP
+            for (size_t j = 0; j < p; j++)
+            {
+                sum[j] = batchSum[j];
+            }
+        }
+        nObs[i] += (algorithmFPType)batchNObs;
+
+        algorithmFPType coeff = (algorithmFPType)1.0 / nObs[i];
+      PRAGMA_IVDEP
+        for (size_t j = 0; j < p; j++)
+        {
+            centroids[i * p + j] = sum[j] * coeff;
+        }
+    }
+
+    algorithmFPType batchGoalFunc = (algorithmFPType)0.0;
+    kmeansClearClusters<algorithmFPType, cpu>(task, (goalFunc ? &batchGoalFunc : 0));
+    if(goalFunc) { *goalFunc += batchGoalFunc; }
+    return true;
+}
+
+} // namespace daal::algorithms::kmeans::internal
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
@@ -0,0 +1,69 @@
+/* file: kmeans_minibatch_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template classes that compute K-means with the mini-batch method.
+//--
+*/
+
+#ifndef _KMEANS_MINIBATCH_KERNEL_H
+#define _KMEANS_MINIBATCH_KERNEL_H
+
+#include "kmeans_types.h"
+#include "kmeans_lloyd_kernel.h"
+#include "kernel.h"
+#include "numeric_table.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+class KMeansMiniBatchBatchKernel: public Kernel
+{
+public:
+    void compute(size_t na, const NumericTable *const *a, size_t nr, const NumericTable *const *r, const Parameter *par);
+};
+
+template <typename algorithmFPType, CpuType cpu>
+class KMeansBatchKernel<miniBatchDense, algorithmFPType, cpu> : public KMeansMiniBatchBatchKernel<miniBatchDense, algorithmFPType, cpu> {};
+
+template <typename algorithmFPType, CpuType cpu>
+class KMeansBatchKernel<miniBatchCSR, algorithmFPType, cpu> : public KMeansMiniBatchBatchKernel<miniBatchCSR, algorithmFPType, cpu> {};
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+class KMeansOnlineKernel: public Kernel
+{
+public:
+    void compute(size_t na, const NumericTable *const *a, size_t nr, const NumericTable *const *r, const Parameter *par);
+    void finalizeCompute(size_t na, const NumericTable *const *a, size_t nr, const NumericTable *const *r, const Parameter *par);
+};
+
+} // namespace daal::algorithms::kmeans::internal
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
+
+#endif
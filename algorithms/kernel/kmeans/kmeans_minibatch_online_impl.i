@@ -0,0 +1,153 @@
+/* file: kmeans_minibatch_online_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the mini-batch method for K-means algorithm
+//  in the online processing mode.
+//--
+*/
+
+#include "algorithm.h"
+#include "numeric_table.h"
+#include "threading.h"
+#include "daal_defines.h"
+#include "service_memory.h"
+#include "service_micro_table.h"
+
+#include "kmeans_minibatch_impl.i"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+
+/**
+ *  Updates the numbers and the sums of observations assigned to centroids
+ *  with mini-batches of the next block of data.
+ *  The goal functions of the mini-batches and the number of processed mini-batches
+ *  are accumulated in the partial results
+ */
+template <Method method, typename algorithmFPType, CpuType cpu>
+void KMeansOnlineKernel<method, algorithmFPType, cpu>::compute( size_t na, const NumericTable *const *a,
+                                                                size_t nr, const NumericTable *const *r, const Parameter *par)
+{
+    const NumericTable *ntData = a[0];
+
+    size_t p = ntData->getNumberOfColumns();
+    size_t n = ntData->getNumberOfRows();
+    size_t nClusters = par->nClusters;
+    size_t batchSize = par->batchSize;
+
+    BlockMicroTable<algorithmFPType, readWrite, cpu> mtNObs    ( r[0] );
+    BlockMicroTable<algorithmFPType, readWrite, cpu> mtSums    ( r[1] );
+    BlockMicroTable<algorithmFPType, readWrite, cpu> mtGoalFunc( r[2] );
+    BlockMicroTable<int,             readWrite, cpu> mtNBatches( r[3] );
+
+    algorithmFPType *nObs;
+    algorithmFPType *sums;
+    algorithmFPType *goalFunc;
+    int *nBatches;
+
+    mtNObs    .getBlockOfRows(0, nClusters, &nObs    );
+    mtSums    .getBlockOfRows(0, nClusters, &sums    );
+    mtGoalFunc.getBlockOfRows(0, 1,         &goalFunc);
+    mtNBatches.getBlockOfRows(0, 1,         &nBatches);
+
+    algorithmFPType *centroids = service_calloc<algorithmFPType, cpu>(nClusters * p);
+    algorithmFPType *batchSum  = service_calloc<algorithmFPType, cpu>(p);
+    if(!centroids || !batchSum)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+    else
+    {
+        kmeansMiniBatchCentroids<algorithmFPType, cpu>(p, nClusters, nObs, sums, centroids);
+
+        MiniBatchRows<method, algorithmFPType, cpu> batchRows( ntData );
+        for (size_t startRow = 0; startRow < n; startRow += batchSize)
+        {
+            size_t nRows = (startRow + batchSize <= n ? batchSize : n - startRow);
+
+            NumericTable *ntBatch = batchRows.get(startRow, nRows);
+            bool isOk = kmeansMiniBatchUpdate<method, algorithmFPType, cpu>(ntBatch, p, nClusters, nObs, sums, centroids,
+                                                                            batchSum, goalFunc, this->_errors);
+            batchRows.release();
+            if(!isOk) { break; }
+            (*nBatches)++;
+        }
+    }
+
+    service_free<algorithmFPType, cpu>(centroids);
+    service_free<algorithmFPType, cpu>(batchSum);
+
+    mtNObs    .release();
+    mtSums    .release();
+    mtGoalFunc.release();
+    mtNBatches.release();
+}
+
+template <Method method, typename algorithmFPType, CpuType cpu>
+void KMeansOnlineKernel<method, algorithmFPType, cpu>::finalizeCompute( size_t na, const NumericTable *const *a,
+                                                                        size_t nr, const NumericTable *const *r, const Parameter *par)
+{
+    size_t p = a[1]->getNumberOfColumns();
+    size_t nClusters = par->nClusters;
+
+    BlockMicroTable<algorithmFPType, readOnly,  cpu> mtNObs     ( a[0] );
+    BlockMicroTable<algorithmFPType, readOnly,  cpu> mtSums     ( a[1] );
+    BlockMicroTable<algorithmFPType, readOnly,  cpu> mtInGoal   ( a[2] );
+    BlockMicroTable<int,             readOnly,  cpu> mtNBatches ( a[3] );
+    BlockMicroTable<algorithmFPType, writeOnly, cpu> mtCentroids( r[0] );
+    BlockMicroTable<algorithmFPType, writeOnly, cpu> mtGoal     ( r[1] );
+    BlockMicroTable<int,             writeOnly, cpu> mtIterations( r[2] );
+
+    algorithmFPType *nObs, *sums, *inGoal, *centroids, *goal;
+    int *nBatches, *nIterations;
+
+    mtNObs     .getBlockOfRows(0, nClusters, &nObs     );
+    mtSums     .getBlockOfRows(0, nClusters, &sums     );
+    mtInGoal   .getBlockOfRows(0, 1,         &inGoal   );
+    mtNBatches .getBlockOfRows(0, 1,         &nBatches );
+    mtCentroids.getBlockOfRows(0, nClusters, &centroids);
+    mtGoal     .getBlockOfRows(0, 1,         &goal     );
+    mtIterations.getBlockOfRows(0, 1,        &nIterations);
+
+    kmeansMiniBatchCentroids<algorithmFPType, cpu>(p, nClusters, nObs, sums, centroids);
+    *goal = *inGoal;
+    *nIterations = *nBatches;
+
+    mtNObs     .release();
+    mtSums     .release();
+    mtInGoal   .release();
+    mtNBatches .release();
+    mtCentroids.release();
+    mtGoal     .release();
+    mtIterations.release();
+}
+
+} // namespace daal::algorithms::kmeans::internal
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
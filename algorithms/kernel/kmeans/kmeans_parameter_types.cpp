@@ -44,7 +44,7 @@ namespace interface1
  */
 Parameter::Parameter(size_t _nClusters, size_t _maxIterations) :
     nClusters(_nClusters), maxIterations(_maxIterations), accuracyThreshold(0.0), gamma(1.0),
-    distanceType(euclidean), assignFlag(true) {}
+    distanceType(euclidean), assignFlag(true), batchSize(1024) {}
 
 /**
  *  Constructs parameters of the K-Means algorithm by copying another parameters of the K-Means algorithm
@@ -53,7 +53,7 @@ Parameter::Parameter(size_t _nClusters, size_t _maxIterations) :
 Parameter::Parameter(const Parameter &other) :
     nClusters(other.nClusters), maxIterations(other.maxIterations),
     accuracyThreshold(other.accuracyThreshold), gamma(other.gamma),
-    distanceType(other.distanceType), assignFlag(other.assignFlag)
+    distanceType(other.distanceType), assignFlag(other.assignFlag), batchSize(other.batchSize)
 {}
 
 void Parameter::check() const
@@ -61,6 +61,7 @@ void Parameter::check() const
     DAAL_CHECK_EX(nClusters > 0, ErrorIncorrectParameter, ParameterName, nClustersStr());
     DAAL_CHECK_EX(accuracyThreshold >= 0, ErrorIncorrectParameter, ParameterName, accuracyThresholdStr());
     DAAL_CHECK_EX(gamma >= 0, ErrorIncorrectParameter, ParameterName, gammaStr());
+    DAAL_CHECK_EX(batchSize > 0, ErrorIncorrectParameter, ParameterName, batchSizeStr());
 }
 
 } // namespace interface1
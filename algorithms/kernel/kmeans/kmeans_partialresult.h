@@ -55,6 +55,12 @@ DAAL_EXPORT void PartialResult::allocate(const daal::algorithms::Input *input, c
     Argument::set(partialGoalFunction, data_management::SerializationIfacePtr(
                       new data_management::HomogenNumericTable<algorithmFPType>(1, 1, data_management::NumericTable::doAllocate)));
 
+    if( method == miniBatchDense || method == miniBatchCSR )
+    {
+        Argument::set(nMiniBatches, data_management::SerializationIfacePtr(
+                          new data_management::HomogenNumericTable<int>(1, 1, data_management::NumericTable::doAllocate)));
+    }
+
     if( kmPar->assignFlag )
     {
         Input *algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
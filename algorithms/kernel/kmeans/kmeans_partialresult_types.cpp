@@ -37,7 +37,7 @@ namespace kmeans
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_KMEANS_PARTIAL_RESULT_ID);
-PartialResult::PartialResult() : daal::algorithms::PartialResult(4) {}
+PartialResult::PartialResult() : daal::algorithms::PartialResult(5) {}
 
 /**
  * Returns a partial result of the K-Means algorithm
@@ -86,6 +86,10 @@ void PartialResult::check(const daal::algorithms::Input *input, const daal::algo
     if (!checkNumericTable(get(nObservations).get(), this->_errors.get(), nObservationsStr(), unexpectedLayouts, 0, 1, kmPar->nClusters)) { return; }
     if (!checkNumericTable(get(partialSums).get(), this->_errors.get(), partialSumsStr(), unexpectedLayouts, 0, inputFeatures, kmPar->nClusters)) { return; }
     if (!checkNumericTable(get(partialGoalFunction).get(), this->_errors.get(), partialGoalFunctionStr(), unexpectedLayouts, 0, 1, 1)) { return; }
+    if (method == miniBatchDense || method == miniBatchCSR)
+    {
+        if (!checkNumericTable(get(nMiniBatches).get(), this->_errors.get(), nMiniBatchesStr(), unexpectedLayouts, 0, 1, 1)) { return; }
+    }
 
     if( kmPar->assignFlag )
     {
@@ -108,6 +112,60 @@ void PartialResult::check(const daal::algorithms::Parameter *par, int method) co
 
     if (!checkNumericTable(get(nObservations).get(), this->_errors.get(), nObservationsStr(), unexpectedLayouts, 0, 1, kmPar->nClusters)) { return; }
     if (!checkNumericTable(get(partialSums).get(), this->_errors.get(), partialSumsStr(), unexpectedLayouts, 0, 0, kmPar->nClusters)) { return; }
+    if (method == miniBatchDense || method == miniBatchCSR)
+    {
+        if (!checkNumericTable(get(nMiniBatches).get(), this->_errors.get(), nMiniBatchesStr(), unexpectedLayouts, 0, 1, 1)) { return; }
+    }
+}
+
+/**
+ * Initializes partial results of the K-Means algorithm in the online processing mode
+ * \param[in] input   %Input object of the algorithm
+ * \param[in] par     Algorithm parameter
+ * \param[in] method  Computation method
+ */
+void PartialResult::initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method)
+{
+    const Input *algInput = static_cast<const Input *>(input);
+    const Parameter *kmPar = static_cast<const Parameter *>(par);
+    size_t nClusters = kmPar->nClusters;
+    size_t nFeatures = algInput->getNumberOfFeatures();
+
+    NumericTablePtr inCentroidsTable = algInput->get(inputCentroids);
+    NumericTablePtr sumsTable        = get(partialSums);
+    NumericTablePtr nObsTable        = get(nObservations);
+    NumericTablePtr goalTable        = get(partialGoalFunction);
+    NumericTablePtr nBatchesTable    = get(nMiniBatches);
+
+    BlockDescriptor<double> inCentroidsBlock, sumsBlock, nObsBlock, goalBlock;
+    BlockDescriptor<int> nBatchesBlock;
+    inCentroidsTable->getBlockOfRows(0, nClusters, readOnly,  inCentroidsBlock);
+    sumsTable       ->getBlockOfRows(0, nClusters, writeOnly, sumsBlock);
+    nObsTable       ->getBlockOfRows(0, nClusters, writeOnly, nObsBlock);
+    goalTable       ->getBlockOfRows(0, 1,         writeOnly, goalBlock);
+    nBatchesTable   ->getBlockOfRows(0, 1,         writeOnly, nBatchesBlock);
+
+    double *inCentroids = inCentroidsBlock.getBlockPtr();
+    double *sums        = sumsBlock.getBlockPtr();
+    double *nObs        = nObsBlock.getBlockPtr();
+
+    /* Until the first observation is assigned to a cluster, its partial sum holds the initial centroid */
+    for(size_t i = 0; i < nClusters * nFeatures; i++)
+    {
+        sums[i] = inCentroids[i];
+    }
+    for(size_t i = 0; i < nClusters; i++)
+    {
+        nObs[i] = 0.0;
+    }
+    goalBlock.getBlockPtr()[0] = 0.0;
+    nBatchesBlock.getBlockPtr()[0] = 0;
+
+    inCentroidsTable->releaseBlockOfRows(inCentroidsBlock);
+    sumsTable       ->releaseBlockOfRows(sumsBlock);
+    nObsTable       ->releaseBlockOfRows(nObsBlock);
+    goalTable       ->releaseBlockOfRows(goalBlock);
+    nBatchesTable   ->releaseBlockOfRows(nBatchesBlock);
 }
 
 } // namespace interface1
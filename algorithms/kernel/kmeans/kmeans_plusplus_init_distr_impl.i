@@ -446,7 +446,7 @@ void KMeansinitStep5MasterKernel<method, algorithmFPType, cpu>::finalizeCompute(
     if(pRngState && pRngState->size() && brng.loadState(pRngState->get()))
         this->_errors->add(ErrorIncorrectErrorcodeFromGenerator);
     TaskPlusPlusBatch<algorithmFPType, cpu, DataHelperDense<algorithmFPType, cpu> > task(const_cast<NumericTable*>(ntCand),
-        weightsBD.get(), pCentroids, par->nClusters, brng);
+        weightsBD.get(), pCentroids, par->nClusters, 1, brng);
     if(!task.run())
         this->_errors->add(services::ErrorMemoryAllocationFailed);
 }
@@ -31,6 +31,7 @@
 #include "service_rng.h"
 #include "service_blas.h"
 #include "service_spblas.h"
+#include "kmeans_distance_argmin_impl.i"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -49,8 +50,8 @@ namespace internal
 const size_t _nRowsInBlock = 512;
 
 //BlockHelperXXX template class is a helper class for a block of rows.
-//It provides multiplication of the block's rows to the given matrix of centers
-//and the result access according to the data type.
+//It provides the search of the nearest of the given centers for the block's rows
+//according to the data type.
 //Single interface hides data-specific manipulations.
 
 //BlockHelperDense is the helper class for the dense data type
@@ -61,6 +62,47 @@ public:
     BlockHelperDense(NumericTableType* nt, size_t dim, size_t iStartRow, size_t nRowsToProcess) : _dim(dim),
         _ntDataBD(nt, iStartRow, nRowsToProcess){}
 
+    //find the nearest center for every row of the block using buffer of nRows*nCenters elements,
+    //centersNorm2 contains 0.5*(center, center) for each center
+    void findNearestCenters(const algorithmFPType* pCenters, const algorithmFPType* centersNorm2, size_t nRows, size_t nCenters,
+        algorithmFPType* buff, int* aNearest)
+    {
+        typedef kmeans::internal::DistanceArgmin<algorithmFPType, cpu> DistanceArgminType;
+        if(DistanceArgminType::getTileSize(_dim) <= nRows*nCenters)
+        {
+            //fused kernel does not store the distances to all the centers
+            DistanceArgminType::find(nRows, _dim, _ntDataBD.get(), nCenters, pCenters, centersNorm2, buff, aNearest);
+            return;
+        }
+        callGemm(pCenters, nRows, nCenters, buff);
+        for(size_t iRow = 0; iRow < nRows; ++iRow)
+        {
+            const algorithmFPType* pRow = buff + iRow*nCenters;
+            algorithmFPType valBest = centersNorm2[0] - pRow[0];
+            int iBest = 0;
+            for(size_t iCenter = 1; iCenter < nCenters; ++iCenter)
+            {
+                const algorithmFPType valCand = centersNorm2[iCenter] - pRow[iCenter];
+                if(valBest > valCand)
+                {
+                    valBest = valCand;
+                    iBest = (int)iCenter;
+                }
+            }
+            aNearest[iRow] = iBest;
+        }
+    }
+
+    algorithmFPType getRowSumSq(size_t iRow, const algorithmFPType* cen)
+    {
+        const algorithmFPType* pData = _ntDataBD.get() + iRow*_dim;
+        algorithmFPType norm2 = 0;
+        for(size_t i = 0; i < _dim; ++i)
+            norm2 += (pData[i] - cen[i])* (pData[i] - cen[i]);
+        return norm2;
+    }
+
+protected:
     void callGemm(const algorithmFPType* pCenters, size_t nRows, size_t nCenters, algorithmFPType* gemmResult)
     {
         char transa = 't';
@@ -78,20 +120,6 @@ public:
             &lda, const_cast<algorithmFPType*>(_ntDataBD.get()), &ldy, &beta, gemmResult, &ldaty);
     }
 
-    algorithmFPType getRowSumSq(size_t iRow, const algorithmFPType* cen)
-    {
-        const algorithmFPType* pData = _ntDataBD.get() + iRow*_dim;
-        algorithmFPType norm2 = 0;
-        for(size_t i = 0; i < _dim; ++i)
-            norm2 += (pData[i] - cen[i])* (pData[i] - cen[i]);
-        return norm2;
-    }
-
-    algorithmFPType getGemmResult(size_t iRow, size_t iCol, size_t nRows, size_t nCols, const algorithmFPType* gemmResult) const
-    {
-        return gemmResult[iRow*nCols + iCol];
-    }
-
 protected:
     ReadRows<algorithmFPType, cpu> _ntDataBD;
     const size_t _dim;
@@ -105,6 +133,42 @@ public:
     BlockHelperCSR(NumericTableType* nt, size_t dim, size_t iStartRow, size_t nRowsToProcess) : _dim(dim),
         _ntDataBD(nt, iStartRow, nRowsToProcess){}
 
+    //find the nearest center for every row of the block using buffer of nRows*nCenters elements,
+    //centersNorm2 contains 0.5*(center, center) for each center
+    void findNearestCenters(const algorithmFPType* pCenters, const algorithmFPType* centersNorm2, size_t nRows, size_t nCenters,
+        algorithmFPType* buff, int* aNearest)
+    {
+        callGemm(pCenters, nRows, nCenters, buff);
+        for(size_t iRow = 0; iRow < nRows; ++iRow)
+        {
+            algorithmFPType valBest = centersNorm2[0] - buff[iRow];
+            int iBest = 0;
+            for(size_t iCenter = 1; iCenter < nCenters; ++iCenter)
+            {
+                const algorithmFPType valCand = centersNorm2[iCenter] - buff[iRow + iCenter*nRows];
+                if(valBest > valCand)
+                {
+                    valBest = valCand;
+                    iBest = (int)iCenter;
+                }
+            }
+            aNearest[iRow] = iBest;
+        }
+    }
+
+    algorithmFPType getRowSumSq(size_t iRow, const algorithmFPType* cen)
+    {
+        const size_t* rowIdx = _ntDataBD.rows();
+        const algorithmFPType* pData = _ntDataBD.values() + rowIdx[iRow] - 1;
+        const size_t* colIdx = _ntDataBD.cols() + rowIdx[iRow] - 1;
+        const size_t nValues = rowIdx[iRow + 1] - rowIdx[iRow];
+        algorithmFPType res(0.);
+        for(size_t i = 0; i < nValues; ++i)
+            res += (pData[i] - cen[colIdx[i] - 1])*(pData[i] - cen[colIdx[i] - 1]);
+        return res;
+    }
+
+protected:
     void callGemm(const algorithmFPType* pCenters, size_t nRows, size_t nCenters, algorithmFPType* gemmResult)
     {
         char transa = 'n';
@@ -125,23 +189,6 @@ public:
             pCenters, &_p, &beta, gemmResult, &_n);
     }
 
-    algorithmFPType getRowSumSq(size_t iRow, const algorithmFPType* cen)
-    {
-        const size_t* rowIdx = _ntDataBD.rows();
-        const algorithmFPType* pData = _ntDataBD.values() + rowIdx[iRow] - 1;
-        const size_t* colIdx = _ntDataBD.cols() + rowIdx[iRow] - 1;
-        const size_t nValues = rowIdx[iRow + 1] - rowIdx[iRow];
-        algorithmFPType res(0.);
-        for(size_t i = 0; i < nValues; ++i)
-            res += (pData[i] - cen[colIdx[i] - 1])*(pData[i] - cen[colIdx[i] - 1]);
-        return res;
-    }
-
-    algorithmFPType getGemmResult(size_t iRow, size_t iCol, size_t nRows, size_t nCols, const algorithmFPType* gemmResult) const
-    {
-        return gemmResult[iRow + iCol*nRows];
-    }
-
 protected:
     ReadRowsCSR<algorithmFPType, cpu> _ntDataBD;
     const size_t _dim;
@@ -180,6 +227,30 @@ public:
         }
         return sumOfDist2;
     }
+    //calculate the goal function in the block for each of nCandidates centers as if it was added to the clusters
+    void calcGoalInBlock(const algorithmFPType* aWeights, size_t iStartRow, size_t nRowsToProcess,
+        const algorithmFPType* pCandidates, size_t nCandidates, const algorithmFPType* aMinDist, algorithmFPType* aGoal) const
+    {
+        ReadRows<algorithmFPType, cpu> ntDataBD(nt(), iStartRow, nRowsToProcess);
+        const algorithmFPType* pData = ntDataBD.get();
+        const algorithmFPType* pDistSq = aMinDist + iStartRow;
+        for(size_t iCandidate = 0; iCandidate < nCandidates; ++iCandidate)
+            aGoal[iCandidate] = 0;
+        for(size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
+        {
+            const algorithmFPType* pRow = pData + iRow*dim;
+            for(size_t iCandidate = 0; iCandidate < nCandidates; ++iCandidate)
+            {
+                const algorithmFPType* pCandidate = pCandidates + iCandidate*dim;
+                algorithmFPType dist2(0);
+                for(size_t i = 0; i < dim; ++i)
+                    dist2 += (pRow[i] - pCandidate[i])*(pRow[i] - pCandidate[i]);
+                if(aWeights)
+                    dist2 *= aWeights[iStartRow + iRow];
+                aGoal[iCandidate] += (pDistSq[iRow] > dist2 ? dist2 : pDistSq[iRow]);
+            }
+        }
+    }
     //copy one row from the given table to the destination buffer and return the sum of squares
     //of the data in this row
     algorithmFPType copyOneRowCalcSumSq(size_t iRow, algorithmFPType* pDst) const
@@ -241,6 +312,35 @@ public:
         }
         return sumOfDist2;
     }
+    //calculate the goal function in the block for each of nCandidates centers as if it was added to the clusters
+    void calcGoalInBlock(const algorithmFPType* aWeights, size_t iStartRow, size_t nRowsToProcess,
+        const algorithmFPType* pCandidates, size_t nCandidates, const algorithmFPType* aMinDist, algorithmFPType* aGoal) const
+    {
+        ReadRowsCSR<algorithmFPType, cpu> ntDataBD(_csr, iStartRow, nRowsToProcess);
+        const algorithmFPType* pData = ntDataBD.values();
+        const size_t* colIdx = ntDataBD.cols();
+        const size_t* rowIdx = ntDataBD.rows();
+
+        const algorithmFPType* pDistSq = aMinDist + iStartRow;
+        for(size_t iCandidate = 0; iCandidate < nCandidates; ++iCandidate)
+            aGoal[iCandidate] = 0;
+        size_t csrStart = 0;
+        for(size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
+        {
+            const size_t nValues = rowIdx[iRow + 1] - rowIdx[iRow];
+            for(size_t iCandidate = 0; iCandidate < nCandidates; ++iCandidate)
+            {
+                const algorithmFPType* pCandidate = pCandidates + iCandidate*dim;
+                algorithmFPType dist2(0.);
+                for(size_t i = csrStart; i < csrStart + nValues; ++i)
+                    dist2 += (pData[i] - pCandidate[colIdx[i] - 1])*(pData[i] - pCandidate[colIdx[i] - 1]);
+                if(aWeights)
+                    dist2 *= aWeights[iStartRow + iRow];
+                aGoal[iCandidate] += (pDistSq[iRow] > dist2 ? dist2 : pDistSq[iRow]);
+            }
+            csrStart += nValues;
+        }
+    }
     //copy one row from the given table to the destination buffer and return the sum of squares
     //of the data in this row
     algorithmFPType copyOneRowCalcSumSq(size_t iRow, algorithmFPType* pDst) const
@@ -286,6 +386,7 @@ public:
         _nBlocks = _data.nRows / _nRowsInBlock;
         _nBlocks += (_nBlocks * _nRowsInBlock != _data.nRows);
         _aMinDistAcc.reset(_nBlocks);
+        _aMinDistAccBound.reset(_nBlocks);
     }
 
 protected:
@@ -300,13 +401,22 @@ protected:
     //find a row corresponding to the sample
     size_t findSample(algorithmFPType sample);
 
-    //recalculate overall error as a sum of error values per each block
-    void calcOverallError()
+    //calculate prefix sums of the error values per each block,
+    //the sample belongs to the first block whose bound exceeds it
+    void calcMinDistAccBounds()
     {
         const algorithmFPType* aMinDistAcc = _aMinDistAcc.get();
-        _overallError = aMinDistAcc[0];
+        algorithmFPType* aBound = _aMinDistAccBound.get();
+        aBound[0] = aMinDistAcc[0];
         for(size_t iBlock = 1; iBlock < _nBlocks; ++iBlock)
-            _overallError += aMinDistAcc[iBlock];
+            aBound[iBlock] = aBound[iBlock - 1] + aMinDistAcc[iBlock];
+    }
+
+    //recalculate overall error as a sum of error values per each block
+    void calcOverallError()
+    {
+        calcMinDistAccBounds();
+        _overallError = _aMinDistAccBound.get()[_nBlocks - 1];
     }
 
     //update minimal distance using last added center
@@ -331,6 +441,7 @@ protected:
     TArray<algorithmFPType, cpu> _lastAddedCenter; //center last added to the clusters
     TArray<algorithmFPType, cpu> _aMinDist; //distance to the nearest cluster for every point
     TArray<algorithmFPType, cpu> _aMinDistAcc; //accumulated aMinDist per every block
+    TArray<algorithmFPType, cpu> _aMinDistAccBound; //prefix sums of _aMinDistAcc
     algorithmFPType _lastAddedCenterSumSq; //sum of squares of last added center
     algorithmFPType _overallError; //current value of overall error (goal function)
     TArray<algorithmFPType, cpu> _aProbability; //array of probabilities for all candidates
@@ -342,28 +453,43 @@ class TaskPlusPlusBatch : public TaskPlusPlusBatchBase<algorithmFPType, cpu, Dat
 public:
     typedef TaskPlusPlusBatchBase<algorithmFPType, cpu, DataHelper> super;
     TaskPlusPlusBatch(NumericTable *ntData, const algorithmFPType* aWeight,
-        NumericTable *ntClusters, size_t numClusters, BaseRNGs<cpu>& brng) :
-        super(ntData, ntClusters, numClusters, brng), _aWeight(aWeight)
+        NumericTable *ntClusters, size_t numClusters, size_t nTrials, BaseRNGs<cpu>& brng) :
+        super(ntData, ntClusters, numClusters, brng), _aWeight(aWeight), _nTrials(nTrials)
     {
         this->_lastAddedCenter.reset(this->_data.dim); //reserve memory for a single point only
-        this->_aProbability.reset(numClusters); //reserve memory for all candidates
+        this->_aProbability.reset(nProbabilities()); //reserve memory for all candidates
+        if(_nTrials > 1)
+        {
+            _aTrialRow.reset(_nTrials);
+            _aTrialCenter.reset(_nTrials*this->_data.dim);
+            _aTrialGoal.reset(_nTrials*this->_nBlocks);
+        }
     }
     bool run();
 
 protected:
+    //number of probability values used: one for the first center and _nTrials for each of the others
+    size_t nProbabilities() const { return (this->_nClusters - 1)*_nTrials + 1; }
     size_t calcCenter(size_t iCluster);
     //sample a point with the probability proportional to its contribution to the overall error,
     //return index of the point
-    size_t samplePoint(size_t iCluster);
+    size_t samplePoint(algorithmFPType probability);
+    //sample _nTrials points and return index of the one that reduces the overall error most
+    size_t selectBestTrial(const algorithmFPType* aProbability);
 
 protected:
     const algorithmFPType* _aWeight;
+    const size_t _nTrials; //number of candidates evaluated per each new center
+    TArray<size_t, cpu> _aTrialRow; //array[_nTrials], row indices of the candidates
+    TArray<algorithmFPType, cpu> _aTrialCenter; //array[_nTrials*dim], the candidates
+    TArray<algorithmFPType, cpu> _aTrialGoal; //array[_nBlocks*_nTrials], goal function per each block and candidate
 };
 
 template <typename algorithmFPType, CpuType cpu>
 struct TlsPPData
 {
     algorithmFPType* gemmResult; //result of gemm call is placed here
+    int* aNearestCandidate; //index of the nearest of the new candidates per each point of a block
     algorithmFPType accMinDist2; //goal function accumulated for all blocks processed by a thread
     int aCandidateRating[1]; //rating of candidates updated in all blocks processed by a thread
 };
@@ -393,8 +519,6 @@ public:
 
 protected:
     void processBlock(size_t iBlock, TlsPPData_t* tlsLocal, size_t iFirstOfNewCandidates, size_t nNewCandidates);
-    bool findBestCandidate(typename DataHelper::BlockHelperType& blockHelper, size_t iRow, algorithmFPType* pDistSq, size_t nRowsToProcess,
-        size_t nNewCandidates, size_t& iBestCandidate, const algorithmFPType* gemmResult) const;
 
 protected:
     size_t _nBlocks;
@@ -451,11 +575,14 @@ bool TaskPlusPlusBatch<algorithmFPType, cpu, DataHelper>::run()
 {
     WriteOnlyRows<algorithmFPType, cpu> clustersBD(this->_ntClusters, 0, this->_nClusters);
     algorithmFPType *clusters = clustersBD.get();
-    if(!clusters || !this->_aMinDist.get() || !this->_aMinDistAcc.get() || !this->_lastAddedCenter.get() || !this->_aProbability.get())
+    if(!clusters || !this->_aMinDist.get() || !this->_aMinDistAcc.get() || !this->_aMinDistAccBound.get() ||
+        !this->_lastAddedCenter.get() || !this->_aProbability.get())
+        return false;
+    if(_nTrials > 1 && (!_aTrialRow.get() || !_aTrialCenter.get() || !_aTrialGoal.get()))
         return false;
     daal::services::internal::service_memset<algorithmFPType, cpu>(this->_aMinDist.get(),
         data_feature_utils::getMaxVal<algorithmFPType>(), this->_data.nRows);
-    this->generateProbabilities(0, this->_nClusters);
+    this->generateProbabilities(0, nProbabilities());
 
     //get first center at random
     size_t iCenter = this->calcFirstCenter();
@@ -488,12 +615,21 @@ size_t TaskPlusPlusBatchBase<algorithmFPType, cpu, DataHelper>::calcFirstCenter(
 template <typename algorithmFPType, CpuType cpu, typename DataHelper>
 size_t TaskPlusPlusBatchBase<algorithmFPType, cpu, DataHelper>::findSample(algorithmFPType sample)
 {
-    const algorithmFPType* aMinDistAcc = _aMinDistAcc.get();
+    const algorithmFPType* aBound = _aMinDistAccBound.get();
     algorithmFPType* aMinDist = _aMinDist.get();
-    //find the block this sample belongs to
+    //binary search of the block this sample belongs to
     size_t iBlock = 0;
-    for(; (iBlock + 1 < _nBlocks) && (sample >= aMinDistAcc[iBlock]); ++iBlock)
-        sample -= aMinDistAcc[iBlock];
+    size_t iLastBlock = _nBlocks - 1;
+    while(iBlock < iLastBlock)
+    {
+        const size_t iMiddle = (iBlock + iLastBlock) / 2;
+        if(sample >= aBound[iMiddle])
+            iBlock = iMiddle + 1;
+        else
+            iLastBlock = iMiddle;
+    }
+    if(iBlock)
+        sample -= aBound[iBlock - 1];
 
     //find the row in the block corresponding to the sample
     size_t nRowsToProcess = _nRowsInBlock;
@@ -507,23 +643,17 @@ size_t TaskPlusPlusBatchBase<algorithmFPType, cpu, DataHelper>::findSample(algor
 }
 
 template <typename algorithmFPType, CpuType cpu, typename DataHelper>
-size_t TaskPlusPlusBatch<algorithmFPType, cpu, DataHelper>::samplePoint(size_t iCluster)
+size_t TaskPlusPlusBatch<algorithmFPType, cpu, DataHelper>::samplePoint(algorithmFPType probability)
 {
     if(this->overallError() > 0)
     {
         const algorithmFPType eps = algorithmFPType(0.1)*this->overallError() / algorithmFPType(this->_data.nRows);
-        const algorithmFPType* aMinDistAcc = this->_aMinDistAcc.get();
-        algorithmFPType* aMinDist = this->_aMinDist.get();
-        //take a pre-computed probability value
-        algorithmFPType probability = this->_aProbability.get()[iCluster];
+        const algorithmFPType* aMinDist = this->_aMinDist.get();
         do
         {
             size_t iRow = this->findSample(this->overallError()*probability);
             if(aMinDist[iRow] > eps)
-            {
-                aMinDist[iRow] = 0;
                 return iRow;
-            }
             //already taken or duplicate point, sample again
             this->_rng.uniform(1, &probability, this->_brng, algorithmFPType(0.), algorithmFPType(1.));
         }
@@ -546,11 +676,51 @@ void TaskPlusPlusBatchBase<algorithmFPType, cpu, DataHelper>::updateMinDist(cons
     calcOverallError();
 }
 
+template <typename algorithmFPType, CpuType cpu, typename DataHelper>
+size_t TaskPlusPlusBatch<algorithmFPType, cpu, DataHelper>::selectBestTrial(const algorithmFPType* aProbability)
+{
+    const size_t dim = this->_data.dim;
+    size_t* aTrialRow = _aTrialRow.get();
+    algorithmFPType* aTrialCenter = _aTrialCenter.get();
+    algorithmFPType* aTrialGoal = _aTrialGoal.get();
+    for(size_t iTrial = 0; iTrial < _nTrials; ++iTrial)
+    {
+        aTrialRow[iTrial] = samplePoint(aProbability[iTrial]);
+        this->_data.copyOneRowCalcSumSq(aTrialRow[iTrial], aTrialCenter + iTrial*dim);
+    }
+
+    //evaluate the goal function for all the candidates in one pass through the data
+    daal::threader_for(this->_nBlocks, this->_nBlocks, [=](size_t iBlock)
+    {
+        this->_data.calcGoalInBlock(_aWeight,
+            iBlock*_nRowsInBlock,//start row
+            (iBlock == this->_nBlocks - 1) ? this->_data.nRows - iBlock * _nRowsInBlock : _nRowsInBlock, //rows to process
+            aTrialCenter, _nTrials, this->_aMinDist.get(), aTrialGoal + iBlock*_nTrials);
+    });
+
+    //sum up the goal function over the blocks in the fixed order, so that the result does not depend on threading
+    for(size_t iBlock = 1; iBlock < this->_nBlocks; ++iBlock)
+    {
+        for(size_t iTrial = 0; iTrial < _nTrials; ++iTrial)
+            aTrialGoal[iTrial] += aTrialGoal[iBlock*_nTrials + iTrial];
+    }
+    size_t iBest = 0;
+    for(size_t iTrial = 1; iTrial < _nTrials; ++iTrial)
+    {
+        if(aTrialGoal[iTrial] < aTrialGoal[iBest])
+            iBest = iTrial;
+    }
+    return aTrialRow[iBest];
+}
+
 template <typename algorithmFPType, CpuType cpu, typename DataHelper>
 size_t TaskPlusPlusBatch<algorithmFPType, cpu, DataHelper>::calcCenter(size_t iCluster)
 {
     this->updateMinDist(_aWeight);
-    const size_t iRow = samplePoint(iCluster);
+    //take pre-computed probability values
+    const algorithmFPType* aProbability = this->_aProbability.get() + 1 + (iCluster - 1)*_nTrials;
+    const size_t iRow = (_nTrials > 1 ? selectBestTrial(aProbability) : samplePoint(aProbability[0]));
+    this->_aMinDist.get()[iRow] = 0;
     this->_lastAddedCenterSumSq = this->_data.copyOneRowCalcSumSq(iRow, this->_lastAddedCenter.get());
     return iRow;
 }
@@ -564,7 +734,7 @@ void KMeansinitKernel<plusPlusDense, algorithmFPType, cpu>::compute(size_t na, c
         const_cast<NumericTable *>(a[0]), //data
         nullptr,
         const_cast<NumericTable *>(r[0]), //clusters
-        par->nClusters, brng);
+        par->nClusters, par->nTrials, brng);
     if(!task.run())
         this->_errors->add(services::ErrorMemoryAllocationFailed);
 }
@@ -578,7 +748,7 @@ void KMeansinitKernel<plusPlusCSR, algorithmFPType, cpu>::compute(size_t na, con
         const_cast<NumericTable *>(a[0]), //data
         nullptr,
         const_cast<NumericTable *>(r[0]), //clusters
-        par->nClusters, brng);
+        par->nClusters, par->nTrials, brng);
     if(!task.run())
         this->_errors->add(services::ErrorMemoryAllocationFailed);
 }
@@ -622,32 +792,6 @@ size_t TaskParallelPlusBatch<algorithmFPType, cpu, DataHelper>::samplePoints(siz
     return iNewCandidate;
 }
 
-template <typename algorithmFPType, CpuType cpu, typename DataHelper>
-bool TaskParallelPlusUpdateDist<algorithmFPType, cpu, DataHelper>::findBestCandidate(typename DataHelper::BlockHelperType& blockHelper, size_t iRow,
-    algorithmFPType* pDistSq, size_t nRowsToProcess, size_t nNewCandidates, size_t& iBestCandidate, const algorithmFPType* gemmResult) const
-{
-    size_t iCandidate = 0;
-    iBestCandidate = iCandidate;
-    algorithmFPType valBest = _lastAddedCenterNorm2[iCandidate] - blockHelper.getGemmResult(iRow, iCandidate, nRowsToProcess, nNewCandidates, gemmResult);
-    for(size_t iCandidate = 1; iCandidate < nNewCandidates; ++iCandidate)
-    {
-        algorithmFPType valCand = _lastAddedCenterNorm2[iCandidate] - blockHelper.getGemmResult(iRow, iCandidate, nRowsToProcess, nNewCandidates, gemmResult);
-        if(valBest > valCand)
-        {
-            valBest = valCand;
-            iBestCandidate = iCandidate;
-        }
-    }
-    const algorithmFPType* pLastAddedCenter = _lastAddedCenter;
-    const algorithmFPType dist2 = blockHelper.getRowSumSq(iRow, pLastAddedCenter + iBestCandidate*this->_data.dim);
-    if(dist2 < pDistSq[iRow])
-    {
-        pDistSq[iRow] = dist2;
-        return true;
-    }
-    return false;
-}
-
 template <typename algorithmFPType, CpuType cpu, typename DataHelper>
 void TaskParallelPlusUpdateDist<algorithmFPType, cpu, DataHelper>::processBlock(size_t iBlock, TlsPPData_t* tlsLocal,
     size_t iFirstOfNewCandidates, size_t nNewCandidates)
@@ -659,16 +803,20 @@ void TaskParallelPlusUpdateDist<algorithmFPType, cpu, DataHelper>::processBlock(
     const size_t iStartRow = iBlock*_nRowsInBlock;
 
     typename DataHelper::BlockHelperType blockHelper(_data.ntIface(), _data.dim, iStartRow, nRowsToProcess);
-    blockHelper.callGemm(_lastAddedCenter, nRowsToProcess, nNewCandidates, tlsLocal->gemmResult);
+    int* aNearestCandidate = tlsLocal->aNearestCandidate;
+    blockHelper.findNearestCenters(_lastAddedCenter, _lastAddedCenterNorm2, nRowsToProcess, nNewCandidates,
+        tlsLocal->gemmResult, aNearestCandidate);
 
     algorithmFPType* pDistSq = _aMinDist + iStartRow;
     auto* pNearestCandIndex = _aNearestCandidateIdx + iStartRow;
     algorithmFPType sumOfDist2 = 0;
     for(size_t iRow = 0; iRow < nRowsToProcess; ++iRow)
     {
-        size_t iBestCandidate = 0;
-        if(findBestCandidate(blockHelper, iRow, pDistSq, nRowsToProcess, nNewCandidates, iBestCandidate, tlsLocal->gemmResult))
+        const size_t iBestCandidate = aNearestCandidate[iRow];
+        const algorithmFPType dist2 = blockHelper.getRowSumSq(iRow, _lastAddedCenter + iBestCandidate*this->_data.dim);
+        if(dist2 < pDistSq[iRow])
         {
+            pDistSq[iRow] = dist2;
             const auto iPrevCandidate = pNearestCandIndex[iRow];
             pNearestCandIndex[iRow] = iFirstOfNewCandidates + iBestCandidate;
             aCandidateRating[iPrevCandidate] -= 1;
@@ -694,8 +842,11 @@ bool TaskParallelPlusUpdateDist<algorithmFPType, cpu, DataHelper>::updateMinDist
         if(pData)
         {
             pData->gemmResult = service_calloc<algorithmFPType, cpu>(gemmDataSize);
-            if(!pData->gemmResult)
+            pData->aNearestCandidate = service_calloc<int, cpu>(_nRowsInBlock);
+            if(!pData->gemmResult || !pData->aNearestCandidate)
             {
+                service_free<algorithmFPType, cpu>(pData->gemmResult);
+                service_free<int, cpu>(pData->aNearestCandidate);
                 service_scalable_free<byte, cpu>(ptr);
                 return nullptr;
             }
@@ -722,6 +873,7 @@ bool TaskParallelPlusUpdateDist<algorithmFPType, cpu, DataHelper>::updateMinDist
         for(size_t j = 0; j < nCandidates; ++j)
             _aCandidateRating[j] += ptr->aCandidateRating[j];
         service_free<algorithmFPType, cpu>(ptr->gemmResult);
+        service_free<int, cpu>(ptr->aNearestCandidate);
         service_scalable_free<byte, cpu>((byte*)ptr);
     });
     this->_overallError = newOverallError;
@@ -738,7 +890,10 @@ bool TaskParallelPlusBatch<algorithmFPType, cpu, DataHelper>::updateMinDist(size
         this->_lastAddedCenter.get(),
         this->_lastAddedCenterNorm2.get(),
         this->_aMinDist.get(), this->_aMinDistAcc.get());
-    return impl.updateMinDist(iFirstOfNewCandidates, nNewCandidates);
+    if(!impl.updateMinDist(iFirstOfNewCandidates, nNewCandidates))
+        return false;
+    this->calcMinDistAccBounds();
+    return true;
 }
 
 template <typename algorithmFPType, CpuType cpu, typename DataHelper>
@@ -806,7 +961,7 @@ bool TaskParallelPlusBatch<algorithmFPType, cpu, DataHelper>::getCandidates(Homo
 template <typename algorithmFPType, CpuType cpu, typename DataHelper>
 bool TaskParallelPlusBatch<algorithmFPType, cpu, DataHelper>::run()
 {
-    if(!this->_aMinDist.get() || !this->_aMinDistAcc.get() || !this->_lastAddedCenter.get())
+    if(!this->_aMinDist.get() || !this->_aMinDistAcc.get() || !this->_aMinDistAccBound.get() || !this->_lastAddedCenter.get())
         return false;
     if(!_lastAddedCenterNorm2.get())
         return false;
@@ -821,7 +976,7 @@ bool TaskParallelPlusBatch<algorithmFPType, cpu, DataHelper>::run()
     const algorithmFPType div(1. / algorithmFPType(this->_data.nRows));
     for(auto i = 0; i < nCandidates; ++i)
         aWeight.get()[i] = div*algorithmFPType(_aCandidateRating.get()[i]);
-    TaskPlusPlusBatch<algorithmFPType, cpu, DataHelperDense<algorithmFPType, cpu> > task(pCandidates.get(), aWeight.get(), this->_ntClusters, this->_nClusters, this->_brng);
+    TaskPlusPlusBatch<algorithmFPType, cpu, DataHelperDense<algorithmFPType, cpu> > task(pCandidates.get(), aWeight.get(), this->_ntClusters, this->_nClusters, 1, this->_brng);
     return task.run();
 }
 
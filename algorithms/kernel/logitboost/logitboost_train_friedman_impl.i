@@ -123,7 +123,9 @@ void LogitBoostTrainKernel<friedman, algorithmFPType, cpu>::compute(const size_t
     y->getBlockOfColumnValues( 0, 0, n, readOnly, block );
     y_label = block.getBlockPtr();
 
-    services::SharedPtr<weak_learner::training::Batch>   learnerTrain   = parameter->weakLearnerTraining;
+    /* Copy of the weak learner keeps the data prepared for the training data set between the iterations */
+    services::SharedPtr<weak_learner::training::Batch>   learnerTrain   = parameter->weakLearnerTraining->clone();
+    stump::training::internal::enableSortedFeaturesReuse(learnerTrain.get());
     learnerTrain->getErrors()->setCanThrow(false);
     learnerTrain->input.set(classifier::training::data,    x);
     learnerTrain->input.set(classifier::training::labels,  zTable);
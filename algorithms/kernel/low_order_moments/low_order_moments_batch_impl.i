@@ -26,6 +26,7 @@
 
 #include "low_order_moments_kernel.h"
 #include "low_order_moments_impl.i"
+#include "low_order_moments_weighted_impl.i"
 
 namespace daal
 {
@@ -38,9 +39,16 @@ namespace internal
 
 template<typename algorithmFPType, Method method, CpuType cpu>
 void LowOrderMomentsBatchKernel<algorithmFPType, method, cpu>::compute( NumericTable *dataTable,
+                                                                        NumericTable *weightsTable,
                                                                         Result *result,
                                                                         const Parameter *parameter )
 {
+    if (weightsTable || parameter->skipMissingValues)
+    {
+        computeWeightedBatch<algorithmFPType, cpu>(dataTable, weightsTable, result, parameter, this->_errors.get());
+        return;
+    }
+
     if( method == defaultDense)
     {
         switch(parameter->estimatesToCompute)
@@ -61,8 +69,6 @@ void LowOrderMomentsBatchKernel<algorithmFPType, method, cpu>::compute( NumericT
                 break;
             }
         }
-
-        return;
     }
     else
     {
@@ -123,6 +129,9 @@ void LowOrderMomentsBatchKernel<algorithmFPType, method, cpu>::compute( NumericT
                                                                 task.resultArray[(int)sumSquaresCentered],
                                                                 isOnline );
     } /* if( method == defaultDense && do_daal_optimization) */
+    if (this->_errors->size() != 0) { return; }
+
+    setNObservationsPerFeature<algorithmFPType, cpu>(result->get(nObservationsPerFeature).get(), dataTable->getNumberOfRows(), false);
 }
 
 }
@@ -55,13 +55,14 @@ void BatchContainer<algorithmFPType, method, cpu>::compute()
     Input *input = static_cast<Input *>(_in);
     Result *result = static_cast<Result *>(_res);
 
-    NumericTable *dataTable = input->get(data).get();
+    NumericTable *dataTable    = input->get(data).get();
+    NumericTable *weightsTable = input->get(weights).get();
 
     Parameter *par = static_cast<Parameter *>(_par);
     daal::services::Environment::env &env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::LowOrderMomentsBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), \
-            compute, dataTable, result, par);
+            compute, dataTable, weightsTable, result, par);
 }
 
 
@@ -84,13 +85,14 @@ void OnlineContainer<algorithmFPType, method, cpu>::compute()
     Input *input = static_cast<Input *>(_in);
     PartialResult *partialResult = static_cast<PartialResult *>(_pres);
 
-    NumericTable *dataTable = input->get(data).get();
+    NumericTable *dataTable    = input->get(data).get();
+    NumericTable *weightsTable = input->get(weights).get();
 
     Parameter *par = static_cast<Parameter *>(_par);
     daal::services::Environment::env &env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::LowOrderMomentsOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),    \
-            compute, dataTable, partialResult, par, isOnline);
+            compute, dataTable, weightsTable, partialResult, par, isOnline);
 }
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -99,10 +101,10 @@ void OnlineContainer<algorithmFPType, method, cpu>::finalizeCompute()
     PartialResult *partialResult = static_cast<PartialResult *>(_pres);
     Result *result = static_cast<Result *>(_res);
 
-    NumericTable *nObservationsTable = partialResult->get(nObservations).get();
-    NumericTable *sumTable           = partialResult->get(partialSum).get();
-    NumericTable *sumSqTable         = partialResult->get(partialSumSquares).get();
-    NumericTable *sumSqCenTable      = partialResult->get(partialSumSquaresCentered).get();
+    NumericTable *nObservationsPerFeatureTable = partialResult->get(partialNObservationsPerFeature).get();
+    NumericTable *sumTable                     = partialResult->get(partialSum).get();
+    NumericTable *sumSqTable                   = partialResult->get(partialSumSquares).get();
+    NumericTable *sumSqCenTable                = partialResult->get(partialSumSquaresCentered).get();
 
     NumericTable *meanTable      = result->get(mean).get();
     NumericTable *raw2MomTable   = result->get(secondOrderRawMoment).get();
@@ -114,14 +116,15 @@ void OnlineContainer<algorithmFPType, method, cpu>::finalizeCompute()
     daal::services::Environment::env &env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::LowOrderMomentsOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),    \
-            finalizeCompute, nObservationsTable, sumTable, sumSqTable, sumSqCenTable,
+            finalizeCompute, nObservationsPerFeatureTable, sumTable, sumSqTable, sumSqCenTable,
             meanTable, raw2MomTable, varianceTable, stDevTable, variationTable, par);
 
     result->set(minimum,            partialResult->get(partialMinimum));
     result->set(maximum,            partialResult->get(partialMaximum));
     result->set(sum,                partialResult->get(partialSum));
     result->set(sumSquares,         partialResult->get(partialSumSquares));
-    result->set(sumSquaresCentered, partialResult->get(partialSumSquaresCentered));
+    result->set(sumSquaresCentered,      partialResult->get(partialSumSquaresCentered));
+    result->set(nObservationsPerFeature, partialResult->get(partialNObservationsPerFeature));
 }
 
 template<typename algorithmFPType, Method method, CpuType cpu>
@@ -143,13 +146,14 @@ void DistributedContainer<step1Local, algorithmFPType, method, cpu>::compute()
     Input *input = static_cast<Input *>(_in);
     PartialResult *partialResult = static_cast<PartialResult *>(_pres);
 
-    NumericTable *dataTable = input->get(data).get();
+    NumericTable *dataTable    = input->get(data).get();
+    NumericTable *weightsTable = input->get(weights).get();
 
     Parameter *par = static_cast<Parameter *>(_par);
     daal::services::Environment::env &env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::LowOrderMomentsOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),    \
-            compute, dataTable, partialResult, par, isOnline);
+            compute, dataTable, weightsTable, partialResult, par, isOnline);
 }
 
 template<typename algorithmFPType, Method method, CpuType cpu>
@@ -158,10 +162,10 @@ void DistributedContainer<step1Local, algorithmFPType, method, cpu>::finalizeCom
     PartialResult *partialResult = static_cast<PartialResult *>(_pres);
     Result *result = static_cast<Result *>(_res);
 
-    NumericTable *nObservationsTable = partialResult->get(nObservations).get();
-    NumericTable *sumTable           = partialResult->get(partialSum).get();
-    NumericTable *sumSqTable         = partialResult->get(partialSumSquares).get();
-    NumericTable *sumSqCenTable      = partialResult->get(partialSumSquaresCentered).get();
+    NumericTable *nObservationsPerFeatureTable = partialResult->get(partialNObservationsPerFeature).get();
+    NumericTable *sumTable                     = partialResult->get(partialSum).get();
+    NumericTable *sumSqTable                   = partialResult->get(partialSumSquares).get();
+    NumericTable *sumSqCenTable                = partialResult->get(partialSumSquaresCentered).get();
 
     NumericTable *meanTable      = result->get(mean).get();
     NumericTable *raw2MomTable   = result->get(secondOrderRawMoment).get();
@@ -173,14 +177,15 @@ void DistributedContainer<step1Local, algorithmFPType, method, cpu>::finalizeCom
     daal::services::Environment::env &env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::LowOrderMomentsOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),    \
-            finalizeCompute, nObservationsTable, sumTable, sumSqTable, sumSqCenTable,
+            finalizeCompute, nObservationsPerFeatureTable, sumTable, sumSqTable, sumSqCenTable,
             meanTable, raw2MomTable, varianceTable, stDevTable, variationTable, par);
 
     result->set(minimum,            partialResult->get(partialMinimum));
     result->set(maximum,            partialResult->get(partialMaximum));
     result->set(sum,                partialResult->get(partialSum));
     result->set(sumSquares,         partialResult->get(partialSumSquares));
-    result->set(sumSquaresCentered, partialResult->get(partialSumSquaresCentered));
+    result->set(sumSquaresCentered,      partialResult->get(partialSumSquaresCentered));
+    result->set(nObservationsPerFeature, partialResult->get(partialNObservationsPerFeature));
 }
 
 
@@ -218,10 +223,10 @@ void DistributedContainer<step2Master, algorithmFPType, method, cpu>::finalizeCo
     PartialResult *partialResult = static_cast<PartialResult *>(_pres);
     Result *result = static_cast<Result *>(_res);
 
-    NumericTable *nObservationsTable = partialResult->get(nObservations).get();
-    NumericTable *sumTable           = partialResult->get(partialSum).get();
-    NumericTable *sumSqTable         = partialResult->get(partialSumSquares).get();
-    NumericTable *sumSqCenTable      = partialResult->get(partialSumSquaresCentered).get();
+    NumericTable *nObservationsPerFeatureTable = partialResult->get(partialNObservationsPerFeature).get();
+    NumericTable *sumTable                     = partialResult->get(partialSum).get();
+    NumericTable *sumSqTable                   = partialResult->get(partialSumSquares).get();
+    NumericTable *sumSqCenTable                = partialResult->get(partialSumSquaresCentered).get();
 
     NumericTable *meanTable      = result->get(mean).get();
     NumericTable *raw2MomTable   = result->get(secondOrderRawMoment).get();
@@ -233,14 +238,15 @@ void DistributedContainer<step2Master, algorithmFPType, method, cpu>::finalizeCo
     daal::services::Environment::env &env = *_env;
 
     __DAAL_CALL_KERNEL(env, internal::LowOrderMomentsDistributedKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method),    \
-            finalizeCompute, nObservationsTable, sumTable, sumSqTable, sumSqCenTable,
+            finalizeCompute, nObservationsPerFeatureTable, sumTable, sumSqTable, sumSqCenTable,
             meanTable, raw2MomTable, varianceTable, stDevTable, variationTable, par);
 
     result->set(minimum,            partialResult->get(partialMinimum));
     result->set(maximum,            partialResult->get(partialMaximum));
     result->set(sum,                partialResult->get(partialSum));
     result->set(sumSquares,         partialResult->get(partialSumSquares));
-    result->set(sumSquaresCentered, partialResult->get(partialSumSquaresCentered));
+    result->set(sumSquaresCentered,      partialResult->get(partialSumSquaresCentered));
+    result->set(nObservationsPerFeature, partialResult->get(partialNObservationsPerFeature));
 }
 
 }
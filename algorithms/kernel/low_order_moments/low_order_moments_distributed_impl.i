@@ -26,6 +26,7 @@
 
 #include "low_order_moments_kernel.h"
 #include "low_order_moments_impl.i"
+#include "low_order_moments_weighted_impl.i"
 
 namespace daal
 {
@@ -41,28 +42,19 @@ void LowOrderMomentsDistributedKernel<algorithmFPType, method, cpu>::compute(
             data_management::DataCollection *partialResultsCollection,
             PartialResult *partialResult, const Parameter *parameter)
 {
-    int *partialNObservations = (int *)daal_malloc(partialResultsCollection->size() * sizeof(int));
-    if (!partialNObservations)
-    { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
-
-    mergeNObservations<algorithmFPType, cpu>(partialResultsCollection, partialResult, partialNObservations);
-    mergeMinAndMax<algorithmFPType, cpu>(partialResultsCollection, partialResult);
-    mergeSums<algorithmFPType, cpu>(partialResultsCollection, partialResult,
-        partialNObservations);
-
-    daal_free(partialNObservations);
+    mergePartialResults<algorithmFPType, cpu>(partialResultsCollection, partialResult, this->_errors.get());
 }
 
 template<typename algorithmFPType, Method method, CpuType cpu>
 void LowOrderMomentsDistributedKernel<algorithmFPType, method, cpu>::finalizeCompute(
-            NumericTable *nObservationsTable,
+            NumericTable *nObservationsPerFeatureTable,
             NumericTable *sumTable, NumericTable *sumSqTable, NumericTable *sumSqCenTable,
             NumericTable *meanTable, NumericTable *raw2MomTable, NumericTable *varianceTable,
             NumericTable *stDevTable, NumericTable *variationTable,
             const Parameter *parameter)
 {
     LowOrderMomentsFinalizeTask<algorithmFPType, cpu> task(
-        nObservationsTable, sumTable, sumSqTable, sumSqCenTable, meanTable,
+        nObservationsPerFeatureTable, sumTable, sumSqTable, sumSqCenTable, meanTable,
         raw2MomTable, varianceTable, stDevTable, variationTable);
 
     finalize<algorithmFPType, cpu>(task);
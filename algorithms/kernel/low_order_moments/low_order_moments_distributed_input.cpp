@@ -118,7 +118,8 @@ void DistributedInput<step2Master>::check(const daal::algorithms::Parameter *par
         if(!checkNumericTable(partialResult->get(partialMinimum).get(), this->_errors.get(), partialMinimumStr(), unexpectedLayouts)) { return; }
 
         size_t nFeatures = partialResult->get(partialMinimum)->getNumberOfColumns();
-        const char* errorMessages[] = {partialMinimumStr(), partialMaximumStr(), partialSumStr(), partialSumSquaresStr(), partialSumSquaresCenteredStr() };
+        const char* errorMessages[] = {partialMinimumStr(), partialMaximumStr(), partialSumStr(), partialSumSquaresStr(), partialSumSquaresCenteredStr(),
+            partialNObservationsPerFeatureStr() };
 
         for(size_t i = 1; i < nPartialResults; i++)
         {
@@ -229,6 +229,135 @@ struct tls_moments_data_t
 };
 
 
+/* Numbers of rows and features in the blocks the data is split into */
+#define _BLOCK_SIZE_ 256
+#define _FEATURE_BLOCK_SIZE_ 64
+
+/* Number of features in the blocks processed by the threads in the column-partitioned computation */
+#define _COLUMN_BLOCK_SIZE_ 512
+
+/* Minimal ratio of the number of features to the number of rows for the column-partitioned computation */
+#define _COLUMN_PARTITION_RATIO_ 8
+
+/* Column-partitioned computation for the tables with many more features than rows.
+   The row-partitioned computation has few row blocks to split across the threads for such tables,
+   and every thread keeps its own copy of the estimates for all features.
+   Here the blocks of rows are read one after another, and the features of the block are split across the threads,
+   so every thread updates its own range of the result arrays and no thread local copies are needed */
+template<typename algorithmFPType, CpuType cpu>
+void compute_estimates_by_columns( common_moments_data_t<algorithmFPType,cpu> &_cd )
+{
+    const size_t nFeatures = _cd.nFeatures;
+
+    /* "Short names" for result arrays */
+    algorithmFPType* _min   = _cd.resultArray[(int)minimum];
+    algorithmFPType* _max   = _cd.resultArray[(int)maximum];
+    algorithmFPType* _sum   = _cd.resultArray[(int)sum];
+    algorithmFPType* _sum2  = _cd.resultArray[(int)sumSquares];
+    algorithmFPType* _sum2c = _cd.resultArray[(int)sumSquaresCentered];
+    algorithmFPType* _mean  = _cd.resultArray[(int)mean];
+    algorithmFPType* _sorm  = _cd.resultArray[(int)secondOrderRawMoment];
+    algorithmFPType* _varc  = _cd.resultArray[(int)variance];
+    algorithmFPType* _stdev = _cd.resultArray[(int)standardDeviation];
+    algorithmFPType* _vart  = _cd.resultArray[(int)variation];
+
+    size_t numRowsInBlock = (_cd.nVectors > _BLOCK_SIZE_)?_BLOCK_SIZE_:_cd.nVectors;
+    size_t numRowsBlocks  = (_cd.nVectors + numRowsInBlock - 1) / numRowsInBlock;
+
+    size_t numFeatureBlocks = (nFeatures + _COLUMN_BLOCK_SIZE_ - 1) / _COLUMN_BLOCK_SIZE_;
+
+    for(size_t iBlock = 0; iBlock < numRowsBlocks; iBlock++)
+    {
+        size_t _startRow = iBlock * numRowsInBlock;
+        size_t _nRows    = (iBlock < (numRowsBlocks-1))?numRowsInBlock:(_cd.nVectors - _startRow);
+
+        daal::internal::ReadRows<algorithmFPType, cpu, NumericTable> dataTableBD(_cd.dataTable, _startRow, _nRows);
+        const algorithmFPType* _dataArray_block = dataTableBD.get();
+
+        daal::threader_for( numFeatureBlocks, numFeatureBlocks, [ & ](int iFeatureBlock)
+        {
+            size_t _jstart = iFeatureBlock * _COLUMN_BLOCK_SIZE_;
+            size_t _jend   = (_jstart + _COLUMN_BLOCK_SIZE_ < nFeatures)?(_jstart + _COLUMN_BLOCK_SIZE_):nFeatures;
+
+            for(size_t i = 0; i < _nRows; i++)
+            {
+                const algorithmFPType* _row = _dataArray_block + i * nFeatures;
+
+                /* loop invariants */
+#if defined _MEAN_ENABLE_  || defined _SORM_ENABLE_
+                algorithmFPType _invN = algorithmFPType(1.0) / algorithmFPType(_startRow + i + 1);
+#endif
+                PRAGMA_IVDEP
+                PRAGMA_VECTOR_ALWAYS
+                for(size_t j = _jstart; j < _jend; j++)
+                {
+                    algorithmFPType arg  = _row[j];
+
+#if defined _SUM2_ENABLE_ || defined _SORM_ENABLE_
+                    algorithmFPType arg2   = arg * arg;
+#endif
+#if defined _MEAN_ENABLE_ || defined _SUM2C_ENABLE_ || defined  _VARC_ENABLE_  || defined _STDEV_ENABLE_ || defined _VART_ENABLE_
+                    algorithmFPType delta  = arg  - _mean[j];
+#endif
+#ifdef _SORM_ENABLE_
+                    algorithmFPType delta2 = arg2 - _sorm[j];
+#endif
+
+#ifdef _MIN_ENABLE_
+                    if(arg < _min[j]) _min[j] = arg;
+#endif
+#ifdef _MAX_ENABLE_
+                    if(arg > _max[j]) _max[j] = arg;
+#endif
+#ifdef _SUM_ENABLE_
+                    _sum[j]  += arg;
+#endif
+#ifdef _SUM2_ENABLE_
+                    _sum2[j] += arg2;
+#endif
+#ifdef _MEAN_ENABLE_
+                    _mean[j] += delta  * _invN;
+#endif
+#ifdef _SORM_ENABLE_
+                    _sorm[j] += delta2 * _invN;
+#endif
+#if defined _SUM2C_ENABLE_ || defined  _VARC_ENABLE_  || defined _STDEV_ENABLE_ || defined _VART_ENABLE_
+                    /* the sum of squared differences from the mean is accumulated in the variance array */
+                    _varc[j] += delta * ( arg - _mean[j] );
+#endif
+                }
+            }
+        } );
+    }
+
+    /* Final loop for sums of squared differences from the means, variances, std deviations and variations */
+#if defined _SUM2C_ENABLE_ || defined  _VARC_ENABLE_  || defined _STDEV_ENABLE_ || defined _VART_ENABLE_
+    algorithmFPType variance_scale = algorithmFPType(1.0) / (algorithmFPType(_cd.nVectors) - algorithmFPType(1.0));
+
+    daal::threader_for( numFeatureBlocks, numFeatureBlocks, [ & ](int iFeatureBlock)
+    {
+        size_t _jstart = iFeatureBlock * _COLUMN_BLOCK_SIZE_;
+        size_t _jend   = (_jstart + _COLUMN_BLOCK_SIZE_ < nFeatures)?(_jstart + _COLUMN_BLOCK_SIZE_):nFeatures;
+
+        PRAGMA_IVDEP
+        PRAGMA_VECTOR_ALWAYS
+        for(size_t j = _jstart; j < _jend; j++)
+        {
+#ifdef _SUM2C_ENABLE_
+            _sum2c[j] = _varc[j];
+#endif
+            _varc[j]  = _varc[j] * variance_scale;
+#if defined _STDEV_ENABLE_  || defined _VART_ENABLE_
+            _stdev[j] = daal::internal::Math<algorithmFPType, cpu>::sSqrt(_varc[j]);
+#endif
+#ifdef _VART_ENABLE_
+            _vart[j]  = _stdev[j] / _mean[j];
+#endif
+        }
+    } );
+#endif
+} /* compute_estimates_by_columns */
+
 template<typename algorithmFPType, CpuType cpu>
 void compute_estimates( NumericTable *dataTable,
                         Result *result,
@@ -255,12 +384,16 @@ algorithmFPType* _stdev = _cd.resultArray[(int)standardDeviation];
 algorithmFPType* _vart  = _cd.resultArray[(int)variation];
 
 /* Rows and features splitting by blocks */
-#define _BLOCK_SIZE_ 256
+    if(_cd.nFeatures >= _COLUMN_PARTITION_RATIO_ * _cd.nVectors && _cd.nFeatures >= 2 * _COLUMN_BLOCK_SIZE_)
+    {
+        compute_estimates_by_columns<algorithmFPType, cpu>(_cd);
+        return;
+    }
+
     size_t numRowsInBlock = (_cd.nVectors > _BLOCK_SIZE_)?_BLOCK_SIZE_:_cd.nVectors;
     size_t numRowsBlocks   = _cd.nVectors / numRowsInBlock;
     size_t numRowsInLastBlock = numRowsInBlock + ( _cd.nVectors - numRowsBlocks * numRowsInBlock);
 
-#define _FEATURE_BLOCK_SIZE_ 64
     size_t numFeaturesInBlock = (_cd.nFeatures > _FEATURE_BLOCK_SIZE_)?_FEATURE_BLOCK_SIZE_:_cd.nFeatures;
     size_t numFeatureBlocks   = _cd.nFeatures / numFeaturesInBlock;
     size_t numFeaturesInLastBlock = numFeaturesInBlock + ( _cd.nFeatures - numFeatureBlocks * numFeaturesInBlock);
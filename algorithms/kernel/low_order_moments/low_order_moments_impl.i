@@ -288,7 +288,7 @@ LowOrderMomentsOnlineTask<algorithmFPType, cpu>::~LowOrderMomentsOnlineTask()
 
 /****************************************************************************************************************************/
 template<typename algorithmFPType, CpuType cpu>
-LowOrderMomentsFinalizeTask<algorithmFPType, cpu>::LowOrderMomentsFinalizeTask( NumericTable *nObservationsTable,
+LowOrderMomentsFinalizeTask<algorithmFPType, cpu>::LowOrderMomentsFinalizeTask( NumericTable *nObservationsPerFeatureTable,
                                                                                 NumericTable *sumTable,
                                                                                 NumericTable *sumSqTable,
                                                                                 NumericTable *sumSqCenTable,
@@ -297,7 +297,7 @@ LowOrderMomentsFinalizeTask<algorithmFPType, cpu>::LowOrderMomentsFinalizeTask(
                                                                                 NumericTable *varianceTable,
                                                                                 NumericTable *stDevTable, NumericTable *variationTable)
 
-                                                                             :  nObservationsTable(nObservationsTable),
+                                                                             :  nObservationsPerFeatureTable(nObservationsPerFeatureTable),
                                                                                 sumTable(sumTable),
                                                                                 sumSqTable(sumSqTable),
                                                                                 sumSqCenTable(sumSqCenTable),
@@ -309,8 +309,8 @@ LowOrderMomentsFinalizeTask<algorithmFPType, cpu>::LowOrderMomentsFinalizeTask(
 {
     nFeatures = sumTable->getNumberOfColumns();
 
-    nObservationsTable->getBlockOfRows(0, 1, readOnly, nObservationsBD);
-    nObservations = nObservationsBD.getBlockPtr();
+    nObservationsPerFeatureTable->getBlockOfRows(0, 1, readOnly, nObservationsPerFeatureBD);
+    nObservationsPerFeature = nObservationsPerFeatureBD.getBlockPtr();
 
     sumTable     ->getBlockOfRows(0, 1, readOnly, sumBD);
     sumSqTable   ->getBlockOfRows(0, 1, readOnly, sumSqBD);
@@ -337,7 +337,7 @@ template<typename algorithmFPType, CpuType cpu>
 /****************************************************************************************************************************/
 LowOrderMomentsFinalizeTask<algorithmFPType, cpu>::~LowOrderMomentsFinalizeTask()
 {
-    nObservationsTable->releaseBlockOfRows(nObservationsBD);
+    nObservationsPerFeatureTable->releaseBlockOfRows(nObservationsPerFeatureBD);
     sumTable          ->releaseBlockOfRows(sumBD);
     sumSqTable        ->releaseBlockOfRows(sumSqBD);
     sumSqCenTable     ->releaseBlockOfRows(sumSqCenBD);
@@ -566,328 +566,29 @@ void computeSumOfSquaredDiffsFromMean( size_t nFeatures,
 }
 
 /****************************************************************************************************************************/
+/* Computes the moments of every feature from its own number of observations, which is the sum of the weights of
+   the non-missing observations in the weighted and missing-value-aware modes and the number of rows otherwise */
 template<typename algorithmFPType, CpuType cpu>
-void mergeNObservations( data_management::DataCollection *partialResultsCollection,
-                         PartialResult *partialResult,
-                         int *partialNObservations )
-{
-    PartialResult *inputPartialResult = static_cast<PartialResult* >((*partialResultsCollection)[0].get());
-
-    NumericTable *nObsTable = partialResult->get(nObservations).get();
-    NumericTable *inputNObsTable = inputPartialResult->get(nObservations).get();
-
-    BlockDescriptor<int> nObsBD, inputNObsBD;
-
-    nObsTable->getBlockOfRows(0, 1, writeOnly, nObsBD);
-    inputNObsTable->getBlockOfRows(0, 1, readOnly, inputNObsBD);
-    int *nObs = nObsBD.getBlockPtr();
-    int *inputNObs = inputNObsBD.getBlockPtr();
-
-    nObs[0] = inputNObs[0];
-    partialNObservations[0] = inputNObs[0];
-
-    inputNObsTable->releaseBlockOfRows(inputNObsBD);
-    size_t collectionSize = partialResultsCollection->size();
-
-    for (size_t i = 1; i < collectionSize; i++)
-    {
-        inputPartialResult = static_cast<PartialResult* >((*partialResultsCollection)[i].get());
-        inputNObsTable = inputPartialResult->get(nObservations).get();
-        inputNObsTable->getBlockOfRows(0, 1, readOnly, inputNObsBD);
-        int *inputNObs = inputNObsBD.getBlockPtr();
-
-        nObs[0] += inputNObs[0];
-        partialNObservations[i] = inputNObs[0];
-
-        inputNObsTable->releaseBlockOfRows(inputNObsBD);
-    }
-    nObsTable->releaseBlockOfRows(nObsBD);
-}
-
-/****************************************************************************************************************************/
-template<typename algorithmFPType, CpuType cpu>
-void getTwoTables( ReadWriteMode rwMode,
-                   NumericTable *table1,
-                   NumericTable *table2,
-                   BlockDescriptor<algorithmFPType> &bd1,
-                   BlockDescriptor<algorithmFPType> &bd2,
-                   algorithmFPType **array1,
-                   algorithmFPType **array2 )
-{
-    table1->getBlockOfRows(0, 1, rwMode, bd1);
-    table2->getBlockOfRows(0, 1, rwMode, bd2);
-    *array1 = bd1.getBlockPtr();
-    *array2 = bd2.getBlockPtr();
-}
-
-/****************************************************************************************************************************/
-template<typename algorithmFPType, CpuType cpu>
-void releaseTwoTables( NumericTable *table1,
-                       NumericTable *table2,
-                       BlockDescriptor<algorithmFPType> &bd1,
-                       BlockDescriptor<algorithmFPType> &bd2 )
-{
-    table1->releaseBlockOfRows(bd1);
-    table2->releaseBlockOfRows(bd2);
-}
-/****************************************************************************************************************************/
-template<typename algorithmFPType, CpuType cpu>
-void mergeMinAndMax( data_management::DataCollection *partialResultsCollection,
-                     PartialResult *partialResult )
-{
-    NumericTable *minTable = partialResult->get(partialMinimum).get();
-    NumericTable *maxTable = partialResult->get(partialMaximum).get();
-
-    size_t nFeatures = minTable->getNumberOfColumns();
-
-    BlockDescriptor<algorithmFPType> minBD, maxBD;
-    algorithmFPType *min, *max;
-
-    getTwoTables<algorithmFPType, cpu>( writeOnly,
-                                        minTable,
-                                        maxTable,
-                                        minBD,
-                                        maxBD,
-                                        &min,
-                                        &max);
-
-    PartialResult *inputPartialResult = static_cast<PartialResult* >((*partialResultsCollection)[0].get());
-    NumericTable *inputMinTable = inputPartialResult->get(partialMinimum).get();
-    NumericTable *inputMaxTable = inputPartialResult->get(partialMaximum).get();
-
-    BlockDescriptor<algorithmFPType> inputMinBD, inputMaxBD;
-    algorithmFPType *inputMin, *inputMax;
-
-    getTwoTables<algorithmFPType, cpu>( readOnly,
-                                        inputMinTable,
-                                        inputMaxTable,
-                                        inputMinBD,
-                                        inputMaxBD,
-                                        &inputMin,
-                                        &inputMax );
-
-    size_t rowSize = nFeatures * sizeof(algorithmFPType);
-    daal_memcpy_s(min, rowSize, inputMin, rowSize);
-    daal_memcpy_s(max, rowSize, inputMax, rowSize);
-
-    releaseTwoTables<algorithmFPType, cpu>( inputMinTable,
-                                            inputMaxTable,
-                                            inputMinBD,
-                                            inputMaxBD );
-
-    size_t collectionSize = partialResultsCollection->size();
-
-    for (size_t i = 1; i < collectionSize; ++i)
-    {
-        inputPartialResult = static_cast<PartialResult* >((*partialResultsCollection)[i].get());
-        inputMinTable = inputPartialResult->get(partialMinimum).get();
-        inputMaxTable = inputPartialResult->get(partialMaximum).get();
-
-        getTwoTables<algorithmFPType, cpu>( readOnly,
-                                            inputMinTable,
-                                            inputMaxTable,
-                                            inputMinBD,
-                                            inputMaxBD,
-                                            &inputMin,
-                                            &inputMax );
-
-        for (size_t j = 0; j < nFeatures; ++j)
-        {
-            if (inputMin[j] < min[j]) { min[j] = inputMin[j]; }
-            if (inputMax[j] > max[j]) { max[j] = inputMax[j]; }
-        }
-
-        releaseTwoTables<algorithmFPType, cpu>( inputMinTable,
-                                                inputMaxTable,
-                                                inputMinBD,
-                                                inputMaxBD );
-    }
-
-    releaseTwoTables<algorithmFPType, cpu>( minTable,
-                                            maxTable,
-                                            minBD,
-                                            maxBD );
-}
-
-/****************************************************************************************************************************/
-template<typename algorithmFPType, CpuType cpu>
-void getThreeTables( ReadWriteMode rwMode,
-                     NumericTable *table1,
-                     NumericTable *table2,
-                     NumericTable *table3,
-                     BlockDescriptor<algorithmFPType> &bd1,
-                     BlockDescriptor<algorithmFPType> &bd2,
-                     BlockDescriptor<algorithmFPType> &bd3,
-                     algorithmFPType **array1,
-                     algorithmFPType **array2,
-                     algorithmFPType **array3 )
-{
-    table1->getBlockOfRows(0, 1, rwMode, bd1);
-    table2->getBlockOfRows(0, 1, rwMode, bd2);
-    table3->getBlockOfRows(0, 1, rwMode, bd3);
-    *array1 = bd1.getBlockPtr();
-    *array2 = bd2.getBlockPtr();
-    *array3 = bd3.getBlockPtr();
-}
-
-/****************************************************************************************************************************/
-template<typename algorithmFPType, CpuType cpu>
-void releaseThreeTables( NumericTable *table1,
-                         NumericTable *table2,
-                         NumericTable *table3,
-                         BlockDescriptor<algorithmFPType> &bd1,
-                         BlockDescriptor<algorithmFPType> &bd2,
-                         BlockDescriptor<algorithmFPType> &bd3 )
-{
-    table1->releaseBlockOfRows(bd1);
-    table2->releaseBlockOfRows(bd2);
-    table3->releaseBlockOfRows(bd3);
-}
-
-/****************************************************************************************************************************/
-template<typename algorithmFPType, CpuType cpu>
-void mergeSums( data_management::DataCollection *partialResultsCollection,
-                PartialResult *partialResult,
-                int *partialNObservations )
-{
-
-    ///merge first block
-    size_t nMergedObservations = partialNObservations[0];
-    NumericTable *sumTable      = partialResult->get(partialSum).get();
-    NumericTable *sumSqTable    = partialResult->get(partialSumSquares).get();
-    NumericTable *sumSqCenTable = partialResult->get(partialSumSquaresCentered).get();
-
-    size_t nFeatures = sumTable->getNumberOfColumns();
-
-    BlockDescriptor<algorithmFPType> sumBD, sumSqBD, sumSqCenBD;
-    algorithmFPType *sums, *sumSq, *sumSqCen;
-
-    getThreeTables<algorithmFPType, cpu>( writeOnly,
-                                          sumTable,
-                                          sumSqTable,
-                                          sumSqCenTable,
-                                          sumBD,
-                                          sumSqBD,
-                                          sumSqCenBD,
-                                          &sums,
-                                          &sumSq,
-                                          &sumSqCen );
-
-    PartialResult *inputPartialResult = static_cast<PartialResult* >((*partialResultsCollection)[0].get());
-
-    NumericTable *inputSumTable      = inputPartialResult->get(partialSum).get();
-    NumericTable *inputSumSqTable    = inputPartialResult->get(partialSumSquares).get();
-    NumericTable *inputSumSqCenTable = inputPartialResult->get(partialSumSquaresCentered).get();
-
-    BlockDescriptor<algorithmFPType> inputSumBD, inputSumSqBD, inputSumSqCenBD;
-    algorithmFPType *inputSums, *inputSumSq, *inputSumSqCen;
-
-    getThreeTables<algorithmFPType, cpu>( readOnly,
-                                          inputSumTable,
-                                          inputSumSqTable,
-                                          inputSumSqCenTable,
-                                          inputSumBD,
-                                          inputSumSqBD,
-                                          inputSumSqCenBD,
-                                          &inputSums,
-                                          &inputSumSq,
-                                          &inputSumSqCen );
-
-    size_t rowSize = nFeatures * sizeof(algorithmFPType);
-    daal_memcpy_s(sums,     rowSize, inputSums,     rowSize);
-    daal_memcpy_s(sumSq,    rowSize, inputSumSq,    rowSize);
-    daal_memcpy_s(sumSqCen, rowSize, inputSumSqCen, rowSize);
-
-    releaseThreeTables<algorithmFPType, cpu>( inputSumTable,
-                                              inputSumSqTable,
-                                              inputSumSqCenTable,
-                                              inputSumBD,
-                                              inputSumSqBD,
-                                              inputSumSqCenBD );
-
-    size_t collectionSize = partialResultsCollection->size();
-
-    BlockDescriptor<int> inputNObsBD;
-    int *inputNObs;
-    for(size_t block = 1; block < collectionSize; ++block)
-    {
-        inputPartialResult = static_cast<PartialResult* >((*partialResultsCollection)[block].get());
-
-        inputSumTable      = inputPartialResult->get(partialSum).get();
-        inputSumSqTable    = inputPartialResult->get(partialSumSquares).get();
-        inputSumSqCenTable = inputPartialResult->get(partialSumSquaresCentered).get();
-
-        getThreeTables<algorithmFPType, cpu>(readOnly, inputSumTable, inputSumSqTable, inputSumSqCenTable,
-            inputSumBD, inputSumSqBD, inputSumSqCenBD, &inputSums, &inputSumSq, &inputSumSqCen);
-
-        int n1 = nMergedObservations;
-        int n2 = partialNObservations[block];
-
-        if(n2 == 0)
-        {
-            continue;
-        }
-
-        if(n1 == 0)
-        {
-            for(size_t i = 0; i < nFeatures; i++)
-            {
-                sumSqCen[i] += inputSumSqCen[i];
-                sumSq[i]    += inputSumSq[i];
-                sums[i]     += inputSums[i];
-            }
-            nMergedObservations += n2;
-            continue;
-        }
-
-        algorithmFPType coeff = (algorithmFPType)(n1 * n2) / (algorithmFPType)(n1 + n2);
-        algorithmFPType invN1 = 1.0 / (algorithmFPType)n1;
-        algorithmFPType invN2 = 1.0 / (algorithmFPType)n2;
-
-        for(size_t i = 0; i < nFeatures; i++)
-        {
-            algorithmFPType mean1 = sums[i] * invN1;
-            algorithmFPType mean2 = inputSums[i] * invN2;
-
-            sumSqCen[i] += (inputSumSqCen[i] + coeff * (mean1 * mean1 + mean2 * mean2 - 2 * mean1 * mean2));
-
-            sums[i]  += inputSums[i];
-            sumSq[i] += inputSumSq[i];
-        }
-        nMergedObservations += n2;
-
-        releaseThreeTables<algorithmFPType, cpu>(inputSumTable, inputSumSqTable, inputSumSqCenTable,
-            inputSumBD, inputSumSqBD, inputSumSqCenBD);
-    }
-
-    releaseThreeTables<algorithmFPType, cpu>(sumTable, sumSqTable, sumSqCenTable,
-        sumBD, sumSqBD, sumSqCenBD);
-}
-
-/****************************************************************************************************************************/
-template<typename algorithmFPType, CpuType cpu>
-void finalize( LowOrderMomentsFinalizeTask<algorithmFPType, cpu> &task )
-{
-    algorithmFPType invNObservations   = 1.0 / (algorithmFPType)(task.nObservations[0]);
-    algorithmFPType invNObservationsM1 = 1.0 / (algorithmFPType)(task.nObservations[0] - 1);
-
-    algorithmFPType *sums     = task.sums;
-    algorithmFPType *sumSq    = task.sumSq;
-    algorithmFPType *sumSqCen = task.sumSqCen;
-
-    algorithmFPType *mean      = task.mean;
-    algorithmFPType *raw2Mom   = task.raw2Mom;
-    algorithmFPType *variance  = task.variance;
-    algorithmFPType *stDev     = task.stDev;
-    algorithmFPType *variation = task.variation;
-
-    size_t nFeatures           = task.nFeatures;
+void finalizeMoments( size_t nFeatures,
+                      const algorithmFPType *nObservationsPerFeature,
+                      const algorithmFPType *sums,
+                      const algorithmFPType *sumSq,
+                      const algorithmFPType *sumSqCen,
+                      algorithmFPType *mean,
+                      algorithmFPType *raw2Mom,
+                      algorithmFPType *variance,
+                      algorithmFPType *stDev,
+                      algorithmFPType *variation )
+{
+    const algorithmFPType one(1.0);
 
    PRAGMA_IVDEP
    PRAGMA_VECTOR_ALWAYS
-   PRAGMA_SIMD_ASSERT
     for (size_t i = 0; i < nFeatures; i++)
     {
+        const algorithmFPType invNObservations   = one / nObservationsPerFeature[i];
+        const algorithmFPType invNObservationsM1 = one / (nObservationsPerFeature[i] - one);
+
         mean[i]      = sums[i]     * invNObservations;
         raw2Mom[i]   = sumSq[i]    * invNObservations;
         variance[i]  = sumSqCen[i] * invNObservationsM1;
@@ -896,6 +597,14 @@ void finalize( LowOrderMomentsFinalizeTask<algorithmFPType, cpu> &task )
     }
 }
 
+/****************************************************************************************************************************/
+template<typename algorithmFPType, CpuType cpu>
+void finalize( LowOrderMomentsFinalizeTask<algorithmFPType, cpu> &task )
+{
+    finalizeMoments<algorithmFPType, cpu>(task.nFeatures, task.nObservationsPerFeature, task.sums, task.sumSq, task.sumSqCen,
+                                          task.mean, task.raw2Mom, task.variance, task.stDev, task.variation);
+}
+
 }
 }
 }
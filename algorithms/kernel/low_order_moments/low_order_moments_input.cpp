@@ -35,7 +35,7 @@ namespace low_order_moments
 namespace interface1
 {
 
-Input::Input() : InputIface(1) {}
+Input::Input() : InputIface(2) {}
 
 /**
  * Returns the number of columns in the input data set
@@ -94,6 +94,12 @@ void Input::check(const daal::algorithms::Parameter *parameter, int method) cons
         NumericTablePtr sum = dataTable->basicStatistics.get(NumericTableIface::sum);
         if(!checkNumericTable(sum.get(), this->_errors.get(), basicStatisticsSumStr(), 0, 0, dataTable->getNumberOfColumns(), 1)) { return; }
     }
+
+    NumericTablePtr weightsTable = get(weights);
+    if(weightsTable)
+    {
+        if(!checkNumericTable(weightsTable.get(), this->_errors.get(), weightsStr(), 0, 0, 1, dataTable->getNumberOfRows())) { return; }
+    }
 }
 
 } // namespace interface1
@@ -44,17 +44,17 @@ template<typename algorithmFPType, low_order_moments::Method method, CpuType cpu
 class LowOrderMomentsBatchKernel : public daal::algorithms::Kernel
 {
 public:
-    void compute(NumericTable *dataTable, Result *result, const Parameter *parameter);
+    void compute(NumericTable *dataTable, NumericTable *weightsTable, Result *result, const Parameter *parameter);
 };
 
 template<typename algorithmFPType, low_order_moments::Method method, CpuType cpu>
 class LowOrderMomentsOnlineKernel : public daal::algorithms::Kernel
 {
 public:
-    void compute(NumericTable *dataTable, PartialResult *partialResult,
+    void compute(NumericTable *dataTable, NumericTable *weightsTable, PartialResult *partialResult,
             const Parameter *parameter, bool isOnline);
 
-    void finalizeCompute(NumericTable *nObservationsTable,
+    void finalizeCompute(NumericTable *nObservationsPerFeatureTable,
             NumericTable *sumTable, NumericTable *sumSqTable, NumericTable *sumSqCenTable,
             NumericTable *meanTable, NumericTable *raw2MomTable, NumericTable *varianceTable,
             NumericTable *stDevTable, NumericTable *variationTable,
@@ -68,7 +68,7 @@ public:
     void compute(data_management::DataCollection *partialResultsCollection,
             PartialResult *partialResult, const Parameter *parameter);
 
-    void finalizeCompute(NumericTable *nObservationsTable,
+    void finalizeCompute(NumericTable *nObservationsPerFeatureTable,
             NumericTable *sumTable, NumericTable *sumSqTable, NumericTable *sumSqCenTable,
             NumericTable *meanTable, NumericTable *raw2MomTable, NumericTable *varianceTable,
             NumericTable *stDevTable, NumericTable *variationTable,
@@ -125,7 +125,7 @@ struct LowOrderMomentsOnlineTask
 template<typename algorithmFPType, CpuType cpu>
 struct LowOrderMomentsFinalizeTask
 {
-    LowOrderMomentsFinalizeTask(NumericTable *nObservationsTable,
+    LowOrderMomentsFinalizeTask(NumericTable *nObservationsPerFeatureTable,
             NumericTable *sumTable, NumericTable *sumSqTable, NumericTable *sumSqCenTable,
             NumericTable *meanTable, NumericTable *raw2MomTable, NumericTable *varianceTable,
             NumericTable *stDevTable, NumericTable *variationTable);
@@ -133,7 +133,7 @@ struct LowOrderMomentsFinalizeTask
 
     size_t nFeatures;
 
-    NumericTable *nObservationsTable;
+    NumericTable *nObservationsPerFeatureTable;
     NumericTable *sumTable;
     NumericTable *sumSqTable;
     NumericTable *sumSqCenTable;
@@ -144,7 +144,7 @@ struct LowOrderMomentsFinalizeTask
     NumericTable *stDevTable;
     NumericTable *variationTable;
 
-    BlockDescriptor<int> nObservationsBD;
+    BlockDescriptor<algorithmFPType> nObservationsPerFeatureBD;
     BlockDescriptor<algorithmFPType> sumBD;
     BlockDescriptor<algorithmFPType> sumSqBD;
     BlockDescriptor<algorithmFPType> sumSqCenBD;
@@ -155,7 +155,7 @@ struct LowOrderMomentsFinalizeTask
     BlockDescriptor<algorithmFPType> stDevBD;
     BlockDescriptor<algorithmFPType> variationBD;
 
-    int *nObservations;
+    algorithmFPType *nObservationsPerFeature;
     algorithmFPType *sums;
     algorithmFPType *sumSq;
     algorithmFPType *sumSqCen;
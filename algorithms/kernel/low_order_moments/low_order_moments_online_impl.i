@@ -26,6 +26,7 @@
 
 #include "low_order_moments_kernel.h"
 #include "low_order_moments_impl.i"
+#include "low_order_moments_weighted_impl.i"
 
 namespace daal
 {
@@ -38,9 +39,23 @@ namespace internal
 
 template<typename algorithmFPType, Method method, CpuType cpu>
 void LowOrderMomentsOnlineKernel<algorithmFPType, method, cpu>::compute(
-            NumericTable *dataTable, PartialResult *partialResult,
+            NumericTable *dataTable, NumericTable *weightsTable, PartialResult *partialResult,
             const Parameter *parameter, bool isOnline)
 {
+    if (isOnline)
+    {
+        initNObservationsPerFeature<algorithmFPType, cpu>(partialResult);
+    }
+
+    /* The partial results updated with the weights or with missing values are updated with the weighted moments
+       for the following blocks too, as the moments of the other methods assume one observation per row */
+    if (weightsTable || parameter->skipMissingValues ||
+        (isOnline && isNObservationsPerFeatureWeighted<algorithmFPType, cpu>(partialResult)))
+    {
+        computeWeightedOnline<algorithmFPType, cpu>(dataTable, weightsTable, partialResult, parameter, isOnline, this->_errors.get());
+        return;
+    }
+
     if(method == defaultDense)
     {
 
@@ -62,8 +77,6 @@ void LowOrderMomentsOnlineKernel<algorithmFPType, method, cpu>::compute(
                 break;
             }
         }
-
-        return;
     }
     else
     {
@@ -101,20 +114,22 @@ void LowOrderMomentsOnlineKernel<algorithmFPType, method, cpu>::compute(
 
         task.resultArray[(int)nObservations][0] += (algorithmFPType)(task.nVectors);
     }
+    if (this->_errors->size() != 0) { return; }
 
-    return;
+    setNObservationsPerFeature<algorithmFPType, cpu>(partialResult->get(partialNObservationsPerFeature).get(),
+                                                     dataTable->getNumberOfRows(), isOnline);
 }
 
 template<typename algorithmFPType, Method method, CpuType cpu>
 void LowOrderMomentsOnlineKernel<algorithmFPType, method, cpu>::finalizeCompute(
-            NumericTable *nObservationsTable,
+            NumericTable *nObservationsPerFeatureTable,
             NumericTable *sumTable, NumericTable *sumSqTable, NumericTable *sumSqCenTable,
             NumericTable *meanTable, NumericTable *raw2MomTable, NumericTable *varianceTable,
             NumericTable *stDevTable, NumericTable *variationTable,
             const Parameter *parameter)
 {
     LowOrderMomentsFinalizeTask<algorithmFPType, cpu> task(
-        nObservationsTable, sumTable, sumSqTable, sumSqCenTable, meanTable,
+        nObservationsPerFeatureTable, sumTable, sumSqTable, sumSqCenTable, meanTable,
         raw2MomTable, varianceTable, stDevTable, variationTable);
 
     finalize<algorithmFPType, cpu>(task);
@@ -114,7 +114,7 @@ void PartialResult::checkImpl(size_t nFeatures) const
 {
     int unexpectedLayouts = (int)packed_mask;
     const char* errorMessages[] = {partialMinimumStr(), partialMaximumStr(), partialSumStr(),
-        partialSumSquaresStr(), partialSumSquaresCenteredStr() };
+        partialSumSquaresStr(), partialSumSquaresCenteredStr(), partialNObservationsPerFeatureStr() };
 
     for(size_t i = 1; i < nPartialResults; i++)
     {
@@ -171,7 +171,8 @@ void DefaultPartialResultInit::operator()(const Input &input, services::SharedPt
     inTable->releaseBlockOfRows(firstRowBlock);
 }
 
-Parameter::Parameter(EstimatesToCompute  _estimatesToCompute) : initializationProcedure(new DefaultPartialResultInit()), estimatesToCompute(_estimatesToCompute)
+Parameter::Parameter(EstimatesToCompute  _estimatesToCompute) : initializationProcedure(new DefaultPartialResultInit()), estimatesToCompute(_estimatesToCompute),
+    skipMissingValues(false)
 {
 }
 
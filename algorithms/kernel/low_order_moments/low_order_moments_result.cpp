@@ -88,7 +88,7 @@ void Result::checkImpl(size_t nFeatures) const
     int unexpectedLayouts = (int)packed_mask;
 
     const char* errorMessages[] = {minimumStr(), maximumStr(), sumStr(), sumSquaresStr(), sumSquaresCenteredStr(), meanStr(),
-        secondOrderRawMomentStr(), varianceStr(), standardDeviationStr(), variationStr() };
+        secondOrderRawMomentStr(), varianceStr(), standardDeviationStr(), variationStr(), nObservationsPerFeatureStr() };
 
     for(size_t i = 0; i < nResults; i++)
     {
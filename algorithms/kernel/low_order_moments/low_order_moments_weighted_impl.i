@@ -0,0 +1,557 @@
+/* file: low_order_moments_weighted_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the low order moments with the weights of observations and missing values.
+//  Every block of rows is processed in one pass: the values equal to NaN are masked out of the sums,
+//  so every feature has its own number of observations, that is the sum of the weights of its non-missing values.
+//  The centered sums of squares of the blocks are merged with the pairwise update.
+//--
+*/
+
+#ifndef __LOW_ORDER_MOMENTS_WEIGHTED_IMPL_I__
+#define __LOW_ORDER_MOMENTS_WEIGHTED_IMPL_I__
+
+#include "csr_numeric_table.h"
+#include "low_order_moments_kernel.h"
+#include "service_numeric_table.h"
+#include "service_data_utils.h"
+#include "service_memory.h"
+#include "service_math.h"
+#include "threading.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace low_order_moments
+{
+namespace internal
+{
+
+/** \brief Weighted moments of the features of the block of the data set */
+template<typename algorithmFPType, CpuType cpu>
+struct WeightedMoments
+{
+    WeightedMoments(size_t nFeatures) : nFeatures(nFeatures), nRows(0)
+    {
+        nObservations = (algorithmFPType *)daal::services::daal_malloc(10 * nFeatures * sizeof(algorithmFPType));
+        sum            = nObservations + nFeatures;
+        sumSq          = sum + nFeatures;
+        sumSqCen       = sumSq + nFeatures;
+        min            = sumSqCen + nFeatures;
+        max            = min + nFeatures;
+        storedWeight   = max + nFeatures;
+        missingWeight  = storedWeight + nFeatures;
+        nStored        = missingWeight + nFeatures;
+        nMissing       = nStored + nFeatures;
+        isValid = (nObservations != NULL);
+    }
+
+    ~WeightedMoments() { daal::services::daal_free(nObservations); }
+
+    void reset()
+    {
+        const algorithmFPType zero(0.0);
+        const algorithmFPType maxVal = daal::data_feature_utils::internal::MaxVal<algorithmFPType, cpu>::get();
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            nObservations[j] = zero;
+            sum[j]      = zero;
+            sumSq[j]    = zero;
+            sumSqCen[j] = zero;
+            min[j]      =  maxVal;
+            max[j]      = -maxVal;
+        }
+        nRows = 0;
+    }
+
+    /** \brief Compute the moments of the block of rows of the dense table from scratch.
+     *         The rows with non-positive weights are skipped */
+    void setDense(const algorithmFPType *data, const algorithmFPType *weights, size_t nBlockRows, bool skipMissingValues)
+    {
+        const algorithmFPType zero(0.0);
+        reset();
+
+        for (size_t i = 0; i < nBlockRows; i++)
+        {
+            const algorithmFPType w = (weights ? weights[i] : algorithmFPType(1.0));
+            if (!(w > zero)) { continue; }
+
+            const algorithmFPType *row = data + i * nFeatures;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                const algorithmFPType x  = row[j];
+                const algorithmFPType wx = (!skipMissingValues || x == x ? w : zero);
+                const algorithmFPType xv = (wx > zero ? x : zero);
+                nObservations[j] += wx;
+                sum[j]   += wx * xv;
+                sumSq[j] += wx * xv * xv;
+                min[j] = (x < min[j] ? x : min[j]);
+                max[j] = (x > max[j] ? x : max[j]);
+            }
+        }
+
+        /* Center on the mean of the block to avoid the cancellation of the raw sums of squares */
+        algorithmFPType *mean = storedWeight;
+        computeMean(mean);
+        for (size_t i = 0; i < nBlockRows; i++)
+        {
+            const algorithmFPType w = (weights ? weights[i] : algorithmFPType(1.0));
+            if (!(w > zero)) { continue; }
+
+            const algorithmFPType *row = data + i * nFeatures;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                const algorithmFPType x  = row[j];
+                const algorithmFPType wx = (!skipMissingValues || x == x ? w : zero);
+                const algorithmFPType diff = (wx > zero ? x - mean[j] : zero);
+                sumSqCen[j] += wx * diff * diff;
+            }
+        }
+        nRows = nBlockRows;
+    }
+
+    /** \brief Compute the moments of the block of rows of the CSR table from scratch.
+     *         The values that are not stored are zeros, they are never missing */
+    void setCSR(const algorithmFPType *values, const size_t *colIndices, const size_t *rowOffsets,
+                const algorithmFPType *weights, size_t nBlockRows, bool skipMissingValues)
+    {
+        const algorithmFPType zero(0.0);
+        const algorithmFPType one(1.0);
+        reset();
+
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            storedWeight[j]  = zero;
+            missingWeight[j] = zero;
+            nStored[j]       = zero;
+            nMissing[j]      = zero;
+        }
+
+        algorithmFPType rowsWeight = zero;
+        algorithmFPType nPositiveRows = zero;
+        for (size_t i = 0; i < nBlockRows; i++)
+        {
+            const algorithmFPType w = (weights ? weights[i] : one);
+            if (!(w > zero)) { continue; }
+            rowsWeight += w;
+            nPositiveRows += one;
+
+            for (size_t k = rowOffsets[i] - rowOffsets[0]; k < rowOffsets[i + 1] - rowOffsets[0]; k++)
+            {
+                const size_t j = colIndices[k] - 1;
+                const algorithmFPType x = values[k];
+                if (skipMissingValues && x != x)
+                {
+                    missingWeight[j] += w;
+                    nMissing[j] += one;
+                    continue;
+                }
+                storedWeight[j] += w;
+                nStored[j] += one;
+                sum[j]   += w * x;
+                sumSq[j] += w * x * x;
+                min[j] = (x < min[j] ? x : min[j]);
+                max[j] = (x > max[j] ? x : max[j]);
+            }
+        }
+
+        /* Add the zeros that are not stored. nStored and nMissing keep the exact numbers of the stored values,
+           so the weight of the zeros accumulated with rounding errors is used only if such zeros exist */
+        algorithmFPType *zerosWeight = missingWeight;
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            const bool hasZeros = (nStored[j] + nMissing[j] < nPositiveRows);
+            algorithmFPType zerosW = rowsWeight - missingWeight[j] - storedWeight[j];
+            zerosW = (hasZeros && zerosW > zero ? zerosW : zero);
+            zerosWeight[j] = zerosW;
+            nObservations[j] = storedWeight[j] + zerosW;
+            if (hasZeros)
+            {
+                min[j] = (zero < min[j] ? zero : min[j]);
+                max[j] = (zero > max[j] ? zero : max[j]);
+            }
+        }
+
+        algorithmFPType *mean = storedWeight;
+        computeMean(mean);
+        for (size_t i = 0; i < nBlockRows; i++)
+        {
+            const algorithmFPType w = (weights ? weights[i] : one);
+            if (!(w > zero)) { continue; }
+
+            for (size_t k = rowOffsets[i] - rowOffsets[0]; k < rowOffsets[i + 1] - rowOffsets[0]; k++)
+            {
+                const size_t j = colIndices[k] - 1;
+                const algorithmFPType x = values[k];
+                if (skipMissingValues && x != x) { continue; }
+                const algorithmFPType diff = x - mean[j];
+                sumSqCen[j] += w * diff * diff;
+            }
+        }
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            sumSqCen[j] += zerosWeight[j] * mean[j] * mean[j];
+        }
+        nRows = nBlockRows;
+    }
+
+    /** \brief Merge the moments of another part of the data set into these moments feature by feature */
+    void merge(size_t nRowsB, const algorithmFPType *nObservationsB, const algorithmFPType *sumB, const algorithmFPType *sumSqB,
+               const algorithmFPType *sumSqCenB, const algorithmFPType *minB, const algorithmFPType *maxB)
+    {
+        const algorithmFPType zero(0.0);
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            const algorithmFPType nB = nObservationsB[j];
+            if (!(nB > zero)) { continue; }
+
+            const algorithmFPType nA = nObservations[j];
+            if (nA > zero)
+            {
+                const algorithmFPType delta = sumB[j] / nB - sum[j] / nA;
+                sumSqCen[j] += sumSqCenB[j] + delta * delta * (nA * nB / (nA + nB));
+                min[j] = (minB[j] < min[j] ? minB[j] : min[j]);
+                max[j] = (maxB[j] > max[j] ? maxB[j] : max[j]);
+            }
+            else
+            {
+                sumSqCen[j] = sumSqCenB[j];
+                min[j] = minB[j];
+                max[j] = maxB[j];
+            }
+            nObservations[j] = nA + nB;
+            sum[j]   += sumB[j];
+            sumSq[j] += sumSqB[j];
+        }
+        nRows += nRowsB;
+    }
+
+    void merge(const WeightedMoments &other)
+    {
+        merge(other.nRows, other.nObservations, other.sum, other.sumSq, other.sumSqCen, other.min, other.max);
+    }
+
+    /** \brief Sets the minimum and the maximum of the features without observations to NaN, that is the zero sum over zero weight */
+    void setUndefinedMinMax()
+    {
+        const algorithmFPType zero(0.0);
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            if (!(nObservations[j] > zero))
+            {
+                min[j] = max[j] = sum[j] / nObservations[j];
+            }
+        }
+    }
+
+    size_t nFeatures;
+    size_t nRows;                       /* Number of rows including the ones with missing values */
+    algorithmFPType *nObservations;     /* Sum of the weights of the non-missing values of every feature */
+    algorithmFPType *sum;
+    algorithmFPType *sumSq;
+    algorithmFPType *sumSqCen;
+    algorithmFPType *min;
+    algorithmFPType *max;
+    bool isValid;
+
+private:
+    void computeMean(algorithmFPType *mean) const
+    {
+        const algorithmFPType zero(0.0);
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            mean[j] = (nObservations[j] > zero ? sum[j] / nObservations[j] : zero);
+        }
+    }
+
+    /* Work arrays of the CSR blocks */
+    algorithmFPType *storedWeight;
+    algorithmFPType *missingWeight;
+    algorithmFPType *nStored;
+    algorithmFPType *nMissing;
+};
+
+/** \brief Computes the weighted moments of all rows of the dense or CSR table */
+template<typename algorithmFPType, CpuType cpu>
+void computeWeightedMoments(NumericTable *dataTable, NumericTable *weightsTable, bool skipMissingValues,
+                            WeightedMoments<algorithmFPType, cpu> &moments, services::KernelErrorCollection *errors)
+{
+    const size_t blockSize = 512;
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t nVectors  = dataTable->getNumberOfRows();
+
+    CSRNumericTableIface *csrTable = NULL;
+    if (dataTable->getDataLayout() == NumericTableIface::csrArray)
+    {
+        csrTable = dynamic_cast<CSRNumericTableIface *>(dataTable);
+    }
+
+    size_t nBlocks = nVectors / blockSize;
+    if (nBlocks * blockSize < nVectors) { nBlocks++; }
+
+    typedef WeightedMoments<algorithmFPType, cpu> TlsMoments;
+    daal::tls<TlsMoments *> tlsMoments([ = ]()
+    {
+        TlsMoments *localMoments = new TlsMoments(nFeatures);
+        if (localMoments->isValid) { localMoments->reset(); }
+        return localMoments;
+    } );
+    daal::tls<TlsMoments *> tlsBlockMoments([ = ]()
+    {
+        return new TlsMoments(nFeatures);
+    } );
+
+    daal::threader_for( nBlocks, nBlocks, [ & ](int iBlock)
+    {
+        TlsMoments *localMoments = tlsMoments.local();
+        TlsMoments *blockMoments = tlsBlockMoments.local();
+        if (!localMoments->isValid || !blockMoments->isValid) { return; }
+
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows = (startRow + blockSize < nVectors ? blockSize : nVectors - startRow);
+
+        ReadRows<algorithmFPType, cpu> weightsRows(weightsTable, startRow, nRows);
+        if (csrTable)
+        {
+            ReadRowsCSR<algorithmFPType, cpu> dataRows(csrTable, startRow, nRows);
+            blockMoments->setCSR(dataRows.values(), dataRows.cols(), dataRows.rows(), weightsRows.get(), nRows, skipMissingValues);
+        }
+        else
+        {
+            ReadRows<algorithmFPType, cpu> dataRows(dataTable, startRow, nRows);
+            blockMoments->setDense(dataRows.get(), weightsRows.get(), nRows, skipMissingValues);
+        }
+        localMoments->merge(*blockMoments);
+    } );
+
+    bool isValid = true;
+    tlsMoments.reduce( [ & ](TlsMoments *localMoments)
+    {
+        isValid = isValid && localMoments->isValid;
+        if (localMoments->isValid) { moments.merge(*localMoments); }
+        delete localMoments;
+    } );
+    tlsBlockMoments.reduce( [ & ](TlsMoments *blockMoments)
+    {
+        isValid = isValid && blockMoments->isValid;
+        delete blockMoments;
+    } );
+    if (!isValid) { errors->add(services::ErrorMemoryAllocationFailed); }
+}
+
+/** \brief Merges the partial result into the moments */
+template<typename algorithmFPType, CpuType cpu>
+void mergePartialResult(PartialResult *partialResult, WeightedMoments<algorithmFPType, cpu> &moments)
+{
+    ReadRows<double, cpu>          nRowsRows   (partialResult->get(nObservations).get(),                  0, 1);
+    ReadRows<algorithmFPType, cpu> nObsRows    (partialResult->get(partialNObservationsPerFeature).get(), 0, 1);
+    ReadRows<algorithmFPType, cpu> sumRows     (partialResult->get(partialSum).get(),                     0, 1);
+    ReadRows<algorithmFPType, cpu> sumSqRows   (partialResult->get(partialSumSquares).get(),              0, 1);
+    ReadRows<algorithmFPType, cpu> sumSqCenRows(partialResult->get(partialSumSquaresCentered).get(),      0, 1);
+    ReadRows<algorithmFPType, cpu> minRows     (partialResult->get(partialMinimum).get(),                 0, 1);
+    ReadRows<algorithmFPType, cpu> maxRows     (partialResult->get(partialMaximum).get(),                 0, 1);
+
+    moments.merge((size_t)(nRowsRows.get()[0]), nObsRows.get(), sumRows.get(), sumSqRows.get(),
+                  sumSqCenRows.get(), minRows.get(), maxRows.get());
+}
+
+/** \brief Stores the moments in the partial result */
+template<typename algorithmFPType, CpuType cpu>
+void setPartialResult(WeightedMoments<algorithmFPType, cpu> &moments, PartialResult *partialResult)
+{
+    const size_t nFeatures = moments.nFeatures;
+    const size_t rowSize = nFeatures * sizeof(algorithmFPType);
+    moments.setUndefinedMinMax();
+
+    WriteOnlyRows<double, cpu>          nRowsRows   (partialResult->get(nObservations).get(),                  0, 1);
+    WriteOnlyRows<algorithmFPType, cpu> nObsRows    (partialResult->get(partialNObservationsPerFeature).get(), 0, 1);
+    WriteOnlyRows<algorithmFPType, cpu> sumRows     (partialResult->get(partialSum).get(),                     0, 1);
+    WriteOnlyRows<algorithmFPType, cpu> sumSqRows   (partialResult->get(partialSumSquares).get(),              0, 1);
+    WriteOnlyRows<algorithmFPType, cpu> sumSqCenRows(partialResult->get(partialSumSquaresCentered).get(),      0, 1);
+    WriteOnlyRows<algorithmFPType, cpu> minRows     (partialResult->get(partialMinimum).get(),                 0, 1);
+    WriteOnlyRows<algorithmFPType, cpu> maxRows     (partialResult->get(partialMaximum).get(),                 0, 1);
+
+    nRowsRows.get()[0] = (double)moments.nRows;
+    daal_memcpy_s(nObsRows.get(),     rowSize, moments.nObservations, rowSize);
+    daal_memcpy_s(sumRows.get(),      rowSize, moments.sum,           rowSize);
+    daal_memcpy_s(sumSqRows.get(),    rowSize, moments.sumSq,         rowSize);
+    daal_memcpy_s(sumSqCenRows.get(), rowSize, moments.sumSqCen,      rowSize);
+    daal_memcpy_s(minRows.get(),      rowSize, moments.min,           rowSize);
+    daal_memcpy_s(maxRows.get(),      rowSize, moments.max,           rowSize);
+}
+
+/** \brief Computes the results of the batch mode with the weights of observations and missing values */
+template<typename algorithmFPType, CpuType cpu>
+void computeWeightedBatch(NumericTable *dataTable, NumericTable *weightsTable, Result *result, const Parameter *parameter,
+                          services::KernelErrorCollection *errors)
+{
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+
+    WeightedMoments<algorithmFPType, cpu> moments(nFeatures);
+    if (!moments.isValid) { errors->add(services::ErrorMemoryAllocationFailed); return; }
+    moments.reset();
+
+    computeWeightedMoments<algorithmFPType, cpu>(dataTable, weightsTable, parameter->skipMissingValues, moments, errors);
+    if (errors->size() != 0) { return; }
+    moments.setUndefinedMinMax();
+
+    const size_t rowSize = nFeatures * sizeof(algorithmFPType);
+    WriteOnlyRows<algorithmFPType, cpu> resultRows[nResults];
+    for (size_t i = 0; i < nResults; i++)
+    {
+        resultRows[i].set(result->get((ResultId)i).get(), 0, 1);
+    }
+
+    daal_memcpy_s(resultRows[(int)minimum].get(),                 rowSize, moments.min,           rowSize);
+    daal_memcpy_s(resultRows[(int)maximum].get(),                 rowSize, moments.max,           rowSize);
+    daal_memcpy_s(resultRows[(int)sum].get(),                     rowSize, moments.sum,           rowSize);
+    daal_memcpy_s(resultRows[(int)sumSquares].get(),              rowSize, moments.sumSq,         rowSize);
+    daal_memcpy_s(resultRows[(int)sumSquaresCentered].get(),      rowSize, moments.sumSqCen,      rowSize);
+    daal_memcpy_s(resultRows[(int)nObservationsPerFeature].get(), rowSize, moments.nObservations, rowSize);
+
+    finalizeMoments<algorithmFPType, cpu>(nFeatures, moments.nObservations, moments.sum, moments.sumSq, moments.sumSqCen,
+                                          resultRows[(int)mean].get(), resultRows[(int)secondOrderRawMoment].get(),
+                                          resultRows[(int)variance].get(), resultRows[(int)standardDeviation].get(),
+                                          resultRows[(int)variation].get());
+}
+
+/** \brief Updates the partial result with the block of the data set with the weights of observations and missing values */
+template<typename algorithmFPType, CpuType cpu>
+void computeWeightedOnline(NumericTable *dataTable, NumericTable *weightsTable, PartialResult *partialResult,
+                           const Parameter *parameter, bool isOnline, services::KernelErrorCollection *errors)
+{
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+
+    WeightedMoments<algorithmFPType, cpu> moments(nFeatures);
+    if (!moments.isValid) { errors->add(services::ErrorMemoryAllocationFailed); return; }
+    moments.reset();
+
+    if (isOnline)
+    {
+        mergePartialResult<algorithmFPType, cpu>(partialResult, moments);
+    }
+
+    computeWeightedMoments<algorithmFPType, cpu>(dataTable, weightsTable, parameter->skipMissingValues, moments, errors);
+    if (errors->size() != 0) { return; }
+
+    setPartialResult<algorithmFPType, cpu>(moments, partialResult);
+}
+
+/** \brief Merges the partial results computed on local nodes */
+template<typename algorithmFPType, CpuType cpu>
+void mergePartialResults(data_management::DataCollection *partialResultsCollection, PartialResult *partialResult,
+                         services::KernelErrorCollection *errors)
+{
+    const size_t nFeatures = partialResult->get(partialSum)->getNumberOfColumns();
+
+    WeightedMoments<algorithmFPType, cpu> moments(nFeatures);
+    if (!moments.isValid) { errors->add(services::ErrorMemoryAllocationFailed); return; }
+    moments.reset();
+
+    for (size_t i = 0; i < partialResultsCollection->size(); i++)
+    {
+        PartialResult *localPartialResult = static_cast<PartialResult *>((*partialResultsCollection)[i].get());
+        mergePartialResult<algorithmFPType, cpu>(localPartialResult, moments);
+    }
+
+    setPartialResult<algorithmFPType, cpu>(moments, partialResult);
+}
+
+/**
+ *  \brief Sets the numbers of observations of the features to the number of observations processed so far
+ *         if the initialization procedure of the partial results did not set them
+ */
+template<typename algorithmFPType, CpuType cpu>
+void initNObservationsPerFeature(PartialResult *partialResult)
+{
+    NumericTable *nObservationsPerFeatureTable = partialResult->get(partialNObservationsPerFeature).get();
+    const size_t nFeatures = nObservationsPerFeatureTable->getNumberOfColumns();
+    WriteRows<algorithmFPType, cpu> nObsRows(nObservationsPerFeatureTable, 0, 1);
+    algorithmFPType *nObs = nObsRows.get();
+    if (!nObs || nFeatures == 0 || nObs[0] >= (algorithmFPType)0) { return; }
+
+    ReadRows<double, cpu> nRowsRows(partialResult->get(nObservations).get(), 0, 1);
+    const algorithmFPType n = (nRowsRows.get() ? (algorithmFPType)(nRowsRows.get()[0]) : (algorithmFPType)0);
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        nObs[j] = n;
+    }
+}
+
+/**
+ *  \brief Returns true if the number of observations of any feature differs from the number of observations,
+ *         that is, the partial results were updated with the weights of observations or with missing values
+ */
+template<typename algorithmFPType, CpuType cpu>
+bool isNObservationsPerFeatureWeighted(PartialResult *partialResult)
+{
+    NumericTable *nObservationsPerFeatureTable = partialResult->get(partialNObservationsPerFeature).get();
+    const size_t nFeatures = nObservationsPerFeatureTable->getNumberOfColumns();
+    ReadRows<algorithmFPType, cpu> nObsRows(nObservationsPerFeatureTable, 0, 1);
+    ReadRows<double, cpu> nRowsRows(partialResult->get(nObservations).get(), 0, 1);
+    const algorithmFPType *nObs = nObsRows.get();
+    if (!nObs || !nRowsRows.get()) { return false; }
+
+    const algorithmFPType n = (algorithmFPType)(nRowsRows.get()[0]);
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        if (nObs[j] != n) { return true; }
+    }
+    return false;
+}
+
+/** \brief Sets the numbers of observations of the features when no values are missing and all weights are equal to one */
+template<typename algorithmFPType, CpuType cpu>
+void setNObservationsPerFeature(NumericTable *nObservationsPerFeatureTable, size_t nVectors, bool isOnline)
+{
+    const size_t nFeatures = nObservationsPerFeatureTable->getNumberOfColumns();
+    WriteRows<algorithmFPType, cpu> nObsRows(nObservationsPerFeatureTable, 0, 1);
+    algorithmFPType *nObs = nObsRows.get();
+
+    const algorithmFPType n = (algorithmFPType)nVectors;
+  PRAGMA_IVDEP
+  PRAGMA_VECTOR_ALWAYS
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        nObs[j] = (isOnline ? nObs[j] + n : n);
+    }
+}
+
+} // namespace internal
+} // namespace low_order_moments
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -45,11 +45,15 @@ DAAL_EXPORT void PartialResult::allocate(const daal::algorithms::Input *input, c
 
     Argument::set(nObservations, data_management::NumericTablePtr(
                       new data_management::HomogenNumericTable<size_t>(1, 1, data_management::NumericTable::doAllocate)));
-    for(size_t i = 1; i < nPartialResults; i++)
+    for(size_t i = 1; i < partialNObservationsPerFeature; i++)
     {
         Argument::set(i, data_management::NumericTablePtr(
                           new data_management::HomogenNumericTable<algorithmFPType>(nFeatures, 1, data_management::NumericTable::doAllocate)));
     }
+    /* Negative values mark the numbers of observations of the features that are not set by the initialization procedure */
+    Argument::set(partialNObservationsPerFeature, data_management::NumericTablePtr(
+                      new data_management::HomogenNumericTable<algorithmFPType>(nFeatures, 1, data_management::NumericTable::doAllocate,
+                                                                                (algorithmFPType)(-1))));
 }
 
 }// namespace low_order_moments
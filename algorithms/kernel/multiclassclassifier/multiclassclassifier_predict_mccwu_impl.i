@@ -78,6 +78,16 @@ void MultiClassClassifierPredictKernel<multiClassClassifierWu, training::oneAgai
     size_t nVectors  = a->getNumberOfRows();
 
     size_t nRowsInBlock = getMultiClassClassifierPredictBlockSize<algorithmFPType, cpu>();
+
+    /* Two-class SVM models share the kernel function values computed for the unique support vectors */
+    MultiClassSVMModel<algorithmFPType, cpu> svmModelStorage;
+    const MultiClassSVMModel<algorithmFPType, cpu> *svmModel = NULL;
+    if (nClasses > 1 && svmModelStorage.init(model, nClasses, nonEmptyClassMap, nFeatures, mccPar->prediction))
+    {
+        svmModel = &svmModelStorage;
+        size_t maxRowsInBlock = getMultiClassSVMKernelBlockSize<algorithmFPType, cpu>() / svmModel->nUniqueSV;
+        if (maxRowsInBlock < nRowsInBlock) { nRowsInBlock = (maxRowsInBlock > 0 ? maxRowsInBlock : 1); }
+    }
     /* Calculate number of blocks of rows including tail block */
     size_t nBlocks = nVectors / nRowsInBlock;
     if (nBlocks * nRowsInBlock < nVectors) { nBlocks++; }
@@ -88,7 +98,7 @@ void MultiClassClassifierPredictKernel<multiClassClassifierWu, training::oneAgai
     daal::tls<MultiClassClassifierTls<algorithmFPType, cpu> *> tls([=]()
     {
         return new MultiClassClassifierTls<algorithmFPType, cpu>(
-                nClasses, nRowsInBlock, a, r, mccPar->prediction);
+                nClasses, nRowsInBlock, a, r, mccPar->prediction, svmModel);
     } );
 
     daal::threader_for(nBlocks, nBlocks, [&](size_t iBlock)
@@ -103,9 +113,10 @@ void MultiClassClassifierPredictKernel<multiClassClassifierWu, training::oneAgai
         services::SharedPtr<classifier::prediction::Batch> simplePrediction = localValues->simplePrediction;
         algorithmFPType *buffer = localValues->buffer;
         services::Error &localError = localValues->error;
+        if(localError.id() != services::NoErrorMessageFound) { return; }
         getBlockOfRowsOfResults(nFeatures, startRow, nRows, nClasses, nonEmptyClassMap, mtX, mtR,
                                 simplePrediction, model,
-                                nIter, eps, buffer, localError);
+                                nIter, eps, buffer, svmModel, localValues->kernel.get(), localValues->svmBuffer, localError);
         if(localError.id() != services::NoErrorMessageFound) { return; }
     } );
 
@@ -159,6 +170,8 @@ getBlockOfRowsOfResults(size_t nFeatures, size_t startRow, size_t nRows, size_t
                         services::SharedPtr<classifier::prediction::Batch> simplePrediction,
                         Model *model,
                         size_t nIter, double eps, algorithmFPType *buffer,
+                        const MultiClassSVMModel<algorithmFPType, cpu> *svmModel,
+                        kernel_function::KernelIface *kernel, algorithmFPType *svmBuffer,
                         services::Error &error)
 {
     algorithmFPType one = 1.0;
@@ -172,7 +185,7 @@ getBlockOfRowsOfResults(size_t nFeatures, size_t startRow, size_t nRows, size_t
 
     /* Get 2-class probabilities */
     get2ClassProbabilities(nFeatures, startRow, nRows, nClasses, nonEmptyClassMap, mtX, y,
-                           simplePrediction, model, rProb, error);
+                           simplePrediction, model, svmModel, kernel, svmBuffer, rProb, error);
     if(error.id() != services::NoErrorMessageFound) { return; }
 
     algorithmFPType *rProbPtr = rProb;
@@ -225,6 +238,8 @@ get2ClassProbabilities(size_t nFeatures, size_t startRow, size_t nRows, size_t n
                        MicroTable *mtX, algorithmFPType *y,
                        services::SharedPtr<classifier::prediction::Batch> simplePrediction,
                        Model *model,
+                       const MultiClassSVMModel<algorithmFPType, cpu> *svmModel,
+                       kernel_function::KernelIface *kernel, algorithmFPType *svmBuffer,
                        algorithmFPType *rProb, services::Error &error)
 {
     algorithmFPType one = 1.0;
@@ -249,20 +264,40 @@ get2ClassProbabilities(size_t nFeatures, size_t startRow, size_t nRows, size_t n
     services::SharedPtr<classifier::prediction::Result> yRes(new classifier::prediction::Result());
     if (!xTable || !yTable || !yRes) { error.setId(services::ErrorMemoryAllocationFailed); return; }
     yRes->set(classifier::prediction::prediction, yTable);
-    for (size_t i = 1; i < nClasses; i++)
+
+    algorithmFPType *decisions = NULL;
+    if (svmModel)
     {
-        for (size_t j = 0; j < i; j++)
+        computeSVMDecisionFunctions(xTable, nRows, svmModel, kernel, svmBuffer, error);
+        if(error.id() != services::NoErrorMessageFound) { return; }
+        decisions = svmBuffer;
+    }
+
+    for (size_t i = 1, iPair = 0; i < nClasses; i++)
+    {
+        for (size_t j = 0; j < i; j++, iPair++)
         {
-            /* Compute prediction of the "simple" classifier for pair of labels (i, j) */
+            if (svmModel)
+            {
+                /* Take the decision function of the two-class SVM model for pair of labels (i, j) */
+                for (size_t k = 0; k < nRows; k++)
+                {
+                    y[k] = decisions[k * svmModel->nModels + iPair];
+                }
+            }
+            else
+            {
+                /* Compute prediction of the "simple" classifier for pair of labels (i, j) */
 
-            size_t imodel = ((nonEmptyClassMap[i] - 1) * nonEmptyClassMap[i]) / 2 + nonEmptyClassMap[j];
-            simplePrediction->inputBase->set(classifier::prediction::data, xTable);
-            simplePrediction->inputBase->set(classifier::prediction::model, model->getTwoClassClassifierModel(imodel));
+                size_t imodel = ((nonEmptyClassMap[i] - 1) * nonEmptyClassMap[i]) / 2 + nonEmptyClassMap[j];
+                simplePrediction->inputBase->set(classifier::prediction::data, xTable);
+                simplePrediction->inputBase->set(classifier::prediction::model, model->getTwoClassClassifierModel(imodel));
 
-            simplePrediction->setResult(yRes);
-            simplePrediction->computeNoThrow();
-            if(simplePrediction->getErrors()->size() != 0)
-            { error.setId(services::ErrorMultiClassFailedToComputeTwoClassPrediction); return; }
+                simplePrediction->setResult(yRes);
+                simplePrediction->computeNoThrow();
+                if(simplePrediction->getErrors()->size() != 0)
+                { error.setId(services::ErrorMultiClassFailedToComputeTwoClassPrediction); return; }
+            }
 
             /* Use sigmoid to calculate probabilities */
             daal::internal::Math<algorithmFPType, cpu>::vExp(nRows, y, y);
@@ -285,6 +320,276 @@ get2ClassProbabilities(size_t nFeatures, size_t startRow, size_t nRows, size_t n
     }
 }
 
+template<typename algorithmFPType, CpuType cpu>
+inline void MultiClassClassifierPredictKernel<multiClassClassifierWu, training::oneAgainstOne, algorithmFPType, cpu>::
+computeSVMDecisionFunctions(const NumericTablePtr &xTable, size_t nRows,
+                            const MultiClassSVMModel<algorithmFPType, cpu> *svmModel,
+                            kernel_function::KernelIface *kernel, algorithmFPType *svmBuffer,
+                            services::Error &error)
+{
+    size_t nModels   = svmModel->nModels;
+    size_t nUniqueSV = svmModel->nUniqueSV;
+    algorithmFPType *decisions    = svmBuffer;
+    algorithmFPType *kernelValues = svmBuffer + nRows * nModels;
+
+    /* Compute kernel function values between the observations and the unique support vectors */
+    NumericTablePtr kernelValuesTable(new HomogenNumericTableCPU<algorithmFPType, cpu>(kernelValues, nUniqueSV, nRows));
+    services::SharedPtr<kernel_function::Result> kernelResult(new kernel_function::Result());
+    if (!kernelValuesTable || !kernelResult) { error.setId(services::ErrorMemoryAllocationFailed); return; }
+    kernelResult->set(kernel_function::values, kernelValuesTable);
+    kernel->setResult(kernelResult);
+    kernel->inputBase->set(kernel_function::X, xTable);
+    kernel->computeNoThrow();
+    if(kernel->getErrors()->size() != 0)
+    { error.setId(services::ErrorMultiClassFailedToComputeTwoClassPrediction); return; }
+
+    /* Accumulate the decision functions of all the two-class models */
+    const size_t *coeffOffsets = svmModel->coeffOffsets.get();
+    const size_t *coeffModels  = svmModel->coeffModels.get();
+    const algorithmFPType *coeffs = svmModel->coeffs.get();
+    const algorithmFPType *biases = svmModel->biases.get();
+    for (size_t k = 0; k < nRows; k++)
+    {
+        algorithmFPType *decision = decisions + k * nModels;
+        const algorithmFPType *kernelRow = kernelValues + k * nUniqueSV;
+        for (size_t m = 0; m < nModels; m++)
+        {
+            decision[m] = biases[m];
+        }
+        for (size_t sv = 0; sv < nUniqueSV; sv++)
+        {
+            algorithmFPType kernelValue = kernelRow[sv];
+            for (size_t c = coeffOffsets[sv]; c < coeffOffsets[sv + 1]; c++)
+            {
+                decision[coeffModels[c]] += kernelValue * coeffs[c];
+            }
+        }
+    }
+}
+
+template<typename algorithmFPType, CpuType cpu>
+bool MultiClassSVMModel<algorithmFPType, cpu>::init(Model *model, size_t nClasses, const size_t *nonEmptyClassMap,
+                                                    size_t nFeatures,
+                                                    const services::SharedPtr<classifier::prediction::Batch> &simplePrediction)
+{
+    /* Kernel function is taken from the parameters of the two-class SVM prediction algorithm */
+    svm::prediction::Batch<double> *doublePrediction = dynamic_cast<svm::prediction::Batch<double> *>(simplePrediction.get());
+    svm::prediction::Batch<float>  *floatPrediction  = dynamic_cast<svm::prediction::Batch<float>  *>(simplePrediction.get());
+    if      (doublePrediction) { kernel = doublePrediction->parameter.kernel; }
+    else if (floatPrediction)  { kernel = floatPrediction->parameter.kernel; }
+    if (!kernel) { return false; }
+
+    nModels = nClasses * (nClasses - 1) / 2;
+    TArray<svm::Model *, cpu> svmModelsArray(nModels);
+    svm::Model **svmModels = svmModelsArray.get();
+    if (!svmModels) { return false; }
+
+    size_t nSV = 0, nValues = 0;
+    for (size_t i = 1, iPair = 0; i < nClasses; i++)
+    {
+        for (size_t j = 0; j < i; j++, iPair++)
+        {
+            size_t imodel = ((nonEmptyClassMap[i] - 1) * nonEmptyClassMap[i]) / 2 + nonEmptyClassMap[j];
+            svmModels[iPair] = dynamic_cast<svm::Model *>(model->getTwoClassClassifierModel(imodel).get());
+            if (!svmModels[iPair]) { return false; }
+
+            NumericTablePtr modelSVTable = svmModels[iPair]->getSupportVectors();
+            bool isModelCSR = (modelSVTable->getDataLayout() == NumericTableIface::csrArray);
+            if (iPair == 0) { isCSR = isModelCSR; }
+            if (isModelCSR != isCSR) { return false; }
+
+            size_t nModelSV = modelSVTable->getNumberOfRows();
+            nSV += nModelSV;
+            nValues += (isCSR ? dynamic_cast<CSRNumericTableIface *>(modelSVTable.get())->getDataSize() : nModelSV * nFeatures);
+        }
+    }
+    if (nSV == 0) { return false; }
+
+    size_t hashSize = 1;
+    while (hashSize < 2 * nSV) { hashSize *= 2; }
+
+    _svData.reset(nValues);
+    if (isCSR)
+    {
+        _svColIndices.reset(nValues);
+        _svRowOffsets.reset(nSV + 1);
+    }
+    coeffOffsets.reset(nSV + 1);
+    coeffModels.reset(nSV);
+    coeffs.reset(nSV);
+    biases.reset(nModels);
+    TArray<size_t, cpu> uniqueIndicesArray(nSV);
+    TArray<size_t, cpu> modelIndicesArray(nSV);
+    TArray<algorithmFPType, cpu> modelCoeffsArray(nSV);
+    TArray<size_t, cpu> hashTableArray(hashSize);
+    size_t *uniqueIndices = uniqueIndicesArray.get();
+    size_t *modelIndices = modelIndicesArray.get();
+    algorithmFPType *modelCoeffs = modelCoeffsArray.get();
+    size_t *hashTable = hashTableArray.get();
+    if ((nValues && !_svData.get()) || (isCSR && (!_svRowOffsets.get() || (nValues && !_svColIndices.get()))) ||
+        !coeffOffsets.get() || !coeffModels.get() || !coeffs.get() || !biases.get() ||
+        !uniqueIndices || !modelIndices || !modelCoeffs || !hashTable)
+    { return false; }
+
+    /* Value nSV marks the empty slot of the hash table */
+    for (size_t h = 0; h < hashSize; h++)
+    {
+        hashTable[h] = nSV;
+    }
+    if (isCSR) { _svRowOffsets[0] = 1; }
+
+    nUniqueSV = 0;
+    for (size_t m = 0, iSV = 0; m < nModels; m++)
+    {
+        NumericTablePtr modelSVTable = svmModels[m]->getSupportVectors();
+        NumericTablePtr modelCoeffTable = svmModels[m]->getClassificationCoefficients();
+        size_t nModelSV = modelSVTable->getNumberOfRows();
+        biases[m] = (algorithmFPType)svmModels[m]->getBias();
+        if (nModelSV == 0) { continue; }
+
+        ReadRows<algorithmFPType, cpu> modelCoeffRows(modelCoeffTable.get(), 0, nModelSV);
+        const algorithmFPType *modelCoeff = modelCoeffRows.get();
+        if (!modelCoeff) { return false; }
+        if (isCSR)
+        {
+            ReadRowsCSR<algorithmFPType, cpu> svRows(dynamic_cast<CSRNumericTableIface *>(modelSVTable.get()), 0, nModelSV);
+            const algorithmFPType *values = svRows.values();
+            const size_t *cols = svRows.cols();
+            const size_t *rows = svRows.rows();
+            if (!values || !cols || !rows) { return false; }
+            for (size_t k = 0; k < nModelSV; k++, iSV++)
+            {
+                uniqueIndices[iSV] = findOrInsert(values + rows[k] - 1, cols + rows[k] - 1, rows[k + 1] - rows[k], nFeatures,
+                                                  hashTable, hashSize - 1);
+                modelIndices[iSV] = m;
+                modelCoeffs[iSV]  = modelCoeff[k];
+            }
+        }
+        else
+        {
+            ReadRows<algorithmFPType, cpu> svRows(modelSVTable.get(), 0, nModelSV);
+            const algorithmFPType *values = svRows.get();
+            if (!values) { return false; }
+            for (size_t k = 0; k < nModelSV; k++, iSV++)
+            {
+                uniqueIndices[iSV] = findOrInsert(values + k * nFeatures, NULL, nFeatures, nFeatures, hashTable, hashSize - 1);
+                modelIndices[iSV] = m;
+                modelCoeffs[iSV]  = modelCoeff[k];
+            }
+        }
+    }
+
+    /* Group the coefficients by the unique support vectors */
+    for (size_t sv = 0; sv <= nUniqueSV; sv++)
+    {
+        coeffOffsets[sv] = 0;
+    }
+    for (size_t iSV = 0; iSV < nSV; iSV++)
+    {
+        coeffOffsets[uniqueIndices[iSV] + 1]++;
+    }
+    for (size_t sv = 0; sv < nUniqueSV; sv++)
+    {
+        coeffOffsets[sv + 1] += coeffOffsets[sv];
+    }
+    for (size_t iSV = 0; iSV < nSV; iSV++)
+    {
+        size_t c = coeffOffsets[uniqueIndices[iSV]]++;
+        coeffModels[c] = modelIndices[iSV];
+        coeffs[c]      = modelCoeffs[iSV];
+    }
+    for (size_t sv = nUniqueSV; sv > 0; sv--)
+    {
+        coeffOffsets[sv] = coeffOffsets[sv - 1];
+    }
+    coeffOffsets[0] = 0;
+
+    if (isCSR)
+    {
+        svTable = NumericTablePtr(new CSRNumericTable(_svData.get(), _svColIndices.get(), _svRowOffsets.get(),
+                                                      nFeatures, nUniqueSV));
+    }
+    else
+    {
+        svTable = NumericTablePtr(new HomogenNumericTableCPU<algorithmFPType, cpu>(_svData.get(), nFeatures, nUniqueSV));
+    }
+    return (bool)svTable;
+}
+
+/**
+ * Returns the index of the unique support vector equal to the given one,
+ * appends the given support vector to the unique ones if there is no such vector
+ */
+template<typename algorithmFPType, CpuType cpu>
+size_t MultiClassSVMModel<algorithmFPType, cpu>::findOrInsert(const algorithmFPType *values, const size_t *colIndices,
+                                                              size_t nValues, size_t nFeatures, size_t *hashTable, size_t hashMask)
+{
+    /* FNV-1a hash of the binary representation of the support vector */
+    size_t hash = (size_t)14695981039346656037ULL;
+    const unsigned char *bytes = (const unsigned char *)values;
+    for (size_t b = 0; b < nValues * sizeof(algorithmFPType); b++)
+    {
+        hash = (hash ^ bytes[b]) * (size_t)1099511628211ULL;
+    }
+    if (colIndices)
+    {
+        bytes = (const unsigned char *)colIndices;
+        for (size_t b = 0; b < nValues * sizeof(size_t); b++)
+        {
+            hash = (hash ^ bytes[b]) * (size_t)1099511628211ULL;
+        }
+    }
+
+    size_t emptySlot = coeffModels.size();
+    for (size_t h = hash & hashMask; ; h = (h + 1) & hashMask)
+    {
+        size_t sv = hashTable[h];
+        if (sv == emptySlot) { hashTable[h] = nUniqueSV; break; }
+
+        /* Compare with the unique support vector stored in the slot */
+        const algorithmFPType *svValues;
+        const size_t *svColIndices = NULL;
+        size_t svNValues = nFeatures;
+        if (isCSR)
+        {
+            svValues     = _svData.get() + _svRowOffsets[sv] - 1;
+            svColIndices = _svColIndices.get() + _svRowOffsets[sv] - 1;
+            svNValues    = _svRowOffsets[sv + 1] - _svRowOffsets[sv];
+        }
+        else
+        {
+            svValues = _svData.get() + sv * nFeatures;
+        }
+        if (svNValues != nValues) { continue; }
+        bool isEqual = true;
+        for (size_t v = 0; v < nValues && isEqual; v++)
+        {
+            isEqual = (svValues[v] == values[v]) && (!colIndices || svColIndices[v] == colIndices[v]);
+        }
+        if (isEqual) { return sv; }
+    }
+
+    /* Append the new unique support vector */
+    if (isCSR)
+    {
+        size_t offset = _svRowOffsets[nUniqueSV] - 1;
+        for (size_t v = 0; v < nValues; v++)
+        {
+            _svData[offset + v]       = values[v];
+            _svColIndices[offset + v] = colIndices[v];
+        }
+        _svRowOffsets[nUniqueSV + 1] = _svRowOffsets[nUniqueSV] + nValues;
+    }
+    else
+    {
+        for (size_t v = 0; v < nValues; v++)
+        {
+            _svData[nUniqueSV * nFeatures + v] = values[v];
+        }
+    }
+    return nUniqueSV++;
+}
+
 template<typename algorithmFPType, CpuType cpu>
 inline void MultiClassClassifierPredictKernel<multiClassClassifierWu, training::oneAgainstOne, algorithmFPType, cpu>::
     computeQ(size_t nClasses, const algorithmFPType *rProb, algorithmFPType *Q)
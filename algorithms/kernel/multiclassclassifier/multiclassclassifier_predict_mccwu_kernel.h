@@ -33,6 +33,8 @@
 #define __MULTICLASSCLASSIFIER_PREDICT_MCCWU_KERNEL_H__
 
 #include "multi_class_classifier_model.h"
+#include "svm_model.h"
+#include "svm_predict.h"
 
 #include "threading.h"
 #include "service_math.h"
@@ -61,13 +63,58 @@ size_t getMultiClassClassifierPredictBlockSize()
     return 128;
 }
 
+/* Maximal number of the kernel function values computed for a block of observations */
+template<typename algorithmFPType, CpuType cpu>
+size_t getMultiClassSVMKernelBlockSize()
+{
+    return (size_t)1 << 18;
+}
+
+/**
+ * Two-class SVM models of the multi-class classifier with the shared support vectors.
+ * Duplicates of the support vectors are removed, and for every unique support vector
+ * the classification coefficients of all the two-class models that contain it are stored,
+ * so the kernel function values between an observation and the support vectors are computed
+ * once for all the two-class models
+ */
+template<typename algorithmFPType, CpuType cpu>
+struct MultiClassSVMModel
+{
+    MultiClassSVMModel() : nModels(0), nUniqueSV(0), isCSR(false) {}
+
+    /**
+     * Merges the support vectors of the two-class SVM models
+     * \return false if the two-class models or the two-class prediction algorithm are not SVM ones
+     */
+    bool init(Model *model, size_t nClasses, const size_t *nonEmptyClassMap, size_t nFeatures,
+              const services::SharedPtr<classifier::prediction::Batch> &simplePrediction);
+
+    services::SharedPtr<kernel_function::KernelIface> kernel;   /*!< Kernel function of the two-class SVM models */
+    NumericTablePtr svTable;                /*!< Unique support vectors */
+    size_t nModels;                         /*!< Number of the two-class models */
+    size_t nUniqueSV;                       /*!< Number of the unique support vectors */
+    TArray<size_t, cpu> coeffOffsets;       /*!< Offsets of the coefficients of every unique support vector */
+    TArray<size_t, cpu> coeffModels;        /*!< Indices of the two-class models the coefficients belong to */
+    TArray<algorithmFPType, cpu> coeffs;    /*!< Classification coefficients */
+    TArray<algorithmFPType, cpu> biases;    /*!< Biases of the two-class models */
+
+protected:
+    size_t findOrInsert(const algorithmFPType *values, const size_t *colIndices, size_t nValues, size_t nFeatures,
+                        size_t *hashTable, size_t hashMask);
+
+    bool isCSR;
+    TArray<algorithmFPType, cpu> _svData;
+    TArray<size_t, cpu> _svColIndices;
+    TArray<size_t, cpu> _svRowOffsets;
+};
+
 template<typename algorithmFPType, CpuType cpu>
 struct MultiClassClassifierTls
 {
     MultiClassClassifierTls(size_t nClasses, size_t nRowsInBlock, const NumericTable *xTable, NumericTable *rTable,
-                            services::SharedPtr<classifier::prediction::Batch> simplePrediction) :
-        mtR(rTable),
-        simplePrediction(simplePrediction->clone())
+                            services::SharedPtr<classifier::prediction::Batch> simplePrediction,
+                            const MultiClassSVMModel<algorithmFPType, cpu> *svmModel) :
+        mtX(NULL), mtR(rTable), simplePrediction(simplePrediction->clone()), buffer(NULL), svmBuffer(NULL)
     {
         size_t bufferSize = nRowsInBlock * nClasses * nClasses + nClasses * nClasses + 2 * nClasses + nRowsInBlock;
         buffer = (algorithmFPType *)daal::services::daal_malloc(bufferSize * sizeof(algorithmFPType));
@@ -81,18 +128,34 @@ struct MultiClassClassifierTls
             mtX = new BlockMicroTable<algorithmFPType, readOnly, cpu>(xTable);
         }
         if (!mtX) { error.setId(services::ErrorMemoryAllocationFailed); return; }
+
+        if (svmModel)
+        {
+            /* Buffer for the kernel function values and the decision functions of the block of observations */
+            size_t svmBufferSize = nRowsInBlock * (svmModel->nUniqueSV + svmModel->nModels);
+            svmBuffer = (algorithmFPType *)daal::services::daal_malloc(svmBufferSize * sizeof(algorithmFPType));
+            if (!svmBuffer) { error.setId(services::ErrorMemoryAllocationFailed); return; }
+
+            kernel = svmModel->kernel->clone();
+            kernel->getErrors()->setCanThrow(false);
+            kernel->inputBase->set(kernel_function::Y, svmModel->svTable);
+            kernel->parameterBase->computationMode = kernel_function::matrixMatrix;
+        }
     }
 
     virtual ~MultiClassClassifierTls()
     {
         daal::services::daal_free(buffer);
+        daal::services::daal_free(svmBuffer);
         delete mtX;
     }
 
     MicroTable *mtX;
     FeatureMicroTable <int, writeOnly, cpu> mtR;
     services::SharedPtr<classifier::prediction::Batch> simplePrediction;
+    services::SharedPtr<kernel_function::KernelIface> kernel;
     algorithmFPType *buffer;
+    algorithmFPType *svmBuffer;
     services::Error error;
 };
 
@@ -113,6 +176,8 @@ protected:
                                         services::SharedPtr<classifier::prediction::Batch> simplePrediction,
                                         Model *model,
                                         size_t nIter, double eps, algorithmFPType *buffer,
+                                        const MultiClassSVMModel<algorithmFPType, cpu> *svmModel,
+                                        kernel_function::KernelIface *kernel, algorithmFPType *svmBuffer,
                                         services::Error &error);
 
     /** Get 2-class classification probabilities for a block of observations */
@@ -120,8 +185,16 @@ protected:
                                        const size_t *nonEmptyClassMap, MicroTable *mtX, algorithmFPType *y,
                                        services::SharedPtr<classifier::prediction::Batch> simplePrediction,
                                        Model *model,
+                                       const MultiClassSVMModel<algorithmFPType, cpu> *svmModel,
+                                       kernel_function::KernelIface *kernel, algorithmFPType *svmBuffer,
                                        algorithmFPType *rProb, services::Error &error);
 
+    /** Compute decision functions of all the two-class SVM models for a block of observations */
+    inline void computeSVMDecisionFunctions(const NumericTablePtr &xTable, size_t nRows,
+                                            const MultiClassSVMModel<algorithmFPType, cpu> *svmModel,
+                                            kernel_function::KernelIface *kernel, algorithmFPType *svmBuffer,
+                                            services::Error &error);
+
     /** Compute matrix Q from the 2-class parobabilities */
     inline void computeQ(size_t nClasses, const algorithmFPType *rProb, algorithmFPType *Q);
 
@@ -70,20 +70,51 @@ void MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, cpu>::
     int *y;
     mtY.getBlockOfColumnValues(0, 0, nVectors, &y);
 
-    /* Compute data size needed to store the largest subset of input tables */
-    size_t nSubsetVectors, dataSize;
-    computeDataSize(nVectors, nFeatures, nClasses, xTable, y, &nSubsetVectors, &dataSize);
+    /* Group the indices of the observations by the classes */
+    TArray<size_t, cpu> classOffsetsArray(nClasses + 1);
+    TArray<size_t, cpu> classRowsArray(nVectors);
+    size_t *classOffsets = classOffsetsArray.get();
+    size_t *classRows = classRowsArray.get();
+    if (!classOffsets || !classRows) { mtY.release(); this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+    groupRowsByClasses(nVectors, nClasses, y, classOffsets, classRows);
+    mtY.release();
 
-    /* Allocate memory for storing subsets of input data */
+    /* Models are trained in the descending order of the sizes of their training subsets */
+    size_t nModels = (nClasses * (nClasses - 1)) >> 1;
+    TArray<size_t, cpu> subsetSizesArray(nModels);
+    TArray<size_t, cpu> modelOrderArray(nModels);
+    size_t *subsetSizes = subsetSizesArray.get();
+    size_t *modelOrder = modelOrderArray.get();
+    if (!subsetSizes || !modelOrder) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+    size_t nSubsetVectors = 0;
+    for (size_t i = 1, imodel = 0; i < nClasses; i++)
+    {
+        for (size_t j = 0; j < i; j++, imodel++)
+        {
+            subsetSizes[imodel] = (classOffsets[i + 1] - classOffsets[i]) + (classOffsets[j + 1] - classOffsets[j]);
+            modelOrder[imodel] = imodel;
+            if (subsetSizes[imodel] > nSubsetVectors) { nSubsetVectors = subsetSizes[imodel]; }
+        }
+    }
+    daal::algorithms::internal::qSort<size_t, size_t, cpu>(nModels, subsetSizes, modelOrder);
+
+    /* Two-class classifiers may read the whole training subset for every observation, so the dense subsets
+       are copied into contiguous per-thread buffers while these buffers fit into the size of the input data set.
+       Otherwise the two-class classifiers read the subsets through the views of the input data set. */
+    size_t nThreads = daal::threader_get_max_threads_number();
+    bool copySubsets = (xTable->getDataLayout() != NumericTableIface::csrArray) &&
+                       (nThreads * nSubsetVectors <= nVectors);
+
+    /* Allocate memory for storing indices and labels of the subsets of input data */
     daal::tls<MultiClassClassifierTls<algorithmFPType, cpu> *> subset([=]()
     {
-        return new MultiClassClassifierTls<algorithmFPType, cpu>(
-                nFeatures, nSubsetVectors, dataSize, xTable, simpleTrainingInit);
+        return new MultiClassClassifierTls<algorithmFPType, cpu>(nSubsetVectors, xTable, copySubsets, simpleTrainingInit);
     } );
 
-    size_t nModels = (nClasses * (nClasses - 1)) >> 1;
-    daal::threader_for(nModels, nModels, [&](size_t imodel)
+    daal::threader_for(nModels, nModels, [&](size_t iorder)
     {
+        size_t imodel = modelOrder[nModels - 1 - iorder];
+
         /* Find indices of positive and negative classes for current model */
         size_t i = 1;       /* index of the positive class */
         size_t j = 0;       /* index of the negative class */
@@ -97,53 +128,41 @@ void MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, cpu>::
 
         MultiClassClassifierTls<algorithmFPType, cpu> *subsetLocal = subset.local();
         if (subsetLocal->error.id() != services::NoErrorMessageFound) { return; }
-        algorithmFPType *subsetX = subsetLocal->subsetX;
-        size_t *colIndicesX = subsetLocal->colIndicesX;
-        size_t *rowOffsetsX = subsetLocal->rowOffsetsX;
+        size_t *subsetIndices = subsetLocal->subsetIndices;
         algorithmFPType *subsetY = subsetLocal->subsetY;
-        NumericTablePtr subsetXTable = subsetLocal->subsetXTable;
-        NumericTablePtr subsetYTable = subsetLocal->subsetYTable;
 
-        size_t nTotal, nPositive, nNegative;
-        if (xTable->getDataLayout() == NumericTableIface::csrArray)
+        /* Prepare "positive" and "negative" observations of the training subset */
+        size_t nPositive = classOffsets[i + 1] - classOffsets[i];
+        size_t nNegative = classOffsets[j + 1] - classOffsets[j];
+        for (size_t k = 0; k < nPositive; k++)
         {
-            CSRBlockMicroTable<algorithmFPType, readOnly, cpu> *mtX =
-                static_cast<CSRBlockMicroTable<algorithmFPType, readOnly, cpu> *>(subsetLocal->mtX);
-            /* Prepare "positive" observations of the training subset */
-            size_t positiveDataSize;
-            rowOffsetsX[0] = 1;
-            copyDataIntoSubtable(nFeatures, nVectors, i, 1, *mtX, y, subsetX, colIndicesX, rowOffsetsX,
-                                 subsetY, &nPositive, &positiveDataSize);
-
-            /* Prepare "negative" observations of the training subset */
-            size_t negativeDataSize;
-            copyDataIntoSubtable(nFeatures, nVectors, j, -1, *mtX, y,
-                                 subsetX + positiveDataSize, colIndicesX + positiveDataSize, rowOffsetsX + nPositive,
-                                 subsetY + nPositive, &nNegative, &negativeDataSize);
+            subsetIndices[k] = classRows[classOffsets[i] + k];
+            subsetY[k] = 1;
         }
-        else
+        for (size_t k = 0; k < nNegative; k++)
         {
-            BlockMicroTable<algorithmFPType, readOnly, cpu> *mtX =
-                static_cast<BlockMicroTable<algorithmFPType, readOnly, cpu> *>(subsetLocal->mtX);
-            /* Prepare "positive" observations of the training subset */
-            size_t positiveDataSize;
-            copyDataIntoSubtable(nFeatures, nVectors, i, 1, *mtX, y, subsetX, subsetY, &nPositive, &positiveDataSize);
-
-            /* Prepare "negative" observations of the training subset */
-            size_t negativeDataSize;
-            copyDataIntoSubtable(nFeatures, nVectors, j, -1, *mtX, y,
-                                 subsetX + positiveDataSize, subsetY + nPositive, &nNegative, &negativeDataSize);
+            subsetIndices[nPositive + k] = classRows[classOffsets[j] + k];
+            subsetY[nPositive + k] = -1;
         }
+
         if (nPositive && nNegative)
         {
-            nTotal = nPositive + nNegative;
-            subsetXTable->setNumberOfRows(nTotal);
-            subsetYTable->setNumberOfRows(nTotal);
+            size_t nTotal = nPositive + nNegative;
+            subsetLocal->subsetXTable->setRowIndices(subsetIndices, nTotal);
+            subsetLocal->subsetYTable->setNumberOfRows(nTotal);
+
+            NumericTablePtr subsetXTable = subsetLocal->subsetXTable;
+            if (subsetLocal->subsetX)
+            {
+                copySubset(subsetLocal->subsetXTable.get(), nTotal, nFeatures, subsetLocal->subsetX);
+                subsetLocal->subsetXCopyTable->setNumberOfRows(nTotal);
+                subsetXTable = subsetLocal->subsetXCopyTable;
+            }
 
             /* Train "simple" classifier for pair of labels (i, j) */
             services::SharedPtr<classifier::training::Batch> simpleTraining = subsetLocal->simpleTraining;
             simpleTraining->input.set(classifier::training::data, subsetXTable);
-            simpleTraining->input.set(classifier::training::labels, subsetYTable);
+            simpleTraining->input.set(classifier::training::labels, subsetLocal->subsetYTable);
             simpleTraining->resetResult();
 
             simpleTraining->computeNoThrow();
@@ -169,120 +188,59 @@ void MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, cpu>::
         }
         delete subsetLocal;
     } );
-
-    mtY.release();
 }
 
+/**
+ * Sorts the indices of the observations by the classes with the counting sort,
+ * the observations of every class keep their order in the input data set
+ */
 template<typename algorithmFPType, CpuType cpu>
 void MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, cpu>::
-    computeDataSize(size_t nVectors, size_t nFeatures, size_t nClasses,
-                    const NumericTable *xTable, int *y, size_t *nSubsetVectorsPtr, size_t *dataSizePtr)
+    groupRowsByClasses(size_t nVectors, size_t nClasses, const int *y, size_t *classOffsets, size_t *classRows)
 {
-    size_t *buffer = service_calloc<size_t, cpu>(4 * nClasses * sizeof(size_t));
-    if (!buffer) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
-    size_t *classLabelsCount        = buffer;
-    size_t *classNonZeroValuesCount = buffer + nClasses;
-    size_t *classDataSize           = buffer + 2 * nClasses;
-    size_t *classIndex              = buffer + 3 * nClasses;
+    for (size_t i = 0; i <= nClasses; i++)
+    {
+        classOffsets[i] = 0;
+    }
     for (size_t i = 0; i < nVectors; i++)
     {
-        classLabelsCount[y[i]]++;
+        classOffsets[y[i] + 1]++;
     }
-    if (xTable->getDataLayout() == NumericTableIface::csrArray)
+    for (size_t i = 0; i < nClasses; i++)
     {
-        CSRBlockMicroTable<algorithmFPType, readOnly, cpu> mtX(xTable);
-        algorithmFPType *data;
-        size_t *colIndices, *rowOffsets;
-        mtX.getSparseBlock(0, nVectors, &data, &colIndices, &rowOffsets);
-
-        /* Compute data size needed to store the largest subset of input tables */
-        for (size_t i = 0; i < nVectors; i++)
-        {
-            classNonZeroValuesCount[y[i]] += (rowOffsets[i + 1] - rowOffsets[i]);
-        }
-        mtX.release();
-
-        for (size_t i = 0; i < nClasses; i++)
-        {
-            classDataSize[i] = classLabelsCount[i] + classNonZeroValuesCount[i];
-            classIndex[i] = i;
-        }
-
-        daal::algorithms::internal::qSort<size_t, size_t, cpu>(nClasses, classDataSize, classIndex);
-        *nSubsetVectorsPtr = classLabelsCount       [classIndex[nClasses - 1]] + classLabelsCount       [classIndex[nClasses - 2]];
-        *dataSizePtr       = classNonZeroValuesCount[classIndex[nClasses - 1]] + classNonZeroValuesCount[classIndex[nClasses - 2]];
+        classOffsets[i + 1] += classOffsets[i];
     }
-    else
+    for (size_t i = 0; i < nVectors; i++)
     {
-        daal::algorithms::internal::qSort<size_t, cpu>(nClasses, classLabelsCount);
-        size_t nSubsetVectors = classLabelsCount[nClasses - 1] + classLabelsCount[nClasses - 2];
-        *nSubsetVectorsPtr = nSubsetVectors;
-        *dataSizePtr = nFeatures * nSubsetVectors;
+        classRows[classOffsets[y[i]]++] = i;
     }
-    daal::services::daal_free(buffer);
-}
-
-template<typename algorithmFPType, CpuType cpu>
-void MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, cpu>::
-    copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-                         BlockMicroTable  <algorithmFPType, readOnly, cpu> &mtX,
-                         const int *y, algorithmFPType *subsetX, algorithmFPType *subsetY,
-                         size_t *nRowsPtr, size_t *dataSize)
-{
-    size_t nRows = 0;
-    algorithmFPType *xRow;
-    for (size_t ix = 0; ix < nVectors; ix++)
+    for (size_t i = nClasses; i > 0; i--)
     {
-        if (y[ix] == classIdx)
-        {
-            mtX.getBlockOfRows(ix, 1, &xRow);
-          PRAGMA_IVDEP
-          PRAGMA_VECTOR_ALWAYS
-            for (size_t jx = 0; jx < nFeatures; jx++)
-            {
-                subsetX[nRows * nFeatures + jx] = xRow[jx];
-            }
-            subsetY[nRows] = label;
-            mtX.release();
-            nRows++;
-        }
+        classOffsets[i] = classOffsets[i - 1];
     }
-    *nRowsPtr = nRows;
-    *dataSize = nRows * nFeatures;
+    classOffsets[0] = 0;
 }
 
+/**
+ * Copies the observations of the training subset into contiguous memory,
+ * the observations are read from the view of the input data set by blocks of rows
+ */
 template<typename algorithmFPType, CpuType cpu>
 void MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, cpu>::
-    copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-                         CSRBlockMicroTable<algorithmFPType, readOnly, cpu> &mtX,
-                         const int *y, algorithmFPType *subsetX, size_t *colIndicesX, size_t *rowOffsetsX,
-                         algorithmFPType *subsetY, size_t *nRowsPtr, size_t *dataSize)
+    copySubset(NumericTable *subsetXTable, size_t nRows, size_t nFeatures, algorithmFPType *subsetX)
 {
-    size_t nRows = 0;
-    algorithmFPType *xRow;
-    size_t *colIndices, *rowOffsets;
-    size_t dataIndex = 0;
-    for (size_t ix = 0; ix < nVectors; ix++)
+    const size_t nRowsInBlock = 256;
+    BlockMicroTable<algorithmFPType, readOnly, cpu> mtX(subsetXTable);
+    for (size_t startRow = 0; startRow < nRows; startRow += nRowsInBlock)
     {
-        if (y[ix] == classIdx)
-        {
-            mtX.getSparseBlock(ix, 1, &xRow, &colIndices, &rowOffsets);
-            size_t nNonZeroValuesInRow = rowOffsets[1] - rowOffsets[0];
-          PRAGMA_IVDEP
-          PRAGMA_VECTOR_ALWAYS
-            for (size_t jx = 0; jx < nNonZeroValuesInRow; jx++, dataIndex++)
-            {
-                subsetX[dataIndex] = xRow[jx];
-                colIndicesX[dataIndex] = colIndices[jx];
-            }
-            rowOffsetsX[nRows + 1] = rowOffsetsX[nRows] + nNonZeroValuesInRow;
-            subsetY[nRows] = label;
-            mtX.release();
-            nRows++;
-        }
+        size_t nRowsToCopy = (startRow + nRowsInBlock < nRows ? nRowsInBlock : nRows - startRow);
+        algorithmFPType *x;
+        mtX.getBlockOfRows(startRow, nRowsToCopy, &x);
+        size_t nElements = nRowsToCopy * nFeatures;
+        daal::services::daal_memcpy_s(subsetX + startRow * nFeatures, nElements * sizeof(algorithmFPType),
+                                      x, nElements * sizeof(algorithmFPType));
+        mtX.release();
     }
-    *nRowsPtr = nRows;
-    *dataSize = rowOffsetsX[nRows] - rowOffsetsX[0];
 }
 
 } // namespace internal
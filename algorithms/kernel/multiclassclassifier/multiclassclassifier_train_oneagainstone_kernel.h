@@ -51,49 +51,55 @@ namespace internal
 template<typename algorithmFPType, CpuType cpu>
 struct MultiClassClassifierTls
 {
-    MultiClassClassifierTls(size_t nFeatures, size_t nSubsetVectors, size_t dataSize, const NumericTable *xTable,
-                            services::SharedPtr<classifier::training::Batch> simpleTraining)
+    MultiClassClassifierTls(size_t nSubsetVectors, const NumericTable *xTable, bool copySubsets,
+                            services::SharedPtr<classifier::training::Batch> simpleTraining) :
+        subsetY(NULL), subsetIndices(NULL), subsetX(NULL)
     {
-        subsetX = (algorithmFPType *)daal::services::daal_malloc((dataSize + nSubsetVectors) * sizeof(algorithmFPType));
-        if (!subsetX) { error.setId(services::ErrorMemoryAllocationFailed); return; }
-        subsetY = subsetX + dataSize;
+        subsetY = (algorithmFPType *)daal::services::daal_malloc(nSubsetVectors * sizeof(algorithmFPType));
+        subsetIndices = (size_t *)daal::services::daal_malloc(nSubsetVectors * sizeof(size_t));
+        if (!subsetY || !subsetIndices) { error.setId(services::ErrorMemoryAllocationFailed); return; }
         subsetYTable = NumericTablePtr(
                 new HomogenNumericTableCPU<algorithmFPType, cpu> (subsetY, 1, nSubsetVectors));
-        if (!subsetYTable) { error.setId(services::ErrorMemoryAllocationFailed); return; }
         this->simpleTraining = simpleTraining->clone();
+
+        /* Training subset refers to the rows of the input data set without copying them */
         if (xTable->getDataLayout() == NumericTableIface::csrArray)
         {
-            colIndicesX = (size_t *)daal::services::daal_malloc((dataSize + nSubsetVectors + 1) * sizeof(size_t));
-            if (!colIndicesX) { error.setId(services::ErrorMemoryAllocationFailed); return; }
-            rowOffsetsX = colIndicesX + dataSize;
-            subsetXTable = NumericTablePtr(
-                    new CSRNumericTable(subsetX, colIndicesX, rowOffsetsX, nFeatures));
-            mtX = new CSRBlockMicroTable<algorithmFPType, readOnly, cpu>(xTable);
+            subsetXTable = services::SharedPtr<SubsetNumericTableCPU<cpu> >(
+                    new CSRSubsetNumericTableCPU<cpu>(xTable, subsetIndices, nSubsetVectors));
         }
         else
         {
-            colIndicesX = NULL;
-            subsetXTable = NumericTablePtr(
-                new HomogenNumericTableCPU<algorithmFPType, cpu> (subsetX, nFeatures, nSubsetVectors));
-            mtX = new BlockMicroTable<algorithmFPType, readOnly, cpu>(xTable);
+            subsetXTable = services::SharedPtr<SubsetNumericTableCPU<cpu> >(
+                    new SubsetNumericTableCPU<cpu>(xTable, subsetIndices, nSubsetVectors));
+        }
+        if (!subsetXTable || !subsetYTable) { error.setId(services::ErrorMemoryAllocationFailed); return; }
+
+        /* Buffer for the contiguous copy of the dense training subset of the largest size */
+        if (copySubsets)
+        {
+            size_t nFeatures = xTable->getNumberOfColumns();
+            subsetX = (algorithmFPType *)daal::services::daal_malloc(nSubsetVectors * nFeatures * sizeof(algorithmFPType));
+            if (!subsetX) { error.setId(services::ErrorMemoryAllocationFailed); return; }
+            subsetXCopyTable = NumericTablePtr(
+                    new HomogenNumericTableCPU<algorithmFPType, cpu> (subsetX, nFeatures, nSubsetVectors));
+            if (!subsetXCopyTable) { error.setId(services::ErrorMemoryAllocationFailed); return; }
         }
-        if (!subsetXTable || !mtX) { error.setId(services::ErrorMemoryAllocationFailed); return; }
     }
 
     virtual ~MultiClassClassifierTls()
     {
+        daal::services::daal_free(subsetY);
+        daal::services::daal_free(subsetIndices);
         daal::services::daal_free(subsetX);
-        if (colIndicesX) daal::services::daal_free(colIndicesX);
-        delete mtX;
     }
 
-    algorithmFPType *subsetX;
     algorithmFPType *subsetY;
-    size_t *colIndicesX;
-    size_t *rowOffsetsX;
-    NumericTablePtr subsetXTable;
+    size_t *subsetIndices;
+    algorithmFPType *subsetX;
+    services::SharedPtr<SubsetNumericTableCPU<cpu> > subsetXTable;
+    NumericTablePtr subsetXCopyTable;
     NumericTablePtr subsetYTable;
-    MicroTable *mtX;
     services::SharedPtr<classifier::training::Batch> simpleTraining;
     services::Error error;
 };
@@ -105,18 +111,8 @@ struct MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, cpu> : pu
                  const daal::algorithms::Parameter *par);
 
 protected:
-    void computeDataSize(size_t nVectors, size_t nFeatures, size_t nClasses,
-                const NumericTable *xTable, int *y, size_t *nSubsetVectorsPtr, size_t *dataSizePtr);
-
-    void copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-                              BlockMicroTable  <algorithmFPType, readOnly, cpu> &mtX,
-                              const int *y, algorithmFPType *subsetX, algorithmFPType *subsetY,
-                              size_t *nRowsPtr, size_t *dataSize);
-
-    void copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-                              CSRBlockMicroTable<algorithmFPType, readOnly, cpu> &mtX,
-                              const int *y, algorithmFPType *subsetX, size_t *colIndicesX, size_t *rowOffsetsX,
-                              algorithmFPType *subsetY, size_t *nRowsPtr, size_t *dataSize);
+    void groupRowsByClasses(size_t nVectors, size_t nClasses, const int *y, size_t *classOffsets, size_t *classRows);
+    void copySubset(NumericTable *subsetXTable, size_t nRows, size_t nFeatures, algorithmFPType *subsetX);
 };
 
 } // namespace internal
@@ -38,9 +38,21 @@ namespace minmax
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_NORMALIZATION_MINMAX_RESULT_ID);
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_NORMALIZATION_MINMAX_PARTIAL_RESULT_ID);
 
 /** Default constructor */
-Input::Input() : daal::algorithms::Input(1) {}
+Input::Input() : InputIface(1) {}
+
+/**
+ * Returns the number of columns in the input data set
+ * \return Number of columns in the input data set
+ */
+size_t Input::getNumberOfColumns() const
+{
+    NumericTablePtr dataTable = get(data);
+    if (!checkNumericTable(dataTable.get(), this->_errors.get(), dataStr())) { return 0; }
+    return dataTable->getNumberOfColumns();
+}
 
 /**
  * Returns an input object for the min-max normalization algorithm
@@ -87,8 +99,177 @@ void Input::check(const daal::algorithms::Parameter *par, int method) const
     }
 }
 
+PartialResult::PartialResult() : daal::algorithms::PartialResult(3) {}
+
+/**
+ * Sets the partial results of the min-max normalization algorithm to the values of the empty data set
+ */
+void PartialResult::initialize()
+{
+    for (size_t i = (size_t)nObservations; i <= (size_t)partialMaximum; i++)
+    {
+        NumericTablePtr ntPtr = get((PartialResultId)i);
+        size_t nColumns = ntPtr->getNumberOfColumns();
+
+        BlockDescriptor<double> block;
+        ntPtr->getBlockOfRows(0, 1, writeOnly, block);
+        double *values = block.getBlockPtr();
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            values[j] = 0.0;
+        }
+        ntPtr->releaseBlockOfRows(block);
+    }
+}
+
+/**
+ * Returns the number of columns in the partial result of the min-max normalization algorithm
+ * \return Number of columns in the partial result
+ */
+size_t PartialResult::getNumberOfColumns() const
+{
+    NumericTablePtr ntPtr = get(partialMinimum);
+    if (!checkNumericTable(ntPtr.get(), this->_errors.get(), partialMinimumStr())) { return 0; }
+    return ntPtr->getNumberOfColumns();
+}
+
+/**
+ * Returns the partial result of the min-max normalization algorithm
+ * \param[in] id   Identifier of the partial result, daal::algorithms::normalization::minmax::PartialResultId
+ * \return         Partial result that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult::get(PartialResultId id) const
+{
+    return services::staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the partial result of the min-max normalization algorithm
+ * \param[in] id        Identifier of the partial result
+ * \param[in] value     Pointer to the partial result
+ */
+void PartialResult::set(PartialResultId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
 
-Result::Result() : daal::algorithms::Result(1) {}
+/**
+ * Checks the correctness of the partial result
+ * \param[in] in     Pointer to the input object
+ * \param[in] par    Pointer to the parameter object
+ * \param[in] method Algorithm computation method
+ */
+void PartialResult::check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const
+{
+    size_t nFeatures = static_cast<const InputIface *>(in)->getNumberOfColumns();
+    checkImpl(nFeatures);
+}
+
+/**
+ * Checks the correctness of the partial result
+ * \param[in] par    Pointer to the parameter object
+ * \param[in] method Algorithm computation method
+ */
+void PartialResult::check(const daal::algorithms::Parameter *par, int method) const
+{
+    size_t nFeatures = getNumberOfColumns();
+    if (this->_errors->size() != 0) { return; }
+    checkImpl(nFeatures);
+}
+
+void PartialResult::checkImpl(size_t nFeatures) const
+{
+    int unexpectedLayouts = (int)NumericTableIface::csrArray;
+    if (!checkNumericTable(get(nObservations).get(), this->_errors.get(), nObservationsStr(), unexpectedLayouts, 0, 1, 1)) { return; }
+
+    unexpectedLayouts = (int)packed_mask;
+    if (!checkNumericTable(get(partialMinimum).get(), this->_errors.get(), partialMinimumStr(), unexpectedLayouts, 0, nFeatures, 1)) { return; }
+    if (!checkNumericTable(get(partialMaximum).get(), this->_errors.get(), partialMaximumStr(), unexpectedLayouts, 0, nFeatures, 1)) { return; }
+}
+
+DistributedInput<step2Master>::DistributedInput() : InputIface(1)
+{
+    Argument::set(partialResults, DataCollectionPtr(new DataCollection()));
+}
+
+/**
+ * Returns the number of columns in the input data set
+ * \return Number of columns in the input data set
+ */
+size_t DistributedInput<step2Master>::getNumberOfColumns() const
+{
+    DataCollectionPtr collection = get(partialResults);
+    if (!collection) { this->_errors->add(ErrorNullInputDataCollection); return 0; }
+    if (collection->size() == 0) { this->_errors->add(ErrorIncorrectNumberOfInputNumericTables); return 0; }
+
+    PartialResultPtr partialResult = PartialResult::cast((*collection)[0]);
+    if (!partialResult) { this->_errors->add(ErrorIncorrectElementInPartialResultCollection); return 0; }
+
+    NumericTablePtr ntPtr = partialResult->get(partialMinimum);
+    if (!checkNumericTable(ntPtr.get(), this->_errors.get(), partialMinimumStr())) { return 0; }
+    return ntPtr->getNumberOfColumns();
+}
+
+/**
+ * Adds the partial result computed on a local node to the collection of input objects
+ * \param[in] id            Identifier of the input object
+ * \param[in] partialResult Partial result obtained in the first step of the distributed algorithm
+ */
+void DistributedInput<step2Master>::add(MasterInputId id, const PartialResultPtr &partialResult)
+{
+    DataCollectionPtr collection = get(id);
+    collection->push_back(services::staticPointerCast<SerializationIface, PartialResult>(partialResult));
+}
+
+/**
+ * Sets the input object of the min-max normalization algorithm on the master node
+ * \param[in] id  Identifier of the input object
+ * \param[in] ptr Pointer to the input object
+ */
+void DistributedInput<step2Master>::set(MasterInputId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Returns the collection of input objects
+ * \param[in] id   Identifier of the input object, \ref MasterInputId
+ * \return Collection of partial results
+ */
+DataCollectionPtr DistributedInput<step2Master>::get(MasterInputId id) const
+{
+    return services::staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Checks the input objects of the min-max normalization algorithm on the master node
+ * \param[in] par       Algorithm parameter
+ * \param[in] method    Algorithm computation method
+ */
+void DistributedInput<step2Master>::check(const daal::algorithms::Parameter *par, int method) const
+{
+    size_t nFeatures = getNumberOfColumns();
+    if (this->_errors->size() != 0) { return; }
+
+    DataCollectionPtr collection = get(partialResults);
+    for (size_t i = 0; i < collection->size(); i++)
+    {
+        PartialResultPtr partialResult = PartialResult::cast((*collection)[i]);
+        if (!partialResult) { this->_errors->add(ErrorIncorrectElementInPartialResultCollection); return; }
+
+        int unexpectedLayouts = (int)NumericTableIface::csrArray;
+        if (!checkNumericTable(partialResult->get(nObservations).get(), this->_errors.get(), nObservationsStr(),
+                               unexpectedLayouts, 0, 1, 1)) { return; }
+
+        unexpectedLayouts = (int)packed_mask;
+        if (!checkNumericTable(partialResult->get(partialMinimum).get(), this->_errors.get(), partialMinimumStr(),
+                               unexpectedLayouts, 0, nFeatures, 1)) { return; }
+        if (!checkNumericTable(partialResult->get(partialMaximum).get(), this->_errors.get(), partialMaximumStr(),
+                               unexpectedLayouts, 0, nFeatures, 1)) { return; }
+    }
+}
+
+Result::Result() : daal::algorithms::Result(3) {}
 
 /**
  * Returns the final result of the min-max normalization algorithm
@@ -131,6 +312,21 @@ void Result::check(const daal::algorithms::Input *in, const daal::algorithms::Pa
     }
 }
 
+/**
+ * Checks the minimums and maximums computed in the online or distributed processing mode
+ * \param[in] partialResult Pointer to the partial results
+ * \param[in] par           Pointer to the parameter object
+ * \param[in] method        Algorithm computation method
+ */
+void Result::check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *par, int method) const
+{
+    size_t nFeatures = static_cast<const PartialResult *>(partialResult)->getNumberOfColumns();
+
+    int unexpectedLayouts = data_management::packed_mask;
+    if (!data_management::checkNumericTable(get(minimum).get(), this->_errors.get(), minimumStr(), unexpectedLayouts, 0, nFeatures, 1)) { return; }
+    if (!data_management::checkNumericTable(get(maximum).get(), this->_errors.get(), maximumStr(), unexpectedLayouts, 0, nFeatures, 1)) { return; }
+}
+
 }// namespace interface1
 }// namespace minmax
 }// namespace normalization
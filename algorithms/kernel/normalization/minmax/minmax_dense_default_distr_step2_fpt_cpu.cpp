@@ -0,0 +1,44 @@
+/* file: minmax_dense_default_distr_step2_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Implementation of minmax calculation functions.
+//--
+
+
+#include "minmax_online_container.h"
+#include "minmax_kernel.h"
+#include "minmax_online_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace normalization
+{
+namespace minmax
+{
+
+namespace interface1
+{
+template class DistributedContainer<step2Master, DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+}
+
+}
+}
+}
+}
@@ -56,7 +56,44 @@ DAAL_EXPORT void Result::allocate(const daal::algorithms::Input *input, int meth
     set(normalizedData, normalizedDataTable);
 }
 
+/**
+ * Allocates memory to store the minimums and maximums computed by the min-max normalization algorithm
+ * in the online or distributed processing mode
+ * \param[in] partialResult Partial results of the min-max normalization algorithm
+ * \param[in] method        Computation method of the minmax normalization algorithm
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT void Result::allocate(const daal::algorithms::PartialResult *partialResult, int method)
+{
+    size_t nColumns = static_cast<const PartialResult *>(partialResult)->getNumberOfColumns();
+
+    set(minimum, data_management::NumericTablePtr(new data_management::HomogenNumericTable<algorithmFPType>(
+                                                   nColumns, 1, data_management::NumericTable::doAllocate)));
+    set(maximum, data_management::NumericTablePtr(new data_management::HomogenNumericTable<algorithmFPType>(
+                                                   nColumns, 1, data_management::NumericTable::doAllocate)));
+}
+
+/**
+ * Allocates memory to store partial results of the minmax normalization algorithm
+ * \param[in] input  %Input object for the minmax normalization algorithm
+ * \param[in] method Computation method of the minmax normalization algorithm
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT void PartialResult::allocate(const daal::algorithms::Input *input, int method)
+{
+    size_t nColumns = static_cast<const InputIface *>(input)->getNumberOfColumns();
+
+    set(nObservations, data_management::NumericTablePtr(new data_management::HomogenNumericTable<size_t>(
+                                                         1, 1, data_management::NumericTable::doAllocate)));
+    set(partialMinimum, data_management::NumericTablePtr(new data_management::HomogenNumericTable<algorithmFPType>(
+                                                          nColumns, 1, data_management::NumericTable::doAllocate)));
+    set(partialMaximum, data_management::NumericTablePtr(new data_management::HomogenNumericTable<algorithmFPType>(
+                                                          nColumns, 1, data_management::NumericTable::doAllocate)));
+}
+
 template DAAL_EXPORT void Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, int method);
+template DAAL_EXPORT void Result::allocate<DAAL_FPTYPE>(const daal::algorithms::PartialResult *partialResult, int method);
+template DAAL_EXPORT void PartialResult::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, int method);
 
 }// namespace interface1
 }// namespace minmax
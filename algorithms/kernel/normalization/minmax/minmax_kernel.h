@@ -60,6 +60,30 @@ protected:
     static const size_t BLOCK_SIZE_NORM = 256;
 };
 
+/**
+ *  \brief Kernel for the computation of the minimums and maximums
+ *  in the online and distributed processing modes
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class MinMaxOnlineKernel : public Kernel
+{
+public:
+    void compute(NumericTable *inputTable, NumericTable *nObservationsTable,
+                 NumericTable *minimums, NumericTable *maximums);
+
+    void merge(DataCollection *partialResults, NumericTable *nObservationsTable,
+               NumericTable *minimums, NumericTable *maximums);
+
+    void finalizeCompute(NumericTable *partialMinimums, NumericTable *partialMaximums,
+                         NumericTable *minimums, NumericTable *maximums);
+
+protected:
+    void mergeIntoPartialResult(size_t nRows, const algorithmFPType *minArray, const algorithmFPType *maxArray,
+                                NumericTable *nObservationsTable, NumericTable *minimums, NumericTable *maximums);
+
+    static const size_t BLOCK_SIZE_NORM = 256;
+};
+
 } // namespace daal::internal
 } // namespace minmax
 } // namespace normalization
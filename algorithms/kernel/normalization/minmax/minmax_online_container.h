@@ -0,0 +1,182 @@
+/* file: minmax_online_container.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of minmax calculation algorithm container
+//  in the online and distributed processing modes.
+//--
+*/
+
+#ifndef __MINMAX_ONLINE_CONTAINER_H__
+#define __MINMAX_ONLINE_CONTAINER_H__
+
+#include "normalization/minmax_online.h"
+#include "normalization/minmax_distributed.h"
+#include "minmax_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace normalization
+{
+namespace minmax
+{
+namespace interface1
+{
+template<typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::OnlineContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::MinMaxOnlineKernel, algorithmFPType, method);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::~OnlineContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void OnlineContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input *input = static_cast<Input *>(_in);
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+
+    NumericTablePtr dataTable = input->get(data);
+    NumericTablePtr nObservationsTable = partialResult->get(nObservations);
+    NumericTablePtr minimumsTable = partialResult->get(partialMinimum);
+    NumericTablePtr maximumsTable = partialResult->get(partialMaximum);
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::MinMaxOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+                       dataTable.get(), nObservationsTable.get(), minimumsTable.get(), maximumsTable.get());
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void OnlineContainer<algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    Result *result = static_cast<Result *>(_res);
+
+    NumericTablePtr partialMinimumsTable = partialResult->get(partialMinimum);
+    NumericTablePtr partialMaximumsTable = partialResult->get(partialMaximum);
+    NumericTablePtr minimumsTable = result->get(minimum);
+    NumericTablePtr maximumsTable = result->get(maximum);
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::MinMaxOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), finalizeCompute,
+                       partialMinimumsTable.get(), partialMaximumsTable.get(), minimumsTable.get(), maximumsTable.get());
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::MinMaxOnlineKernel, algorithmFPType, method);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step1Local, algorithmFPType, method, cpu>::compute()
+{
+    Input *input = static_cast<Input *>(_in);
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+
+    NumericTablePtr dataTable = input->get(data);
+    NumericTablePtr nObservationsTable = partialResult->get(nObservations);
+    NumericTablePtr minimumsTable = partialResult->get(partialMinimum);
+    NumericTablePtr maximumsTable = partialResult->get(partialMaximum);
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::MinMaxOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+                       dataTable.get(), nObservationsTable.get(), minimumsTable.get(), maximumsTable.get());
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step1Local, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    Result *result = static_cast<Result *>(_res);
+
+    NumericTablePtr partialMinimumsTable = partialResult->get(partialMinimum);
+    NumericTablePtr partialMaximumsTable = partialResult->get(partialMaximum);
+    NumericTablePtr minimumsTable = result->get(minimum);
+    NumericTablePtr maximumsTable = result->get(maximum);
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::MinMaxOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), finalizeCompute,
+                       partialMinimumsTable.get(), partialMaximumsTable.get(), minimumsTable.get(), maximumsTable.get());
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::MinMaxOnlineKernel, algorithmFPType, method);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step2Master, algorithmFPType, method, cpu>::compute()
+{
+    DistributedInput<step2Master> *input = static_cast<DistributedInput<step2Master> *>(_in);
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+
+    DataCollectionPtr collection = input->get(partialResults);
+    NumericTablePtr nObservationsTable = partialResult->get(nObservations);
+    NumericTablePtr minimumsTable = partialResult->get(partialMinimum);
+    NumericTablePtr maximumsTable = partialResult->get(partialMaximum);
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::MinMaxOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), merge,
+                       collection.get(), nObservationsTable.get(), minimumsTable.get(), maximumsTable.get());
+
+    collection->clear();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step2Master, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    Result *result = static_cast<Result *>(_res);
+
+    NumericTablePtr partialMinimumsTable = partialResult->get(partialMinimum);
+    NumericTablePtr partialMaximumsTable = partialResult->get(partialMaximum);
+    NumericTablePtr minimumsTable = result->get(minimum);
+    NumericTablePtr maximumsTable = result->get(maximum);
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::MinMaxOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), finalizeCompute,
+                       partialMinimumsTable.get(), partialMaximumsTable.get(), minimumsTable.get(), maximumsTable.get());
+}
+
+} // namespace interface1
+} // namespace minmax
+} // namespace normalization
+} // namespace algorithms
+} // namespace daal
+
+#endif
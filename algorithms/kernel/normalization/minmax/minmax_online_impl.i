@@ -0,0 +1,207 @@
+/* file: minmax_online_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the computation of the minimums and maximums
+//  for the min-max normalization in the online and distributed processing modes
+//--
+*/
+
+#ifndef __MINMAX_ONLINE_IMPL_I__
+#define __MINMAX_ONLINE_IMPL_I__
+
+#include "threading.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "service_data_utils.h"
+
+using namespace daal::services;
+using namespace daal::services::internal;
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace normalization
+{
+namespace minmax
+{
+namespace internal
+{
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void MinMaxOnlineKernel<algorithmFPType, method, cpu>::compute(NumericTable *inputTable, NumericTable *nObservationsTable,
+                                                               NumericTable *minimums, NumericTable *maximums)
+{
+    const size_t nRows = inputTable->getNumberOfRows();
+    const size_t nColumns = inputTable->getNumberOfColumns();
+    const algorithmFPType maxVal = daal::data_feature_utils::internal::MaxVal<algorithmFPType, cpu>::get();
+
+    size_t blocksNumber = nRows / BLOCK_SIZE_NORM;
+    if (blocksNumber * BLOCK_SIZE_NORM < nRows) { blocksNumber++; }
+
+    /* Every thread keeps the minimums followed by the maximums of the blocks it processed */
+    daal::tls<algorithmFPType *> tlsMinMax([ = ]()
+    {
+        algorithmFPType *minMax = (algorithmFPType *)daal::services::daal_malloc(2 * nColumns * sizeof(algorithmFPType));
+        if (minMax)
+        {
+            for (size_t j = 0; j < nColumns; j++)
+            {
+                minMax[j]            =  maxVal;
+                minMax[nColumns + j] = -maxVal;
+            }
+        }
+        return minMax;
+    } );
+
+    daal::threader_for(blocksNumber, blocksNumber, [ & ](int iRowsBlock)
+    {
+        algorithmFPType *minMax = tlsMinMax.local();
+        if (!minMax) { return; }
+        algorithmFPType *minArray = minMax;
+        algorithmFPType *maxArray = minMax + nColumns;
+
+        const size_t startRowIndex = iRowsBlock * BLOCK_SIZE_NORM;
+        const size_t blockSize = (startRowIndex + BLOCK_SIZE_NORM < nRows ? BLOCK_SIZE_NORM : nRows - startRowIndex);
+
+        daal::internal::ReadRows<algorithmFPType, cpu, NumericTable> inputTableRows(inputTable, startRowIndex, blockSize);
+        const algorithmFPType *input = inputTableRows.get();
+
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            PRAGMA_IVDEP
+            PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nColumns; j++)
+            {
+                const algorithmFPType value = input[i * nColumns + j];
+                minArray[j] = (value < minArray[j] ? value : minArray[j]);
+                maxArray[j] = (value > maxArray[j] ? value : maxArray[j]);
+            }
+        }
+    } );
+
+    daal::internal::TArray<algorithmFPType, cpu> minMaxPtr(2 * nColumns);
+    algorithmFPType *minMax = minMaxPtr.get();
+    bool isValid = (minMax != NULL);
+    if (isValid)
+    {
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            minMax[j]            =  maxVal;
+            minMax[nColumns + j] = -maxVal;
+        }
+    }
+
+    tlsMinMax.reduce([ & ](algorithmFPType *localMinMax)
+    {
+        if (!localMinMax) { isValid = false; return; }
+        if (isValid)
+        {
+            for (size_t j = 0; j < nColumns; j++)
+            {
+                minMax[j]            = (localMinMax[j] < minMax[j] ? localMinMax[j] : minMax[j]);
+                minMax[nColumns + j] = (localMinMax[nColumns + j] > minMax[nColumns + j] ? localMinMax[nColumns + j] : minMax[nColumns + j]);
+            }
+        }
+        daal::services::daal_free(localMinMax);
+    } );
+
+    if (!isValid)
+    {
+        this->_errors->add(daal::services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    mergeIntoPartialResult(nRows, minMax, minMax + nColumns, nObservationsTable, minimums, maximums);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void MinMaxOnlineKernel<algorithmFPType, method, cpu>::merge(DataCollection *partialResults, NumericTable *nObservationsTable,
+                                                             NumericTable *minimums, NumericTable *maximums)
+{
+    for (size_t i = 0; i < partialResults->size(); i++)
+    {
+        PartialResult *localPartialResult = static_cast<PartialResult *>((*partialResults)[i].get());
+
+        daal::internal::ReadRows<double, cpu, NumericTable> nObservationsRows(localPartialResult->get(nObservations).get(), 0, 1);
+        daal::internal::ReadRows<algorithmFPType, cpu, NumericTable> minimumsRows(localPartialResult->get(partialMinimum).get(), 0, 1);
+        daal::internal::ReadRows<algorithmFPType, cpu, NumericTable> maximumsRows(localPartialResult->get(partialMaximum).get(), 0, 1);
+
+        mergeIntoPartialResult((size_t)(nObservationsRows.get()[0]), minimumsRows.get(), maximumsRows.get(),
+                               nObservationsTable, minimums, maximums);
+    }
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void MinMaxOnlineKernel<algorithmFPType, method, cpu>::mergeIntoPartialResult(size_t nRows, const algorithmFPType *minArray,
+                                                                              const algorithmFPType *maxArray, NumericTable *nObservationsTable,
+                                                                              NumericTable *minimums, NumericTable *maximums)
+{
+    if (nRows == 0) { return; }
+
+    const size_t nColumns = minimums->getNumberOfColumns();
+
+    daal::internal::WriteRows<double, cpu, NumericTable> nObservationsRows(nObservationsTable, 0, 1);
+    daal::internal::WriteRows<algorithmFPType, cpu, NumericTable> minimumsRows(minimums, 0, 1);
+    daal::internal::WriteRows<algorithmFPType, cpu, NumericTable> maximumsRows(maximums, 0, 1);
+    double *nObs = nObservationsRows.get();
+    algorithmFPType *partialMinArray = minimumsRows.get();
+    algorithmFPType *partialMaxArray = maximumsRows.get();
+
+    /* The values stored in the partial result of the empty data set are not used */
+    const bool isEmpty = (nObs[0] == 0.0);
+    for (size_t j = 0; j < nColumns; j++)
+    {
+        partialMinArray[j] = (isEmpty || minArray[j] < partialMinArray[j] ? minArray[j] : partialMinArray[j]);
+        partialMaxArray[j] = (isEmpty || maxArray[j] > partialMaxArray[j] ? maxArray[j] : partialMaxArray[j]);
+    }
+    nObs[0] += (double)nRows;
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void MinMaxOnlineKernel<algorithmFPType, method, cpu>::finalizeCompute(NumericTable *partialMinimums, NumericTable *partialMaximums,
+                                                                       NumericTable *minimums, NumericTable *maximums)
+{
+    const size_t nColumns = partialMinimums->getNumberOfColumns();
+
+    daal::internal::ReadRows<algorithmFPType, cpu, NumericTable> partialMinimumsRows(partialMinimums, 0, 1);
+    daal::internal::ReadRows<algorithmFPType, cpu, NumericTable> partialMaximumsRows(partialMaximums, 0, 1);
+    daal::internal::WriteOnlyRows<algorithmFPType, cpu, NumericTable> minimumsRows(minimums, 0, 1);
+    daal::internal::WriteOnlyRows<algorithmFPType, cpu, NumericTable> maximumsRows(maximums, 0, 1);
+
+    const algorithmFPType *partialMinArray = partialMinimumsRows.get();
+    const algorithmFPType *partialMaxArray = partialMaximumsRows.get();
+    algorithmFPType *minArray = minimumsRows.get();
+    algorithmFPType *maxArray = maximumsRows.get();
+
+    for (size_t j = 0; j < nColumns; j++)
+    {
+        minArray[j] = partialMinArray[j];
+        maxArray[j] = partialMaxArray[j];
+    }
+}
+
+} // namespace daal::internal
+} // namespace minmax
+} // namespace normalization
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -39,7 +39,7 @@ namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_NORMALIZATION_ZSCORE_RESULT_ID);
 /** Default constructor */
-Input::Input() : daal::algorithms::Input(1)
+Input::Input() : daal::algorithms::Input(2)
 {}
 
 /**
@@ -77,6 +77,13 @@ void Input::check(const daal::algorithms::Parameter *par, int method) const
                                                 basicStatisticsSumStr(),
                                                 0, 0, nFeatures, 1)) { return; }
     }
+
+    NumericTablePtr weightsTable = get(weights);
+    if (weightsTable)
+    {
+        DAAL_CHECK_EX(method == defaultDense, ErrorIncorrectOptionalInput, ArgumentName, weightsStr());
+        if (!data_management::checkNumericTable(weightsTable.get(), this->_errors.get(), weightsStr(), 0, 0, 1, get(data)->getNumberOfRows())) { return; }
+    }
 }
 
 Result::Result() : daal::algorithms::Result(1) {}
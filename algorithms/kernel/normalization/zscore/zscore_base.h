@@ -53,12 +53,14 @@ public:
      *  \brief Function that computes z-score normalization
      *
      *  \param input[in]        Input of the algorithm
+     *  \param weights[in]      Optional weights of observations
      *  \param result[out]      Result of the algorithm
      *  \param parameter[in]    Parameters of the algorithm
      */
-    void compute(SharedPtr<NumericTable> inputTable,  NumericTable *sumTable, NumericTable *resultTable, daal::algorithms::Parameter *parameter);
+    void compute(SharedPtr<NumericTable> inputTable, SharedPtr<NumericTable> weightsTable, NumericTable *sumTable, NumericTable *resultTable, daal::algorithms::Parameter *parameter);
 
     virtual int computeMeanVariance_thr( SharedPtr<NumericTable> inputTable,
+                                        SharedPtr<NumericTable> weightsTable,
                                         algorithmFPType* resultMean,
                                         algorithmFPType* resultVariance,
                                         daal::algorithms::Parameter *parameter
@@ -58,10 +58,11 @@ void BatchContainer<algorithmFPType, method, cpu>::compute()
     daal::services::Environment::env &env = *_env;
 
     SharedPtr<NumericTable> inputTable  = input->get(data);
+    SharedPtr<NumericTable> weightsTable = input->get(weights);
     NumericTable *resultTable = result->get(normalizedData).get();
     NumericTable *sumTable    = inputTable->basicStatistics.get(NumericTableIface::sum).get();
 
-    __DAAL_CALL_KERNEL(env, internal::ZScoreKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, inputTable, sumTable, resultTable, parameter);
+    __DAAL_CALL_KERNEL(env, internal::ZScoreKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, inputTable, weightsTable, sumTable, resultTable, parameter);
 
 }
 }
@@ -74,6 +74,7 @@ struct tls_data_t
 
 template<typename algorithmFPType, CpuType cpu>
 int ZScoreKernel<algorithmFPType, defaultDense, cpu>::computeMeanVariance_thr( SharedPtr<NumericTable> inputTable,
+                                                                              SharedPtr<NumericTable> weightsTable,
                                                                               algorithmFPType* resultMean,
                                                                               algorithmFPType* resultVariance,
                                                                               daal::algorithms::Parameter *par
@@ -87,6 +88,7 @@ int ZScoreKernel<algorithmFPType, defaultDense, cpu>::computeMeanVariance_thr( S
     Parameter<algorithmFPType, defaultDense> *parameter = static_cast<Parameter<algorithmFPType, defaultDense> *>(par);
 
     parameter->moments->input.set(low_order_moments::data, inputTable);
+    parameter->moments->input.set(low_order_moments::weights, weightsTable);
     parameter->moments->parameter.estimatesToCompute = low_order_moments::estimatesMeanVariance;
     parameter->moments->computeNoThrow();
     if(parameter->moments->getErrors()->size() != 0)
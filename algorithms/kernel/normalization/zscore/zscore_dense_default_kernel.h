@@ -49,6 +49,7 @@ class ZScoreKernel<algorithmFPType, defaultDense, cpu> : public ZScoreKernelBase
 {
 public:
     int computeMeanVariance_thr(         SharedPtr<NumericTable> inputTable,
+                                        SharedPtr<NumericTable> weightsTable,
                                         algorithmFPType* resultMean,
                                         algorithmFPType* resultVariance,
                                         daal::algorithms::Parameter *parameter
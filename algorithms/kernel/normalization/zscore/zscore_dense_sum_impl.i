@@ -69,6 +69,7 @@ struct tls_data_t
 
 template<typename algorithmFPType, CpuType cpu>
 int ZScoreKernel<algorithmFPType, sumDense, cpu>::computeMeanVariance_thr( SharedPtr<NumericTable> inputTable,
+                                                                              SharedPtr<NumericTable> weightsTable,
                                                                               algorithmFPType* resultMean,
                                                                               algorithmFPType* resultVariance,
                                                                               daal::algorithms::Parameter *parameter
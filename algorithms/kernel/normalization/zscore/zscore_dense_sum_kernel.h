@@ -49,6 +49,7 @@ class ZScoreKernel<algorithmFPType, sumDense, cpu> : public ZScoreKernelBase<alg
 {
 public:
     int computeMeanVariance_thr(         SharedPtr<NumericTable> inputTable,
+                                        SharedPtr<NumericTable> weightsTable,
                                         algorithmFPType* resultMean,
                                         algorithmFPType* resultVariance,
                                         daal::algorithms::Parameter *parameter
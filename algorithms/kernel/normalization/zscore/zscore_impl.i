@@ -44,7 +44,7 @@ namespace internal
 {
 
 template<typename algorithmFPType, CpuType cpu>
-void ZScoreKernelBase<algorithmFPType, cpu>::compute(SharedPtr<NumericTable> inputTable,  NumericTable *sumTable, NumericTable *resultTable,
+void ZScoreKernelBase<algorithmFPType, cpu>::compute(SharedPtr<NumericTable> inputTable, SharedPtr<NumericTable> weightsTable, NumericTable *sumTable, NumericTable *resultTable,
                                                      daal::algorithms::Parameter *parameter)
 {
     size_t _nVectors    = inputTable->getNumberOfRows();
@@ -107,7 +107,7 @@ void ZScoreKernelBase<algorithmFPType, cpu>::compute(SharedPtr<NumericTable> inp
     }
 
     /* Call method-specific function to compute means and variances */
-    if( computeMeanVariance_thr( inputTable, mean_total, inv_sigma_total, parameter ) )
+    if( computeMeanVariance_thr( inputTable, weightsTable, mean_total, inv_sigma_total, parameter ) )
     {
         if(mean_total)      service_free<algorithmFPType,cpu>( mean_total );
         if(inv_sigma_total) service_free<algorithmFPType,cpu>( inv_sigma_total );
@@ -27,10 +27,12 @@
 #include "numeric_table.h"
 #include "outlier_detection_multivariate_types.h"
 
-#include "service_micro_table.h"
 #include "service_numeric_table.h"
 #include "service_math.h"
-#include "service_stat.h"
+#include "service_blas.h"
+#include "service_lapack.h"
+#include "service_sort.h"
+#include "threading.h"
 
 #include "outlierdetection_multivariate_dense_bacon_kernel.h"
 
@@ -46,48 +48,695 @@ namespace multivariate_outlier_detection
 namespace internal
 {
 
+/* Size of the initial basic subset relative to the number of features */
+const size_t baconInitialSubsetFactor = 4;
+
+/* The Cholesky factor of the scatter matrix is updated by rank-one updates instead of the recomputation
+   if the number of observations that enter or leave the basic subset does not exceed nFeatures / choleskyUpdateRatio */
+const size_t choleskyUpdateRatio = 4;
+
+/* Maximal number of iterations, protects from the oscillation of the basic subset */
+const size_t baconMaxIterations = 100;
+
+/*
+ * Basic subset of the BACON algorithm. Stores the number of observations in the subset, the sums and the cross-product
+ * of the observations shifted by the fixed vector, the mean of the subset and the lower Cholesky factor L
+ * of the scatter matrix, that is the cross-product of the observations centered by the mean.
+ * The matrices are stored in the row-major order
+ */
 template <typename algorithmFPType, CpuType cpu>
-void OutlierDetectionKernel<algorithmFPType, baconDense, cpu>::compute(const NumericTable *a, NumericTable *r, const daal::algorithms::Parameter *par)
+class BaconSubset
+{
+public:
+    BaconSubset(size_t nFeatures) : _nFeatures(nFeatures), _nObservations(0), _nFactorized(0),
+        _buffer(3 * nFeatures + 2 * nFeatures * nFeatures)
+    {
+        _shift        = _buffer.get();
+        _sums         = _shift + nFeatures;
+        _mean         = _sums + nFeatures;
+        _crossProduct = _mean + nFeatures;
+        _cholesky     = _crossProduct + nFeatures * nFeatures;
+    }
+
+    bool isValid() const { return _buffer.get() != nullptr; }
+
+    size_t size() const { return _nObservations; }
+
+    const algorithmFPType *mean() const { return _mean; }
+
+    const algorithmFPType *choleskyFactor() const { return _cholesky; }
+
+    /* Makes the subset empty and sets the vector the observations are shifted by */
+    void reset(const algorithmFPType *shift)
+    {
+        _nObservations = 0;
+        _nFactorized   = 0;
+        for (size_t j = 0; j < _nFeatures; j++)
+        {
+            _shift[j] = shift[j];
+            _sums[j]  = 0.0;
+            _mean[j]  = shift[j];
+        }
+        for (size_t j = 0; j < _nFeatures * _nFeatures; j++)
+        {
+            _crossProduct[j] = 0.0;
+            _cholesky[j]     = 0.0;
+        }
+    }
+
+    /* Adds the rows to the sums and the lower triangle of the cross-product if isAdded is true, subtracts them otherwise.
+       The rows are shifted in place */
+    void accumulate(algorithmFPType *rows, size_t nRows, bool isAdded)
+    {
+        if (nRows == 0) { return; }
+
+        const algorithmFPType sign = (isAdded ? 1.0 : -1.0);
+        for (size_t i = 0; i < nRows; i++)
+        {
+            algorithmFPType *row = rows + i * _nFeatures;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < _nFeatures; j++)
+            {
+                row[j] -= _shift[j];
+                _sums[j] += sign * row[j];
+            }
+        }
+
+        char uplo  = 'U';
+        char trans = 'N';
+        DAAL_INT dim = (DAAL_INT)_nFeatures;
+        DAAL_INT n   = (DAAL_INT)nRows;
+        algorithmFPType alpha = sign;
+        algorithmFPType beta  = 1.0;
+        Blas<algorithmFPType, cpu>::xxsyrk(&uplo, &trans, &dim, &n, &alpha, rows, &dim, &beta, _crossProduct, &dim);
+
+        _nObservations = (isAdded ? _nObservations + nRows : _nObservations - nRows);
+    }
+
+    /* Adds the sums and the cross-product of the other subset with the same shift */
+    void merge(const BaconSubset &other)
+    {
+        for (size_t j = 0; j < _nFeatures; j++)
+        {
+            _sums[j] += other._sums[j];
+        }
+        for (size_t i = 0; i < _nFeatures; i++)
+        {
+            for (size_t j = 0; j <= i; j++)
+            {
+                _crossProduct[i * _nFeatures + j] += other._crossProduct[i * _nFeatures + j];
+            }
+        }
+        _nObservations += other._nObservations;
+    }
+
+    /* Computes the mean from the sums */
+    void computeMean()
+    {
+        const algorithmFPType invN = 1.0 / (algorithmFPType)_nObservations;
+        for (size_t j = 0; j < _nFeatures; j++)
+        {
+            _mean[j] = _shift[j] + _sums[j] * invN;
+        }
+    }
+
+    /* Computes the mean and the Cholesky factor of the scatter matrix from the sums and the cross-product.
+       Returns false if the scatter matrix is not positive definite */
+    bool factorize()
+    {
+        if (_nObservations <= _nFeatures) { return false; }
+
+        const algorithmFPType invN = 1.0 / (algorithmFPType)_nObservations;
+        for (size_t i = 0; i < _nFeatures; i++)
+        {
+            for (size_t j = 0; j <= i; j++)
+            {
+                _cholesky[i * _nFeatures + j] = _crossProduct[i * _nFeatures + j] - _sums[i] * _sums[j] * invN;
+            }
+            for (size_t j = i + 1; j < _nFeatures; j++)
+            {
+                _cholesky[i * _nFeatures + j] = 0.0;
+            }
+        }
+        computeMean();
+
+        /* The lower triangle in the row-major order is the upper triangle in the column-major order */
+        char uplo = 'U';
+        DAAL_INT dim = (DAAL_INT)_nFeatures;
+        DAAL_INT info = 0;
+        Lapack<algorithmFPType, cpu>::xpotrf(&uplo, &dim, _cholesky, &dim, &info);
+        _nFactorized = _nObservations;
+        return (info == 0);
+    }
+
+    /* Updates the mean and the Cholesky factor for the rows that enter the subset if isAdded is true,
+       or leave the subset otherwise. Every row changes the scatter matrix by the rank-one term
+       n / (n + 1) * (x - mean) * (x - mean)^T when it enters the subset of n observations,
+       and by the term -n / (n - 1) * (x - mean) * (x - mean)^T when it leaves the subset.
+       Returns false if the updated scatter matrix is not positive definite */
+    bool updateFactorization(const algorithmFPType *rows, size_t nRows, bool isAdded, algorithmFPType *work)
+    {
+        for (size_t i = 0; i < nRows; i++)
+        {
+            const size_t n = _nFactorized;
+            if (!isAdded && n <= _nFeatures + 1) { return false; }
+
+            const algorithmFPType *row = rows + i * _nFeatures;
+            const algorithmFPType invN = 1.0 / (algorithmFPType)(isAdded ? n + 1 : n - 1);
+            const algorithmFPType scale = daal::internal::Math<algorithmFPType, cpu>::sSqrt((algorithmFPType)n * invN);
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < _nFeatures; j++)
+            {
+                const algorithmFPType delta = row[j] - _mean[j];
+                _mean[j] += (isAdded ? delta * invN : -delta * invN);
+                work[j] = scale * delta;
+            }
+
+            if (!updateCholesky(work, isAdded)) { return false; }
+            _nFactorized = (isAdded ? n + 1 : n - 1);
+        }
+        return true;
+    }
+
+private:
+    /* Rank-one update L * L^T + x * x^T or downdate L * L^T - x * x^T of the Cholesky factor, x is overwritten */
+    bool updateCholesky(algorithmFPType *x, bool isUpdate)
+    {
+        const algorithmFPType sign = (isUpdate ? 1.0 : -1.0);
+        for (size_t k = 0; k < _nFeatures; k++)
+        {
+            const algorithmFPType lkk = _cholesky[k * _nFeatures + k];
+            algorithmFPType r2 = lkk * lkk + sign * x[k] * x[k];
+            if (!(r2 > 0)) { return false; }
+
+            const algorithmFPType r = daal::internal::Math<algorithmFPType, cpu>::sSqrt(r2);
+            const algorithmFPType c = r / lkk;
+            const algorithmFPType s = x[k] / lkk;
+            const algorithmFPType invC = 1.0 / c;
+            _cholesky[k * _nFeatures + k] = r;
+            for (size_t i = k + 1; i < _nFeatures; i++)
+            {
+                algorithmFPType &lik = _cholesky[i * _nFeatures + k];
+                lik  = (lik + sign * s * x[i]) * invC;
+                x[i] = c * x[i] - s * lik;
+            }
+        }
+        return true;
+    }
+
+    size_t _nFeatures;
+    size_t _nObservations;
+    size_t _nFactorized;
+    TArray<algorithmFPType, cpu> _buffer;
+    algorithmFPType *_shift;
+    algorithmFPType *_sums;
+    algorithmFPType *_mean;
+    algorithmFPType *_crossProduct;
+    algorithmFPType *_cholesky;
+};
+
+/* Growing buffer of the rows that enter or leave the basic subset */
+template <typename algorithmFPType, CpuType cpu>
+class BaconRows
+{
+public:
+    BaconRows(size_t nFeatures) : _nFeatures(nFeatures), _nRows(0), _capacity(0), _rows(nullptr) {}
+
+    ~BaconRows() { daal::services::daal_free(_rows); }
+
+    size_t size() const { return _nRows; }
+
+    algorithmFPType *get() { return _rows; }
+
+    bool add(const algorithmFPType *row)
+    {
+        if (_nRows == _capacity)
+        {
+            const size_t capacity = (_capacity ? 2 * _capacity : 16);
+            algorithmFPType *rows = (algorithmFPType *)daal::services::daal_malloc(capacity * _nFeatures * sizeof(algorithmFPType));
+            if (!rows) { return false; }
+            for (size_t i = 0; i < _nRows * _nFeatures; i++)
+            {
+                rows[i] = _rows[i];
+            }
+            daal::services::daal_free(_rows);
+            _rows = rows;
+            _capacity = capacity;
+        }
+        algorithmFPType *dst = _rows + _nRows * _nFeatures;
+        for (size_t j = 0; j < _nFeatures; j++)
+        {
+            dst[j] = row[j];
+        }
+        _nRows++;
+        return true;
+    }
+
+private:
+    size_t _nFeatures;
+    size_t _nRows;
+    size_t _capacity;
+    algorithmFPType *_rows;
+};
+
+/* Thread local data of the pass over the blocks of observations */
+template <typename algorithmFPType, CpuType cpu>
+struct BaconTask
+{
+    BaconTask(size_t nFeatures, size_t blockSize) : centered(nFeatures * blockSize), distances(blockSize),
+        added(nFeatures), removed(nFeatures), subset(nFeatures), next(nullptr)
+    {
+        isValid = (centered.get() && distances.get() && subset.isValid());
+    }
+
+    TArray<algorithmFPType, cpu> centered;
+    TArray<algorithmFPType, cpu> distances;
+    BaconRows<algorithmFPType, cpu> added;
+    BaconRows<algorithmFPType, cpu> removed;
+    BaconSubset<algorithmFPType, cpu> subset;
+    bool isValid;
+    BaconTask *next;
+};
+
+/* Computes the squared distances of the rows to the center. If the lower Cholesky factor L is given,
+   the distances are the squared norms of L^{-1} * (x - center), otherwise they are the squared Euclidean distances */
+template <typename algorithmFPType, CpuType cpu>
+bool computeSquaredDistances(size_t nFeatures, size_t nRows, const algorithmFPType *data, const algorithmFPType *center,
+                             const algorithmFPType *cholesky, algorithmFPType *centered, algorithmFPType *distances)
+{
+    for (size_t i = 0; i < nRows; i++)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            centered[i * nFeatures + j] = data[i * nFeatures + j] - center[j];
+        }
+    }
+
+    if (cholesky)
+    {
+        /* L stored in the row-major order is the upper triangular L^T in the column-major order */
+        char uplo  = 'U';
+        char trans = 'T';
+        char diag  = 'N';
+        DAAL_INT dim  = (DAAL_INT)nFeatures;
+        DAAL_INT nrhs = (DAAL_INT)nRows;
+        DAAL_INT info = 0;
+        Lapack<algorithmFPType, cpu>::xxtrtrs(&uplo, &trans, &diag, &dim, &nrhs, const_cast<algorithmFPType *>(cholesky), &dim,
+                                              centered, &dim, &info);
+        if (info != 0) { return false; }
+    }
+
+    for (size_t i = 0; i < nRows; i++)
+    {
+        algorithmFPType sum = 0.0;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            sum += centered[i * nFeatures + j] * centered[i * nFeatures + j];
+        }
+        distances[i] = sum;
+    }
+    return true;
+}
+
+/* Approximation of Wilson and Hilferty to the (1 - alpha) quantile of the chi-squared distribution */
+template <typename algorithmFPType, CpuType cpu>
+algorithmFPType chiSquaredQuantile(size_t nDegrees, algorithmFPType alpha)
 {
-    const __int64 nBaconParams = 3;
-    algorithmFPType baconParams[nBaconParams];
-    Parameter<baconDense> *odPar = static_cast<Parameter<baconDense> *>(const_cast<daal::algorithms::Parameter *>(par));
-    if (odPar == NULL)
+    const algorithmFPType z = daal::internal::Math<algorithmFPType, cpu>::sSqrt(2.0) *
+                              daal::internal::Math<algorithmFPType, cpu>::sErfInv(1.0 - 2.0 * alpha);
+    const algorithmFPType a = 2.0 / (9.0 * (algorithmFPType)nDegrees);
+    algorithmFPType t = 1.0 - a + z * daal::internal::Math<algorithmFPType, cpu>::sSqrt(a);
+    if (t < 0) { t = 0; }
+    return (algorithmFPType)nDegrees * t * t * t;
+}
+
+/* Correction factor of the threshold for the basic subset of nSubset observations
+   from Billor, Hadi and Velleman, "BACON: blocked adaptive computationally efficient outlier nominators", 2000 */
+template <typename algorithmFPType>
+algorithmFPType baconCorrectionFactor(size_t nVectors, size_t nFeatures, size_t nSubset)
+{
+    const algorithmFPType h = (algorithmFPType)((nVectors + nFeatures + 1) / 2);
+    algorithmFPType cnp = 1.0 + (algorithmFPType)(nFeatures + 1) / (algorithmFPType)(nVectors - nFeatures);
+    if (nVectors > 3 * nFeatures + 1)
     {
-        odPar = new Parameter<baconDense>();
+        cnp += 2.0 / (algorithmFPType)(nVectors - 1 - 3 * nFeatures);
     }
+    algorithmFPType chr = (h - (algorithmFPType)nSubset) / (h + (algorithmFPType)nSubset);
+    if (chr < 0) { chr = 0; }
+    return cnp + chr;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+bool OutlierDetectionKernel<algorithmFPType, baconDense, cpu>::computeInitialSubset(
+    const NumericTable *a, NumericTable *r, BaconInitializationMethod initMethod, BaconSubset<algorithmFPType, cpu> &subset)
+{
+    const size_t nFeatures = a->getNumberOfColumns();
+    const size_t nVectors  = a->getNumberOfRows();
+    const size_t nBlocks   = nVectors / blockSize + !!(nVectors % blockSize);
+    NumericTable *data = const_cast<NumericTable *>(a);
+
+    TArray<algorithmFPType, cpu> centerArray(nFeatures);
+    algorithmFPType *center = centerArray.get();
+    if (!center) { this->_errors->add(services::ErrorMemoryAllocationFailed); return false; }
 
-    switch (odPar->initMethod)
+    const algorithmFPType *cholesky = nullptr;
+    if (initMethod == baconMahalanobis)
     {
-    case baconMedian:
-    default:
+        /* The center is the mean of all observations, the distances are the Mahalanobis distances */
+        ReadRows<algorithmFPType, cpu> firstRow(data, 0, 1);
+        const algorithmFPType *shift = firstRow.get();
+        if (!shift) { this->_errors->add(services::ErrorMemoryAllocationFailed); return false; }
+        subset.reset(shift);
+
+        daal::tls<BaconTask<algorithmFPType, cpu> *> tlsTask([ = ]()
+        {
+            BaconTask<algorithmFPType, cpu> *task = new BaconTask<algorithmFPType, cpu>(nFeatures, blockSize);
+            if (task->isValid) { task->subset.reset(shift); }
+            return task;
+        } );
+
+        daal::threader_for( nBlocks, nBlocks, [ & ](int iBlock)
+        {
+            BaconTask<algorithmFPType, cpu> *task = tlsTask.local();
+            if (!task->isValid) { return; }
+            const size_t startRow = iBlock * blockSize;
+            const size_t nRows = (startRow + blockSize < nVectors ? blockSize : nVectors - startRow);
+            ReadRows<algorithmFPType, cpu> rows(data, startRow, nRows);
+            const algorithmFPType *block = rows.get();
+            if (!block) { task->isValid = false; return; }
+
+            algorithmFPType *centered = task->centered.get();
+            for (size_t i = 0; i < nRows * nFeatures; i++)
+            {
+                centered[i] = block[i];
+            }
+            task->subset.accumulate(centered, nRows, true);
+        } );
+
+        bool isValid = true;
+        tlsTask.reduce( [ & ](BaconTask<algorithmFPType, cpu> *task)
+        {
+            isValid = isValid && task->isValid;
+            if (task->isValid) { subset.merge(task->subset); }
+            delete task;
+        } );
+        if (!isValid) { this->_errors->add(services::ErrorMemoryAllocationFailed); return false; }
+        if (!subset.factorize()) { this->_errors->add(services::ErrorOutlierDetectionInternal); return false; }
+
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            center[j] = subset.mean()[j];
+        }
+        cholesky = subset.choleskyFactor();
+    }
+    else
     {
-        baconParams[0] = (algorithmFPType)__DAAL_VSL_SS_METHOD_BACON_MEDIAN_INIT;
-        break;
+        /* The center is the vector of the medians of the features, the distances are the Euclidean distances */
+        daal::tls<algorithmFPType *> tlsValues([ = ]()
+        {
+            return (algorithmFPType *)daal::services::daal_malloc(nVectors * sizeof(algorithmFPType));
+        } );
+
+        bool isValid = true;
+        daal::threader_for( nFeatures, nFeatures, [ & ](int iFeature)
+        {
+            algorithmFPType *values = tlsValues.local();
+            if (!values) { isValid = false; return; }
+
+            BlockDescriptor<algorithmFPType> column;
+            data->getBlockOfColumnValues(iFeature, 0, nVectors, readOnly, column);
+            const algorithmFPType *columnValues = column.getBlockPtr();
+            for (size_t i = 0; i < nVectors; i++)
+            {
+                values[i] = columnValues[i];
+            }
+            data->releaseBlockOfColumnValues(column);
+
+            daal::algorithms::internal::qSort<algorithmFPType, cpu>(nVectors, values);
+            center[iFeature] = (nVectors % 2 ? values[nVectors / 2] : 0.5 * (values[nVectors / 2 - 1] + values[nVectors / 2]));
+        } );
+
+        tlsValues.reduce( [ & ](algorithmFPType *values)
+        {
+            daal::services::daal_free(values);
+        } );
+        if (!isValid) { this->_errors->add(services::ErrorMemoryAllocationFailed); return false; }
     }
-    case baconMahalanobis:
+
+    /* Distances of all observations to the center */
+    TArray<algorithmFPType, cpu> distancesArray(nVectors);
+    TArray<size_t, cpu> indicesArray(nVectors);
+    algorithmFPType *distances = distancesArray.get();
+    size_t *indices = indicesArray.get();
+    if (!distances || !indices) { this->_errors->add(services::ErrorMemoryAllocationFailed); return false; }
+
     {
-        baconParams[0] = (algorithmFPType)__DAAL_VSL_SS_METHOD_BACON_MAHALANOBIS_INIT;
-        break;
+        daal::tls<BaconTask<algorithmFPType, cpu> *> tlsTask([ = ]()
+        {
+            return new BaconTask<algorithmFPType, cpu>(nFeatures, blockSize);
+        } );
+
+        daal::threader_for( nBlocks, nBlocks, [ & ](int iBlock)
+        {
+            BaconTask<algorithmFPType, cpu> *task = tlsTask.local();
+            if (!task->isValid) { return; }
+            const size_t startRow = iBlock * blockSize;
+            const size_t nRows = (startRow + blockSize < nVectors ? blockSize : nVectors - startRow);
+            ReadRows<algorithmFPType, cpu> rows(data, startRow, nRows);
+            if (!rows.get()) { task->isValid = false; return; }
+
+            if (!computeSquaredDistances<algorithmFPType, cpu>(nFeatures, nRows, rows.get(), center, cholesky,
+                                                               task->centered.get(), distances + startRow))
+            {
+                task->isValid = false;
+            }
+            for (size_t i = 0; i < nRows; i++)
+            {
+                indices[startRow + i] = startRow + i;
+            }
+        } );
+
+        bool isValid = true;
+        tlsTask.reduce( [ & ](BaconTask<algorithmFPType, cpu> *task)
+        {
+            isValid = isValid && task->isValid;
+            delete task;
+        } );
+        if (!isValid) { this->_errors->add(services::ErrorOutlierDetectionInternal); return false; }
     }
+
+    daal::algorithms::internal::qSort<algorithmFPType, size_t, cpu>(nVectors, distances, indices);
+
+    /* The initial basic subset consists of the observations closest to the center.
+       It is enlarged while its scatter matrix is singular */
+    subset.reset(center);
+    size_t nSubset = 0;
+    size_t nSubsetNew = baconInitialSubsetFactor * nFeatures;
+    if (nSubsetNew > nVectors) { nSubsetNew = nVectors; }
+    while (nSubset < nSubsetNew)
+    {
+        TArray<algorithmFPType, cpu> rowsArray((nSubsetNew - nSubset) * nFeatures);
+        algorithmFPType *rows = rowsArray.get();
+        if (!rows) { this->_errors->add(services::ErrorMemoryAllocationFailed); return false; }
+        for (size_t i = nSubset; i < nSubsetNew; i++)
+        {
+            ReadRows<algorithmFPType, cpu> row(data, indices[i], 1);
+            if (!row.get()) { this->_errors->add(services::ErrorMemoryAllocationFailed); return false; }
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                rows[(i - nSubset) * nFeatures + j] = row.get()[j];
+            }
+        }
+        subset.accumulate(rows, nSubsetNew - nSubset, true);
+        nSubset = nSubsetNew;
+
+        if (subset.factorize()) { break; }
+        if (nSubset == nVectors) { this->_errors->add(services::ErrorOutlierDetectionInternal); return false; }
+        nSubsetNew = (nSubset + nFeatures < nVectors ? nSubset + nFeatures : nVectors);
     }
-    baconParams[1] = (algorithmFPType)(odPar->alpha);
-    baconParams[2] = (algorithmFPType)(odPar->toleranceToConverge);
 
-    BlockMicroTable<algorithmFPType, readOnly, cpu> mtA(a);
-    FeatureMicroTable<algorithmFPType, writeOnly, cpu> mtR(r);
-    size_t nFeatures = mtA.getFullNumberOfColumns();
-    size_t nVectors  = mtA.getFullNumberOfRows();
+    /* Indicators of the basic subset */
+    TArray<char, cpu> isInSubsetArray(nVectors);
+    char *isInSubset = isInSubsetArray.get();
+    if (!isInSubset) { this->_errors->add(services::ErrorMemoryAllocationFailed); return false; }
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        isInSubset[i] = 0;
+    }
+    for (size_t i = 0; i < nSubset; i++)
+    {
+        isInSubset[indices[i]] = 1;
+    }
 
-    algorithmFPType *data, *weight;
-    mtA.getBlockOfRows(0, nVectors, &data);
-    mtR.getBlockOfColumnValues(0, 0, nVectors, &weight);
+    bool isValid = true;
+    daal::threader_for( nBlocks, nBlocks, [ & ](int iBlock)
+    {
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows = (startRow + blockSize < nVectors ? blockSize : nVectors - startRow);
+        WriteOnlyRows<algorithmFPType, cpu> weightRows(r, startRow, nRows);
+        algorithmFPType *weight = weightRows.get();
+        if (!weight) { isValid = false; return; }
+        for (size_t i = 0; i < nRows; i++)
+        {
+            weight[i] = (algorithmFPType)isInSubset[startRow + i];
+        }
+    } );
+    if (!isValid) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+    return isValid;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+bool OutlierDetectionKernel<algorithmFPType, baconDense, cpu>::updateSubset(
+    const NumericTable *a, NumericTable *r, algorithmFPType threshold, BaconSubset<algorithmFPType, cpu> &subset, size_t &nChanged)
+{
+    const size_t nFeatures = a->getNumberOfColumns();
+    const size_t nVectors  = a->getNumberOfRows();
+    const size_t nBlocks   = nVectors / blockSize + !!(nVectors % blockSize);
+    NumericTable *data = const_cast<NumericTable *>(a);
+
+    /* The squared Mahalanobis distance is (n - 1) * |L^{-1} * (x - mean)|^2 for the scatter matrix L * L^T
+       of the basic subset of n observations */
+    const algorithmFPType maxDistance = threshold * threshold / (algorithmFPType)(subset.size() - 1);
+    const algorithmFPType *mean = subset.mean();
+    const algorithmFPType *cholesky = subset.choleskyFactor();
+
+    daal::tls<BaconTask<algorithmFPType, cpu> *> tlsTask([ = ]()
+    {
+        return new BaconTask<algorithmFPType, cpu>(nFeatures, blockSize);
+    } );
+
+    daal::threader_for( nBlocks, nBlocks, [ & ](int iBlock)
+    {
+        BaconTask<algorithmFPType, cpu> *task = tlsTask.local();
+        if (!task->isValid) { return; }
+        const size_t startRow = iBlock * blockSize;
+        const size_t nRows = (startRow + blockSize < nVectors ? blockSize : nVectors - startRow);
+        ReadRows<algorithmFPType, cpu> rows(data, startRow, nRows);
+        WriteRows<algorithmFPType, cpu> weightRows(r, startRow, nRows);
+        const algorithmFPType *block = rows.get();
+        algorithmFPType *weight = weightRows.get();
+        if (!block || !weight) { task->isValid = false; return; }
+
+        algorithmFPType *distances = task->distances.get();
+        if (!computeSquaredDistances<algorithmFPType, cpu>(nFeatures, nRows, block, mean, cholesky,
+                                                           task->centered.get(), distances))
+        {
+            task->isValid = false;
+            return;
+        }
+
+        /* The weights store the indicators of the current basic subset */
+        for (size_t i = 0; i < nRows; i++)
+        {
+            const bool isInSubset  = (distances[i] < maxDistance);
+            const bool wasInSubset = (weight[i] != 0);
+            if (isInSubset == wasInSubset) { continue; }
+
+            weight[i] = (isInSubset ? 1.0 : 0.0);
+            BaconRows<algorithmFPType, cpu> &changedRows = (isInSubset ? task->added : task->removed);
+            if (!changedRows.add(block + i * nFeatures)) { task->isValid = false; return; }
+        }
+    } );
+
+    BaconTask<algorithmFPType, cpu> *tasks = nullptr;
+    bool isValid = true;
+    size_t nAdded = 0, nRemoved = 0;
+    tlsTask.reduce( [ & ](BaconTask<algorithmFPType, cpu> *task)
+    {
+        isValid = isValid && task->isValid;
+        nAdded   += task->added.size();
+        nRemoved += task->removed.size();
+        task->next = tasks;
+        tasks = task;
+    } );
+    nChanged = nAdded + nRemoved;
+
+    if (isValid && nChanged)
+    {
+        /* The Cholesky factor is updated by the rank-one terms of the changed rows if there are few of them.
+           The observations enter the subset before the others leave it, so the scatter matrix stays positive definite
+           as long as possible */
+        bool isUpdated = false;
+        TArray<algorithmFPType, cpu> work(nFeatures);
+        if (nChanged * choleskyUpdateRatio <= nFeatures && work.get())
+        {
+            isUpdated = true;
+            for (BaconTask<algorithmFPType, cpu> *task = tasks; task && isUpdated; task = task->next)
+            {
+                isUpdated = subset.updateFactorization(task->added.get(), task->added.size(), true, work.get());
+            }
+            for (BaconTask<algorithmFPType, cpu> *task = tasks; task && isUpdated; task = task->next)
+            {
+                isUpdated = subset.updateFactorization(task->removed.get(), task->removed.size(), false, work.get());
+            }
+        }
+
+        for (BaconTask<algorithmFPType, cpu> *task = tasks; task; task = task->next)
+        {
+            subset.accumulate(task->added.get(), task->added.size(), true);
+            subset.accumulate(task->removed.get(), task->removed.size(), false);
+        }
 
-    Statistics<algorithmFPType, cpu>::xoutlierdetection(data, (__int64)nFeatures, (__int64)nVectors, nBaconParams, baconParams, weight);
+        if (isUpdated)
+        {
+            subset.computeMean();
+        }
+        else
+        {
+            isValid = subset.factorize();
+        }
+    }
 
-    mtA.release();
-    mtR.release();
-    if (par == NULL) { delete odPar; }
+    while (tasks)
+    {
+        BaconTask<algorithmFPType, cpu> *next = tasks->next;
+        delete tasks;
+        tasks = next;
+    }
+
+    if (!isValid) { this->_errors->add(services::ErrorOutlierDetectionInternal); }
+    return isValid;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void OutlierDetectionKernel<algorithmFPType, baconDense, cpu>::compute(const NumericTable *a, NumericTable *r, const daal::algorithms::Parameter *par)
+{
+    Parameter<baconDense> defaultParameter;
+    const Parameter<baconDense> *odPar = (par ? static_cast<const Parameter<baconDense> *>(par) : &defaultParameter);
+
+    const size_t nFeatures = a->getNumberOfColumns();
+    const size_t nVectors  = a->getNumberOfRows();
+
+    BaconSubset<algorithmFPType, cpu> subset(nFeatures);
+    if (!subset.isValid()) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+    if (!computeInitialSubset(a, r, odPar->initMethod, subset)) { return; }
+
+    /* The basic subset is replaced by the observations with the distances to it below the threshold
+       until its size is stable. The mean and the Cholesky factor are updated with the changed observations only */
+    const algorithmFPType chi = daal::internal::Math<algorithmFPType, cpu>::sSqrt(
+                                    chiSquaredQuantile<algorithmFPType, cpu>(nFeatures, (algorithmFPType)odPar->alpha));
+    for (size_t iteration = 0; iteration < baconMaxIterations; iteration++)
+    {
+        const size_t nSubset = subset.size();
+        const algorithmFPType threshold = baconCorrectionFactor<algorithmFPType>(nVectors, nFeatures, nSubset) * chi;
+
+        size_t nChanged = 0;
+        if (!updateSubset(a, r, threshold, subset, nChanged)) { return; }
+
+        const size_t nSubsetNew = subset.size();
+        const size_t sizeChange = (nSubsetNew > nSubset ? nSubsetNew - nSubset : nSubset - nSubsetNew);
+        if (nChanged == 0 || (algorithmFPType)sizeChange < (algorithmFPType)odPar->toleranceToConverge * (algorithmFPType)nSubset)
+        {
+            break;
+        }
+    }
 }
 
 } // namespace internal
@@ -45,9 +45,23 @@ namespace multivariate_outlier_detection
 namespace internal
 {
 
+template <typename algorithmFPType, CpuType cpu>
+class BaconSubset;
+
 template <typename algorithmFPType, CpuType cpu>
 struct OutlierDetectionKernel<algorithmFPType, baconDense, cpu> : public Kernel
 {
+    static const size_t blockSize = 512;
+
+    /** \brief Select the initial basic subset of observations and store its indicators into the weights table */
+    bool computeInitialSubset(const NumericTable *a, NumericTable *r, BaconInitializationMethod initMethod,
+                              BaconSubset<algorithmFPType, cpu> &subset);
+
+    /** \brief Compute the distances of all observations to the basic subset, select the new basic subset
+               by the threshold on the distance and update the mean and the Cholesky factor of the scatter matrix */
+    bool updateSubset(const NumericTable *a, NumericTable *r, algorithmFPType threshold,
+                      BaconSubset<algorithmFPType, cpu> &subset, size_t &nChanged);
+
     void compute(const NumericTable *a, NumericTable *r, const daal::algorithms::Parameter *par);
 };
 
@@ -23,6 +23,7 @@
 
 #include "outlier_detection_univariate_types.h"
 #include "serialization_utils.h"
+#include "quantiles_kernel.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -36,6 +37,7 @@ namespace univariate_outlier_detection
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_OUTLIER_DETECTION_UNIVARIATE_RESULT_ID);
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_OUTLIER_DETECTION_UNIVARIATE_PARTIAL_RESULT_ID);
 
 /**
 * Returns the initial value for the univariate outlier detection algorithm
@@ -76,7 +78,18 @@ Parameter::Parameter() : daal::algorithms::Parameter(), initializationProcedure(
 
 void Parameter::check() const {}
 
-Input::Input() : daal::algorithms::Input(1) {}
+Input::Input() : InputIface(4) {}
+
+/**
+ * Returns the number of columns in the input data set
+ * \return Number of columns in the input data set
+ */
+size_t Input::getNumberOfColumns() const
+{
+    NumericTablePtr dataTable = get(data);
+    if (!checkNumericTable(dataTable.get(), this->_errors.get(), dataStr())) { return 0; }
+    return dataTable->getNumberOfColumns();
+}
 
 /**
  * Returns an input object for the univariate outlier detection algorithm
@@ -106,9 +119,207 @@ void Input::set(InputId id, const NumericTablePtr &ptr)
 void Input::check(const daal::algorithms::Parameter *par, int method) const
 {
     if (!checkNumericTable(get(data).get(), this->_errors.get(), dataStr())) { return; }
+
+    size_t nFeatures = get(data)->getNumberOfColumns();
+    int unexpectedLayouts = (int)NumericTableIface::csrArray;
+    const char *optionalInputNames[] = { locationStr(), scatterStr(), thresholdStr() };
+    for (size_t i = (size_t)location; i <= (size_t)threshold; i++)
+    {
+        NumericTablePtr optionalInput = get((InputId)i);
+        if (optionalInput)
+        {
+            if (!checkNumericTable(optionalInput.get(), this->_errors.get(), optionalInputNames[i - location],
+                                   unexpectedLayouts, 0, nFeatures, 1)) { return; }
+        }
+    }
+}
+
+PartialResult::PartialResult() : daal::algorithms::PartialResult(3) {}
+
+/**
+ * Sets the partial results of the univariate outlier detection algorithm to the values of the empty data set
+ */
+void PartialResult::initialize()
+{
+    NumericTablePtr nObservationsTable = get(nObservations);
+    BlockDescriptor<double> nObservationsBlock;
+    nObservationsTable->getBlockOfRows(0, 1, writeOnly, nObservationsBlock);
+    nObservationsBlock.getBlockPtr()[0] = 0.0;
+    nObservationsTable->releaseBlockOfRows(nObservationsBlock);
+
+    /* The empty levels start at the end of the row of the sketch items */
+    NumericTablePtr levelsTable = get(sketchLevels);
+    const size_t nFeatures = levelsTable->getNumberOfRows();
+    const int capacity = (int)get(sketchItems)->getNumberOfColumns();
+    BlockDescriptor<int> levelsBlock;
+    levelsTable->getBlockOfRows(0, nFeatures, writeOnly, levelsBlock);
+    int *levels = levelsBlock.getBlockPtr();
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        for (size_t h = 0; h <= __QUANTILES_SKETCH_MAX_LEVELS; h++)
+        {
+            levels[j * quantiles::internal::sketchLevelsStride + h] = capacity;
+        }
+        levels[j * quantiles::internal::sketchLevelsStride + __QUANTILES_SKETCH_MAX_LEVELS + 1] = 0;
+    }
+    levelsTable->releaseBlockOfRows(levelsBlock);
+}
+
+/**
+ * Returns the number of columns in the input data set processed by the univariate outlier detection algorithm
+ * \return Number of columns in the input data set
+ */
+size_t PartialResult::getNumberOfColumns() const
+{
+    NumericTablePtr ntPtr = get(sketchItems);
+    if (!checkNumericTable(ntPtr.get(), this->_errors.get(), sketchItemsStr())) { return 0; }
+    return ntPtr->getNumberOfRows();
+}
+
+/**
+ * Returns a partial result of the univariate outlier detection algorithm
+ * \param[in] id   Identifier of the partial result, \ref PartialResultId
+ * \return         Partial result that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult::get(PartialResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets a partial result of the univariate outlier detection algorithm
+ * \param[in] id    Identifier of the partial result
+ * \param[in] ptr   Pointer to the partial result
+ */
+void PartialResult::set(PartialResultId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Checks the partial result of the univariate outlier detection algorithm
+ * \param[in] input     Pointer to the structure with input objects
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ */
+void PartialResult::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const
+{
+    size_t nFeatures = (static_cast<const InputIface *>(input))->getNumberOfColumns();
+    checkImpl(nFeatures);
+}
+
+/**
+ * Checks the partial result of the univariate outlier detection algorithm
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ */
+void PartialResult::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    size_t nFeatures = getNumberOfColumns();
+    if (this->_errors->size() != 0) { return; }
+    checkImpl(nFeatures);
+}
+
+void PartialResult::checkImpl(size_t nFeatures) const
+{
+    int unexpectedLayouts = (int)NumericTableIface::csrArray;
+    if (!checkNumericTable(get(nObservations).get(), this->_errors.get(), nObservationsStr(), unexpectedLayouts, 0, 1, 1)) { return; }
+
+    unexpectedLayouts = (int)packed_mask;
+    if (!checkNumericTable(get(sketchItems).get(), this->_errors.get(), sketchItemsStr(), unexpectedLayouts, 0, 0, nFeatures)) { return; }
+
+    /* The sketch of the smallest size corresponds to epsilon equal to one */
+    DAAL_CHECK_EX(get(sketchItems)->getNumberOfColumns() >= quantiles::internal::getSketchCapacity(1.0), ErrorIncorrectNumberOfColumns,
+                  ArgumentName, sketchItemsStr());
+    if (!checkNumericTable(get(sketchLevels).get(), this->_errors.get(), sketchLevelsStr(), unexpectedLayouts, 0,
+                           quantiles::internal::sketchLevelsStride, nFeatures)) { return; }
+}
+
+DistributedInput<step2Master>::DistributedInput() : InputIface(1)
+{
+    Argument::set(partialResults, DataCollectionPtr(new DataCollection()));
+}
+
+/**
+ * Returns the number of columns in the input data set
+ * \return Number of columns in the input data set
+ */
+size_t DistributedInput<step2Master>::getNumberOfColumns() const
+{
+    DataCollectionPtr collection = get(partialResults);
+    if (!collection) { this->_errors->add(ErrorNullInputDataCollection); return 0; }
+    if (collection->size() == 0) { this->_errors->add(ErrorIncorrectNumberOfInputNumericTables); return 0; }
+
+    PartialResultPtr partialResult = PartialResult::cast((*collection)[0]);
+    if (!partialResult) { this->_errors->add(ErrorIncorrectElementInPartialResultCollection); return 0; }
+
+    NumericTablePtr ntPtr = partialResult->get(sketchItems);
+    if (!checkNumericTable(ntPtr.get(), this->_errors.get(), sketchItemsStr())) { return 0; }
+    return ntPtr->getNumberOfRows();
+}
+
+/**
+ * Adds the partial result computed on a local node to the collection of input objects
+ * \param[in] id            Identifier of the input object
+ * \param[in] partialResult Partial result obtained in the first step of the distributed algorithm
+ */
+void DistributedInput<step2Master>::add(MasterInputId id, const PartialResultPtr &partialResult)
+{
+    DataCollectionPtr collection = get(id);
+    collection->push_back(staticPointerCast<SerializationIface, PartialResult>(partialResult));
+}
+
+/**
+ * Sets the input object of the univariate outlier detection algorithm on the master node
+ * \param[in] id  Identifier of the input object
+ * \param[in] ptr Pointer to the input object
+ */
+void DistributedInput<step2Master>::set(MasterInputId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, ptr);
 }
 
-Result::Result() : daal::algorithms::Result(1) {}
+/**
+ * Returns the collection of input objects
+ * \param[in] id   Identifier of the input object, \ref MasterInputId
+ * \return Collection of partial results
+ */
+DataCollectionPtr DistributedInput<step2Master>::get(MasterInputId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Checks the input objects of the univariate outlier detection algorithm on the master node
+ * \param[in] parameter Pointer to the algorithm parameters
+ * \param[in] method    Computation method
+ */
+void DistributedInput<step2Master>::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    size_t nFeatures = getNumberOfColumns();
+    if (this->_errors->size() != 0) { return; }
+
+    DataCollectionPtr collection = get(partialResults);
+    for (size_t i = 0; i < collection->size(); i++)
+    {
+        PartialResultPtr partialResult = PartialResult::cast((*collection)[i]);
+        if (!partialResult) { this->_errors->add(ErrorIncorrectElementInPartialResultCollection); return; }
+
+        int unexpectedLayouts = (int)NumericTableIface::csrArray;
+        if (!checkNumericTable(partialResult->get(nObservations).get(), this->_errors.get(), nObservationsStr(),
+                               unexpectedLayouts, 0, 1, 1)) { return; }
+
+        unexpectedLayouts = (int)packed_mask;
+        if (!checkNumericTable(partialResult->get(sketchItems).get(), this->_errors.get(), sketchItemsStr(),
+                               unexpectedLayouts, 0, 0, nFeatures)) { return; }
+        DAAL_CHECK_EX(partialResult->get(sketchItems)->getNumberOfColumns() >= quantiles::internal::getSketchCapacity(1.0),
+                      ErrorIncorrectNumberOfColumns, ArgumentName, sketchItemsStr());
+        if (!checkNumericTable(partialResult->get(sketchLevels).get(), this->_errors.get(), sketchLevelsStr(),
+                               unexpectedLayouts, 0, quantiles::internal::sketchLevelsStride, nFeatures)) { return; }
+    }
+}
+
+Result::Result() : daal::algorithms::Result(3) {}
 
 /**
  * Returns a result of the univariate outlier detection algorithm
@@ -147,6 +358,21 @@ void Result::check(const daal::algorithms::Input *input, const daal::algorithms:
     if (!checkNumericTable(get(weights).get(), this->_errors.get(), weightsStr(), unexpectedLayouts, 0, nFeatures, nVectors)) { return; }
 }
 
+/**
+ * Checks the estimates of the univariate outlier detection algorithm in the online or distributed processing mode
+ * \param[in] partialResult Pointer to the partial results of the algorithm
+ * \param[in] par           Pointer to the parameters of the algorithm
+ * \param[in] method        univariate outlier detection computation method
+ */
+void Result::check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *par, int method) const
+{
+    size_t nFeatures = static_cast<const PartialResult *>(partialResult)->getNumberOfColumns();
+
+    int unexpectedLayouts = packed_mask;
+    if (!checkNumericTable(get(locationEstimate).get(), this->_errors.get(), locationEstimateStr(), unexpectedLayouts, 0, nFeatures, 1)) { return; }
+    if (!checkNumericTable(get(scatterEstimate).get(), this->_errors.get(), scatterEstimateStr(), unexpectedLayouts, 0, nFeatures, 1)) { return; }
+}
+
 } // namespace interface1
 } // namespace univariate_outlier_detection
 } // namespace algorithms
@@ -0,0 +1,87 @@
+/* file: outlier_detection_univariate_partial_result.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the allocation of partial results and estimates
+//  of the univariate outlier detection algorithm in the online and distributed processing modes
+//--
+*/
+
+#ifndef __OUTLIERDETECTION_UNIVARIATE_PARTIAL_RESULT_H__
+#define __OUTLIERDETECTION_UNIVARIATE_PARTIAL_RESULT_H__
+
+#include "outlier_detection_univariate_types.h"
+#include "quantiles_kernel.h"
+
+#define __UNIVAR_OUTLIERDETECTION_SKETCH_EPSILON 0.001   // Bound of the rank error of the quantile sketches of the features.
+
+namespace daal
+{
+namespace algorithms
+{
+namespace univariate_outlier_detection
+{
+namespace interface1
+{
+
+/**
+ * Allocates memory to store partial results of the univariate outlier detection algorithm
+ * \param[in] input     Pointer to the structure with input objects
+ * \param[in] parameter Pointer to the structure of algorithm parameters
+ * \param[in] method    Computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT void PartialResult::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    size_t nFeatures = static_cast<const InputIface *>(input)->getNumberOfColumns();
+
+    Argument::set(nObservations, data_management::SerializationIfacePtr(
+                      new data_management::HomogenNumericTable<size_t>(1, 1, data_management::NumericTable::doAllocate)));
+    Argument::set(sketchItems, data_management::SerializationIfacePtr(
+                      new data_management::HomogenNumericTable<algorithmFPType>(
+                          quantiles::internal::getSketchCapacity(__UNIVAR_OUTLIERDETECTION_SKETCH_EPSILON), nFeatures,
+                          data_management::NumericTable::doAllocate)));
+    Argument::set(sketchLevels, data_management::SerializationIfacePtr(
+                      new data_management::HomogenNumericTable<int>(quantiles::internal::sketchLevelsStride, nFeatures,
+                                                                    data_management::NumericTable::doAllocate)));
+}
+
+/**
+ * Allocates memory to store the estimates of the univariate outlier detection algorithm
+ * in the online or distributed processing mode
+ * \param[in] partialResult Pointer to the partial results of the algorithm
+ * \param[in] parameter     Pointer to the parameters of the algorithm
+ * \param[in] method        univariate outlier detection computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT void Result::allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method)
+{
+    size_t nFeatures = static_cast<const PartialResult *>(partialResult)->getNumberOfColumns();
+
+    Argument::set(locationEstimate, data_management::SerializationIfacePtr(
+                      new data_management::HomogenNumericTable<algorithmFPType>(nFeatures, 1, data_management::NumericTable::doAllocate)));
+    Argument::set(scatterEstimate, data_management::SerializationIfacePtr(
+                      new data_management::HomogenNumericTable<algorithmFPType>(nFeatures, 1, data_management::NumericTable::doAllocate)));
+}
+
+} // namespace interface1
+} // namespace univariate_outlier_detection
+} // namespace algorithms
+} // namespace daal
+
+#endif
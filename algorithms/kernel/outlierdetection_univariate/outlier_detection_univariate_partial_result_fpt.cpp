@@ -0,0 +1,42 @@
+/* file: outlier_detection_univariate_partial_result_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Instantiation of the allocation of partial results and estimates
+//  of the univariate outlier detection algorithm
+//--
+*/
+
+#include "outlier_detection_univariate_partial_result.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace univariate_outlier_detection
+{
+namespace interface1
+{
+
+template DAAL_EXPORT void PartialResult::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+template DAAL_EXPORT void Result::allocate<DAAL_FPTYPE>(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method);
+
+} // namespace interface1
+} // namespace univariate_outlier_detection
+} // namespace algorithms
+} // namespace daal
@@ -50,11 +50,15 @@ void BatchContainer<algorithmFPType, method, cpu>::compute()
     Result *result = static_cast<Result *>(_res);
 
     NumericTable *a = static_cast<NumericTable *>(input->get(data).get());
+    NumericTable *locationTable  = input->get(location).get();
+    NumericTable *scatterTable   = input->get(scatter).get();
+    NumericTable *thresholdTable = input->get(threshold).get();
     NumericTable *r = static_cast<NumericTable *>(result->get(weights).get());
     daal::algorithms::Parameter *par = _par;
 
     daal::services::Environment::env &env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::OutlierDetectionKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, a, r, par);
+    __DAAL_CALL_KERNEL(env, internal::OutlierDetectionKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+                       a, locationTable, scatterTable, thresholdTable, r, par);
 }
 
 } // namespace univariate_outlier_detection
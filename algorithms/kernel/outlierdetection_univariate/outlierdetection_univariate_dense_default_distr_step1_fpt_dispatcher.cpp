@@ -0,0 +1,36 @@
+/* file: outlierdetection_univariate_dense_default_distr_step1_fpt_dispatcher.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of container for univariate outlier detection in the first step of the distributed processing mode.
+//--
+*/
+
+#include "outlierdetection_univariate_online_container.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace interface1
+{
+__DAAL_INSTANTIATE_DISPATCH_CONTAINER(univariate_outlier_detection::DistributedContainer, distributed, step1Local, DAAL_FPTYPE, univariate_outlier_detection::defaultDense)
+}
+} // namespace algorithms
+
+} // namespace daal
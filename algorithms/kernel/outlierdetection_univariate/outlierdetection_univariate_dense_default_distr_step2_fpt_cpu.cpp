@@ -0,0 +1,44 @@
+/* file: outlierdetection_univariate_dense_default_distr_step2_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of univariate outlier detection algorithm in the second step of the distributed processing mode.
+//--
+*/
+
+#include "outlierdetection_univariate_online_container.h"
+#include "outlierdetection_univariate_online_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace univariate_outlier_detection
+{
+namespace interface1
+{
+
+template class DistributedContainer<step2Master, DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+
+}
+
+} // namespace univariate_outlier_detection
+
+} // namespace algorithms
+
+} // namespace daal
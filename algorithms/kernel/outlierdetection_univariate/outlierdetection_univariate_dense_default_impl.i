@@ -48,7 +48,8 @@ namespace internal
 
 template <typename algorithmFPType, CpuType cpu>
 void OutlierDetectionKernel<algorithmFPType, defaultDense, cpu>::
-compute(const NumericTable *a, NumericTable *r, const daal::algorithms::Parameter *par)
+compute(const NumericTable *a, const NumericTable *location, const NumericTable *scatter, const NumericTable *threshold,
+        NumericTable *r, const daal::algorithms::Parameter *par)
 {
 
     /* Create micro-tables for input data and output results */
@@ -74,7 +75,18 @@ compute(const NumericTable *a, NumericTable *r, const daal::algorithms::Paramete
     services::SharedPtr<daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> > thresholdTable(
         new daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>(nFeatures, 1));
 
-    (*initProcedure)(const_cast<NumericTable *>(a), locationTable.get(), scatterTable.get(), thresholdTable.get());
+    /* Skip the initialization procedure if all its values are provided in the input */
+    if (!location || !scatter || !threshold)
+    {
+        (*initProcedure)(const_cast<NumericTable *>(a), locationTable.get(), scatterTable.get(), thresholdTable.get());
+    }
+    if (!overrideInitialValue(nFeatures, location,  locationTable->getArray()) ||
+        !overrideInitialValue(nFeatures, scatter,   scatterTable->getArray())  ||
+        !overrideInitialValue(nFeatures, threshold, thresholdTable->getArray()))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
 
     /* Allocate memory for storing intermediate results */
     algorithmFPType *invScatter = (algorithmFPType *)daal::services::daal_malloc(nFeatures * sizeof(algorithmFPType));
@@ -123,7 +123,25 @@ struct OutlierDetectionKernel<algorithmFPType, defaultDense, cpu> : public Kerne
 
     /** \brief Detect outliers in the data from input numeric table
                and store resulting weights into output numeric table */
-    void compute(const NumericTable *a, NumericTable *r, const daal::algorithms::Parameter *par);
+    void compute(const NumericTable *a, const NumericTable *location, const NumericTable *scatter, const NumericTable *threshold,
+                 NumericTable *r, const daal::algorithms::Parameter *par);
+
+    /** \brief Replace the values computed by the initialization procedure
+               with the values of the optional input numeric table,
+               return false if the values of the input numeric table cannot be read */
+    inline static bool overrideInitialValue(size_t nFeatures, const NumericTable *inputTable, algorithmFPType *values)
+    {
+        if (!inputTable) { return true; }
+
+        ReadRows<algorithmFPType, cpu> inputRows(const_cast<NumericTable *>(inputTable), 0, 1);
+        const algorithmFPType *inputValues = inputRows.get();
+        if (!inputValues) { return false; }
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            values[j] = inputValues[j];
+        }
+        return true;
+    }
 };
 
 } // namespace internal
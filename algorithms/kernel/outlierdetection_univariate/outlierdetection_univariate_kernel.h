@@ -44,7 +44,22 @@ namespace internal
 template <typename algorithmFPType, Method method, CpuType cpu>
 struct OutlierDetectionKernel : public Kernel
 {
-    void compute(const NumericTable *a, NumericTable *r, const daal::algorithms::Parameter *par);
+    void compute(const NumericTable *a, const NumericTable *location, const NumericTable *scatter, const NumericTable *threshold,
+                 NumericTable *r, const daal::algorithms::Parameter *par);
+};
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+struct OutlierDetectionOnlineKernel : public Kernel
+{
+    /** \brief Update the number of observations and the quantile sketches of the features
+               in the partial result with the data from input numeric table */
+    void compute(const NumericTable *a, NumericTable *nObservationsTable, NumericTable *itemsTable, NumericTable *levelsTable);
+
+    /** \brief Merge the collection of partial results computed on local nodes into the partial result */
+    void merge(DataCollection *partialResults, NumericTable *nObservationsTable, NumericTable *itemsTable, NumericTable *levelsTable);
+
+    /** \brief Compute the median and the interquartile range based scatter estimates from the quantile sketches */
+    void finalizeCompute(NumericTable *itemsTable, NumericTable *levelsTable, NumericTable *locationTable, NumericTable *scatterTable);
 };
 
 } // namespace internal
@@ -0,0 +1,174 @@
+/* file: outlierdetection_univariate_online_container.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of univariate outlier detection algorithm container
+//  in the online and distributed processing modes.
+//--
+*/
+
+#include "outlier_detection_univariate_online.h"
+#include "outlier_detection_univariate_distributed.h"
+#include "outlierdetection_univariate_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace univariate_outlier_detection
+{
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::OnlineContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::OutlierDetectionOnlineKernel, algorithmFPType, method);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::~OnlineContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+void OnlineContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input *input = static_cast<Input *>(_in);
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+
+    NumericTable *a                  = input->get(data).get();
+    NumericTable *nObservationsTable = partialResult->get(nObservations).get();
+    NumericTable *itemsTable         = partialResult->get(sketchItems).get();
+    NumericTable *levelsTable        = partialResult->get(sketchLevels).get();
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::OutlierDetectionOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+                       a, nObservationsTable, itemsTable, levelsTable);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+void OnlineContainer<algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    Result *result = static_cast<Result *>(_res);
+
+    NumericTable *itemsTable         = partialResult->get(sketchItems).get();
+    NumericTable *levelsTable        = partialResult->get(sketchLevels).get();
+    NumericTable *locationTable      = result->get(locationEstimate).get();
+    NumericTable *scatterTable       = result->get(scatterEstimate).get();
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::OutlierDetectionOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), finalizeCompute,
+                       itemsTable, levelsTable, locationTable, scatterTable);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::OutlierDetectionOnlineKernel, algorithmFPType, method);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step1Local, algorithmFPType, method, cpu>::compute()
+{
+    Input *input = static_cast<Input *>(_in);
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+
+    NumericTable *a                  = input->get(data).get();
+    NumericTable *nObservationsTable = partialResult->get(nObservations).get();
+    NumericTable *itemsTable         = partialResult->get(sketchItems).get();
+    NumericTable *levelsTable        = partialResult->get(sketchLevels).get();
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::OutlierDetectionOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+                       a, nObservationsTable, itemsTable, levelsTable);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step1Local, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    Result *result = static_cast<Result *>(_res);
+
+    NumericTable *itemsTable         = partialResult->get(sketchItems).get();
+    NumericTable *levelsTable        = partialResult->get(sketchLevels).get();
+    NumericTable *locationTable      = result->get(locationEstimate).get();
+    NumericTable *scatterTable       = result->get(scatterEstimate).get();
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::OutlierDetectionOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), finalizeCompute,
+                       itemsTable, levelsTable, locationTable, scatterTable);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::OutlierDetectionOnlineKernel, algorithmFPType, method);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step2Master, algorithmFPType, method, cpu>::compute()
+{
+    DistributedInput<step2Master> *input = static_cast<DistributedInput<step2Master> *>(_in);
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+
+    DataCollection *collection       = input->get(partialResults).get();
+    NumericTable *nObservationsTable = partialResult->get(nObservations).get();
+    NumericTable *itemsTable         = partialResult->get(sketchItems).get();
+    NumericTable *levelsTable        = partialResult->get(sketchLevels).get();
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::OutlierDetectionOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), merge,
+                       collection, nObservationsTable, itemsTable, levelsTable);
+
+    collection->clear();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step2Master, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    Result *result = static_cast<Result *>(_res);
+
+    NumericTable *itemsTable         = partialResult->get(sketchItems).get();
+    NumericTable *levelsTable        = partialResult->get(sketchLevels).get();
+    NumericTable *locationTable      = result->get(locationEstimate).get();
+    NumericTable *scatterTable       = result->get(scatterEstimate).get();
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::OutlierDetectionOnlineKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), finalizeCompute,
+                       itemsTable, levelsTable, locationTable, scatterTable);
+}
+
+} // namespace univariate_outlier_detection
+
+} // namespace algorithms
+
+} // namespace daal
@@ -0,0 +1,182 @@
+/* file: outlierdetection_univariate_online_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of univariate outlier detection in the online and distributed processing modes.
+//
+//  The partial result keeps the mergeable quantile sketch of every feature, the sketches
+//  of the quantiles algorithm. The partial results of the different blocks of the data set
+//  are merged by merging their sketches. The location estimate is the median of the feature,
+//  the scatter estimate is the interquartile range scaled to the standard deviation
+//  of the normal distribution, so the estimates are robust to the outliers themselves.
+//--
+*/
+
+#ifndef __UNIVAR_OUTLIERDETECTION_ONLINE_IMPL_I__
+#define __UNIVAR_OUTLIERDETECTION_ONLINE_IMPL_I__
+
+#include "numeric_table.h"
+#include "outlier_detection_univariate_types.h"
+
+#include "service_numeric_table.h"
+#include "service_memory.h"
+#include "threading.h"
+#include "quantiles_kernel.h"
+#include "quantiles_sketch_impl.i"
+
+#include "outlierdetection_univariate_kernel.h"
+
+/* Ratio of the interquartile range to the standard deviation of the normal distribution */
+#define __UNIVAR_OUTLIERDETECTION_IQR_TO_SIGMA 1.3489795003921635
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace univariate_outlier_detection
+{
+namespace internal
+{
+
+namespace sketch = daal::algorithms::quantiles::internal;
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+void OutlierDetectionOnlineKernel<algorithmFPType, method, cpu>::compute(const NumericTable *a, NumericTable *nObservationsTable,
+                                                                         NumericTable *itemsTable, NumericTable *levelsTable)
+{
+    const size_t nFeatures = a->getNumberOfColumns();
+    const size_t capacity = itemsTable->getNumberOfColumns();
+
+    WriteRows<algorithmFPType, cpu> itemsRows(itemsTable, 0, nFeatures);
+    WriteRows<int, cpu> levelsRows(levelsTable, 0, nFeatures);
+    WriteRows<double, cpu> nObservationsRows(nObservationsTable, 0, 1);
+    if (!itemsRows.get() || !levelsRows.get() || !nObservationsRows.get())
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    if (!sketch::updateSketches<algorithmFPType, cpu>(*a, capacity, itemsRows.get(), levelsRows.get()))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    nObservationsRows.get()[0] += (double)a->getNumberOfRows();
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+void OutlierDetectionOnlineKernel<algorithmFPType, method, cpu>::merge(DataCollection *partialResults, NumericTable *nObservationsTable,
+                                                                       NumericTable *itemsTable, NumericTable *levelsTable)
+{
+    const size_t nFeatures = itemsTable->getNumberOfRows();
+    const size_t capacity = itemsTable->getNumberOfColumns();
+
+    WriteRows<algorithmFPType, cpu> itemsRows(itemsTable, 0, nFeatures);
+    WriteRows<int, cpu> levelsRows(levelsTable, 0, nFeatures);
+    WriteRows<double, cpu> nObservationsRows(nObservationsTable, 0, 1);
+    algorithmFPType * const items = itemsRows.get();
+    int * const levels = levelsRows.get();
+    if (!items || !levels || !nObservationsRows.get())
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    for (size_t i = 0; i < partialResults->size(); i++)
+    {
+        PartialResult * const localPartialResult = static_cast<PartialResult *>((*partialResults)[i].get());
+        NumericTable * const srcItemsTable = localPartialResult->get(sketchItems).get();
+        const size_t srcCapacity = srcItemsTable->getNumberOfColumns();
+
+        ReadRows<algorithmFPType, cpu> srcItemsRows(srcItemsTable, 0, nFeatures);
+        ReadRows<int, cpu> srcLevelsRows(localPartialResult->get(sketchLevels).get(), 0, nFeatures);
+        ReadRows<double, cpu> srcNObservationsRows(localPartialResult->get(nObservations).get(), 0, 1);
+        const algorithmFPType * const srcItems = srcItemsRows.get();
+        const int * const srcLevels = srcLevelsRows.get();
+        if (!srcItems || !srcLevels || !srcNObservationsRows.get())
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+
+        bool isOk = true;
+        daal::threader_for(nFeatures, nFeatures, [=, &isOk](size_t j)
+        {
+            if (!sketch::mergeSketch<algorithmFPType, cpu>(items + j * capacity, levels + j * sketch::sketchLevelsStride, capacity,
+                                                           srcItems + j * srcCapacity, srcLevels + j * sketch::sketchLevelsStride,
+                                                           srcCapacity))
+            {
+                isOk = false;
+            }
+        } );
+        if (!isOk)
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+        nObservationsRows.get()[0] += srcNObservationsRows.get()[0];
+    }
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+void OutlierDetectionOnlineKernel<algorithmFPType, method, cpu>::finalizeCompute(NumericTable *itemsTable, NumericTable *levelsTable,
+                                                                                 NumericTable *locationTable, NumericTable *scatterTable)
+{
+    const size_t nFeatures = itemsTable->getNumberOfRows();
+    const size_t capacity = itemsTable->getNumberOfColumns();
+
+    /* The first, the second and the third quartiles of every feature */
+    const size_t nOrders = 3;
+    const algorithmFPType orders[nOrders] = { (algorithmFPType)0.25, (algorithmFPType)0.5, (algorithmFPType)0.75 };
+
+    ReadRows<algorithmFPType, cpu> itemsRows(itemsTable, 0, nFeatures);
+    ReadRows<int, cpu> levelsRows(levelsTable, 0, nFeatures);
+    WriteOnlyRows<algorithmFPType, cpu> locationRows(locationTable, 0, 1);
+    WriteOnlyRows<algorithmFPType, cpu> scatterRows(scatterTable, 0, 1);
+    TArray<algorithmFPType, cpu> quartilesArray(nFeatures * nOrders);
+    algorithmFPType * const locationArray = locationRows.get();
+    algorithmFPType * const scatterArray = scatterRows.get();
+    algorithmFPType * const quartiles = quartilesArray.get();
+    if (!itemsRows.get() || !levelsRows.get() || !locationArray || !scatterArray || !quartiles ||
+        !sketch::computeQuantiles<algorithmFPType, cpu>(nFeatures, capacity, itemsRows.get(), levelsRows.get(), nOrders, orders, quartiles))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    const algorithmFPType invIqrToSigma = (algorithmFPType)(1.0 / __UNIVAR_OUTLIERDETECTION_IQR_TO_SIGMA);
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        const algorithmFPType *featureQuartiles = quartiles + j * nOrders;
+        locationArray[j] = featureQuartiles[1];
+        scatterArray[j]  = (featureQuartiles[2] - featureQuartiles[0]) * invIqrToSigma;
+    }
+}
+
+} // namespace internal
+
+} // namespace univariate_outlier_detection
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
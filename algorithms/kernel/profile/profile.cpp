@@ -0,0 +1,186 @@
+/* file: profile.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the profile algorithm and types methods.
+//--
+*/
+
+#include "profile_types.h"
+#include "serialization_utils.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace profile
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_PROFILE_RESULT_ID);
+
+Parameter::Parameter(DAAL_UINT64 resultsToCompute, const NumericTablePtr quantileOrders, double epsilon) :
+    daal::algorithms::Parameter(), resultsToCompute(resultsToCompute), quantileOrders(quantileOrders), epsilon(epsilon)
+{
+    if (quantileOrders.get() == NULL)
+    {
+        this->quantileOrders = NumericTablePtr(new HomogenNumericTable<double>(1, 1, NumericTableIface::doAllocate, 0.5));
+    }
+}
+
+/**
+ * Checks the parameters of the profile algorithm
+ */
+void Parameter::check() const
+{
+    DAAL_CHECK_EX(resultsToCompute != 0 && (resultsToCompute & ~(DAAL_UINT64)computeAll) == 0, ErrorIncorrectParameter,
+                  ParameterName, resultsToComputeStr());
+    if (resultsToCompute & computeQuantiles)
+    {
+        DAAL_CHECK_EX(epsilon > 0 && epsilon < 1, ErrorIncorrectParameter, ParameterName, epsilonStr());
+        if (!checkNumericTable(quantileOrders.get(), this->_errors.get(), quantileOrdersStr(), 0, 0, 0, 1)) { return; }
+    }
+}
+
+Input::Input() : InputIface(1) {}
+
+/**
+ * Returns the number of features in the input data set
+ * \return Number of features
+ */
+size_t Input::getNumberOfColumns() const
+{
+    NumericTablePtr dataTable = get(data);
+    if (!checkNumericTable(dataTable.get(), this->_errors.get(), dataStr())) { return 0; }
+    return dataTable->getNumberOfColumns();
+}
+
+/**
+ * Returns an input object for the profile algorithm
+ * \param[in] id    Identifier of the %input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+NumericTablePtr Input::get(InputId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the input object of the profile algorithm
+ * \param[in] id    Identifier of the %input object
+ * \param[in] ptr   Pointer to the input object
+ */
+void Input::set(InputId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Checks the correctness of the %Input object
+ * \param[in] parameter Pointer to the parameters structure
+ * \param[in] method    Algorithm computation method
+ */
+void Input::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    if (!checkNumericTable(get(data).get(), this->_errors.get(), dataStr())) { return; }
+}
+
+Result::Result() : daal::algorithms::Result(8) {}
+
+/**
+ * Returns the final result of the profile algorithm
+ * \param[in] id   Identifier of the final result, \ref ResultId
+ * \return         Final result that corresponds to the given identifier
+ */
+NumericTablePtr Result::get(ResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the Result object of the profile algorithm
+ * \param[in] id        Identifier of the Result object
+ * \param[in] value     Pointer to the Result object
+ */
+void Result::set(ResultId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the correctness of the Result object
+ * \param[in] in     Pointer to the object
+ * \param[in] par    Pointer to the parameters structure
+ * \param[in] method Algorithm computation method
+ */
+void Result::check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const
+{
+    const Input *input = static_cast<const Input *>(in);
+    checkImpl(input->get(data)->getNumberOfColumns(), static_cast<const Parameter *>(par));
+}
+
+/**
+ * Checks the correctness of the Result object in the online and distributed processing modes
+ * \param[in] pres   Pointer to the partial results
+ * \param[in] par    Pointer to the parameters structure
+ * \param[in] method Algorithm computation method
+ */
+void Result::check(const daal::algorithms::PartialResult *pres, const daal::algorithms::Parameter *par, int method) const
+{
+    const PartialResult *partialResult = static_cast<const PartialResult *>(pres);
+    checkImpl(partialResult->getNumberOfColumns(), static_cast<const Parameter *>(par));
+}
+
+void Result::checkImpl(size_t nFeatures, const Parameter *parameter) const
+{
+    const DAAL_UINT64 resultsToCompute = parameter->resultsToCompute;
+    int unexpectedLayouts = (int)packed_mask;
+
+    if (resultsToCompute & computeMinMax)
+    {
+        if (!checkNumericTable(get(minimum).get(), this->_errors.get(), minimumStr(), unexpectedLayouts, 0, nFeatures, 1)) { return; }
+        if (!checkNumericTable(get(maximum).get(), this->_errors.get(), maximumStr(), unexpectedLayouts, 0, nFeatures, 1)) { return; }
+    }
+    if (resultsToCompute & computeMoments)
+    {
+        if (!checkNumericTable(get(sum).get(), this->_errors.get(), sumStr(), unexpectedLayouts, 0, nFeatures, 1)) { return; }
+        if (!checkNumericTable(get(mean).get(), this->_errors.get(), meanStr(), unexpectedLayouts, 0, nFeatures, 1)) { return; }
+        if (!checkNumericTable(get(variance).get(), this->_errors.get(), varianceStr(), unexpectedLayouts, 0, nFeatures, 1)) { return; }
+        if (!checkNumericTable(get(standardDeviation).get(), this->_errors.get(), standardDeviationStr(), unexpectedLayouts, 0,
+                               nFeatures, 1)) { return; }
+    }
+    if (resultsToCompute & computeCovariance)
+    {
+        if (!checkNumericTable(get(covariance).get(), this->_errors.get(), covarianceStr(), unexpectedLayouts, 0, nFeatures,
+                               nFeatures)) { return; }
+    }
+    if (resultsToCompute & computeQuantiles)
+    {
+        const size_t nQuantileOrders = parameter->quantileOrders->getNumberOfColumns();
+        if (!checkNumericTable(get(quantiles).get(), this->_errors.get(), quantilesStr(), unexpectedLayouts, 0, nQuantileOrders,
+                               nFeatures)) { return; }
+    }
+}
+
+}// namespace interface1
+}// namespace profile
+}// namespace algorithms
+}// namespace daal
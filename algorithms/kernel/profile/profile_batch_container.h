@@ -0,0 +1,69 @@
+/* file: profile_batch_container.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the profile algorithm container in the batch processing mode.
+//--
+*/
+
+#ifndef __PROFILE_BATCH_CONTAINER_H__
+#define __PROFILE_BATCH_CONTAINER_H__
+
+#include "profile_batch.h"
+#include "profile_kernel.h"
+#include "kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace profile
+{
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::ProfileKernel, method, algorithmFPType);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void BatchContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input *input = static_cast<Input *>(_in);
+    Result *result = static_cast<Result *>(_res);
+    Parameter *par = static_cast<Parameter *>(_par);
+
+    NumericTable *dataTable = input->get(data).get();
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::ProfileKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, dataTable, result, par);
+}
+
+} // namespace daal::algorithms::profile
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,122 @@
+/* file: profile_distributed_container.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the profile algorithm container in the distributed processing mode.
+//--
+*/
+
+#ifndef __PROFILE_DISTRIBUTED_CONTAINER_H__
+#define __PROFILE_DISTRIBUTED_CONTAINER_H__
+
+#include "profile_distributed.h"
+#include "profile_kernel.h"
+#include "kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace profile
+{
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::ProfileOnlineKernel, method, algorithmFPType);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step1Local, algorithmFPType, method, cpu>::compute()
+{
+    Input *input = static_cast<Input *>(_in);
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    Parameter *par = static_cast<Parameter *>(_par);
+
+    NumericTable *dataTable = input->get(data).get();
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::ProfileOnlineKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute,
+                       dataTable, partialResult, par);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step1Local, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    Result *result = static_cast<Result *>(_res);
+    Parameter *par = static_cast<Parameter *>(_par);
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::ProfileOnlineKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), finalizeCompute,
+                       partialResult, result, par);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::ProfileDistributedKernel, method, algorithmFPType);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step2Master, algorithmFPType, method, cpu>::compute()
+{
+    DistributedInput<step2Master> *input = static_cast<DistributedInput<step2Master> *>(_in);
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    Parameter *par = static_cast<Parameter *>(_par);
+
+    data_management::DataCollection *collection = input->get(partialResults).get();
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::ProfileDistributedKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute,
+                       collection, partialResult, par);
+
+    collection->clear();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step2Master, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    Result *result = static_cast<Result *>(_res);
+    Parameter *par = static_cast<Parameter *>(_par);
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::ProfileDistributedKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), finalizeCompute,
+                       partialResult, result, par);
+}
+
+} // namespace daal::algorithms::profile
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
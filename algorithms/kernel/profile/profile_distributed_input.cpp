@@ -0,0 +1,116 @@
+/* file: profile_distributed_input.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the input of the profile algorithm on the second step in the distributed processing mode.
+//--
+*/
+
+#include "profile_types.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace profile
+{
+namespace interface1
+{
+
+DistributedInput<step2Master>::DistributedInput() : InputIface(1)
+{
+    Argument::set(partialResults, DataCollectionPtr(new DataCollection()));
+}
+
+/**
+ * Returns the number of features in the input data set
+ * \return Number of features
+ */
+size_t DistributedInput<step2Master>::getNumberOfColumns() const
+{
+    DataCollectionPtr collection = get(partialResults);
+    if (!collection) { this->_errors->add(ErrorNullInputDataCollection); return 0; }
+    if (collection->size() == 0) { this->_errors->add(ErrorIncorrectNumberOfInputNumericTables); return 0; }
+
+    PartialResultPtr partialResult = PartialResult::cast((*collection)[0]);
+    if (!partialResult) { this->_errors->add(ErrorIncorrectElementInPartialResultCollection); return 0; }
+    return partialResult->getNumberOfColumns();
+}
+
+/**
+ * Adds the partial result computed on a local node to the collection of input objects
+ * \param[in] id            Identifier of the input object
+ * \param[in] partialResult Partial result of the first step
+ */
+void DistributedInput<step2Master>::add(MasterInputId id, const SharedPtr<PartialResult> &partialResult)
+{
+    DataCollectionPtr collection = get(id);
+    collection->push_back(staticPointerCast<SerializationIface, PartialResult>(partialResult));
+}
+
+/**
+ * Sets the collection of input objects
+ * \param[in] id    Identifier of the input object
+ * \param[in] ptr   Pointer to the collection of partial results
+ */
+void DistributedInput<step2Master>::set(MasterInputId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Returns the collection of input objects
+ * \param[in] id    Identifier of the input object
+ * \return          Collection of partial results
+ */
+DataCollectionPtr DistributedInput<step2Master>::get(MasterInputId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Checks the correctness of the input objects
+ * \param[in] parameter Pointer to the parameters structure
+ * \param[in] method    Algorithm computation method
+ */
+void DistributedInput<step2Master>::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    DataCollectionPtr collection = get(partialResults);
+    if (!collection) { this->_errors->add(ErrorNullInputDataCollection); return; }
+    if (collection->size() == 0) { this->_errors->add(ErrorIncorrectNumberOfInputNumericTables); return; }
+
+    const size_t nFeatures = getNumberOfColumns();
+    if (this->_errors->size() != 0) { return; }
+
+    /* The partial results of the local nodes are required to contain the statistics requested on the master node */
+    const DAAL_UINT64 resultsToCompute = static_cast<const Parameter *>(parameter)->resultsToCompute;
+    for (size_t i = 0; i < collection->size(); i++)
+    {
+        PartialResultPtr partialResult = PartialResult::cast((*collection)[i]);
+        if (!partialResult) { this->_errors->add(ErrorIncorrectElementInPartialResultCollection); return; }
+        if (!partialResult->checkImpl(nFeatures, resultsToCompute, this->_errors.get())) { return; }
+    }
+}
+
+} // namespace interface1
+} // namespace profile
+} // namespace algorithms
+} // namespace daal
@@ -0,0 +1,149 @@
+/* file: profile_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the allocation of the results of the profile algorithm.
+//--
+*/
+
+#include "profile_types.h"
+#include "quantiles_kernel.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace profile
+{
+namespace interface1
+{
+/**
+ * Allocates memory to store final results of the profile algorithm
+ * \param[in] input     Input objects for the profile algorithm
+ * \param[in] parameter Parameters of the profile algorithm
+ * \param[in] method    Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT void Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const Input *in = static_cast<const Input *>(input);
+    allocateImpl<algorithmFPType>(in->get(data)->getNumberOfColumns(), static_cast<const Parameter *>(parameter));
+}
+
+/**
+ * Allocates memory to store final results of the profile algorithm in the online and distributed processing modes
+ * \param[in] partialResult Partial results of the profile algorithm
+ * \param[in] parameter     Parameters of the profile algorithm
+ * \param[in] method        Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT void Result::allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter,
+                                  const int method)
+{
+    const PartialResult *pres = static_cast<const PartialResult *>(partialResult);
+    allocateImpl<algorithmFPType>(pres->getNumberOfColumns(), static_cast<const Parameter *>(parameter));
+}
+
+template <typename algorithmFPType>
+void Result::allocateImpl(size_t nFeatures, const Parameter *parameter)
+{
+    const DAAL_UINT64 resultsToCompute = parameter->resultsToCompute;
+    if (resultsToCompute & computeMinMax)
+    {
+        Argument::set(minimum, SerializationIfacePtr(new HomogenNumericTable<algorithmFPType>(nFeatures, 1, NumericTable::doAllocate)));
+        Argument::set(maximum, SerializationIfacePtr(new HomogenNumericTable<algorithmFPType>(nFeatures, 1, NumericTable::doAllocate)));
+    }
+    if (resultsToCompute & computeMoments)
+    {
+        const ResultId ids[] = { sum, mean, variance, standardDeviation };
+        for (size_t i = 0; i < sizeof(ids) / sizeof(ids[0]); i++)
+        {
+            Argument::set(ids[i], SerializationIfacePtr(new HomogenNumericTable<algorithmFPType>(nFeatures, 1, NumericTable::doAllocate)));
+        }
+    }
+    if (resultsToCompute & computeCovariance)
+    {
+        Argument::set(covariance, SerializationIfacePtr(
+                          new HomogenNumericTable<algorithmFPType>(nFeatures, nFeatures, NumericTable::doAllocate)));
+    }
+    if (resultsToCompute & computeQuantiles)
+    {
+        const size_t nQuantileOrders = parameter->quantileOrders->getNumberOfColumns();
+        Argument::set(quantiles, SerializationIfacePtr(
+                          new HomogenNumericTable<algorithmFPType>(nQuantileOrders, nFeatures, NumericTable::doAllocate)));
+    }
+}
+
+/**
+ * Allocates memory to store the partial results of the profile algorithm
+ * \param[in] input     Input objects for the profile algorithm
+ * \param[in] parameter Parameters of the profile algorithm
+ * \param[in] method    Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT void PartialResult::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+    const DAAL_UINT64 resultsToCompute = par->resultsToCompute;
+    const size_t nFeatures = static_cast<const InputIface *>(input)->getNumberOfColumns();
+
+    Argument::set(nObservations, SerializationIfacePtr(new HomogenNumericTable<size_t>(1, 1, NumericTable::doAllocate)));
+    if (resultsToCompute & computeMinMax)
+    {
+        Argument::set(partialMinimum, SerializationIfacePtr(
+                          new HomogenNumericTable<algorithmFPType>(nFeatures, 1, NumericTable::doAllocate)));
+        Argument::set(partialMaximum, SerializationIfacePtr(
+                          new HomogenNumericTable<algorithmFPType>(nFeatures, 1, NumericTable::doAllocate)));
+    }
+    if (resultsToCompute & (computeMoments | computeCovariance))
+    {
+        Argument::set(partialSum, SerializationIfacePtr(new HomogenNumericTable<algorithmFPType>(nFeatures, 1, NumericTable::doAllocate)));
+    }
+    if (resultsToCompute & computeMoments)
+    {
+        Argument::set(partialSumSquaresCentered, SerializationIfacePtr(
+                          new HomogenNumericTable<algorithmFPType>(nFeatures, 1, NumericTable::doAllocate)));
+    }
+    if (resultsToCompute & computeCovariance)
+    {
+        Argument::set(partialCrossProduct, SerializationIfacePtr(
+                          new HomogenNumericTable<algorithmFPType>(nFeatures, nFeatures, NumericTable::doAllocate)));
+    }
+    if (resultsToCompute & computeQuantiles)
+    {
+        const size_t capacity = quantiles::internal::getSketchCapacity(par->epsilon);
+        Argument::set(sketchItems, SerializationIfacePtr(
+                          new HomogenNumericTable<algorithmFPType>(capacity, nFeatures, NumericTable::doAllocate)));
+        Argument::set(sketchLevels, SerializationIfacePtr(
+                          new HomogenNumericTable<int>(quantiles::internal::sketchLevelsStride, nFeatures, NumericTable::doAllocate)));
+    }
+    initialize(input, parameter, method);
+}
+
+template DAAL_EXPORT void Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method);
+template DAAL_EXPORT void Result::allocate<DAAL_FPTYPE>(const daal::algorithms::PartialResult *partialResult,
+                                                        const daal::algorithms::Parameter *par, const int method);
+template DAAL_EXPORT void PartialResult::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input,
+                                                               const daal::algorithms::Parameter *par, const int method);
+
+}// namespace interface1
+}// namespace profile
+}// namespace algorithms
+}// namespace daal
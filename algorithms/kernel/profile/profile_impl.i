@@ -0,0 +1,660 @@
+/* file: profile_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the profile algorithm.
+//
+//  The observations are read once in blocks of rows processed by the parallel
+//  tasks. The statistics of the block are computed while the block is in cache:
+//  the minimum and maximum, the sums, the sums of squares and the cross product
+//  centered at the means of the block. The statistics of the block are merged
+//  into the statistics of the thread with the pairwise update formulas
+//
+//      S2 = S2a + S2b + delta * delta' * na * nb / (na + nb),
+//
+//  where delta is the difference of the means of the two sets of observations.
+//  The observations of the block are inserted into the quantile sketches of the
+//  thread. The statistics of the threads are merged with the same formulas at
+//  the end of the pass, and so are the partial results in the online and
+//  distributed processing modes.
+//--
+*/
+
+#ifndef __PROFILE_IMPL_I__
+#define __PROFILE_IMPL_I__
+
+#include "service_numeric_table.h"
+#include "service_memory.h"
+#include "service_math.h"
+#include "service_blas.h"
+#include "threading.h"
+#include "quantiles_kernel.h"
+#include "quantiles_sketch_impl.i"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace profile
+{
+namespace internal
+{
+
+namespace sketch = daal::algorithms::quantiles::internal;
+
+/*
+ * Statistics of a set of observations. The pointers to the statistics that are not computed are null.
+ * Only the lower triangle of the cross product is valid
+ */
+template<typename algorithmFPType>
+struct ProfileData
+{
+    ProfileData() : nObservations(nullptr), minimum(nullptr), maximum(nullptr), sum(nullptr), sumSquaresCentered(nullptr),
+        crossProduct(nullptr), items(nullptr), levels(nullptr), capacity(0) {}
+
+    double *nObservations;
+    algorithmFPType *minimum;
+    algorithmFPType *maximum;
+    algorithmFPType *sum;
+    algorithmFPType *sumSquaresCentered;
+    algorithmFPType *crossProduct;
+    algorithmFPType *items;         /* Quantile sketches of the features */
+    int *levels;                    /* Boundaries of the levels of the quantile sketches */
+    size_t capacity;                /* Number of the items of the sketch of one feature */
+};
+
+/* Initializes the statistics of the empty set of observations */
+template<typename algorithmFPType, CpuType cpu>
+void clearProfile(size_t nFeatures, ProfileData<algorithmFPType> &dst)
+{
+    *dst.nObservations = 0;
+    algorithmFPType * const arrays[] = { dst.minimum, dst.maximum, dst.sum, dst.sumSquaresCentered };
+    for (size_t a = 0; a < sizeof(arrays) / sizeof(arrays[0]); a++)
+    {
+        if (!arrays[a]) { continue; }
+        for (size_t j = 0; j < nFeatures; j++) { arrays[a][j] = 0; }
+    }
+    if (dst.crossProduct)
+    {
+        for (size_t j = 0; j < nFeatures * nFeatures; j++) { dst.crossProduct[j] = 0; }
+    }
+    if (dst.items)
+    {
+        sketch::clearSketches<algorithmFPType, cpu>(nFeatures, dst.capacity, dst.items, dst.levels);
+    }
+}
+
+/*
+ * Merges the statistics of the set of observations src into the statistics dst.
+ * delta is the buffer of size nFeatures for the differences of the means
+ */
+template<typename algorithmFPType, CpuType cpu>
+bool mergeProfile(size_t nFeatures, ProfileData<algorithmFPType> &dst, const ProfileData<algorithmFPType> &src, algorithmFPType *delta)
+{
+    const double nA = *dst.nObservations;
+    const double nB = *src.nObservations;
+
+    if (dst.items)
+    {
+        bool isOk = true;
+        daal::threader_for(nFeatures, nFeatures, [=, &isOk](size_t j)
+        {
+            if (!sketch::mergeSketch<algorithmFPType, cpu>(dst.items + j * dst.capacity, dst.levels + j * sketch::sketchLevelsStride,
+                                                           dst.capacity, src.items + j * src.capacity,
+                                                           src.levels + j * sketch::sketchLevelsStride, src.capacity))
+            {
+                isOk = false;
+            }
+        } );
+        if (!isOk) { return false; }
+    }
+    if (nB == 0) { return true; }
+
+    if (dst.minimum)
+    {
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            if (nA == 0 || src.minimum[j] < dst.minimum[j]) { dst.minimum[j] = src.minimum[j]; }
+            if (nA == 0 || src.maximum[j] > dst.maximum[j]) { dst.maximum[j] = src.maximum[j]; }
+        }
+    }
+
+    if (dst.sum)
+    {
+        if (nA == 0)
+        {
+            for (size_t j = 0; j < nFeatures; j++) { delta[j] = 0; }
+        }
+        else
+        {
+            for (size_t j = 0; j < nFeatures; j++) { delta[j] = src.sum[j] / nB - dst.sum[j] / nA; }
+        }
+        const algorithmFPType coeff = (algorithmFPType)(nA * nB / (nA + nB));
+
+        if (dst.sumSquaresCentered)
+        {
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                dst.sumSquaresCentered[j] += src.sumSquaresCentered[j] + coeff * delta[j] * delta[j];
+            }
+        }
+        if (dst.crossProduct)
+        {
+            for (size_t i = 0; i < nFeatures; i++)
+            {
+                algorithmFPType * const dstRow = dst.crossProduct + i * nFeatures;
+                const algorithmFPType * const srcRow = src.crossProduct + i * nFeatures;
+                const algorithmFPType coeffDelta = coeff * delta[i];
+               PRAGMA_IVDEP
+               PRAGMA_VECTOR_ALWAYS
+                for (size_t k = 0; k <= i; k++) { dstRow[k] += srcRow[k] + coeffDelta * delta[k]; }
+            }
+        }
+        for (size_t j = 0; j < nFeatures; j++) { dst.sum[j] += src.sum[j]; }
+    }
+
+    *dst.nObservations = nA + nB;
+    return true;
+}
+
+/* Fills the upper triangle of the cross product from the lower one */
+template<typename algorithmFPType, CpuType cpu>
+void symmetrizeCrossProduct(size_t nFeatures, algorithmFPType *crossProduct)
+{
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        for (size_t k = 0; k < i; k++) { crossProduct[k * nFeatures + i] = crossProduct[i * nFeatures + k]; }
+    }
+}
+
+/* Statistics of the observations processed by one thread and the buffers for the statistics of one block */
+template<typename algorithmFPType, CpuType cpu>
+class ProfileThreadData
+{
+public:
+    ProfileThreadData(size_t nFeatures, DAAL_UINT64 resultsToCompute, size_t capacity) :
+        _nFeatures(nFeatures), _nObservations(0), _blockNObservations(0), _isValid(true)
+    {
+        const bool needMinMax  = (resultsToCompute & computeMinMax) != 0;
+        const bool needMoments = (resultsToCompute & computeMoments) != 0;
+        const bool needCovariance = (resultsToCompute & computeCovariance) != 0;
+        const bool needQuantiles = (resultsToCompute & computeQuantiles) != 0;
+
+        _data.nObservations = &_nObservations;
+        _block.nObservations = &_blockNObservations;
+        if (needMinMax)
+        {
+            _data.minimum  = allocate(_minimum,  nFeatures);
+            _data.maximum  = allocate(_maximum,  nFeatures);
+            _block.minimum = allocate(_blockMinimum, nFeatures);
+            _block.maximum = allocate(_blockMaximum, nFeatures);
+        }
+        if (needMoments || needCovariance)
+        {
+            _data.sum  = allocate(_sum, nFeatures);
+            _block.sum = allocate(_blockSum, nFeatures);
+            allocate(_delta, nFeatures);
+        }
+        if (needMoments)
+        {
+            _data.sumSquaresCentered  = allocate(_sumSquaresCentered, nFeatures);
+            _block.sumSquaresCentered = allocate(_blockSumSquaresCentered, nFeatures);
+        }
+        if (needCovariance)
+        {
+            _data.crossProduct  = allocate(_crossProduct, nFeatures * nFeatures);
+            _block.crossProduct = allocate(_blockCrossProduct, nFeatures * nFeatures);
+            allocate(_centeredBlock, nFeatures * __PROFILE_BLOCK_SIZE);
+        }
+        if (needQuantiles)
+        {
+            _data.items = allocate(_items, nFeatures * capacity);
+            _data.levels = allocate(_levels, nFeatures * sketch::sketchLevelsStride);
+            _data.capacity = capacity;
+            allocate(_column, __PROFILE_BLOCK_SIZE);
+            allocate(_scratch, capacity / 2 + 1);
+        }
+        if (_isValid) { clearProfile<algorithmFPType, cpu>(nFeatures, _data); }
+    }
+
+    bool isValid() const { return _isValid; }
+    void setInvalid() { _isValid = false; }
+
+    const ProfileData<algorithmFPType> &getData() const { return _data; }
+
+    /* Updates the statistics of the thread with the block of nRows observations */
+    void update(const algorithmFPType *block, size_t nRows)
+    {
+        const size_t p = _nFeatures;
+        _blockNObservations = (double)nRows;
+
+        if (_block.minimum)
+        {
+            for (size_t j = 0; j < p; j++) { _block.minimum[j] = _block.maximum[j] = block[j]; }
+            for (size_t i = 1; i < nRows; i++)
+            {
+                const algorithmFPType * const row = block + i * p;
+               PRAGMA_IVDEP
+               PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < p; j++)
+                {
+                    _block.minimum[j] = (row[j] < _block.minimum[j] ? row[j] : _block.minimum[j]);
+                    _block.maximum[j] = (row[j] > _block.maximum[j] ? row[j] : _block.maximum[j]);
+                }
+            }
+        }
+
+        if (_block.sum)
+        {
+            algorithmFPType * const sum = _block.sum;
+            for (size_t j = 0; j < p; j++) { sum[j] = 0; }
+            for (size_t i = 0; i < nRows; i++)
+            {
+                const algorithmFPType * const row = block + i * p;
+               PRAGMA_IVDEP
+               PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < p; j++) { sum[j] += row[j]; }
+            }
+
+            /* The means of the block are kept in the buffer of the differences of the means until the merge */
+            algorithmFPType * const blockMean = _delta.get();
+            const algorithmFPType invN = (algorithmFPType)1.0 / (algorithmFPType)nRows;
+            for (size_t j = 0; j < p; j++) { blockMean[j] = sum[j] * invN; }
+
+            if (_block.crossProduct)
+            {
+                updateCrossProduct(block, nRows, blockMean);
+            }
+            else
+            {
+                algorithmFPType * const sumSquaresCentered = _block.sumSquaresCentered;
+                for (size_t j = 0; j < p; j++) { sumSquaresCentered[j] = 0; }
+                for (size_t i = 0; i < nRows; i++)
+                {
+                    const algorithmFPType * const row = block + i * p;
+                   PRAGMA_IVDEP
+                   PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j < p; j++)
+                    {
+                        const algorithmFPType diff = row[j] - blockMean[j];
+                        sumSquaresCentered[j] += diff * diff;
+                    }
+                }
+            }
+        }
+
+        if (_data.items)
+        {
+            const size_t k = sketch::getSketchSize(_data.capacity);
+            algorithmFPType * const column = _column.get();
+            for (size_t j = 0; j < p; j++)
+            {
+                for (size_t i = 0; i < nRows; i++) { column[i] = block[i * p + j]; }
+                sketch::QuantileSketch<algorithmFPType, cpu> featureSketch(_data.items + j * _data.capacity,
+                                                                           _data.levels + j * sketch::sketchLevelsStride,
+                                                                           _data.capacity, k, _scratch.get());
+                featureSketch.insert(column, nRows);
+            }
+        }
+
+        /* The sketches are updated in place */
+        ProfileData<algorithmFPType> data = _data;
+        data.items = nullptr;
+        mergeProfile<algorithmFPType, cpu>(p, data, _block, _delta.get());
+    }
+
+private:
+    /* Computes the cross product of the block centered at its means, the sums of squares are its diagonal */
+    void updateCrossProduct(const algorithmFPType *block, size_t nRows, const algorithmFPType *blockMean)
+    {
+        const size_t p = _nFeatures;
+        algorithmFPType * const centered = _centeredBlock.get();
+        for (size_t i = 0; i < nRows; i++)
+        {
+           PRAGMA_IVDEP
+           PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++) { centered[i * p + j] = block[i * p + j] - blockMean[j]; }
+        }
+
+        /* The upper triangle of the column-major matrix is the lower triangle of the row-major one */
+        char uplo  = 'U';
+        char trans = 'N';
+        algorithmFPType alpha = 1.0;
+        algorithmFPType beta  = 0.0;
+        DAAL_INT nFeatures = (DAAL_INT)p;
+        DAAL_INT nVectors  = (DAAL_INT)nRows;
+        Blas<algorithmFPType, cpu>::xxsyrk(&uplo, &trans, &nFeatures, &nVectors, &alpha, centered, &nFeatures, &beta,
+                                           _block.crossProduct, &nFeatures);
+
+        if (_block.sumSquaresCentered)
+        {
+            for (size_t j = 0; j < p; j++) { _block.sumSquaresCentered[j] = _block.crossProduct[j * p + j]; }
+        }
+    }
+
+    algorithmFPType *allocate(TArray<algorithmFPType, cpu> &array, size_t n)
+    {
+        array.reset(n);
+        if (!array.get()) { _isValid = false; }
+        return array.get();
+    }
+
+    int *allocate(TArray<int, cpu> &array, size_t n)
+    {
+        array.reset(n);
+        if (!array.get()) { _isValid = false; }
+        return array.get();
+    }
+
+    size_t _nFeatures;
+    double _nObservations;
+    double _blockNObservations;
+    bool _isValid;
+    ProfileData<algorithmFPType> _data;
+    ProfileData<algorithmFPType> _block;
+    TArray<algorithmFPType, cpu> _minimum;
+    TArray<algorithmFPType, cpu> _maximum;
+    TArray<algorithmFPType, cpu> _sum;
+    TArray<algorithmFPType, cpu> _sumSquaresCentered;
+    TArray<algorithmFPType, cpu> _crossProduct;
+    TArray<algorithmFPType, cpu> _items;
+    TArray<int, cpu> _levels;
+    TArray<algorithmFPType, cpu> _blockMinimum;
+    TArray<algorithmFPType, cpu> _blockMaximum;
+    TArray<algorithmFPType, cpu> _blockSum;
+    TArray<algorithmFPType, cpu> _blockSumSquaresCentered;
+    TArray<algorithmFPType, cpu> _blockCrossProduct;
+    TArray<algorithmFPType, cpu> _centeredBlock;
+    TArray<algorithmFPType, cpu> _delta;
+    TArray<algorithmFPType, cpu> _column;
+    TArray<algorithmFPType, cpu> _scratch;
+};
+
+/* Updates the statistics dst with the observations of the data set in a single pass */
+template<typename algorithmFPType, CpuType cpu>
+bool updateProfile(NumericTable *dataTable, DAAL_UINT64 resultsToCompute, ProfileData<algorithmFPType> &dst)
+{
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t nVectors = dataTable->getNumberOfRows();
+    const size_t blockSize = __PROFILE_BLOCK_SIZE;
+    const size_t nBlocks = (nVectors + blockSize - 1) / blockSize;
+    const size_t capacity = dst.capacity;
+
+    daal::tls<ProfileThreadData<algorithmFPType, cpu> *> threadData([ = ]()
+    {
+        return new ProfileThreadData<algorithmFPType, cpu>(nFeatures, resultsToCompute, capacity);
+    } );
+
+    daal::threader_for(nBlocks, nBlocks, [ & ](int iBlock)
+    {
+        ProfileThreadData<algorithmFPType, cpu> *localData = threadData.local();
+        if (!localData->isValid()) { return; }
+
+        const size_t first = iBlock * blockSize;
+        const size_t nRows = (nVectors - first < blockSize ? nVectors - first : blockSize);
+        ReadRows<algorithmFPType, cpu> rows(dataTable, first, nRows);
+        if (!rows.get())
+        {
+            localData->setInvalid();
+            return;
+        }
+        localData->update(rows.get(), nRows);
+    } );
+
+    bool isOk = true;
+    TArray<algorithmFPType, cpu> delta(nFeatures);
+    if (!delta.get()) { isOk = false; }
+    threadData.reduce([ & ](ProfileThreadData<algorithmFPType, cpu> *localData)
+    {
+        if (!localData->isValid()) { isOk = false; }
+        if (isOk) { isOk = mergeProfile<algorithmFPType, cpu>(nFeatures, dst, localData->getData(), delta.get()); }
+        delete localData;
+    } );
+    return isOk;
+}
+
+/* Computes the final results from the statistics of the set of observations */
+template<typename algorithmFPType, CpuType cpu>
+bool finalizeProfile(size_t nFeatures, const ProfileData<algorithmFPType> &src, Result *result, const Parameter *par)
+{
+    const double n = *src.nObservations;
+    const algorithmFPType invN  = (algorithmFPType)(n > 0 ? 1.0 / n : 0.0);
+    const algorithmFPType invN1 = (algorithmFPType)(n > 1 ? 1.0 / (n - 1.0) : 0.0);
+
+    if (par->resultsToCompute & computeMinMax)
+    {
+        WriteOnlyRows<algorithmFPType, cpu> minimumRows(result->get(minimum).get(), 0, 1);
+        WriteOnlyRows<algorithmFPType, cpu> maximumRows(result->get(maximum).get(), 0, 1);
+        if (!minimumRows.get() || !maximumRows.get()) { return false; }
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            minimumRows.get()[j] = src.minimum[j];
+            maximumRows.get()[j] = src.maximum[j];
+        }
+    }
+
+    if (par->resultsToCompute & computeMoments)
+    {
+        WriteOnlyRows<algorithmFPType, cpu> sumRows(result->get(sum).get(), 0, 1);
+        WriteOnlyRows<algorithmFPType, cpu> meanRows(result->get(mean).get(), 0, 1);
+        WriteOnlyRows<algorithmFPType, cpu> varianceRows(result->get(variance).get(), 0, 1);
+        WriteOnlyRows<algorithmFPType, cpu> standardDeviationRows(result->get(standardDeviation).get(), 0, 1);
+        if (!sumRows.get() || !meanRows.get() || !varianceRows.get() || !standardDeviationRows.get()) { return false; }
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            sumRows.get()[j] = src.sum[j];
+            meanRows.get()[j] = src.sum[j] * invN;
+            varianceRows.get()[j] = src.sumSquaresCentered[j] * invN1;
+            standardDeviationRows.get()[j] = daal::internal::Math<algorithmFPType, cpu>::sSqrt(varianceRows.get()[j]);
+        }
+    }
+
+    if (par->resultsToCompute & computeCovariance)
+    {
+        WriteOnlyRows<algorithmFPType, cpu> covarianceRows(result->get(covariance).get(), 0, nFeatures);
+        algorithmFPType * const cov = covarianceRows.get();
+        if (!cov) { return false; }
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            for (size_t k = 0; k <= i; k++)
+            {
+                cov[i * nFeatures + k] = cov[k * nFeatures + i] = src.crossProduct[i * nFeatures + k] * invN1;
+            }
+        }
+    }
+
+    if (par->resultsToCompute & computeQuantiles)
+    {
+        const size_t nOrders = par->quantileOrders->getNumberOfColumns();
+        ReadRows<algorithmFPType, cpu> ordersRows(par->quantileOrders.get(), 0, 1);
+        WriteOnlyRows<algorithmFPType, cpu> quantilesRows(result->get(quantiles).get(), 0, nFeatures);
+        if (!ordersRows.get() || !quantilesRows.get() ||
+            !sketch::computeQuantiles<algorithmFPType, cpu>(nFeatures, src.capacity, src.items, src.levels, nOrders, ordersRows.get(),
+                                                            quantilesRows.get()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Statistics stored in the tables of the partial result, the tables are accessed in the given mode */
+template<typename algorithmFPType, CpuType cpu, ReadWriteMode mode>
+class PartialResultData
+{
+public:
+    PartialResultData(PartialResult *partialResult, DAAL_UINT64 resultsToCompute, size_t nFeatures) : _isValid(true)
+    {
+        _data.nObservations = get(_nObservationsRows, partialResult->get(nObservations).get(), 1);
+        if (resultsToCompute & computeMinMax)
+        {
+            _data.minimum = get(_minimumRows, partialResult->get(partialMinimum).get(), 1);
+            _data.maximum = get(_maximumRows, partialResult->get(partialMaximum).get(), 1);
+        }
+        if (resultsToCompute & (computeMoments | computeCovariance))
+        {
+            _data.sum = get(_sumRows, partialResult->get(partialSum).get(), 1);
+        }
+        if (resultsToCompute & computeMoments)
+        {
+            _data.sumSquaresCentered = get(_sumSquaresCenteredRows, partialResult->get(partialSumSquaresCentered).get(), 1);
+        }
+        if (resultsToCompute & computeCovariance)
+        {
+            _data.crossProduct = get(_crossProductRows, partialResult->get(partialCrossProduct).get(), nFeatures);
+        }
+        if (resultsToCompute & computeQuantiles)
+        {
+            NumericTable *itemsTable = partialResult->get(sketchItems).get();
+            _data.items = get(_itemsRows, itemsTable, nFeatures);
+            _data.levels = get(_levelsRows, partialResult->get(sketchLevels).get(), nFeatures);
+            _data.capacity = (itemsTable ? itemsTable->getNumberOfColumns() : 0);
+        }
+    }
+
+    bool isValid() const { return _isValid; }
+    ProfileData<algorithmFPType> &getData() { return _data; }
+
+private:
+    template<typename T>
+    T *get(GetRows<T, T, cpu, mode, NumericTable> &rows, NumericTable *table, size_t nRows)
+    {
+        T *ptr = rows.set(table, 0, nRows);
+        if (!ptr) { _isValid = false; }
+        return ptr;
+    }
+
+    bool _isValid;
+    ProfileData<algorithmFPType> _data;
+    GetRows<double, double, cpu, mode, NumericTable> _nObservationsRows;
+    GetRows<algorithmFPType, algorithmFPType, cpu, mode, NumericTable> _minimumRows;
+    GetRows<algorithmFPType, algorithmFPType, cpu, mode, NumericTable> _maximumRows;
+    GetRows<algorithmFPType, algorithmFPType, cpu, mode, NumericTable> _sumRows;
+    GetRows<algorithmFPType, algorithmFPType, cpu, mode, NumericTable> _sumSquaresCenteredRows;
+    GetRows<algorithmFPType, algorithmFPType, cpu, mode, NumericTable> _crossProductRows;
+    GetRows<algorithmFPType, algorithmFPType, cpu, mode, NumericTable> _itemsRows;
+    GetRows<int, int, cpu, mode, NumericTable> _levelsRows;
+};
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void ProfileKernel<method, algorithmFPType, cpu>::compute(NumericTable *dataTable, Result *result, const Parameter *par)
+{
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const DAAL_UINT64 resultsToCompute = par->resultsToCompute;
+    const size_t capacity = ((resultsToCompute & computeQuantiles) ? sketch::getSketchCapacity(par->epsilon) : 0);
+
+    ProfileThreadData<algorithmFPType, cpu> profileData(nFeatures, resultsToCompute, capacity);
+    if (!profileData.isValid())
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    ProfileData<algorithmFPType> data = profileData.getData();
+
+    if (!updateProfile<algorithmFPType, cpu>(dataTable, resultsToCompute, data) ||
+        !finalizeProfile<algorithmFPType, cpu>(nFeatures, data, result, par))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void ProfileOnlineKernel<method, algorithmFPType, cpu>::compute(NumericTable *dataTable, PartialResult *partialResult,
+                                                                const Parameter *par)
+{
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+
+    PartialResultData<algorithmFPType, cpu, readWrite> partialData(partialResult, par->resultsToCompute, nFeatures);
+    if (!partialData.isValid() ||
+        !updateProfile<algorithmFPType, cpu>(dataTable, par->resultsToCompute, partialData.getData()))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    if (partialData.getData().crossProduct)
+    {
+        symmetrizeCrossProduct<algorithmFPType, cpu>(nFeatures, partialData.getData().crossProduct);
+    }
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void ProfileOnlineKernel<method, algorithmFPType, cpu>::finalizeCompute(PartialResult *partialResult, Result *result,
+                                                                        const Parameter *par)
+{
+    const size_t nFeatures = partialResult->getNumberOfColumns();
+
+    PartialResultData<algorithmFPType, cpu, readOnly> partialData(partialResult, par->resultsToCompute, nFeatures);
+    if (!partialData.isValid() ||
+        !finalizeProfile<algorithmFPType, cpu>(nFeatures, partialData.getData(), result, par))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void ProfileDistributedKernel<method, algorithmFPType, cpu>::compute(DataCollection *partialResults, PartialResult *partialResult,
+                                                                     const Parameter *par)
+{
+    const size_t nFeatures = partialResult->getNumberOfColumns();
+
+    PartialResultData<algorithmFPType, cpu, readWrite> partialData(partialResult, par->resultsToCompute, nFeatures);
+    TArray<algorithmFPType, cpu> delta(nFeatures);
+    if (!partialData.isValid() || !delta.get())
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    for (size_t i = 0; i < partialResults->size(); i++)
+    {
+        PartialResult *localPartialResult = static_cast<PartialResult *>((*partialResults)[i].get());
+        PartialResultData<algorithmFPType, cpu, readOnly> localData(localPartialResult, par->resultsToCompute, nFeatures);
+        if (!localData.isValid() ||
+            !mergeProfile<algorithmFPType, cpu>(nFeatures, partialData.getData(), localData.getData(), delta.get()))
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+    }
+    if (partialData.getData().crossProduct)
+    {
+        symmetrizeCrossProduct<algorithmFPType, cpu>(nFeatures, partialData.getData().crossProduct);
+    }
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void ProfileDistributedKernel<method, algorithmFPType, cpu>::finalizeCompute(PartialResult *partialResult, Result *result,
+                                                                             const Parameter *par)
+{
+    ProfileOnlineKernel<method, algorithmFPType, cpu> kernel;
+    kernel.finalizeCompute(partialResult, result, par);
+    if (kernel.getErrorCollection()->size()) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+}
+
+} // namespace daal::algorithms::profile::internal
+
+} // namespace daal::algorithms::profile
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,79 @@
+/* file: profile_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that compute the profile of the data set
+//--
+*/
+
+#ifndef __PROFILE_KERNEL_H__
+#define __PROFILE_KERNEL_H__
+
+#include "numeric_table.h"
+#include "profile_batch.h"
+#include "profile_online.h"
+#include "profile_distributed.h"
+
+#include "service_defines.h"
+
+#define __PROFILE_BLOCK_SIZE 512    // Rows read from the input table by one task of the profile algorithm.
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace profile
+{
+namespace internal
+{
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+struct ProfileKernel : public Kernel
+{
+    virtual ~ProfileKernel() {}
+    void compute(NumericTable *dataTable, Result *result, const Parameter *par);
+};
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+struct ProfileOnlineKernel : public Kernel
+{
+    virtual ~ProfileOnlineKernel() {}
+    void compute(NumericTable *dataTable, PartialResult *partialResult, const Parameter *par);
+    void finalizeCompute(PartialResult *partialResult, Result *result, const Parameter *par);
+};
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+struct ProfileDistributedKernel : public Kernel
+{
+    virtual ~ProfileDistributedKernel() {}
+    void compute(DataCollection *partialResults, PartialResult *partialResult, const Parameter *par);
+    void finalizeCompute(PartialResult *partialResult, Result *result, const Parameter *par);
+};
+
+} // namespace daal::algorithms::profile::internal
+
+} // namespace daal::algorithms::profile
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+
+#endif
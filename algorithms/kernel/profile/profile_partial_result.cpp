@@ -0,0 +1,198 @@
+/* file: profile_partial_result.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the partial result of the profile algorithm.
+//--
+*/
+
+#include "profile_types.h"
+#include "quantiles_kernel.h"
+#include "serialization_utils.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace profile
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_PROFILE_PARTIAL_RESULT_ID);
+
+PartialResult::PartialResult() : daal::algorithms::PartialResult(8) {}
+
+/**
+ * Initializes the partial results that correspond to the empty set of observations
+ * \param[in] input     Input objects for the profile algorithm
+ * \param[in] parameter Parameters of the profile algorithm
+ * \param[in] method    Algorithm computation method
+ */
+void PartialResult::initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const PartialResultId ids[] = { nObservations, partialMinimum, partialMaximum, partialSum, partialSumSquaresCentered,
+                                    partialCrossProduct };
+    for (size_t i = 0; i < sizeof(ids) / sizeof(ids[0]); i++)
+    {
+        NumericTablePtr table = get(ids[i]);
+        if (!table) { continue; }
+        const size_t nRows = table->getNumberOfRows();
+        const size_t nValues = nRows * table->getNumberOfColumns();
+        BlockDescriptor<double> block;
+        table->getBlockOfRows(0, nRows, writeOnly, block);
+        double *values = block.getBlockPtr();
+        for (size_t k = 0; k < nValues; k++) { values[k] = 0; }
+        table->releaseBlockOfRows(block);
+    }
+
+    /* The empty levels of the quantile sketches start at the end of the rows of the sketch items */
+    NumericTablePtr levelsTable = get(sketchLevels);
+    if (!levelsTable) { return; }
+    const size_t nFeatures = levelsTable->getNumberOfRows();
+    const int capacity = (int)get(sketchItems)->getNumberOfColumns();
+    BlockDescriptor<int> levelsBlock;
+    levelsTable->getBlockOfRows(0, nFeatures, writeOnly, levelsBlock);
+    int *levels = levelsBlock.getBlockPtr();
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        for (size_t h = 0; h <= __QUANTILES_SKETCH_MAX_LEVELS; h++)
+        {
+            levels[j * quantiles::internal::sketchLevelsStride + h] = capacity;
+        }
+        levels[j * quantiles::internal::sketchLevelsStride + __QUANTILES_SKETCH_MAX_LEVELS + 1] = 0;
+    }
+    levelsTable->releaseBlockOfRows(levelsBlock);
+}
+
+/**
+ * Returns the number of features in the input data set
+ * \return Number of features
+ */
+size_t PartialResult::getNumberOfColumns() const
+{
+    const PartialResultId ids[] = { partialMinimum, partialSum, partialCrossProduct };
+    for (size_t i = 0; i < sizeof(ids) / sizeof(ids[0]); i++)
+    {
+        NumericTablePtr table = get(ids[i]);
+        if (table) { return table->getNumberOfColumns(); }
+    }
+    NumericTablePtr itemsTable = get(sketchItems);
+    if (itemsTable) { return itemsTable->getNumberOfRows(); }
+
+    this->_errors->add(Error::create(ErrorNullPartialResult));
+    return 0;
+}
+
+/**
+ * Returns the partial result of the profile algorithm
+ * \param[in] id   Identifier of the partial result, \ref PartialResultId
+ * \return         Partial result that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult::get(PartialResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the partial result of the profile algorithm
+ * \param[in] id    Identifier of the partial result
+ * \param[in] ptr   Pointer to the partial result
+ */
+void PartialResult::set(PartialResultId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Checks the correctness of the partial result
+ * \param[in] input     Pointer to the input objects
+ * \param[in] parameter Pointer to the parameters structure
+ * \param[in] method    Algorithm computation method
+ */
+void PartialResult::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const
+{
+    const size_t nFeatures = static_cast<const InputIface *>(input)->getNumberOfColumns();
+    checkImpl(nFeatures, static_cast<const Parameter *>(parameter)->resultsToCompute, this->_errors.get());
+}
+
+/**
+ * Checks the correctness of the partial result
+ * \param[in] parameter Pointer to the parameters structure
+ * \param[in] method    Algorithm computation method
+ */
+void PartialResult::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    const DAAL_UINT64 resultsToCompute = static_cast<const Parameter *>(parameter)->resultsToCompute;
+    const size_t nFeatures = getNumberOfColumns();
+    if (this->_errors->size() != 0) { return; }
+    checkImpl(nFeatures, resultsToCompute, this->_errors.get());
+}
+
+/**
+ * Checks the correctness of the partial result
+ * \param[in] nFeatures         Number of features
+ * \param[in] resultsToCompute  64 bit integer flag that indicates the statistics to compute
+ * \param[in] errors            Collection the detected errors are added to
+ */
+bool PartialResult::checkImpl(size_t nFeatures, DAAL_UINT64 resultsToCompute, ErrorCollection *errors) const
+{
+    int unexpectedLayouts = (int)NumericTableIface::csrArray;
+    if (!checkNumericTable(get(nObservations).get(), errors, nObservationsStr(), unexpectedLayouts, 0, 1, 1)) { return false; }
+
+    unexpectedLayouts = (int)packed_mask;
+    if (resultsToCompute & computeMinMax)
+    {
+        if (!checkNumericTable(get(partialMinimum).get(), errors, partialMinimumStr(), unexpectedLayouts, 0, nFeatures, 1)) { return false; }
+        if (!checkNumericTable(get(partialMaximum).get(), errors, partialMaximumStr(), unexpectedLayouts, 0, nFeatures, 1)) { return false; }
+    }
+    if (resultsToCompute & (computeMoments | computeCovariance))
+    {
+        if (!checkNumericTable(get(partialSum).get(), errors, partialSumStr(), unexpectedLayouts, 0, nFeatures, 1)) { return false; }
+    }
+    if (resultsToCompute & computeMoments)
+    {
+        if (!checkNumericTable(get(partialSumSquaresCentered).get(), errors, partialSumSquaresCenteredStr(), unexpectedLayouts, 0,
+                               nFeatures, 1)) { return false; }
+    }
+    if (resultsToCompute & computeCovariance)
+    {
+        if (!checkNumericTable(get(partialCrossProduct).get(), errors, crossProductStr(), unexpectedLayouts, 0, nFeatures,
+                               nFeatures)) { return false; }
+    }
+    if (resultsToCompute & computeQuantiles)
+    {
+        /* The sketch of the smallest size corresponds to epsilon equal to one */
+        if (!checkNumericTable(get(sketchItems).get(), errors, sketchItemsStr(), unexpectedLayouts, 0, 0, nFeatures)) { return false; }
+        if (get(sketchItems)->getNumberOfColumns() < quantiles::internal::getSketchCapacity(1.0))
+        {
+            errors->add(Error::create(ErrorIncorrectNumberOfColumns, ArgumentName, sketchItemsStr()));
+            return false;
+        }
+        if (!checkNumericTable(get(sketchLevels).get(), errors, sketchLevelsStr(), unexpectedLayouts, 0,
+                               quantiles::internal::sketchLevelsStride, nFeatures)) { return false; }
+    }
+    return true;
+}
+
+} // namespace interface1
+} // namespace profile
+} // namespace algorithms
+} // namespace daal
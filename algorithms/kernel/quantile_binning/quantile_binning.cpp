@@ -0,0 +1,165 @@
+/* file: quantile_binning.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the quantile binning algorithm and types methods.
+//--
+*/
+
+#include "quantile_binning_types.h"
+#include "serialization_utils.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantile_binning
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_QUANTILE_BINNING_RESULT_ID);
+
+Parameter::Parameter(size_t maxBins, double epsilon) : daal::algorithms::Parameter(), maxBins(maxBins), epsilon(epsilon) {}
+
+/**
+ * Checks the parameters of the quantile binning algorithm
+ */
+void Parameter::check() const
+{
+    DAAL_CHECK_EX(maxBins >= 2 && maxBins <= 65536, ErrorIncorrectParameter, ParameterName, maxBinsStr());
+    DAAL_CHECK_EX(epsilon > 0 && epsilon < 1, ErrorIncorrectParameter, ParameterName, epsilonStr());
+}
+
+Input::Input() : daal::algorithms::Input(2) {}
+
+/**
+ * Returns the number of features in the input data set
+ * \return Number of features
+ */
+size_t Input::getNumberOfColumns() const
+{
+    NumericTablePtr dataTable = get(data);
+    if (!checkNumericTable(dataTable.get(), this->_errors.get(), dataStr())) { return 0; }
+    return dataTable->getNumberOfColumns();
+}
+
+/**
+ * Returns an input object for the quantile binning algorithm
+ * \param[in] id    Identifier of the %input object
+ * \return          %Input object that corresponds to the given identifier
+ */
+NumericTablePtr Input::get(InputId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the input object of the quantile binning algorithm
+ * \param[in] id    Identifier of the %input object
+ * \param[in] ptr   Pointer to the input object
+ */
+void Input::set(InputId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Checks the correctness of the %Input object
+ * \param[in] parameter Pointer to the parameters structure
+ * \param[in] method    Algorithm computation method
+ */
+void Input::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+
+    if (!checkNumericTable(get(data).get(), this->_errors.get(), dataStr())) { return; }
+
+    NumericTablePtr bordersTable = get(inputBinBorders);
+    if (bordersTable)
+    {
+        const size_t nFeatures = get(data)->getNumberOfColumns();
+        if (!checkNumericTable(bordersTable.get(), this->_errors.get(), inputBinBordersStr(), (int)packed_mask, 0,
+                               par->maxBins - 1, nFeatures)) { return; }
+    }
+}
+
+Result::Result() : daal::algorithms::Result(2) {}
+
+/**
+ * Returns the final result of the quantile binning algorithm
+ * \param[in] id   Identifier of the final result, \ref ResultId
+ * \return         Final result that corresponds to the given identifier
+ */
+NumericTablePtr Result::get(ResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the Result object of the quantile binning algorithm
+ * \param[in] id        Identifier of the Result object
+ * \param[in] value     Pointer to the Result object
+ */
+void Result::set(ResultId id, const NumericTablePtr &value)
+{
+    Argument::set(id, value);
+}
+
+/**
+ * Checks the correctness of the Result object
+ * \param[in] in     Pointer to the object
+ * \param[in] par    Pointer to the parameters structure
+ * \param[in] method Algorithm computation method
+ */
+void Result::check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const
+{
+    const Input *input = static_cast<const Input *>(in);
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+    const size_t nFeatures = input->get(data)->getNumberOfColumns();
+    const size_t nVectors = input->get(data)->getNumberOfRows();
+
+    const int unexpectedLayouts = (int)packed_mask;
+    if (!checkNumericTable(get(binBorders).get(), this->_errors.get(), binBordersStr(), unexpectedLayouts, 0,
+                           parameter->maxBins - 1, nFeatures)) { return; }
+    if (!checkNumericTable(get(binnedData).get(), this->_errors.get(), binnedDataStr(), unexpectedLayouts, 0,
+                           nFeatures, nVectors)) { return; }
+}
+
+/**
+ * Checks the correctness of the Result object in the online processing mode
+ * \param[in] pres   Pointer to the partial results
+ * \param[in] par    Pointer to the parameters structure
+ * \param[in] method Algorithm computation method
+ */
+void Result::check(const daal::algorithms::PartialResult *pres, const daal::algorithms::Parameter *par, int method) const
+{
+    const PartialResult *partialResult = static_cast<const PartialResult *>(pres);
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+    const size_t nFeatures = partialResult->getNumberOfColumns();
+
+    if (!checkNumericTable(get(binBorders).get(), this->_errors.get(), binBordersStr(), (int)packed_mask, 0,
+                           parameter->maxBins - 1, nFeatures)) { return; }
+}
+
+}// namespace interface1
+}// namespace quantile_binning
+}// namespace algorithms
+}// namespace daal
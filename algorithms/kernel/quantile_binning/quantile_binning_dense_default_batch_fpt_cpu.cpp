@@ -0,0 +1,48 @@
+/* file: quantile_binning_dense_default_batch_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Instantiation of the quantile binning exact kernel in the batch processing mode.
+//--
+*/
+
+#include "quantile_binning_batch_container.h"
+#include "quantile_binning_kernel.h"
+#include "quantile_binning_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantile_binning
+{
+namespace interface1
+{
+
+template class BatchContainer<DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+
+}
+namespace internal
+{
+
+template struct QuantileBinningKernel<defaultDense, DAAL_FPTYPE, DAAL_CPU>;
+
+} // namespace daal::algorithms::quantile_binning::internal
+} // namespace daal::algorithms::quantile_binning
+} // namespace daal::algorithms
+} // namespace daal
@@ -0,0 +1,130 @@
+/* file: quantile_binning_fpt.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the quantile binning algorithm and types methods.
+//--
+*/
+
+#include "quantile_binning_types.h"
+#include "quantile_binning_kernel.h"
+#include "quantiles_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantile_binning
+{
+namespace interface1
+{
+/**
+ * Allocates memory to store final results of the quantile binning algorithm
+ * \param[in] input     Input objects for the quantile binning algorithm
+ * \param[in] parameter Parameters of the quantile binning algorithm
+ * \param[in] method    Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT void Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const Input *in = static_cast<const Input *>(input);
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+
+    const size_t nFeatures = in->get(data)->getNumberOfColumns();
+    const size_t nVectors = in->get(data)->getNumberOfRows();
+
+    /* The bin borders given on input are not copied */
+    data_management::NumericTablePtr bordersTable = in->get(inputBinBorders);
+    if (!bordersTable)
+    {
+        bordersTable = data_management::NumericTablePtr(
+                           new data_management::HomogenNumericTable<algorithmFPType>(par->maxBins - 1, nFeatures,
+                                                                                     data_management::NumericTable::doAllocate));
+    }
+    Argument::set(binBorders, bordersTable);
+
+    /* The indices of the bins are stored in the smallest unsigned type that holds maxBins values */
+    if (par->maxBins <= 256)
+    {
+        Argument::set(binnedData, data_management::SerializationIfacePtr(
+                          new data_management::HomogenNumericTable<unsigned char>(nFeatures, nVectors,
+                                                                                  data_management::NumericTable::doAllocate)));
+    }
+    else
+    {
+        Argument::set(binnedData, data_management::SerializationIfacePtr(
+                          new data_management::HomogenNumericTable<unsigned short>(nFeatures, nVectors,
+                                                                                   data_management::NumericTable::doAllocate)));
+    }
+}
+
+/**
+ * Allocates memory to store final results of the quantile binning algorithm in the online processing mode
+ * \param[in] partialResult Partial results of the quantile binning algorithm
+ * \param[in] parameter     Parameters of the quantile binning algorithm
+ * \param[in] method        Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT void Result::allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter,
+                                  const int method)
+{
+    const PartialResult *pres = static_cast<const PartialResult *>(partialResult);
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+
+    const size_t nFeatures = pres->getNumberOfColumns();
+
+    Argument::set(binBorders, data_management::SerializationIfacePtr(
+                      new data_management::HomogenNumericTable<algorithmFPType>(par->maxBins - 1, nFeatures,
+                                                                                data_management::NumericTable::doAllocate)));
+}
+
+/**
+ * Allocates memory to store the partial results of the quantile binning algorithm
+ * \param[in] input     Input objects for the quantile binning algorithm
+ * \param[in] parameter Parameters of the quantile binning algorithm
+ * \param[in] method    Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT void PartialResult::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+
+    const size_t nFeatures = static_cast<const Input *>(input)->getNumberOfColumns();
+    const size_t capacity = quantiles::internal::getSketchCapacity(par->epsilon);
+
+    Argument::set(nObservations, data_management::SerializationIfacePtr(
+                      new data_management::HomogenNumericTable<size_t>(1, 1, data_management::NumericTable::doAllocate)));
+    Argument::set(sketchItems, data_management::SerializationIfacePtr(
+                      new data_management::HomogenNumericTable<algorithmFPType>(capacity, nFeatures,
+                                                                                data_management::NumericTable::doAllocate)));
+    Argument::set(sketchLevels, data_management::SerializationIfacePtr(
+                      new data_management::HomogenNumericTable<int>(quantiles::internal::sketchLevelsStride, nFeatures,
+                                                                    data_management::NumericTable::doAllocate)));
+    initialize(input, parameter, method);
+}
+
+template DAAL_EXPORT void Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method);
+template DAAL_EXPORT void Result::allocate<DAAL_FPTYPE>(const daal::algorithms::PartialResult *partialResult,
+                                                        const daal::algorithms::Parameter *par, const int method);
+template DAAL_EXPORT void PartialResult::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input,
+                                                               const daal::algorithms::Parameter *par, const int method);
+
+}// namespace interface1
+}// namespace quantile_binning
+}// namespace algorithms
+}// namespace daal
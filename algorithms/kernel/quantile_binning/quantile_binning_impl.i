@@ -0,0 +1,374 @@
+/* file: quantile_binning_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the quantile binning algorithm.
+//
+//  The borders of the bins of the feature are the values of the ranks b * N / maxBins,
+//  b = 1, ..., maxBins - 1, in the sorted sequence of the N values of the feature. The
+//  duplicate borders and the borders equal to the maximal value are dropped, so the
+//  frequent values get the bins of their own. The exact method sorts the columns of
+//  the data set, the sketch method takes the ranks from the weighted items of the
+//  mergeable quantile sketches of the quantiles algorithm.
+//
+//  The values are replaced with the indices of the bins in blocks of rows. The borders
+//  of every feature are padded to 2^L - 1 entries, and the index of the bin is found by
+//  the branchless binary search that processes all values of the column of the block
+//  at once, so the L steps of the search are vectorized over the rows of the block.
+//--
+*/
+
+#ifndef __QUANTILE_BINNING_IMPL_I__
+#define __QUANTILE_BINNING_IMPL_I__
+
+#include "service_numeric_table.h"
+#include "service_memory.h"
+#include "service_data_utils.h"
+#include "service_sort.h"
+#include "threading.h"
+#include "quantiles_kernel.h"
+#include "quantiles_sketch_impl.i"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantile_binning
+{
+namespace internal
+{
+
+namespace sketch = daal::algorithms::quantiles::internal;
+
+/*
+ * Computes the bin borders of one feature from its n sorted values and writes them to the row of maxBins - 1 borders,
+ * the unused borders are set to the maximal value of the type. The value i represents 2^levelIndices[i] observations,
+ * or one observation if levelIndices is null
+ */
+template<typename algorithmFPType, CpuType cpu>
+void computeFeatureBorders(size_t n, const algorithmFPType *values, const int *levelIndices, size_t maxBins, algorithmFPType *borders)
+{
+    const algorithmFPType maxVal = daal::data_feature_utils::internal::MaxVal<algorithmFPType, cpu>::get();
+    const size_t nBorders = maxBins - 1;
+    size_t nDst = 0;
+
+    size_t nUnique = (n ? 1 : 0);
+    for (size_t i = 1; i < n; i++) { nUnique += (values[i] != values[i - 1]); }
+
+    if (nUnique <= maxBins)
+    {
+        /* Every distinct value except the maximal one is the border of its own bin */
+        for (size_t i = 1; i < n; i++)
+        {
+            if (values[i] != values[i - 1]) { borders[nDst++] = values[i - 1]; }
+        }
+    }
+    else
+    {
+        double totalWeight = (double)n;
+        if (levelIndices)
+        {
+            totalWeight = 0;
+            for (size_t i = 0; i < n; i++) { totalWeight += (double)((size_t)1 << levelIndices[i]); }
+        }
+
+        /* The border b is the first value with the cumulative weight not less than the rank b * N / maxBins */
+        double weight = 0;
+        size_t i = 0;
+        for (size_t b = 1; b < maxBins; b++)
+        {
+            const double rank = (double)(size_t)((double)b * totalWeight / (double)maxBins);
+            for (; i < n; i++)
+            {
+                weight += (levelIndices ? (double)((size_t)1 << levelIndices[i]) : 1.0);
+                if (weight >= rank) { break; }
+            }
+            if (i == n) { break; }
+            const algorithmFPType value = values[i];
+            weight -= (levelIndices ? (double)((size_t)1 << levelIndices[i]) : 1.0);
+            if (value < values[n - 1] && (!nDst || value > borders[nDst - 1])) { borders[nDst++] = value; }
+        }
+    }
+    for (; nDst < nBorders; nDst++) { borders[nDst] = maxVal; }
+}
+
+/* Computes the bin borders of every feature from the sorted columns of the data set, the missing values are skipped */
+template<typename algorithmFPType, CpuType cpu>
+bool computeExactBorders(const NumericTable &a, size_t maxBins, algorithmFPType *borders)
+{
+    const size_t nRows = a.getNumberOfRows();
+    const size_t nFeatures = a.getNumberOfColumns();
+
+    bool isOk = true;
+    daal::threader_for(nFeatures, nFeatures, [=, &a, &isOk](size_t j)
+    {
+        TArray<algorithmFPType, cpu> columnArray(nRows);
+        algorithmFPType * const column = columnArray.get();
+        if (!column)
+        {
+            isOk = false;
+            return;
+        }
+        BlockDescriptor<algorithmFPType> bd;
+        const_cast<NumericTable &>(a).getBlockOfColumnValues(j, 0, nRows, readOnly, bd);
+        const algorithmFPType * const values = bd.getBlockPtr();
+        if (!values)
+        {
+            isOk = false;
+            return;
+        }
+        size_t n = 0;
+        for (size_t i = 0; i < nRows; i++)
+        {
+            if (values[i] == values[i]) { column[n++] = values[i]; }
+        }
+        const_cast<NumericTable &>(a).releaseBlockOfColumnValues(bd);
+
+        daal::algorithms::internal::qSort<algorithmFPType, cpu>(n, column);
+        computeFeatureBorders<algorithmFPType, cpu>(n, column, nullptr, maxBins, borders + j * (maxBins - 1));
+    } );
+    return isOk;
+}
+
+/* Computes the bin borders of every feature from the weighted items of its quantile sketch */
+template<typename algorithmFPType, CpuType cpu>
+bool computeSketchBorders(size_t nFeatures, size_t capacity, const algorithmFPType *items, const int *levels, size_t maxBins,
+                          algorithmFPType *borders)
+{
+    bool isOk = true;
+    daal::threader_for(nFeatures, nFeatures, [=, &isOk](size_t j)
+    {
+        const algorithmFPType * const featureItems = items + j * capacity;
+        const int * const featureLevels = levels + j * sketch::sketchLevelsStride;
+        const size_t first = featureLevels[0];
+        const size_t n = capacity - first;
+
+        TArray<algorithmFPType, cpu> valuesArray(n ? n : 1);
+        TArray<int, cpu> levelIndicesArray(n ? n : 1);
+        algorithmFPType * const values = valuesArray.get();
+        int * const levelIndices = levelIndicesArray.get();
+        if (!values || !levelIndices)
+        {
+            isOk = false;
+            return;
+        }
+        for (size_t h = 0; h < __QUANTILES_SKETCH_MAX_LEVELS; h++)
+        {
+            for (int p = featureLevels[h]; p < featureLevels[h + 1]; p++)
+            {
+                values[p - first] = featureItems[p];
+                levelIndices[p - first] = (int)h;
+            }
+        }
+        daal::algorithms::internal::qSort<algorithmFPType, int, cpu>(n, values, levelIndices);
+        computeFeatureBorders<algorithmFPType, cpu>(n, values, levelIndices, maxBins, borders + j * (maxBins - 1));
+    } );
+    return isOk;
+}
+
+/*
+ * Replaces the values of the data set with the indices of their bins. The value falls into the bin equal to
+ * the number of the borders less than the value, the values equal to NaN fall into the first bin
+ */
+template<typename algorithmFPType, CpuType cpu>
+bool computeBins(const NumericTable &a, size_t maxBins, const algorithmFPType *borders, NumericTable &binned)
+{
+    const size_t nRows = a.getNumberOfRows();
+    const size_t nFeatures = a.getNumberOfColumns();
+    const size_t nBorders = maxBins - 1;
+    const algorithmFPType maxVal = daal::data_feature_utils::internal::MaxVal<algorithmFPType, cpu>::get();
+
+    /* Pad the borders of every feature to 2^L - 1 entries with the maximal value, and count the used borders */
+    size_t nSteps = 0;
+    while (((size_t)1 << nSteps) - 1 < nBorders) { nSteps++; }
+    const size_t stride = ((size_t)1 << nSteps) - 1;
+
+    TArray<algorithmFPType, cpu> paddedArray(nFeatures * stride);
+    TArray<int, cpu> nUsedArray(nFeatures);
+    algorithmFPType * const padded = paddedArray.get();
+    int * const nUsed = nUsedArray.get();
+    if (!padded || !nUsed) { return false; }
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        const algorithmFPType * const src = borders + j * nBorders;
+        algorithmFPType * const dst = padded + j * stride;
+        size_t k = 0;
+        for (; k < nBorders && src[k] < maxVal; k++) { dst[k] = src[k]; }
+        nUsed[j] = (int)k;
+        for (; k < stride; k++) { dst[k] = maxVal; }
+    }
+
+    const size_t blockSize = __QUANTILE_BINNING_BLOCK_SIZE;
+    const size_t nBlocks = (nRows + blockSize - 1) / blockSize;
+
+    bool isOk = true;
+    daal::threader_for(nBlocks, nBlocks, [=, &a, &binned, &isOk](size_t iBlock)
+    {
+        const size_t first = iBlock * blockSize;
+        const size_t n = (nRows - first < blockSize ? nRows - first : blockSize);
+
+        ReadRows<algorithmFPType, cpu> rows(const_cast<NumericTable &>(a), first, n);
+        WriteOnlyRows<int, cpu> binnedRows(binned, first, n);
+        TArray<algorithmFPType, cpu> columnArray(n);
+        TArray<int, cpu> indicesArray(n);
+        const algorithmFPType * const values = rows.get();
+        int * const bins = binnedRows.get();
+        algorithmFPType * const column = columnArray.get();
+        int * const indices = indicesArray.get();
+        if (!values || !bins || !column || !indices)
+        {
+            isOk = false;
+            return;
+        }
+
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            const algorithmFPType * const featureBorders = padded + j * stride;
+            for (size_t i = 0; i < n; i++)
+            {
+                column[i] = values[i * nFeatures + j];
+                indices[i] = 0;
+            }
+            /* The step halves the range of the bins of every value, the comparison is added without branching */
+            for (int step = (int)(stride + 1) / 2; step > 0; step >>= 1)
+            {
+                const algorithmFPType * const pivots = featureBorders + step - 1;
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t i = 0; i < n; i++)
+                {
+                    indices[i] += step & -(int)(pivots[indices[i]] < column[i]);
+                }
+            }
+            /* The values greater than the maximal value of the type must not fall into the padding */
+            const int nFeatureBins = nUsed[j];
+            for (size_t i = 0; i < n; i++)
+            {
+                bins[i * nFeatures + j] = (indices[i] < nFeatureBins ? indices[i] : nFeatureBins);
+            }
+        }
+    } );
+    return isOk;
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void QuantileBinningKernel<method, algorithmFPType, cpu>::compute(const NumericTable *dataTable, const NumericTable *inputBordersTable,
+                                                                  NumericTable *bordersTable, NumericTable *binnedTable, const Parameter *par)
+{
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t maxBins = par->maxBins;
+
+    if (!inputBordersTable)
+    {
+        WriteOnlyRows<algorithmFPType, cpu> bordersRows(bordersTable, 0, nFeatures);
+        if (!bordersRows.get())
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+
+        bool isOk = true;
+        if (method == defaultDense)
+        {
+            isOk = computeExactBorders<algorithmFPType, cpu>(*dataTable, maxBins, bordersRows.get());
+        }
+        else
+        {
+            const size_t capacity = sketch::getSketchCapacity(par->epsilon);
+            TArray<algorithmFPType, cpu> itemsArray(nFeatures * capacity);
+            TArray<int, cpu> levelsArray(nFeatures * sketch::sketchLevelsStride);
+            algorithmFPType * const items = itemsArray.get();
+            int * const levels = levelsArray.get();
+            isOk = (items && levels);
+            if (isOk)
+            {
+                sketch::clearSketches<algorithmFPType, cpu>(nFeatures, capacity, items, levels);
+                isOk = sketch::updateSketches<algorithmFPType, cpu>(*dataTable, capacity, items, levels) &&
+                       computeSketchBorders<algorithmFPType, cpu>(nFeatures, capacity, items, levels, maxBins, bordersRows.get());
+            }
+        }
+        if (!isOk)
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+    }
+
+    NumericTable *srcBordersTable = (inputBordersTable ? const_cast<NumericTable *>(inputBordersTable) : bordersTable);
+    ReadRows<algorithmFPType, cpu> bordersRows(srcBordersTable, 0, nFeatures);
+    if (!bordersRows.get() || !computeBins<algorithmFPType, cpu>(*dataTable, maxBins, bordersRows.get(), *binnedTable))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void QuantileBinningOnlineKernel<method, algorithmFPType, cpu>::compute(const NumericTable *dataTable, NumericTable *nObservationsTable,
+                                                                        NumericTable *itemsTable, NumericTable *levelsTable, const Parameter *par)
+{
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t capacity = itemsTable->getNumberOfColumns();
+
+    WriteRows<algorithmFPType, cpu> itemsRows(itemsTable, 0, nFeatures);
+    WriteRows<int, cpu> levelsRows(levelsTable, 0, nFeatures);
+    WriteRows<double, cpu> nObservationsRows(nObservationsTable, 0, 1);
+    if (!itemsRows.get() || !levelsRows.get() || !nObservationsRows.get())
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    if (!sketch::updateSketches<algorithmFPType, cpu>(*dataTable, capacity, itemsRows.get(), levelsRows.get()))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    nObservationsRows.get()[0] += (double)dataTable->getNumberOfRows();
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void QuantileBinningOnlineKernel<method, algorithmFPType, cpu>::finalizeCompute(NumericTable *itemsTable, NumericTable *levelsTable,
+                                                                                NumericTable *bordersTable, const Parameter *par)
+{
+    const size_t nFeatures = itemsTable->getNumberOfRows();
+    const size_t capacity = itemsTable->getNumberOfColumns();
+    /* The number of the bins is taken from the result, the parameters are not passed to the container that only finalizes the partial result */
+    const size_t maxBins = bordersTable->getNumberOfColumns() + 1;
+
+    ReadRows<algorithmFPType, cpu> itemsRows(itemsTable, 0, nFeatures);
+    ReadRows<int, cpu> levelsRows(levelsTable, 0, nFeatures);
+    WriteOnlyRows<algorithmFPType, cpu> bordersRows(bordersTable, 0, nFeatures);
+    if (!itemsRows.get() || !levelsRows.get() || !bordersRows.get() ||
+        !computeSketchBorders<algorithmFPType, cpu>(nFeatures, capacity, itemsRows.get(), levelsRows.get(), maxBins, bordersRows.get()))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+}
+
+} // namespace daal::algorithms::quantile_binning::internal
+
+} // namespace daal::algorithms::quantile_binning
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,72 @@
+/* file: quantile_binning_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that compute the bin borders and the binned data set
+//--
+*/
+
+#ifndef __QUANTILE_BINNING_KERNEL_H__
+#define __QUANTILE_BINNING_KERNEL_H__
+
+#include "numeric_table.h"
+#include "quantile_binning_batch.h"
+#include "quantile_binning_online.h"
+
+#include "service_defines.h"
+
+#define __QUANTILE_BINNING_BLOCK_SIZE 512    // Rows replaced with the indices of the bins by one task of the quantile binning algorithm.
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantile_binning
+{
+namespace internal
+{
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+struct QuantileBinningKernel : public Kernel
+{
+    virtual ~QuantileBinningKernel() {}
+    void compute(const NumericTable *dataTable, const NumericTable *inputBordersTable, NumericTable *bordersTable, NumericTable *binnedTable,
+                 const Parameter *par);
+};
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+struct QuantileBinningOnlineKernel : public Kernel
+{
+    virtual ~QuantileBinningOnlineKernel() {}
+    void compute(const NumericTable *dataTable, NumericTable *nObservationsTable, NumericTable *itemsTable, NumericTable *levelsTable,
+                 const Parameter *par);
+    void finalizeCompute(NumericTable *itemsTable, NumericTable *levelsTable, NumericTable *bordersTable, const Parameter *par);
+};
+
+} // namespace daal::algorithms::quantile_binning::internal
+
+} // namespace daal::algorithms::quantile_binning
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+
+#endif
@@ -0,0 +1,89 @@
+/* file: quantile_binning_online_container.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the quantile binning algorithm container in the online processing mode.
+//--
+*/
+
+#ifndef __QUANTILE_BINNING_ONLINE_CONTAINER_H__
+#define __QUANTILE_BINNING_ONLINE_CONTAINER_H__
+
+#include "quantile_binning_online.h"
+#include "quantile_binning_kernel.h"
+#include "kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantile_binning
+{
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::OnlineContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INITIALIZE_KERNELS(internal::QuantileBinningOnlineKernel, method, algorithmFPType);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::~OnlineContainer()
+{
+    __DAAL_DEINITIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void OnlineContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input *input = static_cast<Input *>(_in);
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    Parameter *par = static_cast<Parameter *>(_par);
+
+    NumericTable *dataTable          = input->get(data).get();
+    NumericTable *nObservationsTable = partialResult->get(nObservations).get();
+    NumericTable *itemsTable         = partialResult->get(sketchItems).get();
+    NumericTable *levelsTable        = partialResult->get(sketchLevels).get();
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::QuantileBinningOnlineKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute,
+                       dataTable, nObservationsTable, itemsTable, levelsTable, par);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void OnlineContainer<algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    Result *result = static_cast<Result *>(_res);
+    Parameter *par = static_cast<Parameter *>(_par);
+
+    NumericTable *itemsTable   = partialResult->get(sketchItems).get();
+    NumericTable *levelsTable  = partialResult->get(sketchLevels).get();
+    NumericTable *bordersTable = result->get(binBorders).get();
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::QuantileBinningOnlineKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), finalizeCompute,
+                       itemsTable, levelsTable, bordersTable, par);
+}
+
+} // namespace daal::algorithms::quantile_binning
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,146 @@
+/* file: quantile_binning_partial_result.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the partial result of the quantile binning algorithm.
+//--
+*/
+
+#include "quantile_binning_types.h"
+#include "quantiles_kernel.h"
+#include "serialization_utils.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantile_binning
+{
+namespace interface1
+{
+__DAAL_REGISTER_SERIALIZATION_CLASS(PartialResult, SERIALIZATION_QUANTILE_BINNING_PARTIAL_RESULT_ID);
+
+PartialResult::PartialResult() : daal::algorithms::PartialResult(3) {}
+
+/**
+ * Initializes the partial results with the empty sketches
+ * \param[in] input     Input objects for the quantile binning algorithm
+ * \param[in] parameter Parameters of the quantile binning algorithm
+ * \param[in] method    Algorithm computation method
+ */
+void PartialResult::initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    NumericTablePtr nObservationsTable = get(nObservations);
+    BlockDescriptor<int> nObservationsBlock;
+    nObservationsTable->getBlockOfRows(0, 1, writeOnly, nObservationsBlock);
+    nObservationsBlock.getBlockPtr()[0] = 0;
+    nObservationsTable->releaseBlockOfRows(nObservationsBlock);
+
+    /* The empty levels start at the end of the row of the sketch items */
+    NumericTablePtr levelsTable = get(sketchLevels);
+    const size_t nFeatures = levelsTable->getNumberOfRows();
+    const int capacity = (int)get(sketchItems)->getNumberOfColumns();
+    BlockDescriptor<int> levelsBlock;
+    levelsTable->getBlockOfRows(0, nFeatures, writeOnly, levelsBlock);
+    int *levels = levelsBlock.getBlockPtr();
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        for (size_t h = 0; h <= __QUANTILES_SKETCH_MAX_LEVELS; h++)
+        {
+            levels[j * quantiles::internal::sketchLevelsStride + h] = capacity;
+        }
+        levels[j * quantiles::internal::sketchLevelsStride + __QUANTILES_SKETCH_MAX_LEVELS + 1] = 0;
+    }
+    levelsTable->releaseBlockOfRows(levelsBlock);
+}
+
+/**
+ * Returns the number of features in the input data set
+ * \return Number of features
+ */
+size_t PartialResult::getNumberOfColumns() const
+{
+    NumericTablePtr ntPtr = get(sketchItems);
+    if (checkNumericTable(ntPtr.get(), this->_errors.get(), sketchItemsStr()))
+    {
+        return ntPtr->getNumberOfRows();
+    }
+    return 0;
+}
+
+/**
+ * Returns the partial result of the quantile binning algorithm
+ * \param[in] id   Identifier of the partial result, \ref PartialResultId
+ * \return         Partial result that corresponds to the given identifier
+ */
+NumericTablePtr PartialResult::get(PartialResultId id) const
+{
+    return staticPointerCast<NumericTable, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Sets the partial result of the quantile binning algorithm
+ * \param[in] id    Identifier of the partial result
+ * \param[in] ptr   Pointer to the partial result
+ */
+void PartialResult::set(PartialResultId id, const NumericTablePtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Checks the correctness of the partial result
+ * \param[in] input     Pointer to the input objects
+ * \param[in] parameter Pointer to the parameters structure
+ * \param[in] method    Algorithm computation method
+ */
+void PartialResult::check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const
+{
+    const size_t nFeatures = static_cast<const Input *>(input)->getNumberOfColumns();
+    if (!checkNumericTable(get(sketchItems).get(), this->_errors.get(), sketchItemsStr(), 0, 0, 0, nFeatures)) { return; }
+    check(parameter, method);
+}
+
+/**
+ * Checks the correctness of the partial result
+ * \param[in] parameter Pointer to the parameters structure
+ * \param[in] method    Algorithm computation method
+ */
+void PartialResult::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    int unexpectedLayouts = (int)NumericTableIface::csrArray;
+    if (!checkNumericTable(get(nObservations).get(), this->_errors.get(), nObservationsStr(), unexpectedLayouts, 0, 1, 1)) { return; }
+
+    unexpectedLayouts = (int)packed_mask;
+    if (!checkNumericTable(get(sketchItems).get(), this->_errors.get(), sketchItemsStr(), unexpectedLayouts)) { return; }
+
+    /* The sketch of the smallest size corresponds to epsilon equal to one */
+    const size_t nFeatures = get(sketchItems)->getNumberOfRows();
+    DAAL_CHECK_EX(get(sketchItems)->getNumberOfColumns() >= quantiles::internal::getSketchCapacity(1.0), ErrorIncorrectNumberOfColumns,
+                  ArgumentName, sketchItemsStr());
+    if (!checkNumericTable(get(sketchLevels).get(), this->_errors.get(), sketchLevelsStr(), unexpectedLayouts, 0,
+                           quantiles::internal::sketchLevelsStride, nFeatures)) { return; }
+}
+
+} // namespace interface1
+} // namespace quantile_binning
+} // namespace algorithms
+} // namespace daal
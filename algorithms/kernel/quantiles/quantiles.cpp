@@ -36,8 +36,8 @@ namespace quantiles
 namespace interface1
 {
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_QUANTILES_RESULT_ID);
-Parameter::Parameter(const data_management::NumericTablePtr quantileOrders)
-    : daal::algorithms::Parameter(), quantileOrders(quantileOrders)
+Parameter::Parameter(const data_management::NumericTablePtr quantileOrders, double epsilon)
+    : daal::algorithms::Parameter(), quantileOrders(quantileOrders), epsilon(epsilon)
 {
     if(quantileOrders.get() == NULL)
     {
@@ -46,7 +46,26 @@ Parameter::Parameter(const data_management::NumericTablePtr quantileOrders)
     }
 }
 
-Input::Input() : daal::algorithms::Input(1) {}
+/**
+ * Checks the parameters of the quantiles algorithm
+ */
+void Parameter::check() const
+{
+    DAAL_CHECK_EX(epsilon > 0 && epsilon < 1, ErrorIncorrectParameter, ParameterName, epsilonStr());
+}
+
+Input::Input() : InputIface(1) {}
+
+/**
+ * Returns the number of features in the input data set
+ * \return Number of features
+ */
+size_t Input::getNumberOfColumns() const
+{
+    data_management::NumericTablePtr dataTable = get(data);
+    if (!data_management::checkNumericTable(dataTable.get(), this->_errors.get(), dataStr())) { return 0; }
+    return dataTable->getNumberOfColumns();
+}
 
 /**
  * Returns an input object for the quantiles algorithm
@@ -114,13 +133,27 @@ void Result::set(ResultId id, const data_management::NumericTablePtr &value)
 void Result::check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const
 {
     const Input *input = static_cast<const Input *>(in);
-    const Parameter *parameter = static_cast<const Parameter *>(par);
+    checkImpl(input->get(data)->getNumberOfColumns(), static_cast<const Parameter *>(par));
+}
 
+/**
+ * Checks the correctness of the Result object in the online and distributed processing modes
+ * \param[in] pres   Pointer to the partial results
+ * \param[in] par    Pointer to the parameters structure
+ * \param[in] method Algorithm computation method
+ */
+void Result::check(const daal::algorithms::PartialResult *pres, const daal::algorithms::Parameter *par, int method) const
+{
+    const PartialResult *partialResult = static_cast<const PartialResult *>(pres);
+    checkImpl(partialResult->getNumberOfColumns(), static_cast<const Parameter *>(par));
+}
+
+void Result::checkImpl(size_t nFeatures, const Parameter *parameter) const
+{
     if (!data_management::checkNumericTable(parameter->quantileOrders.get(), this->_errors.get(),
         quantileOrdersStr(), 0, 0, 0, 1)) { return; }
 
-    size_t nVectors  = input->get(data)->getNumberOfColumns();
-    size_t nFeatures = parameter->quantileOrders->getNumberOfColumns();
+    size_t nQuantileOrders = parameter->quantileOrders->getNumberOfColumns();
 
     int unexpectedLayouts = (int)data_management::NumericTableIface::csrArray |
                             (int)data_management::NumericTableIface::upperPackedTriangularMatrix |
@@ -129,7 +162,7 @@ void Result::check(const daal::algorithms::Input *in, const daal::algorithms::Pa
                             (int)data_management::NumericTableIface::lowerPackedSymmetricMatrix;
 
     if (!data_management::checkNumericTable(get(quantiles).get(), this->_errors.get(),
-        quantilesStr(), unexpectedLayouts, 0, nFeatures, nVectors)) { return; }
+        quantilesStr(), unexpectedLayouts, 0, nQuantileOrders, nFeatures)) { return; }
 }
 
 }// namespace interface1
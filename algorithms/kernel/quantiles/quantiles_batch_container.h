@@ -39,7 +39,7 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env *daalEnv)
 {
 
-    __DAAL_INITIALIZE_KERNELS(internal::QuantilesKernel, defaultDense, algorithmFPType);
+    __DAAL_INITIALIZE_KERNELS(internal::QuantilesKernel, method, algorithmFPType);
 }
 
 template<typename algorithmFPType, Method method, CpuType cpu>
@@ -59,7 +59,7 @@ void BatchContainer<algorithmFPType, method, cpu>::compute()
     NumericTable *r = { static_cast<NumericTable *>(result->get(quantiles).get()) };
 
     daal::services::Environment::env &env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::QuantilesKernel, __DAAL_KERNEL_ARGUMENTS(defaultDense, algorithmFPType), compute, a, r, par);
+    __DAAL_CALL_KERNEL(env, internal::QuantilesKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, a, r, par);
 }
 
 } // namespace daal::algorithms::quantiles
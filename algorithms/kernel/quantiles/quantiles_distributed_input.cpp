@@ -0,0 +1,123 @@
+/* file: quantiles_distributed_input.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the input of the quantiles algorithm on the second step in the distributed processing mode.
+//--
+*/
+
+#include "quantiles_types.h"
+#include "quantiles_kernel.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace interface1
+{
+
+DistributedInput<step2Master>::DistributedInput() : InputIface(1)
+{
+    Argument::set(partialResults, DataCollectionPtr(new DataCollection()));
+}
+
+/**
+ * Returns the number of features in the input data set
+ * \return Number of features
+ */
+size_t DistributedInput<step2Master>::getNumberOfColumns() const
+{
+    DataCollectionPtr collection = get(partialResults);
+    if (!collection) { this->_errors->add(ErrorNullInputDataCollection); return 0; }
+    if (collection->size() == 0) { this->_errors->add(ErrorIncorrectNumberOfInputNumericTables); return 0; }
+
+    PartialResultPtr partialResult = PartialResult::cast((*collection)[0]);
+    if (!partialResult) { this->_errors->add(ErrorIncorrectElementInPartialResultCollection); return 0; }
+    return partialResult->getNumberOfColumns();
+}
+
+/**
+ * Adds the partial result computed on a local node to the collection of input objects
+ * \param[in] id            Identifier of the input object
+ * \param[in] partialResult Partial result of the first step
+ */
+void DistributedInput<step2Master>::add(MasterInputId id, const SharedPtr<PartialResult> &partialResult)
+{
+    DataCollectionPtr collection = get(id);
+    collection->push_back(staticPointerCast<SerializationIface, PartialResult>(partialResult));
+}
+
+/**
+ * Sets the collection of input objects
+ * \param[in] id    Identifier of the input object
+ * \param[in] ptr   Pointer to the collection of partial results
+ */
+void DistributedInput<step2Master>::set(MasterInputId id, const DataCollectionPtr &ptr)
+{
+    Argument::set(id, ptr);
+}
+
+/**
+ * Returns the collection of input objects
+ * \param[in] id    Identifier of the input object
+ * \return          Collection of partial results
+ */
+DataCollectionPtr DistributedInput<step2Master>::get(MasterInputId id) const
+{
+    return staticPointerCast<DataCollection, SerializationIface>(Argument::get(id));
+}
+
+/**
+ * Checks the correctness of the input objects
+ * \param[in] parameter Pointer to the parameters structure
+ * \param[in] method    Algorithm computation method
+ */
+void DistributedInput<step2Master>::check(const daal::algorithms::Parameter *parameter, int method) const
+{
+    DataCollectionPtr collection = get(partialResults);
+    if (!collection) { this->_errors->add(ErrorNullInputDataCollection); return; }
+    if (collection->size() == 0) { this->_errors->add(ErrorIncorrectNumberOfInputNumericTables); return; }
+
+    const size_t nFeatures = getNumberOfColumns();
+    for (size_t i = 0; i < collection->size(); i++)
+    {
+        PartialResultPtr partialResult = PartialResult::cast((*collection)[i]);
+        if (!partialResult) { this->_errors->add(ErrorIncorrectElementInPartialResultCollection); return; }
+
+        int unexpectedLayouts = (int)NumericTableIface::csrArray;
+        if (!checkNumericTable(partialResult->get(nObservations).get(), this->_errors.get(), nObservationsStr(), unexpectedLayouts, 0, 1, 1)) { return; }
+
+        unexpectedLayouts = (int)packed_mask;
+        if (!checkNumericTable(partialResult->get(sketchItems).get(), this->_errors.get(), sketchItemsStr(), unexpectedLayouts, 0, 0,
+                               nFeatures)) { return; }
+        DAAL_CHECK_EX(partialResult->get(sketchItems)->getNumberOfColumns() >= internal::getSketchCapacity(1.0),
+                      ErrorIncorrectNumberOfColumns, ArgumentName, sketchItemsStr());
+        if (!checkNumericTable(partialResult->get(sketchLevels).get(), this->_errors.get(), sketchLevelsStr(), unexpectedLayouts, 0,
+                               internal::sketchLevelsStride, nFeatures)) { return; }
+    }
+}
+
+} // namespace interface1
+} // namespace quantiles
+} // namespace algorithms
+} // namespace daal
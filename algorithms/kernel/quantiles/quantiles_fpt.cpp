@@ -22,6 +22,7 @@
 */
 
 #include "quantiles_types.h"
+#include "quantiles_kernel.h"
 
 namespace daal
 {
@@ -51,7 +52,57 @@ DAAL_EXPORT void Result::allocate(const daal::algorithms::Input *input, const da
                                                                                 data_management::NumericTable::doAllocate)));
 }
 
+/**
+ * Allocates memory to store final results of the quantile algorithms in the online and distributed processing modes
+ * \param[in] partialResult Partial results of the quantiles algorithm
+ * \param[in] parameter     Parameters of the quantiles algorithm
+ * \param[in] method        Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT void Result::allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter,
+                                  const int method)
+{
+    const PartialResult *pres = static_cast<const PartialResult *>(partialResult);
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+
+    size_t nFeatures = pres->getNumberOfColumns();
+    size_t nQuantileOrders = par->quantileOrders->getNumberOfColumns();
+
+    Argument::set(quantiles, data_management::SerializationIfacePtr(
+                      new data_management::HomogenNumericTable<algorithmFPType>(nQuantileOrders, nFeatures,
+                                                                                data_management::NumericTable::doAllocate)));
+}
+
+/**
+ * Allocates memory to store the partial results of the quantiles algorithm
+ * \param[in] input     Input objects for the quantiles algorithm
+ * \param[in] parameter Parameters of the quantiles algorithm
+ * \param[in] method    Algorithm computation method
+ */
+template <typename algorithmFPType>
+DAAL_EXPORT void PartialResult::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+
+    size_t nFeatures = static_cast<const InputIface *>(input)->getNumberOfColumns();
+    size_t capacity = internal::getSketchCapacity(par->epsilon);
+
+    Argument::set(nObservations, data_management::SerializationIfacePtr(
+                      new data_management::HomogenNumericTable<size_t>(1, 1, data_management::NumericTable::doAllocate)));
+    Argument::set(sketchItems, data_management::SerializationIfacePtr(
+                      new data_management::HomogenNumericTable<algorithmFPType>(capacity, nFeatures,
+                                                                                data_management::NumericTable::doAllocate)));
+    Argument::set(sketchLevels, data_management::SerializationIfacePtr(
+                      new data_management::HomogenNumericTable<int>(internal::sketchLevelsStride, nFeatures,
+                                                                    data_management::NumericTable::doAllocate)));
+    initialize(input, parameter, method);
+}
+
 template DAAL_EXPORT void Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method);
+template DAAL_EXPORT void Result::allocate<DAAL_FPTYPE>(const daal::algorithms::PartialResult *partialResult,
+                                                        const daal::algorithms::Parameter *par, const int method);
+template DAAL_EXPORT void PartialResult::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input,
+                                                               const daal::algorithms::Parameter *par, const int method);
 
 }// namespace interface1
 }// namespace quantiles
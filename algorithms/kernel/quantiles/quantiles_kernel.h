@@ -30,6 +30,10 @@
 #include "service_defines.h"
 #include "service_micro_table.h"
 
+#define __QUANTILES_SKETCH_MAX_LEVELS 64       // Maximal number of the levels of the quantile sketch, the items of the top level represent 2^63 observations.
+#define __QUANTILES_SKETCH_ERROR_FACTOR 2.0    // Rank error of the sketch relative to the number of observations multiplied by the size of its top level.
+#define __QUANTILES_SKETCH_BLOCK_SIZE 4096     // Rows read from the input table at once by the sketch method.
+
 using namespace daal::data_management;
 
 namespace daal
@@ -41,6 +45,27 @@ namespace quantiles
 namespace internal
 {
 
+/* Number of columns of the table of the sketch levels: the boundaries of the levels and the number of the compactions */
+const size_t sketchLevelsStride = __QUANTILES_SKETCH_MAX_LEVELS + 2;
+
+/**
+ *  Returns the number of columns of the table of the sketch items for the given bound of the rank error
+ */
+inline size_t getSketchCapacity(double epsilon)
+{
+    size_t k = (size_t)(__QUANTILES_SKETCH_ERROR_FACTOR / epsilon);
+    if (k < 2) { k = 2; }
+    return 3 * k + 2 * __QUANTILES_SKETCH_MAX_LEVELS + 1;
+}
+
+/**
+ *  Returns the size of the top level of the sketch stored in the table with the given number of columns
+ */
+inline size_t getSketchSize(size_t capacity)
+{
+    return (capacity - 2 * __QUANTILES_SKETCH_MAX_LEVELS - 1) / 3;
+}
+
 template<Method method, typename algorithmFPType, CpuType cpu>
 struct QuantilesKernel : public Kernel
 {
@@ -48,6 +73,31 @@ struct QuantilesKernel : public Kernel
     void compute(const NumericTable *a, NumericTable *r, const Parameter *par);
 };
 
+template<typename algorithmFPType, CpuType cpu>
+struct QuantilesKernel<sketchDense, algorithmFPType, cpu> : public Kernel
+{
+    virtual ~QuantilesKernel() {}
+    void compute(const NumericTable *a, NumericTable *r, const Parameter *par);
+};
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+struct QuantilesOnlineKernel : public Kernel
+{
+    virtual ~QuantilesOnlineKernel() {}
+    void compute(const NumericTable *a, NumericTable *nObservationsTable, NumericTable *itemsTable, NumericTable *levelsTable,
+                 const Parameter *par);
+    void finalizeCompute(NumericTable *itemsTable, NumericTable *levelsTable, NumericTable *r, const Parameter *par);
+};
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+struct QuantilesDistributedKernel : public Kernel
+{
+    virtual ~QuantilesDistributedKernel() {}
+    void compute(DataCollection *partialResults, NumericTable *nObservationsTable, NumericTable *itemsTable, NumericTable *levelsTable,
+                 const Parameter *par);
+    void finalizeCompute(NumericTable *itemsTable, NumericTable *levelsTable, NumericTable *r, const Parameter *par);
+};
+
 } // namespace daal::algorithms::quantiles::internal
 
 } // namespace daal::algorithms::quantiles
@@ -0,0 +1,489 @@
+/* file: quantiles_sketch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the approximate quantiles computation with the mergeable quantile sketch.
+//
+//  The sketch of every feature is a hierarchy of the compactors of the KLL sketch.
+//  The items of the level h represent 2^h observations each. When the buffer of
+//  the sketch is full, the lowest level that exceeds its capacity is sorted, and
+//  every other of its items goes to the next level, the offset of the selected
+//  items alternates between the compactions. The level capacities decrease
+//  geometrically from the top level down, so the sketch holds O(k) items and
+//  the rank error of the quantiles is O(N / k). Two sketches are merged by
+//  merging their levels and compacting the result.
+//
+//  The sketch is stored in the row of the items table with the levels placed
+//  from the top one at the end of the row downward, the free space is at the
+//  beginning of the row. The row of the levels table holds the boundaries of the
+//  levels and the number of the compactions.
+//--
+*/
+
+#ifndef __QUANTILES_SKETCH_IMPL_I__
+#define __QUANTILES_SKETCH_IMPL_I__
+
+#include "service_numeric_table.h"
+#include "service_memory.h"
+#include "service_sort.h"
+#include "threading.h"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+
+/* Quantile sketch of one feature stored in the external buffers */
+template<typename algorithmFPType, CpuType cpu>
+class QuantileSketch
+{
+public:
+    /*
+     * items    Buffer of the sketch items of size capacity
+     * levels   Boundaries of the levels of size __QUANTILES_SKETCH_MAX_LEVELS + 1 followed by the number of compactions
+     * scratch  Buffer of size capacity / 2 used by the compactions
+     */
+    QuantileSketch(algorithmFPType *items, int *levels, size_t capacity, size_t k, algorithmFPType *scratch) :
+        _items(items), _levels(levels), _capacity(capacity), _k(k), _scratch(scratch) {}
+
+    void clear()
+    {
+        for (size_t h = 0; h <= __QUANTILES_SKETCH_MAX_LEVELS; h++) { _levels[h] = (int)_capacity; }
+        _levels[__QUANTILES_SKETCH_MAX_LEVELS + 1] = 0;
+    }
+
+    size_t size() const { return _capacity - _levels[0]; }
+
+    size_t levelSize(size_t h) const { return _levels[h + 1] - _levels[h]; }
+
+    /* Number of the levels including the empty ones below the top level */
+    size_t getNumberOfLevels() const
+    {
+        size_t nLevels = 1;
+        for (size_t h = 1; h < __QUANTILES_SKETCH_MAX_LEVELS; h++)
+        {
+            if (_levels[h + 1] > _levels[h]) { nLevels = h + 1; }
+        }
+        return nLevels;
+    }
+
+    void insert(const algorithmFPType *values, size_t n)
+    {
+        while (n)
+        {
+            if (_levels[0] == 0) { compress(); }
+            const size_t nCopied = (n < (size_t)_levels[0] ? n : (size_t)_levels[0]);
+            algorithmFPType * const dst = _items + _levels[0] - nCopied;
+            for (size_t i = 0; i < nCopied; i++) { dst[i] = values[i]; }
+            _levels[0] -= (int)nCopied;
+            values += nCopied;
+            n -= nCopied;
+        }
+    }
+
+    /* Compacts the levels until the size of the sketch does not exceed maxSize */
+    void compressTo(size_t maxSize)
+    {
+        while (size() > maxSize) { compress(); }
+    }
+
+    /* Compacts the lowest level that exceeds its capacity */
+    void compress()
+    {
+        size_t nLevels = getNumberOfLevels();
+        size_t h = 0;
+        for (; h < nLevels; h++)
+        {
+            if (levelSize(h) >= levelCapacity(h, nLevels)) { break; }
+        }
+        if (h + 1 >= nLevels && nLevels < __QUANTILES_SKETCH_MAX_LEVELS) { nLevels++; }
+        if (h >= nLevels - 1) { h = nLevels - 2; }
+        compact(h);
+    }
+
+    const algorithmFPType *getItems() const { return _items; }
+    const int *getLevels() const { return _levels; }
+
+private:
+    size_t levelCapacity(size_t h, size_t nLevels) const
+    {
+        double capacity = (double)_k;
+        for (size_t i = h + 1; i < nLevels; i++) { capacity *= 2.0 / 3.0; }
+        const size_t result = (size_t)(capacity + 0.999999);
+        return (result < 2 ? 2 : result);
+    }
+
+    /* Moves every other item of the level h to the level h + 1 */
+    void compact(size_t h)
+    {
+        const size_t a = _levels[h];
+        const size_t b = _levels[h + 1];
+        const size_t c = _levels[h + 2];
+        const size_t n = b - a;
+        const size_t isOdd = n & 1;
+        const size_t nPairs = n / 2;
+        if (!nPairs) { return; }
+
+        if (h == 0) { daal::algorithms::internal::qSort<algorithmFPType, cpu>(n, _items + a); }
+
+        /* The odd item is the smallest one and stays on the level h */
+        const size_t offset = _levels[__QUANTILES_SKETCH_MAX_LEVELS + 1] & 1;
+        _levels[__QUANTILES_SKETCH_MAX_LEVELS + 1]++;
+        for (size_t i = 0; i < nPairs; i++) { _scratch[i] = _items[a + isOdd + 2 * i + offset]; }
+        const algorithmFPType oddItem = _items[a];
+
+        /* Merge the selected items with the level h + 1 */
+        size_t dst = b - nPairs;
+        size_t i = 0;
+        size_t j = b;
+        while (i < nPairs && j < c) { _items[dst++] = (_scratch[i] <= _items[j] ? _scratch[i++] : _items[j++]); }
+        while (i < nPairs) { _items[dst++] = _scratch[i++]; }
+
+        const size_t newBegin = b - nPairs - isOdd;
+        if (isOdd) { _items[newBegin] = oddItem; }
+
+        /* Shift the lower levels to the freed space */
+        const size_t shift = newBegin - a;
+        for (size_t p = a; p > (size_t)_levels[0]; p--) { _items[p - 1 + shift] = _items[p - 1]; }
+        for (size_t g = 0; g < h; g++) { _levels[g] += (int)shift; }
+        _levels[h] = (int)newBegin;
+        _levels[h + 1] = (int)(b - nPairs);
+    }
+
+    algorithmFPType *_items;
+    int *_levels;
+    size_t _capacity;
+    size_t _k;
+    algorithmFPType *_scratch;
+};
+
+/* Initializes the empty sketches of nFeatures features */
+template<typename algorithmFPType, CpuType cpu>
+void clearSketches(size_t nFeatures, size_t capacity, algorithmFPType *items, int *levels)
+{
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        QuantileSketch<algorithmFPType, cpu> sketch(items + j * capacity, levels + j * sketchLevelsStride, capacity, 0, nullptr);
+        sketch.clear();
+    }
+}
+
+/* Inserts the observations of the data set into the sketches of its features */
+template<typename algorithmFPType, CpuType cpu>
+bool updateSketches(const NumericTable &a, size_t capacity, algorithmFPType *items, int *levels)
+{
+    const size_t nFeatures = a.getNumberOfColumns();
+    const size_t nVectors = a.getNumberOfRows();
+    const size_t k = getSketchSize(capacity);
+    const size_t blockSize = __QUANTILES_SKETCH_BLOCK_SIZE;
+
+    bool isOk = true;
+    for (size_t first = 0; first < nVectors && isOk; first += blockSize)
+    {
+        const size_t n = (nVectors - first < blockSize ? nVectors - first : blockSize);
+        ReadRows<algorithmFPType, cpu> rows(const_cast<NumericTable &>(a), first, n);
+        const algorithmFPType * const data = rows.get();
+        if (!data) { return false; }
+
+        /* The features are processed in parallel, every task inserts the column of the block into one sketch */
+        daal::threader_for(nFeatures, nFeatures, [=, &isOk](size_t j)
+        {
+            TArray<algorithmFPType, cpu> columnArray(n);
+            TArray<algorithmFPType, cpu> scratchArray(capacity / 2 + 1);
+            algorithmFPType * const column = columnArray.get();
+            if (!column || !scratchArray.get())
+            {
+                isOk = false;
+                return;
+            }
+            for (size_t i = 0; i < n; i++) { column[i] = data[i * nFeatures + j]; }
+
+            QuantileSketch<algorithmFPType, cpu> sketch(items + j * capacity, levels + j * sketchLevelsStride, capacity, k,
+                                                        scratchArray.get());
+            sketch.insert(column, n);
+        } );
+    }
+    return isOk;
+}
+
+/* Merges the sketch of one feature stored in the src buffers into the sketch stored in the dst buffers */
+template<typename algorithmFPType, CpuType cpu>
+bool mergeSketch(algorithmFPType *dstItems, int *dstLevels, size_t dstCapacity,
+                 const algorithmFPType *srcItems, const int *srcLevels, size_t srcCapacity)
+{
+    const size_t k = getSketchSize(dstCapacity);
+    const size_t dstSize = dstCapacity - dstLevels[0];
+    const size_t srcSize = srcCapacity - srcLevels[0];
+    const size_t capacity = dstSize + srcSize + 1;
+
+    TArray<algorithmFPType, cpu> itemsArray(capacity);
+    TArray<algorithmFPType, cpu> scratchArray(capacity / 2 + 1);
+    TArray<int, cpu> levelsArray(sketchLevelsStride);
+    algorithmFPType * const items = itemsArray.get();
+    int * const levels = levelsArray.get();
+    if (!items || !levels || !scratchArray.get()) { return false; }
+
+    /* Place the merged levels from the top one down, the levels above the level 0 are merged as sorted sequences */
+    size_t end = capacity;
+    levels[__QUANTILES_SKETCH_MAX_LEVELS] = (int)capacity;
+    for (size_t h = __QUANTILES_SKETCH_MAX_LEVELS; h-- > 0;)
+    {
+        const algorithmFPType * const x = dstItems + dstLevels[h];
+        const algorithmFPType * const y = srcItems + srcLevels[h];
+        const size_t nx = dstLevels[h + 1] - dstLevels[h];
+        const size_t ny = srcLevels[h + 1] - srcLevels[h];
+        const size_t begin = end - nx - ny;
+        size_t i = 0, j = 0, dst = begin;
+        if (h == 0)
+        {
+            for (; i < nx; i++) { items[dst++] = x[i]; }
+            for (; j < ny; j++) { items[dst++] = y[j]; }
+        }
+        else
+        {
+            while (i < nx && j < ny) { items[dst++] = (x[i] <= y[j] ? x[i++] : y[j++]); }
+            while (i < nx) { items[dst++] = x[i++]; }
+            while (j < ny) { items[dst++] = y[j++]; }
+        }
+        levels[h] = (int)begin;
+        end = begin;
+    }
+    levels[__QUANTILES_SKETCH_MAX_LEVELS + 1] = dstLevels[__QUANTILES_SKETCH_MAX_LEVELS + 1] + srcLevels[__QUANTILES_SKETCH_MAX_LEVELS + 1];
+
+    QuantileSketch<algorithmFPType, cpu> sketch(items, levels, capacity, k, scratchArray.get());
+    sketch.compressTo(dstCapacity);
+
+    /* Copy the merged sketch to the end of the destination row */
+    const int shift = (int)dstCapacity - (int)capacity;
+    for (int p = levels[0]; p < (int)capacity; p++) { dstItems[p + shift] = items[p]; }
+    for (size_t h = 0; h <= __QUANTILES_SKETCH_MAX_LEVELS; h++) { dstLevels[h] = levels[h] + shift; }
+    dstLevels[__QUANTILES_SKETCH_MAX_LEVELS + 1] = levels[__QUANTILES_SKETCH_MAX_LEVELS + 1];
+    return true;
+}
+
+/*
+ * Computes the quantiles of every feature from its sketch. The quantile of the order q is the item
+ * with the rank q * (N - 1) in the sorted sequence of the N observations represented by the sketch
+ */
+template<typename algorithmFPType, CpuType cpu>
+bool computeQuantiles(size_t nFeatures, size_t capacity, const algorithmFPType *items, const int *levels,
+                      size_t nOrders, const algorithmFPType *orders, algorithmFPType *quants)
+{
+    bool isOk = true;
+    daal::threader_for(nFeatures, nFeatures, [=, &isOk](size_t j)
+    {
+        const algorithmFPType * const featureItems = items + j * capacity;
+        const int * const featureLevels = levels + j * sketchLevelsStride;
+        const size_t first = featureLevels[0];
+        const size_t n = capacity - first;
+        algorithmFPType * const featureQuants = quants + j * nOrders;
+        if (!n)
+        {
+            for (size_t q = 0; q < nOrders; q++) { featureQuants[q] = 0; }
+            return;
+        }
+
+        TArray<algorithmFPType, cpu> valuesArray(n);
+        TArray<int, cpu> levelIndicesArray(n);
+        algorithmFPType * const values = valuesArray.get();
+        int * const levelIndices = levelIndicesArray.get();
+        if (!values || !levelIndices)
+        {
+            isOk = false;
+            return;
+        }
+        for (size_t h = 0; h < __QUANTILES_SKETCH_MAX_LEVELS; h++)
+        {
+            for (int p = featureLevels[h]; p < featureLevels[h + 1]; p++)
+            {
+                values[p - first] = featureItems[p];
+                levelIndices[p - first] = (int)h;
+            }
+        }
+        daal::algorithms::internal::qSort<algorithmFPType, int, cpu>(n, values, levelIndices);
+
+        double totalWeight = 0;
+        for (size_t i = 0; i < n; i++) { totalWeight += (double)((size_t)1 << levelIndices[i]); }
+
+        /* The orders are not required to be sorted */
+        for (size_t q = 0; q < nOrders; q++)
+        {
+            const double rank = (double)orders[q] * (totalWeight - 1);
+            double weight = 0;
+            size_t i = 0;
+            for (; i + 1 < n; i++)
+            {
+                weight += (double)((size_t)1 << levelIndices[i]);
+                if (weight > rank) { break; }
+            }
+            featureQuants[q] = values[i];
+        }
+    } );
+    return isOk;
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void QuantilesKernel<sketchDense, algorithmFPType, cpu>::compute(const NumericTable *a, NumericTable *r, const Parameter *par)
+{
+    const size_t nFeatures = a->getNumberOfColumns();
+    const size_t nOrders = r->getNumberOfColumns();
+    const size_t capacity = getSketchCapacity(par->epsilon);
+
+    TArray<algorithmFPType, cpu> itemsArray(nFeatures * capacity);
+    TArray<int, cpu> levelsArray(nFeatures * sketchLevelsStride);
+    algorithmFPType * const items = itemsArray.get();
+    int * const levels = levelsArray.get();
+    ReadRows<algorithmFPType, cpu> ordersRows(par->quantileOrders.get(), 0, 1);
+    WriteOnlyRows<algorithmFPType, cpu> quantsRows(r, 0, nFeatures);
+    if (!items || !levels || !ordersRows.get() || !quantsRows.get())
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    clearSketches<algorithmFPType, cpu>(nFeatures, capacity, items, levels);
+    if (!updateSketches<algorithmFPType, cpu>(*a, capacity, items, levels) ||
+        !computeQuantiles<algorithmFPType, cpu>(nFeatures, capacity, items, levels, nOrders, ordersRows.get(), quantsRows.get()))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void QuantilesOnlineKernel<method, algorithmFPType, cpu>::compute(const NumericTable *a, NumericTable *nObservationsTable,
+                                                                  NumericTable *itemsTable, NumericTable *levelsTable, const Parameter *par)
+{
+    const size_t nFeatures = a->getNumberOfColumns();
+    const size_t capacity = itemsTable->getNumberOfColumns();
+
+    WriteRows<algorithmFPType, cpu> itemsRows(itemsTable, 0, nFeatures);
+    WriteRows<int, cpu> levelsRows(levelsTable, 0, nFeatures);
+    WriteRows<double, cpu> nObservationsRows(nObservationsTable, 0, 1);
+    if (!itemsRows.get() || !levelsRows.get() || !nObservationsRows.get())
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    if (!updateSketches<algorithmFPType, cpu>(*a, capacity, itemsRows.get(), levelsRows.get()))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    nObservationsRows.get()[0] += (double)a->getNumberOfRows();
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void QuantilesOnlineKernel<method, algorithmFPType, cpu>::finalizeCompute(NumericTable *itemsTable, NumericTable *levelsTable,
+                                                                          NumericTable *r, const Parameter *par)
+{
+    const size_t nFeatures = itemsTable->getNumberOfRows();
+    const size_t capacity = itemsTable->getNumberOfColumns();
+    const size_t nOrders = r->getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu> itemsRows(itemsTable, 0, nFeatures);
+    ReadRows<int, cpu> levelsRows(levelsTable, 0, nFeatures);
+    ReadRows<algorithmFPType, cpu> ordersRows(par->quantileOrders.get(), 0, 1);
+    WriteOnlyRows<algorithmFPType, cpu> quantsRows(r, 0, nFeatures);
+    if (!itemsRows.get() || !levelsRows.get() || !ordersRows.get() || !quantsRows.get() ||
+        !computeQuantiles<algorithmFPType, cpu>(nFeatures, capacity, itemsRows.get(), levelsRows.get(), nOrders, ordersRows.get(),
+                                                quantsRows.get()))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void QuantilesDistributedKernel<method, algorithmFPType, cpu>::compute(DataCollection *partialResults, NumericTable *nObservationsTable,
+                                                                       NumericTable *itemsTable, NumericTable *levelsTable,
+                                                                       const Parameter *par)
+{
+    const size_t nFeatures = itemsTable->getNumberOfRows();
+    const size_t capacity = itemsTable->getNumberOfColumns();
+
+    WriteRows<algorithmFPType, cpu> itemsRows(itemsTable, 0, nFeatures);
+    WriteRows<int, cpu> levelsRows(levelsTable, 0, nFeatures);
+    WriteRows<double, cpu> nObservationsRows(nObservationsTable, 0, 1);
+    algorithmFPType * const items = itemsRows.get();
+    int * const levels = levelsRows.get();
+    if (!items || !levels || !nObservationsRows.get())
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    for (size_t i = 0; i < partialResults->size(); i++)
+    {
+        PartialResult * const partialResult = static_cast<PartialResult *>((*partialResults)[i].get());
+        NumericTable * const srcItemsTable = partialResult->get(sketchItems).get();
+        const size_t srcCapacity = srcItemsTable->getNumberOfColumns();
+
+        ReadRows<algorithmFPType, cpu> srcItemsRows(srcItemsTable, 0, nFeatures);
+        ReadRows<int, cpu> srcLevelsRows(partialResult->get(sketchLevels).get(), 0, nFeatures);
+        ReadRows<double, cpu> srcNObservationsRows(partialResult->get(nObservations).get(), 0, 1);
+        const algorithmFPType * const srcItems = srcItemsRows.get();
+        const int * const srcLevels = srcLevelsRows.get();
+        if (!srcItems || !srcLevels || !srcNObservationsRows.get())
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+
+        bool isOk = true;
+        daal::threader_for(nFeatures, nFeatures, [=, &isOk](size_t j)
+        {
+            if (!mergeSketch<algorithmFPType, cpu>(items + j * capacity, levels + j * sketchLevelsStride, capacity,
+                                                   srcItems + j * srcCapacity, srcLevels + j * sketchLevelsStride, srcCapacity))
+            {
+                isOk = false;
+            }
+        } );
+        if (!isOk)
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+        nObservationsRows.get()[0] += srcNObservationsRows.get()[0];
+    }
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void QuantilesDistributedKernel<method, algorithmFPType, cpu>::finalizeCompute(NumericTable *itemsTable, NumericTable *levelsTable,
+                                                                               NumericTable *r, const Parameter *par)
+{
+    QuantilesOnlineKernel<method, algorithmFPType, cpu> kernel;
+    kernel.finalizeCompute(itemsTable, levelsTable, r, par);
+    if (kernel.getErrorCollection()->size()) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+}
+
+} // namespace daal::algorithms::quantiles::internal
+
+} // namespace daal::algorithms::quantiles
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,588 @@
+/* file: service_distance_tiles.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Tiled computation of the cosine and correlation distances.
+//
+//  The rows of a tile are normalized: u = x / |x| for the cosine distance and
+//  u = (x - mean(x)) / |x - mean(x)| for the correlation distance. The distance
+//  between the rows is then 1 - (u1, u2), so a tile of distances is computed
+//  with a single gemm call on the normalized rows.
+//--
+*/
+
+#ifndef __SERVICE_DISTANCE_TILES_H__
+#define __SERVICE_DISTANCE_TILES_H__
+
+#include "numeric_table.h"
+#include "service_defines.h"
+#include "service_memory.h"
+#include "service_micro_table.h"
+#include "service_math.h"
+#include "service_blas.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace internal
+{
+
+/**
+ *  Number of rows in the tile of the distance matrix
+ */
+const size_t distanceTileSize = 128;
+
+/**
+ *  Thread local buffers used to compute one tile of the distance matrix
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct DistanceTileBuffers
+{
+    DistanceTileBuffers(size_t p) :
+        u1(services::internal::service_malloc<algorithmFPType, cpu>(distanceTileSize * p)),
+        u2(services::internal::service_malloc<algorithmFPType, cpu>(distanceTileSize * p)),
+        dist(services::internal::service_malloc<algorithmFPType, cpu>(distanceTileSize * distanceTileSize)) {}
+
+    ~DistanceTileBuffers()
+    {
+        services::internal::service_free<algorithmFPType, cpu>(u1);
+        services::internal::service_free<algorithmFPType, cpu>(u2);
+        services::internal::service_free<algorithmFPType, cpu>(dist);
+    }
+
+    bool isValid() const { return (u1 && u2 && dist); }
+
+    algorithmFPType *u1;   /* Normalized rows of the first block */
+    algorithmFPType *u2;   /* Normalized rows of the second block */
+    algorithmFPType *dist; /* Distances between the rows of the blocks */
+};
+
+/**
+ *  Computes the distance matrix between the rows of the table x (rows of the matrix)
+ *  and the rows of the table y (columns of the matrix) tile by tile
+ */
+template <typename algorithmFPType, CpuType cpu>
+class DistanceTiles
+{
+public:
+    typedef DistanceTileBuffers<algorithmFPType, cpu> TileBuffers;
+
+    /**
+     *  \param[in] xTable    Observations that correspond to the rows of the distance matrix
+     *  \param[in] yTable    Observations that correspond to the columns of the distance matrix
+     *  \param[in] centered  true for the correlation distance, false for the cosine distance
+     */
+    DistanceTiles(NumericTable *xTable, NumericTable *yTable, bool centered) :
+        _xTable(xTable), _yTable(yTable), _centered(centered), _p(xTable->getNumberOfColumns()),
+        _nx(xTable->getNumberOfRows()), _ny(yTable->getNumberOfRows())
+    {
+        _nxTiles = _nx / distanceTileSize + !!(_nx % distanceTileSize);
+        _nyTiles = _ny / distanceTileSize + !!(_ny % distanceTileSize);
+    }
+
+    size_t getNumberOfRows() const { return _nx; }
+    size_t getNumberOfColumns() const { return _ny; }
+    size_t getNumberOfRowTiles() const { return _nxTiles; }
+    size_t getNumberOfColumnTiles() const { return _nyTiles; }
+
+    /**
+     *  Reads nRows observations of the table starting from startRow and normalizes them into u
+     */
+    void normalizeRows(NumericTable *table, size_t startRow, size_t nRows, algorithmFPType *u) const
+    {
+        algorithmFPType *x;
+        BlockMicroTable<algorithmFPType, readOnly, cpu> xBlock(table);
+        xBlock.getBlockOfRows(startRow, nRows, &x);
+
+        const size_t p = _p;
+        for (size_t i = 0; i < nRows; i++)
+        {
+            const algorithmFPType *xi = x + i * p;
+            algorithmFPType *ui = u + i * p;
+
+            algorithmFPType mean = (algorithmFPType)0.0;
+            if (_centered)
+            {
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < p; j++)
+                {
+                    mean += xi[j];
+                }
+                mean /= (algorithmFPType)p;
+            }
+
+            algorithmFPType sumSq = (algorithmFPType)0.0;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                ui[j] = xi[j] - mean;
+                sumSq += ui[j] * ui[j];
+            }
+
+            /* observation with zero norm is at the distance 1 from all the others */
+            const algorithmFPType invNorm = (sumSq > (algorithmFPType)0.0 ?
+                (algorithmFPType)1.0 / Math<algorithmFPType, cpu>::sSqrt(sumSq) : (algorithmFPType)0.0);
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                ui[j] *= invNorm;
+            }
+        }
+
+        xBlock.release();
+    }
+
+    /**
+     *  Computes dist[i * n2 + j] = 1 - (u1[i], u2[j]) for the blocks of n1 and n2 normalized rows
+     */
+    void computeTile(const algorithmFPType *u1, size_t n1, const algorithmFPType *u2, size_t n2, algorithmFPType *dist) const
+    {
+        algorithmFPType alpha = 1.0, beta = 0.0;
+        char transa = 'T', transb = 'N';
+        DAAL_INT m = n2, nn = n1, k = _p;
+        DAAL_INT lda = _p, ldb = _p, ldc = n2;
+
+        Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &m, &nn, &k, &alpha, const_cast<algorithmFPType *>(u2), &lda,
+                                           const_cast<algorithmFPType *>(u1), &ldb, &beta, dist, &ldc);
+
+        const size_t size = n1 * n2;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < size; i++)
+        {
+            dist[i] = (algorithmFPType)1.0 - dist[i];
+        }
+    }
+
+    /**
+     *  Calls processTile(startRow, nRows, startCol, nCols, dist) for every tile of the lower triangle
+     *  of the symmetric distance matrix, startCol <= startRow. The distances on the main diagonal are set to zero.
+     *  The tiles are numbered along the triangle, so that one parallel loop over them keeps the threads evenly loaded.
+     *  \return false if memory allocation failed
+     */
+    template <typename ProcessTile>
+    bool forEachLowerTile(const ProcessTile &processTile) const
+    {
+        const size_t nTiles = _nxTiles * (_nxTiles + 1) / 2;
+        daal::tls<TileBuffers *> tlsBuffers([ = ]() { return allocateBuffers(); });
+
+        bool bMemoryAllocationFailed = false;
+        daal::threader_for(nTiles, nTiles, [ =, &tlsBuffers, &bMemoryAllocationFailed ](size_t iTile)
+        {
+            TileBuffers *buffers = tlsBuffers.local();
+            if (!buffers)
+            {
+                bMemoryAllocationFailed = true;
+                return;
+            }
+
+            /* tile iTile is in the row of tiles iRowTile: iRowTile * (iRowTile + 1) / 2 <= iTile */
+            size_t iRowTile = (size_t)((Math<double, cpu>::sSqrt(8.0 * (double)iTile + 1.0) - 1.0) / 2.0);
+            while (iRowTile * (iRowTile + 1) / 2 > iTile) { iRowTile--; }
+            while ((iRowTile + 1) * (iRowTile + 2) / 2 <= iTile) { iRowTile++; }
+            const size_t iColTile = iTile - iRowTile * (iRowTile + 1) / 2;
+
+            const size_t startRow = iRowTile * distanceTileSize;
+            const size_t startCol = iColTile * distanceTileSize;
+            const size_t nRows = getTileSize(startRow, _nx);
+            const size_t nCols = getTileSize(startCol, _nx);
+
+            normalizeRows(_xTable, startRow, nRows, buffers->u1);
+            if (iRowTile == iColTile)
+            {
+                computeTile(buffers->u1, nRows, buffers->u1, nRows, buffers->dist);
+                for (size_t i = 0; i < nRows; i++)
+                {
+                    buffers->dist[i * nRows + i] = (algorithmFPType)0.0;
+                }
+            }
+            else
+            {
+                normalizeRows(_xTable, startCol, nCols, buffers->u2);
+                computeTile(buffers->u1, nRows, buffers->u2, nCols, buffers->dist);
+            }
+            processTile(startRow, nRows, startCol, nCols, buffers->dist);
+        } );
+
+        tlsBuffers.reduce([ = ](TileBuffers *buffers) { delete buffers; });
+        return !bMemoryAllocationFailed;
+    }
+
+    /**
+     *  Calls processTile(startRow, nRows, startCol, nCols, dist) for every tile in the rows
+     *  [firstRow, firstRow + nBlockRows) of the distance matrix
+     *  \return false if memory allocation failed
+     */
+    template <typename ProcessTile>
+    bool forEachTileInRows(size_t firstRow, size_t nBlockRows, const ProcessTile &processTile) const
+    {
+        const size_t nRowTiles = nBlockRows / distanceTileSize + !!(nBlockRows % distanceTileSize);
+        const size_t nTiles = nRowTiles * _nyTiles;
+        const size_t lastRow = firstRow + nBlockRows;
+        daal::tls<TileBuffers *> tlsBuffers([ = ]() { return allocateBuffers(); });
+
+        bool bMemoryAllocationFailed = false;
+        daal::threader_for(nTiles, nTiles, [ =, &tlsBuffers, &bMemoryAllocationFailed ](size_t iTile)
+        {
+            TileBuffers *buffers = tlsBuffers.local();
+            if (!buffers)
+            {
+                bMemoryAllocationFailed = true;
+                return;
+            }
+
+            const size_t startRow = firstRow + (iTile / _nyTiles) * distanceTileSize;
+            const size_t startCol = (iTile % _nyTiles) * distanceTileSize;
+            const size_t nRows = getTileSize(startRow, lastRow);
+            const size_t nCols = getTileSize(startCol, _ny);
+
+            normalizeRows(_xTable, startRow, nRows, buffers->u1);
+            normalizeRows(_yTable, startCol, nCols, buffers->u2);
+            computeTile(buffers->u1, nRows, buffers->u2, nCols, buffers->dist);
+            if (_xTable == _yTable)
+            {
+                for (size_t i = 0; i < nRows; i++)
+                {
+                    const size_t j = startRow + i;
+                    if (j >= startCol && j < startCol + nCols)
+                    {
+                        buffers->dist[i * nCols + j - startCol] = (algorithmFPType)0.0;
+                    }
+                }
+            }
+            processTile(startRow, nRows, startCol, nCols, buffers->dist);
+        } );
+
+        tlsBuffers.reduce([ = ](TileBuffers *buffers) { delete buffers; });
+        return !bMemoryAllocationFailed;
+    }
+
+    /**
+     *  Calls processTile(iColPart, startRow, nRows, startCol, nCols, dist) for every tile of the distance matrix.
+     *  The columns of tiles are split into nColParts parts of consecutive tiles. The tiles in the same rows and
+     *  in the same part are processed by one thread in the increasing order of columns, different rows of tiles
+     *  and different parts are processed in parallel. The distances on the main diagonal are not modified.
+     *  \return false if memory allocation failed
+     */
+    template <typename ProcessTile>
+    bool forEachTileByRows(size_t nColParts, const ProcessTile &processTile) const
+    {
+        const size_t nTasks = _nxTiles * nColParts;
+        daal::tls<TileBuffers *> tlsBuffers([ = ]() { return allocateBuffers(); });
+
+        bool bMemoryAllocationFailed = false;
+        daal::threader_for(nTasks, nTasks, [ =, &tlsBuffers, &bMemoryAllocationFailed ](size_t iTask)
+        {
+            TileBuffers *buffers = tlsBuffers.local();
+            if (!buffers)
+            {
+                bMemoryAllocationFailed = true;
+                return;
+            }
+
+            const size_t iRowTile = iTask / nColParts;
+            const size_t iColPart = iTask % nColParts;
+            const size_t startRow = iRowTile * distanceTileSize;
+            const size_t nRows = getTileSize(startRow, _nx);
+            normalizeRows(_xTable, startRow, nRows, buffers->u1);
+
+            const size_t endColTile = (iColPart + 1) * _nyTiles / nColParts;
+            for (size_t iColTile = iColPart * _nyTiles / nColParts; iColTile < endColTile; iColTile++)
+            {
+                const size_t startCol = iColTile * distanceTileSize;
+                const size_t nCols = getTileSize(startCol, _ny);
+                normalizeRows(_yTable, startCol, nCols, buffers->u2);
+                computeTile(buffers->u1, nRows, buffers->u2, nCols, buffers->dist);
+                processTile(iColPart, startRow, nRows, startCol, nCols, buffers->dist);
+            }
+        } );
+
+        tlsBuffers.reduce([ = ](TileBuffers *buffers) { delete buffers; });
+        return !bMemoryAllocationFailed;
+    }
+
+protected:
+    static size_t getTileSize(size_t start, size_t end)
+    {
+        return (start + distanceTileSize < end ? distanceTileSize : end - start);
+    }
+
+    TileBuffers *allocateBuffers() const
+    {
+        TileBuffers *buffers = new TileBuffers(_p);
+        if (buffers && !buffers->isValid())
+        {
+            delete buffers;
+            buffers = nullptr;
+        }
+        return buffers;
+    }
+
+    NumericTable *_xTable;
+    NumericTable *_yTable;
+    const bool _centered;
+    const size_t _p;
+    const size_t _nx;
+    const size_t _ny;
+    size_t _nxTiles;
+    size_t _nyTiles;
+};
+
+/**
+ *  Computes the distance matrix of the observations in the packed symmetric layout
+ *  \param[in]  tiles    Tiles of the distance matrix of the observations with themselves
+ *  \param[out] r        Packed array of n * (n + 1) / 2 elements
+ *  \param[in]  isLower  true for the lower packed layout, false for the upper one
+ *  \return false if memory allocation failed
+ */
+template <typename algorithmFPType, CpuType cpu>
+bool computePackedDistance(const DistanceTiles<algorithmFPType, cpu> &tiles, algorithmFPType *r, bool isLower)
+{
+    const size_t n = tiles.getNumberOfRows();
+    return tiles.forEachLowerTile([ = ](size_t startRow, size_t nRows, size_t startCol, size_t nCols, const algorithmFPType *dist)
+    {
+        for (size_t i = 0; i < nRows; i++)
+        {
+            const size_t iRow = startRow + i;
+            const size_t nColsInRow = (startRow == startCol ? i + 1 : nCols);
+            const algorithmFPType *distRow = dist + i * nCols;
+            if (isLower)
+            {
+                /* element (iRow, iCol), iCol <= iRow, is stored at iRow * (iRow + 1) / 2 + iCol */
+                algorithmFPType *rRow = r + iRow * (iRow + 1) / 2 + startCol;
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nColsInRow; j++)
+                {
+                    rRow[j] = distRow[j];
+                }
+            }
+            else
+            {
+                /* element (iCol, iRow), iCol <= iRow, is stored at iCol * n - iCol * (iCol - 1) / 2 + iRow - iCol */
+                for (size_t j = 0; j < nColsInRow; j++)
+                {
+                    const size_t iCol = startCol + j;
+                    r[iCol * n - iCol * (iCol - 1) / 2 + iRow - iCol] = distRow[j];
+                }
+            }
+        }
+    } );
+}
+
+/**
+ *  Computes the distance matrix block by block of rows and passes every block to processBlock(startRow, nRows, block),
+ *  where block contains nRows full rows of the distance matrix. The blocks are passed in the increasing order of rows.
+ *  \return false if memory allocation failed
+ */
+template <typename algorithmFPType, CpuType cpu, typename ProcessBlock>
+bool computeDistanceByRowBlocks(const DistanceTiles<algorithmFPType, cpu> &tiles, size_t nRowsInBlock, const ProcessBlock &processBlock)
+{
+    const size_t n = tiles.getNumberOfRows();
+    const size_t nCols = tiles.getNumberOfColumns();
+    if (nRowsInBlock > n) { nRowsInBlock = n; }
+
+    algorithmFPType *block = services::internal::service_malloc<algorithmFPType, cpu>(nRowsInBlock * nCols);
+    if (!block) { return false; }
+
+    bool isOk = true;
+    for (size_t firstRow = 0; isOk && firstRow < n; firstRow += nRowsInBlock)
+    {
+        const size_t nBlockRows = (firstRow + nRowsInBlock < n ? nRowsInBlock : n - firstRow);
+        isOk = tiles.forEachTileInRows(firstRow, nBlockRows,
+            [ = ](size_t startRow, size_t nRows, size_t startCol, size_t nTileCols, const algorithmFPType *dist)
+        {
+            for (size_t i = 0; i < nRows; i++)
+            {
+                algorithmFPType *blockRow = block + (startRow - firstRow + i) * nCols + startCol;
+                const algorithmFPType *distRow = dist + i * nTileCols;
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nTileCols; j++)
+                {
+                    blockRow[j] = distRow[j];
+                }
+            }
+        } );
+        if (isOk)
+        {
+            processBlock(firstRow, nBlockRows, block);
+        }
+    }
+
+    services::internal::service_free<algorithmFPType, cpu>(block);
+    return isOk;
+}
+
+/**
+ *  Bounded max-heap of the nearest neighbors of one observation. The neighbors are ordered by the distance,
+ *  the neighbors at equal distances are ordered by the index, so the result does not depend on the order of pushes
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct NeighborsHeap
+{
+    static bool isGreater(algorithmFPType d1, int i1, algorithmFPType d2, int i2)
+    {
+        return (d1 > d2 || (d1 == d2 && i1 > i2));
+    }
+
+    static void swap(algorithmFPType *dist, int *idx, size_t i, size_t j)
+    {
+        const algorithmFPType d = dist[i]; dist[i] = dist[j]; dist[j] = d;
+        const int k = idx[i]; idx[i] = idx[j]; idx[j] = k;
+    }
+
+    static void siftDown(algorithmFPType *dist, int *idx, size_t count, size_t i)
+    {
+        for (size_t child = 2 * i + 1; child < count; i = child, child = 2 * i + 1)
+        {
+            if (child + 1 < count && isGreater(dist[child + 1], idx[child + 1], dist[child], idx[child])) { child++; }
+            if (!isGreater(dist[child], idx[child], dist[i], idx[i])) { return; }
+            swap(dist, idx, i, child);
+        }
+    }
+
+    /**
+     *  Adds the neighbor to the heap of count elements which keeps at most k nearest neighbors
+     */
+    static void push(algorithmFPType *dist, int *idx, size_t &count, size_t k, algorithmFPType d, int index)
+    {
+        if (count < k)
+        {
+            size_t i = count++;
+            dist[i] = d;
+            idx[i]  = index;
+            for (size_t parent = (i - 1) / 2; i > 0 && isGreater(dist[i], idx[i], dist[parent], idx[parent]); i = parent, parent = (i - 1) / 2)
+            {
+                swap(dist, idx, i, parent);
+            }
+        }
+        else if (isGreater(dist[0], idx[0], d, index))
+        {
+            dist[0] = d;
+            idx[0]  = index;
+            siftDown(dist, idx, count, 0);
+        }
+    }
+
+    /**
+     *  Sorts the neighbors in the heap in the increasing order of distances
+     */
+    static void sort(algorithmFPType *dist, int *idx, size_t count)
+    {
+        for (size_t last = count; last > 1; last--)
+        {
+            swap(dist, idx, 0, last - 1);
+            siftDown(dist, idx, last - 1, 0);
+        }
+    }
+};
+
+/**
+ *  Finds k nearest neighbors among the observations of the columns for every observation of the rows.
+ *  When the tiles of the rows are too few to load all the threads, the tiles of the columns are split into parts,
+ *  the neighbors are searched in every part in parallel and the heaps of the parts are merged for every row
+ *  \param[in]  tiles        Tiles of the distance matrix
+ *  \param[in]  k            Number of neighbors
+ *  \param[in]  excludeSelf  true if an observation must not be a neighbor of itself, for the matrix of the observations with themselves
+ *  \param[out] idx          Indices of the neighbors of every observation sorted by the distance, nRows x k array
+ *  \param[out] dist         Distances to the neighbors of every observation, nRows x k array
+ *  \return false if memory allocation failed
+ */
+template <typename algorithmFPType, CpuType cpu>
+bool computeNearestNeighbors(const DistanceTiles<algorithmFPType, cpu> &tiles, size_t k, bool excludeSelf,
+                             int *idx, algorithmFPType *dist)
+{
+    typedef NeighborsHeap<algorithmFPType, cpu> Heap;
+    const size_t n = tiles.getNumberOfRows();
+    const size_t nRowTiles = tiles.getNumberOfRowTiles();
+    const size_t nColTiles = tiles.getNumberOfColumnTiles();
+    const size_t nThreads = daal::threader_get_threads_number();
+
+    size_t nColParts = (nRowTiles && nRowTiles < nThreads ? (nThreads + nRowTiles - 1) / nRowTiles : 1);
+    if (nColParts > nColTiles) { nColParts = nColTiles; }
+    if (nColParts == 0) { nColParts = 1; }
+
+    /* The heaps of the first part are stored in the results, the heaps of the other parts in the temporary arrays */
+    const size_t nPartElements = (nColParts - 1) * n * k;
+    size_t *heapSize = services::internal::service_calloc<size_t, cpu>(nColParts * n);
+    algorithmFPType *partDist = (nPartElements ? services::internal::service_malloc<algorithmFPType, cpu>(nPartElements) : nullptr);
+    int *partIdx = (nPartElements ? services::internal::service_malloc<int, cpu>(nPartElements) : nullptr);
+    if (!heapSize || (nPartElements && (!partDist || !partIdx)))
+    {
+        services::internal::service_free<size_t, cpu>(heapSize);
+        services::internal::service_free<algorithmFPType, cpu>(partDist);
+        services::internal::service_free<int, cpu>(partIdx);
+        return false;
+    }
+
+    const bool isOk = tiles.forEachTileByRows(nColParts,
+        [ = ](size_t iColPart, size_t startRow, size_t nRows, size_t startCol, size_t nCols, const algorithmFPType *tileDist)
+    {
+        algorithmFPType *heapDist = (iColPart ? partDist + (iColPart - 1) * n * k : dist);
+        int *heapIdx = (iColPart ? partIdx + (iColPart - 1) * n * k : idx);
+        for (size_t i = 0; i < nRows; i++)
+        {
+            const size_t iRow = startRow + i;
+            const algorithmFPType *tileRow = tileDist + i * nCols;
+            algorithmFPType *rowDist = heapDist + iRow * k;
+            int *rowIdx = heapIdx + iRow * k;
+            size_t &count = heapSize[iColPart * n + iRow];
+            for (size_t j = 0; j < nCols; j++)
+            {
+                if (count == k && !(tileRow[j] <= rowDist[0])) { continue; }
+                if (excludeSelf && startCol + j == iRow) { continue; }
+                Heap::push(rowDist, rowIdx, count, k, tileRow[j], (int)(startCol + j));
+            }
+        }
+    } );
+
+    if (isOk)
+    {
+        daal::threader_for(n, n, [ = ](size_t iRow)
+        {
+            algorithmFPType *rowDist = dist + iRow * k;
+            int *rowIdx = idx + iRow * k;
+            size_t &count = heapSize[iRow];
+            for (size_t iColPart = 1; iColPart < nColParts; iColPart++)
+            {
+                const algorithmFPType *partRowDist = partDist + ((iColPart - 1) * n + iRow) * k;
+                const int *partRowIdx = partIdx + ((iColPart - 1) * n + iRow) * k;
+                const size_t partCount = heapSize[iColPart * n + iRow];
+                for (size_t j = 0; j < partCount; j++)
+                {
+                    Heap::push(rowDist, rowIdx, count, k, partRowDist[j], partRowIdx[j]);
+                }
+            }
+            Heap::sort(rowDist, rowIdx, count);
+        } );
+    }
+
+    services::internal::service_free<size_t, cpu>(heapSize);
+    services::internal::service_free<algorithmFPType, cpu>(partDist);
+    services::internal::service_free<int, cpu>(partIdx);
+    return isOk;
+}
+
+} // namespace internal
+} // namespace daal
+
+#endif
@@ -48,11 +48,11 @@ template <CpuType cpu>
 class NumericTableDictionaryCPU : public NumericTableDictionary
 {
 public:
-    NumericTableDictionaryCPU( size_t nfeat )
+    NumericTableDictionaryCPU( size_t nfeat, DictionaryIface::FeaturesEqual featuresEqual = DictionaryIface::equal )
     {
         _nfeat = 0;
-        _dict  = (NumericTableFeature *)(new NumericTableFeatureCPU<cpu>[1]);
-        _featuresEqual = DictionaryIface::equal;
+        _featuresEqual = (nfeat ? featuresEqual : DictionaryIface::equal);
+        _dict  = (NumericTableFeature *)(new NumericTableFeatureCPU<cpu>[_featuresEqual == DictionaryIface::equal ? 1 : nfeat]);
         if(nfeat) { setNumberOfFeatures(nfeat); }
     };
 
@@ -355,6 +355,393 @@ private:
     NumericTableDictionary *_cpuDict;
 };
 
+/**
+ * Numeric table that provides access to the subset of rows of another numeric table.
+ * Rows of the subset are given by the array of their indices in the original table,
+ * so the data of the subset is not copied: the blocks of rows and columns are gathered
+ * from the original table on request. Consecutive indices are read with one request
+ * to the original table. The read-only blocks of rows that map to consecutive rows
+ * of a homogeneous original table of the same type point to its data without copying,
+ * the other blocks are gathered into the buffer of the block that holds the requested rows only.
+ */
+template <CpuType cpu>
+class SubsetNumericTableCPU : public NumericTable
+{
+public:
+    SubsetNumericTableCPU(const NumericTable *table, const size_t *rowIndices, size_t nRows)
+        : NumericTable(new NumericTableDictionaryCPU<cpu>(table->getNumberOfColumns(), getFeaturesEqual(table))),
+          _table(const_cast<NumericTable *>(table)), _rowIndices(rowIndices)
+    {
+        _cpuDict = _ddict.get();
+        _layout = NumericTableIface::layout_unknown;
+        _memStatus = userAllocated;
+        setNumberOfRows(nRows);
+
+        /* The subset keeps the types of the features of the original table */
+        NumericTableDictionary *srcDict = table->getDictionary();
+        if (srcDict)
+        {
+            size_t nFeatures = (_cpuDict->getFeaturesEqual() == DictionaryIface::equal ? 1 : _cpuDict->getNumberOfFeatures());
+            for (size_t i = 0; i < nFeatures && i < srcDict->getNumberOfFeatures(); i++)
+            {
+                _cpuDict->setFeature((*srcDict)[i], i);
+            }
+        }
+    }
+
+    virtual ~SubsetNumericTableCPU()
+    {
+        delete _cpuDict;
+    }
+
+    /**
+     * Sets the indices of the rows of the subset
+     * \param[in] rowIndices  Indices of the rows in the original table
+     * \param[in] nRows       Number of rows in the subset
+     */
+    void setRowIndices(const size_t *rowIndices, size_t nRows)
+    {
+        _rowIndices = rowIndices;
+        setNumberOfRows(nRows);
+    }
+
+    int getSerializationTag() DAAL_C11_OVERRIDE { return 0; }
+    void serializeImpl(InputDataArchive *archive) DAAL_C11_OVERRIDE { this->_errors->add(services::ErrorMethodNotSupported); }
+    void deserializeImpl(OutputDataArchive *archive) DAAL_C11_OVERRIDE { this->_errors->add(services::ErrorMethodNotSupported); }
+
+    void allocateDataMemory(daal::MemType type = daal::dram) DAAL_C11_OVERRIDE
+    {
+        this->_errors->add(services::ErrorMethodNotSupported);
+    }
+    void freeDataMemory() DAAL_C11_OVERRIDE {}
+
+    void getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<double>& block) DAAL_C11_OVERRIDE
+    {
+        getTBlock<double>(vector_idx, vector_num, rwflag, block);
+    }
+    void getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<float>& block) DAAL_C11_OVERRIDE
+    {
+        getTBlock<float>(vector_idx, vector_num, rwflag, block);
+    }
+    void getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<int>& block) DAAL_C11_OVERRIDE
+    {
+        getTBlock<int>(vector_idx, vector_num, rwflag, block);
+    }
+
+    void releaseBlockOfRows(BlockDescriptor<double>& block) DAAL_C11_OVERRIDE
+    {
+        releaseTBlock<double>(block);
+    }
+    void releaseBlockOfRows(BlockDescriptor<float>& block) DAAL_C11_OVERRIDE
+    {
+        releaseTBlock<float>(block);
+    }
+    void releaseBlockOfRows(BlockDescriptor<int>& block) DAAL_C11_OVERRIDE
+    {
+        releaseTBlock<int>(block);
+    }
+
+    void getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                  ReadWriteMode rwflag, BlockDescriptor<double>& block) DAAL_C11_OVERRIDE
+    {
+        getTFeature<double>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    void getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                  ReadWriteMode rwflag, BlockDescriptor<float>& block) DAAL_C11_OVERRIDE
+    {
+        getTFeature<float>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    void getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                  ReadWriteMode rwflag, BlockDescriptor<int>& block) DAAL_C11_OVERRIDE
+    {
+        getTFeature<int>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+
+    void releaseBlockOfColumnValues(BlockDescriptor<double>& block) DAAL_C11_OVERRIDE
+    {
+        releaseTFeature<double>(block);
+    }
+    void releaseBlockOfColumnValues(BlockDescriptor<float>& block) DAAL_C11_OVERRIDE
+    {
+        releaseTFeature<float>(block);
+    }
+    void releaseBlockOfColumnValues(BlockDescriptor<int>& block) DAAL_C11_OVERRIDE
+    {
+        releaseTFeature<int>(block);
+    }
+
+protected:
+    /* Returns the number of consecutive indices of the original rows starting from the given row of the subset */
+    size_t getRunLength(size_t idx, size_t nrows) const
+    {
+        size_t n = 1;
+        while (n < nrows && _rowIndices[idx + n] == _rowIndices[idx] + n) { n++; }
+        return n;
+    }
+
+    template <typename T>
+    void getTBlock(size_t idx, size_t nrows, ReadWriteMode rwFlag, BlockDescriptor<T>& block)
+    {
+        size_t ncols = getNumberOfColumns();
+        size_t nobs  = getNumberOfRows();
+        block.setDetails(0, idx, rwFlag);
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer(ncols, 0);
+            return;
+        }
+        nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
+
+        /* The rows that are consecutive in the homogeneous original table are read in place */
+        if (rwFlag == readOnly && getRunLength(idx, nrows) == nrows)
+        {
+            HomogenNumericTable<T> *homogenTable = dynamic_cast<HomogenNumericTable<T> *>(_table);
+            if (homogenTable && homogenTable->getArray())
+            {
+                block.setPtr(homogenTable->getArray() + _rowIndices[idx] * ncols, ncols, nrows);
+                return;
+            }
+        }
+
+        if (!block.resizeBuffer(ncols, nrows)) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+        if (!(rwFlag & (int)readOnly)) { return; }
+
+        T *dst = block.getBlockPtr();
+        BlockDescriptor<T> src;
+        for (size_t i = 0; i < nrows; )
+        {
+            size_t n = getRunLength(idx + i, nrows - i);
+            _table->getBlockOfRows(_rowIndices[idx + i], n, readOnly, src);
+            const T *srcPtr = src.getBlockPtr();
+            for (size_t j = 0; j < n * ncols; j++)
+            {
+                dst[i * ncols + j] = srcPtr[j];
+            }
+            _table->releaseBlockOfRows(src);
+            i += n;
+        }
+    }
+
+    template <typename T>
+    void releaseTBlock(BlockDescriptor<T>& block)
+    {
+        if (block.getRWFlag() & (int)writeOnly)
+        {
+            size_t ncols = getNumberOfColumns();
+            size_t nrows = block.getNumberOfRows();
+            size_t idx   = block.getRowsOffset();
+            const T *srcPtr = block.getBlockPtr();
+            BlockDescriptor<T> dst;
+            for (size_t i = 0; i < nrows; )
+            {
+                size_t n = getRunLength(idx + i, nrows - i);
+                _table->getBlockOfRows(_rowIndices[idx + i], n, writeOnly, dst);
+                T *dstPtr = dst.getBlockPtr();
+                for (size_t j = 0; j < n * ncols; j++)
+                {
+                    dstPtr[j] = srcPtr[i * ncols + j];
+                }
+                _table->releaseBlockOfRows(dst);
+                i += n;
+            }
+        }
+        block.setDetails(0, 0, 0);
+    }
+
+    template <typename T>
+    void getTFeature(size_t feat_idx, size_t idx, size_t nrows, ReadWriteMode rwFlag, BlockDescriptor<T>& block)
+    {
+        size_t nobs = getNumberOfRows();
+        block.setDetails(feat_idx, idx, rwFlag);
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer(1, 0);
+            return;
+        }
+        nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
+
+        if (!block.resizeBuffer(1, nrows)) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+        if (!(rwFlag & (int)readOnly)) { return; }
+
+        T *dst = block.getBlockPtr();
+        BlockDescriptor<T> src;
+        for (size_t i = 0; i < nrows; )
+        {
+            size_t n = getRunLength(idx + i, nrows - i);
+            _table->getBlockOfColumnValues(feat_idx, _rowIndices[idx + i], n, readOnly, src);
+            const T *srcPtr = src.getBlockPtr();
+            for (size_t j = 0; j < n; j++)
+            {
+                dst[i + j] = srcPtr[j];
+            }
+            _table->releaseBlockOfColumnValues(src);
+            i += n;
+        }
+    }
+
+    template <typename T>
+    void releaseTFeature(BlockDescriptor<T>& block)
+    {
+        if (block.getRWFlag() & (int)writeOnly)
+        {
+            size_t feat_idx = block.getColumnsOffset();
+            size_t nrows = block.getNumberOfRows();
+            size_t idx   = block.getRowsOffset();
+            const T *srcPtr = block.getBlockPtr();
+            BlockDescriptor<T> dst;
+            for (size_t i = 0; i < nrows; )
+            {
+                size_t n = getRunLength(idx + i, nrows - i);
+                _table->getBlockOfColumnValues(feat_idx, _rowIndices[idx + i], n, writeOnly, dst);
+                T *dstPtr = dst.getBlockPtr();
+                for (size_t j = 0; j < n; j++)
+                {
+                    dstPtr[j] = srcPtr[i + j];
+                }
+                _table->releaseBlockOfColumnValues(dst);
+                i += n;
+            }
+        }
+        block.setDetails(0, 0, 0);
+    }
+
+    NumericTable *_table;
+    const size_t *_rowIndices;
+
+private:
+    static DictionaryIface::FeaturesEqual getFeaturesEqual(const NumericTable *table)
+    {
+        NumericTableDictionary *dict = table->getDictionary();
+        return (dict ? dict->getFeaturesEqual() : DictionaryIface::equal);
+    }
+
+    NumericTableDictionary *_cpuDict;
+};
+
+/**
+ * Numeric table that provides access to the subset of rows of another numeric table in the CSR layout.
+ * The sparse blocks are gathered from the original table on request and are available for reading only
+ */
+template <CpuType cpu>
+class CSRSubsetNumericTableCPU : public SubsetNumericTableCPU<cpu>, public CSRNumericTableIface
+{
+public:
+    CSRSubsetNumericTableCPU(const NumericTable *table, const size_t *rowIndices, size_t nRows)
+        : SubsetNumericTableCPU<cpu>(table, rowIndices, nRows),
+          _csrTable(dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(table)))
+    {
+        this->_layout = NumericTableIface::csrArray;
+    }
+
+    size_t getDataSize() DAAL_C11_OVERRIDE
+    {
+        size_t nobs = this->getNumberOfRows();
+        size_t dataSize = 0;
+        CSRBlockDescriptor<double> src;
+        for (size_t i = 0; i < nobs; )
+        {
+            size_t n = this->getRunLength(i, nobs - i);
+            _csrTable->getSparseBlock(this->_rowIndices[i], n, readOnly, src);
+            dataSize += src.getDataSize();
+            _csrTable->releaseSparseBlock(src);
+            i += n;
+        }
+        return dataSize;
+    }
+
+    void getSparseBlock(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, CSRBlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        getSparseTBlock<double>(vector_idx, vector_num, rwflag, block);
+    }
+    void getSparseBlock(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, CSRBlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        getSparseTBlock<float>(vector_idx, vector_num, rwflag, block);
+    }
+    void getSparseBlock(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, CSRBlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        getSparseTBlock<int>(vector_idx, vector_num, rwflag, block);
+    }
+
+    void releaseSparseBlock(CSRBlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        block.setDetails(0, 0, 0);
+    }
+    void releaseSparseBlock(CSRBlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        block.setDetails(0, 0, 0);
+    }
+    void releaseSparseBlock(CSRBlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        block.setDetails(0, 0, 0);
+    }
+
+protected:
+    template <typename T>
+    void getSparseTBlock(size_t idx, size_t nrows, ReadWriteMode rwFlag, CSRBlockDescriptor<T> &block)
+    {
+        size_t ncols = this->getNumberOfColumns();
+        size_t nobs  = this->getNumberOfRows();
+        block.setDetails(ncols, idx, rwFlag);
+
+        if (idx >= nobs)
+        {
+            block.resizeValuesBuffer(0);
+            return;
+        }
+        nrows = (idx + nrows < nobs) ? nrows : nobs - idx;
+
+        if (!block.resizeRowsBuffer(nrows)) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+        size_t *rowOffsets = block.getBlockRowIndicesPtr();
+
+        /* Compute the row offsets of the block */
+        CSRBlockDescriptor<T> src;
+        rowOffsets[0] = 1;
+        for (size_t i = 0; i < nrows; )
+        {
+            size_t n = this->getRunLength(idx + i, nrows - i);
+            _csrTable->getSparseBlock(this->_rowIndices[idx + i], n, readOnly, src);
+            const size_t *srcRowOffsets = src.getBlockRowIndicesPtr();
+            for (size_t j = 0; j < n; j++)
+            {
+                rowOffsets[i + j + 1] = rowOffsets[i + j] + (srcRowOffsets[j + 1] - srcRowOffsets[j]);
+            }
+            _csrTable->releaseSparseBlock(src);
+            i += n;
+        }
+
+        /* Values and column indices are stored in one buffer, column indices follow the values */
+        size_t nValues = rowOffsets[nrows] - 1;
+        size_t valuesSize = ((nValues * sizeof(T) + sizeof(size_t) - 1) / sizeof(size_t)) * sizeof(size_t);
+        size_t bufferSize = (valuesSize + nValues * sizeof(size_t) + sizeof(T) - 1) / sizeof(T);
+        if (!block.resizeValuesBuffer(bufferSize)) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+        T *values = block.getBlockValuesPtr();
+        size_t *colIndices = (size_t *)((char *)values + valuesSize);
+
+        for (size_t i = 0; i < nrows; )
+        {
+            size_t n = this->getRunLength(idx + i, nrows - i);
+            _csrTable->getSparseBlock(this->_rowIndices[idx + i], n, readOnly, src);
+            const T *srcValues = src.getBlockValuesPtr();
+            const size_t *srcColIndices = src.getBlockColumnIndicesPtr();
+            size_t offset = rowOffsets[i] - 1;
+            size_t nSrcValues = src.getDataSize();
+            for (size_t j = 0; j < nSrcValues; j++)
+            {
+                values[offset + j] = srcValues[j];
+                colIndices[offset + j] = srcColIndices[j];
+            }
+            _csrTable->releaseSparseBlock(src);
+            i += n;
+        }
+        block.setValuesPtr(values, nValues);
+        block.setColumnIndicesPtr(colIndices, nValues);
+    }
+
+    CSRNumericTableIface *_csrTable;
+};
+
 template<typename algorithmFPType, typename algorithmFPAccessType, CpuType cpu, ReadWriteMode mode, typename NumericTableType>
 class GetRows
 {
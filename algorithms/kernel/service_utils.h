@@ -36,6 +36,18 @@ inline void swap(T& x, T& y)
     y = tmp;
 }
 
+template<CpuType cpu, class T>
+inline const T& min(const T& x, const T& y)
+{
+    return (y < x ? y : x);
+}
+
+template<CpuType cpu, class T>
+inline const T& max(const T& x, const T& y)
+{
+    return (x < y ? y : x);
+}
+
 } // namespace daal
 
 #endif
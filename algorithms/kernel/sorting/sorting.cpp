@@ -37,6 +37,12 @@ namespace interface1
 {
 
 __DAAL_REGISTER_SERIALIZATION_CLASS(Result, SERIALIZATION_SORTING_RESULT_ID);
+void Parameter::check() const
+{
+    DAAL_CHECK_EX((resultsToCompute & (computeSortedData | computeSortedIndices)) != 0, ErrorIncorrectParameter, ParameterName,
+                  resultsToComputeStr());
+}
+
 Input::Input() : daal::algorithms::Input(1) {}
 
 /**
@@ -64,13 +70,13 @@ void Input::set(InputId id, const data_management::NumericTablePtr &ptr)
  * \param[in] method    Algorithm computation method
  * \param[in] par       Pointer to the parameters of the algorithm
  */
-void Input::check(const Parameter *par, int method) const
+void Input::check(const daal::algorithms::Parameter *par, int method) const
 {
     int unexpectedLayouts = data_management::packed_mask;
     if (!data_management::checkNumericTable(get(data).get(), this->_errors.get(), dataStr(), unexpectedLayouts)) { return; }
 }
 
-Result::Result() : daal::algorithms::Result(1) {}
+Result::Result() : daal::algorithms::Result(2) {}
 
 /**
  * Returns the final result of the sorting algorithm
@@ -98,15 +104,24 @@ void Result::set(ResultId id, const data_management::NumericTablePtr &value)
  * \param[in] par     %Parameter of algorithm
  * \param[in] method Algorithm computation method
  */
-void Result::check(const daal::algorithms::Input *in, const Parameter *par, int method) const
+void Result::check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const
 {
     const Input *input = static_cast<const Input *>(in);
+    const Parameter *parameter = static_cast<const Parameter *>(par);
+    const DAAL_UINT64 resultsToCompute = (parameter ? parameter->resultsToCompute : computeSortedData);
 
     size_t nFeatures = input->get(data)->getNumberOfColumns();
     size_t nVectors  = input->get(data)->getNumberOfRows();
     int unexpectedLayouts = data_management::packed_mask;
 
-    if (!data_management::checkNumericTable(get(sortedData).get(), this->_errors.get(), sortedDataStr(), unexpectedLayouts, 0, nFeatures, nVectors)) { return; }
+    if (resultsToCompute & computeSortedData)
+    {
+        if (!data_management::checkNumericTable(get(sortedData).get(), this->_errors.get(), sortedDataStr(), unexpectedLayouts, 0, nFeatures, nVectors)) { return; }
+    }
+    if (resultsToCompute & computeSortedIndices)
+    {
+        if (!data_management::checkNumericTable(get(sortedIndices).get(), this->_errors.get(), sortedIndicesStr(), unexpectedLayouts, 0, nFeatures, nVectors)) { return; }
+    }
 }
 
 }// namespace interface1
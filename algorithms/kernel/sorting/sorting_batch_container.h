@@ -55,7 +55,8 @@ void BatchContainer<algorithmFPType, method, cpu>::compute()
     Input *input   = static_cast<Input *>(_in);
 
     daal::services::Environment::env &env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::SortingKernel, __DAAL_KERNEL_ARGUMENTS(defaultDense, algorithmFPType), compute, input->get(data).get(), result->get(sortedData).get());
+    __DAAL_CALL_KERNEL(env, internal::SortingKernel, __DAAL_KERNEL_ARGUMENTS(defaultDense, algorithmFPType), compute, input->get(data).get(),
+                       result->get(sortedData).get(), result->get(sortedIndices).get());
 }
 
 } // namespace daal::algorithms::sorting
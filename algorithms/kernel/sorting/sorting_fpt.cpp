@@ -49,7 +49,31 @@ DAAL_EXPORT void Result::allocate(const daal::algorithms::Input *input, const in
                                                                                 data_management::NumericTable::doAllocate)));
 }
 
+template <typename algorithmFPType>
+DAAL_EXPORT void Result::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const Input *in = static_cast<const Input *>(input);
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+
+    size_t nFeatures = in->get(data)->getNumberOfColumns();
+    size_t nVectors = in->get(data)->getNumberOfRows();
+
+    if (par->resultsToCompute & computeSortedData)
+    {
+        Argument::set(sortedData, data_management::SerializationIfacePtr(
+                          new data_management::HomogenNumericTable<algorithmFPType>(nFeatures, nVectors,
+                                                                                    data_management::NumericTable::doAllocate)));
+    }
+    if (par->resultsToCompute & computeSortedIndices)
+    {
+        Argument::set(sortedIndices, data_management::SerializationIfacePtr(
+                          new data_management::HomogenNumericTable<int>(nFeatures, nVectors, data_management::NumericTable::doAllocate)));
+    }
+}
+
 template DAAL_EXPORT void Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const int method);
+template DAAL_EXPORT void Result::allocate<DAAL_FPTYPE>(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter,
+                                                        const int method);
 
 }// namespace interface1
 }// namespace sorting
@@ -18,16 +18,25 @@
 /*
 //++
 //  Sorting observations algorithm implementation
+//
+//  Every feature is sorted with the LSD radix sort of the keys that preserve
+//  the order of the floating-point values: the sign bit of the non-negative
+//  values is set, and all bits of the negative values are inverted. The
+//  passes over the digits the keys do not differ in are skipped. The features
+//  are sorted in parallel. If the features are too few to load all threads
+//  and the number of observations is large, every feature is split into the
+//  blocks of observations that compute the histograms of the digits and
+//  scatter the keys in parallel. The radix sort is stable, so the indices of
+//  the observations with equal values keep their original order.
 //--
 */
 
 #ifndef __SORTING_IMPL__
 #define __SORTING_IMPL__
 
-#include "service_micro_table.h"
+#include "service_numeric_table.h"
 #include "service_memory.h"
-#include "service_math.h"
-#include "service_stat.h"
+#include "threading.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -40,21 +49,284 @@ namespace sorting
 {
 namespace internal
 {
+
+template<typename algorithmFPType> struct RadixKey {};
+template<> struct RadixKey<float>  { typedef unsigned int Type; };
+template<> struct RadixKey<double> { typedef DAAL_UINT64 Type; };
+
+template<typename algorithmFPType, CpuType cpu>
+struct RadixSort
+{
+    typedef typename RadixKey<algorithmFPType>::Type KeyType;
+
+    static const size_t nBuckets = (size_t)1 << __SORTING_RADIX_BITS;
+    static const size_t nPasses = sizeof(KeyType) * 8 / __SORTING_RADIX_BITS;
+
+    static KeyType signBit() { return (KeyType)1 << (sizeof(KeyType) * 8 - 1); }
+
+    static KeyType toKey(algorithmFPType value)
+    {
+        union { algorithmFPType value; KeyType key; } u;
+        u.value = value;
+        return (u.key & signBit()) ? ~u.key : (u.key | signBit());
+    }
+
+    static algorithmFPType fromKey(KeyType key)
+    {
+        union { algorithmFPType value; KeyType key; } u;
+        u.key = (key & signBit()) ? (key & ~signBit()) : ~key;
+        return u.value;
+    }
+
+    static size_t digit(KeyType key, size_t pass) { return (size_t)(key >> (pass * __SORTING_RADIX_BITS)) & (nBuckets - 1); }
+
+    /* Reads the keys of the feature j of the observations [first, last) */
+    static void load(const algorithmFPType *data, size_t nFeatures, size_t j, size_t first, size_t last, KeyType *keys, int *indices)
+    {
+        for (size_t i = first; i < last; i++) { keys[i] = toKey(data[i * nFeatures + j]); }
+        if (indices)
+        {
+            for (size_t i = first; i < last; i++) { indices[i] = (int)i; }
+        }
+    }
+
+    /* Writes the sorted values and indices of the feature j of the observations [first, last) */
+    static void store(const KeyType *keys, const int *indices, size_t nFeatures, size_t j, size_t first, size_t last,
+                      algorithmFPType *sortedData, int *sortedIndices)
+    {
+        if (sortedData)
+        {
+            for (size_t i = first; i < last; i++) { sortedData[i * nFeatures + j] = fromKey(keys[i]); }
+        }
+        if (sortedIndices)
+        {
+            for (size_t i = first; i < last; i++) { sortedIndices[i * nFeatures + j] = indices[i]; }
+        }
+    }
+
+    /* Adds the histograms of all digits of the keys [first, last) to counts */
+    static void countDigits(const KeyType *keys, size_t first, size_t last, size_t *counts)
+    {
+        for (size_t i = first; i < last; i++)
+        {
+            const KeyType key = keys[i];
+            for (size_t pass = 0; pass < nPasses; pass++) { counts[pass * nBuckets + digit(key, pass)]++; }
+        }
+    }
+
+    /* Moves the keys [first, last) to the positions given by the offsets of their digits */
+    static void scatter(size_t pass, size_t first, size_t last, const KeyType *keys, const int *indices, size_t *offsets,
+                        KeyType *dstKeys, int *dstIndices)
+    {
+        if (indices)
+        {
+            for (size_t i = first; i < last; i++)
+            {
+                const size_t pos = offsets[digit(keys[i], pass)]++;
+                dstKeys[pos] = keys[i];
+                dstIndices[pos] = indices[i];
+            }
+        }
+        else
+        {
+            for (size_t i = first; i < last; i++) { dstKeys[offsets[digit(keys[i], pass)]++] = keys[i]; }
+        }
+    }
+
+    /*
+     * Sorts n keys and the optional indices by one thread. On exit keys and indices point to the sorted data,
+     * the buffers are swapped with them after every pass. counts is the buffer of size nPasses * nBuckets
+     */
+    static void sort(size_t n, KeyType *&keys, KeyType *&keysBuffer, int *&indices, int *&indicesBuffer, size_t *counts)
+    {
+        for (size_t i = 0; i < nPasses * nBuckets; i++) { counts[i] = 0; }
+        countDigits(keys, 0, n, counts);
+
+        for (size_t pass = 0; pass < nPasses; pass++)
+        {
+            size_t * const offsets = counts + pass * nBuckets;
+            if (offsets[digit(keys[0], pass)] == n) { continue; }
+
+            size_t offset = 0;
+            for (size_t d = 0; d < nBuckets; d++)
+            {
+                const size_t count = offsets[d];
+                offsets[d] = offset;
+                offset += count;
+            }
+            scatter(pass, 0, n, keys, indices, offsets, keysBuffer, indicesBuffer);
+            swap(keys, keysBuffer);
+            swap(indices, indicesBuffer);
+        }
+    }
+
+    /*
+     * Sorts n keys and the optional indices by nBlocks threads, every thread processes the contiguous block of keys.
+     * blockCounts is the buffer of size nBlocks * nPasses * nBuckets
+     */
+    static void sortParallel(size_t n, size_t nBlocks, KeyType *&keys, KeyType *&keysBuffer, int *&indices, int *&indicesBuffer,
+                             size_t *blockCounts)
+    {
+        const size_t countsSize = nPasses * nBuckets;
+        daal::threader_for(nBlocks, nBlocks, [=](size_t iBlock)
+        {
+            size_t * const counts = blockCounts + iBlock * countsSize;
+            for (size_t i = 0; i < countsSize; i++) { counts[i] = 0; }
+            countDigits(keys, iBlock * n / nBlocks, (iBlock + 1) * n / nBlocks, counts);
+        } );
+
+        /* The histograms of all keys do not depend on their order, the passes they are skipped for are known in advance */
+        bool skip[nPasses];
+        for (size_t pass = 0; pass < nPasses; pass++)
+        {
+            const size_t d = digit(keys[0], pass);
+            size_t count = 0;
+            for (size_t iBlock = 0; iBlock < nBlocks; iBlock++) { count += blockCounts[iBlock * countsSize + pass * nBuckets + d]; }
+            skip[pass] = (count == n);
+        }
+
+        for (size_t pass = 0; pass < nPasses; pass++)
+        {
+            if (skip[pass]) { continue; }
+
+            /* Histograms of the digits of the blocks in the current order of the keys */
+            if (pass)
+            {
+                daal::threader_for(nBlocks, nBlocks, [=](size_t iBlock)
+                {
+                    size_t * const counts = blockCounts + iBlock * countsSize + pass * nBuckets;
+                    for (size_t d = 0; d < nBuckets; d++) { counts[d] = 0; }
+                    for (size_t i = iBlock * n / nBlocks; i < (iBlock + 1) * n / nBlocks; i++) { counts[digit(keys[i], pass)]++; }
+                } );
+            }
+
+            /* The keys of the block go after the keys with the same digit from the previous blocks */
+            size_t offset = 0;
+            for (size_t d = 0; d < nBuckets; d++)
+            {
+                for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+                {
+                    size_t &blockOffset = blockCounts[iBlock * countsSize + pass * nBuckets + d];
+                    const size_t count = blockOffset;
+                    blockOffset = offset;
+                    offset += count;
+                }
+            }
+
+            const KeyType * const srcKeys = keys;
+            const int * const srcIndices = indices;
+            KeyType * const dstKeys = keysBuffer;
+            int * const dstIndices = indicesBuffer;
+            daal::threader_for(nBlocks, nBlocks, [=](size_t iBlock)
+            {
+                scatter(pass, iBlock * n / nBlocks, (iBlock + 1) * n / nBlocks, srcKeys, srcIndices,
+                        blockCounts + iBlock * countsSize + pass * nBuckets, dstKeys, dstIndices);
+            } );
+            swap(keys, keysBuffer);
+            swap(indices, indicesBuffer);
+        }
+    }
+
+    template<typename T>
+    static void swap(T *&a, T *&b)
+    {
+        T * const tmp = a;
+        a = b;
+        b = tmp;
+    }
+};
+
 template<Method method, typename algorithmFPType, CpuType cpu>
-void SortingKernel<method, algorithmFPType, cpu>::compute(NumericTable *inputTable, NumericTable *outputTable)
+void SortingKernel<method, algorithmFPType, cpu>::compute(NumericTable *inputTable, NumericTable *outputTable, NumericTable *indicesTable)
 {
-    size_t nFeatures = inputTable->getNumberOfColumns();
-    size_t nVectors  = inputTable->getNumberOfRows();
+    typedef RadixSort<algorithmFPType, cpu> Sort;
+    typedef typename Sort::KeyType KeyType;
+
+    const size_t nFeatures = inputTable->getNumberOfColumns();
+    const size_t nVectors  = inputTable->getNumberOfRows();
+
+    ReadRows<algorithmFPType, cpu> inputBlock(inputTable, 0, nVectors);
+    WriteOnlyRows<algorithmFPType, cpu> outputBlock(outputTable, 0, nVectors);
+    WriteOnlyRows<int, cpu> indicesBlock(indicesTable, 0, nVectors);
+    const algorithmFPType * const data = inputBlock.get();
+    algorithmFPType * const sortedData = outputBlock.get();
+    int * const sortedIndices = indicesBlock.get();
+    if (!data || (outputTable && !sortedData) || (indicesTable && !sortedIndices))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    if (!nVectors) { return; }
+
+    const bool computeIndices = (sortedIndices != nullptr);
+    const size_t nThreads = daal::threader_get_threads_number();
+    const size_t countsSize = Sort::nPasses * Sort::nBuckets;
+
+    if (nVectors >= __SORTING_PARALLEL_THRESHOLD && nFeatures < nThreads)
+    {
+        /* The features are sorted one by one, every feature is split into the blocks processed in parallel */
+        size_t nBlocks = nVectors / __SORTING_BLOCK_SIZE;
+        if (nBlocks > nThreads) { nBlocks = nThreads; }
+
+        TArray<KeyType, cpu> keysArray(nVectors);
+        TArray<KeyType, cpu> keysBufferArray(nVectors);
+        TArray<int, cpu> indicesArray(computeIndices ? nVectors : 0);
+        TArray<int, cpu> indicesBufferArray(computeIndices ? nVectors : 0);
+        TArray<size_t, cpu> countsArray(nBlocks * countsSize);
+        if (!keysArray.get() || !keysBufferArray.get() || !countsArray.get() ||
+            (computeIndices && (!indicesArray.get() || !indicesBufferArray.get())))
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            KeyType *keys = keysArray.get();
+            KeyType *keysBuffer = keysBufferArray.get();
+            int *indices = indicesArray.get();
+            int *indicesBuffer = indicesBufferArray.get();
 
-    ReadRows<algorithmFPType, cpu> inputBlock(*inputTable, 0, nVectors);
-    const algorithmFPType *data = inputBlock.get();
+            daal::threader_for(nBlocks, nBlocks, [=](size_t iBlock)
+            {
+                Sort::load(data, nFeatures, j, iBlock * nVectors / nBlocks, (iBlock + 1) * nVectors / nBlocks, keys, indices);
+            } );
+            Sort::sortParallel(nVectors, nBlocks, keys, keysBuffer, indices, indicesBuffer, countsArray.get());
+            daal::threader_for(nBlocks, nBlocks, [=](size_t iBlock)
+            {
+                Sort::store(keys, indices, nFeatures, j, iBlock * nVectors / nBlocks, (iBlock + 1) * nVectors / nBlocks,
+                            sortedData, sortedIndices);
+            } );
+        }
+        return;
+    }
 
-    WriteRows<algorithmFPType, cpu> otputBlock(*outputTable, 0, nVectors);
-    algorithmFPType *sortedData = otputBlock.get();
+    /* The features are sorted in parallel, every feature is sorted by one thread */
+    bool isOk = true;
+    daal::threader_for(nFeatures, nFeatures, [=, &isOk](size_t j)
+    {
+        TArray<KeyType, cpu> keysArray(nVectors);
+        TArray<KeyType, cpu> keysBufferArray(nVectors);
+        TArray<int, cpu> indicesArray(computeIndices ? nVectors : 0);
+        TArray<int, cpu> indicesBufferArray(computeIndices ? nVectors : 0);
+        TArray<size_t, cpu> countsArray(countsSize);
+        if (!keysArray.get() || !keysBufferArray.get() || !countsArray.get() ||
+            (computeIndices && (!indicesArray.get() || !indicesBufferArray.get())))
+        {
+            isOk = false;
+            return;
+        }
 
-    int errorcode = Statistics<algorithmFPType, cpu>::xSort(const_cast<algorithmFPType *>(data), nFeatures, nVectors, sortedData);
+        KeyType *keys = keysArray.get();
+        KeyType *keysBuffer = keysBufferArray.get();
+        int *indices = indicesArray.get();
+        int *indicesBuffer = indicesBufferArray.get();
 
-    if(errorcode) {this->_errors->add(services::ErrorSortingInternal);}
+        Sort::load(data, nFeatures, j, 0, nVectors, keys, indices);
+        Sort::sort(nVectors, keys, keysBuffer, indices, indicesBuffer, countsArray.get());
+        Sort::store(keys, indices, nFeatures, j, 0, nVectors, sortedData, sortedIndices);
+    } );
+    if (!isOk) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
 }
 
 } // namespace daal::algorithms::sorting::internal
@@ -29,6 +29,10 @@
 #include "service_defines.h"
 #include "service_numeric_table.h"
 
+#define __SORTING_RADIX_BITS 8                  // Number of bits of the key processed by one pass of the radix sort.
+#define __SORTING_PARALLEL_THRESHOLD (1 << 18)  // Minimal number of observations for sorting one feature by several threads.
+#define __SORTING_BLOCK_SIZE (1 << 16)          // Minimal number of observations processed by one thread when sorting one feature.
+
 using namespace daal::data_management;
 
 namespace daal
@@ -44,7 +48,7 @@ template<Method method, typename algorithmFPType, CpuType cpu>
 struct SortingKernel : public Kernel
 {
     virtual ~SortingKernel() {}
-    void compute(NumericTable *inputTable, NumericTable *outputTable);
+    void compute(NumericTable *inputTable, NumericTable *outputTable, NumericTable *indicesTable);
 };
 
 } // namespace daal::algorithms::sorting::internal
@@ -46,7 +46,7 @@ namespace internal
  */
 template <Method method, typename algorithmFPtype, CpuType cpu>
 void StumpTrainKernel<method, algorithmFPtype, cpu>::compute(size_t n, const NumericTable *const *a, stump::Model *r,
-                                                             const Parameter *par)
+                                                             const Parameter *par, const NumericTablePtr &xTablePtr)
 {
     const NumericTable *xTable = a[0];
     const NumericTable *yTable = a[1];
@@ -85,13 +85,40 @@ void StumpTrainKernel<method, algorithmFPtype, cpu>::compute(size_t n, const Num
         }
     }
 
-    size_t          splitFeature;
-    algorithmFPtype splitPoint;
-    algorithmFPtype leftValue;
-    algorithmFPtype rightValue;
+    size_t          splitFeature = 0;
+    algorithmFPtype splitPoint = 0.0;
+    algorithmFPtype leftValue = 0.0;
+    algorithmFPtype rightValue = 0.0;
 
-    doStumpRegression(nVectors, nFeatures, xTableNoConst, w, y,
-                      &splitFeature, &splitPoint, &leftValue, &rightValue);
+    if (par && par->reuseSortedFeatures)
+    {
+        /* Sort the feature values only if they are not sorted for this data set in the previous calls.
+           The kernel holds the reference to the data set, so its address is not reused by another table */
+        if (_sortedTable.get() != xTable || _sortedNVectors != nVectors || _sortedNFeatures != nFeatures)
+        {
+            _sortedTable = NumericTablePtr();
+            if (!sortFeatures(nVectors, nFeatures, xTableNoConst))
+            {
+                this->_errors->add(services::ErrorMemoryAllocationFailed);
+            }
+            else
+            {
+                _sortedTable = xTablePtr;
+                _sortedNVectors  = nVectors;
+                _sortedNFeatures = nFeatures;
+            }
+        }
+        if (_sortedTable.get())
+        {
+            doStumpRegressionSorted(nVectors, nFeatures, xTableNoConst, w, y,
+                                    &splitFeature, &splitPoint, &leftValue, &rightValue);
+        }
+    }
+    else
+    {
+        doStumpRegression(nVectors, nFeatures, xTableNoConst, w, y,
+                          &splitFeature, &splitPoint, &leftValue, &rightValue);
+    }
 
     r->splitFeature = splitFeature;
 
@@ -55,14 +55,16 @@ void BatchContainer<algorithmFPType, method, cpu>::compute()
     classifier::training::Input *input = static_cast<classifier::training::Input *>(_in);
     stump::training::Result *result = static_cast<stump::training::Result *>(_res);
     size_t n = input->size();
+    data_management::NumericTablePtr xTable = input->get(classifier::training::data);
     NumericTable *a[3];
-    a[0] = static_cast<NumericTable *>(input->get(classifier::training::data).get());
+    a[0] = static_cast<NumericTable *>(xTable.get());
     a[1] = static_cast<NumericTable *>(input->get(classifier::training::labels).get());
     a[2] = static_cast<NumericTable *>(input->get(classifier::training::weights).get());
     stump::Model *r = static_cast<stump::Model *>(result->get(classifier::training::model).get());
 
     daal::services::Environment::env &env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::StumpTrainKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, n, a, r, NULL);
+    __DAAL_CALL_KERNEL(env, internal::StumpTrainKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, n, a, r, static_cast<const Parameter *>(_par),
+                       xTable);
 }
 
 } // namespace daal::algorithm::stump::training
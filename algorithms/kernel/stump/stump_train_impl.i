@@ -29,6 +29,7 @@
 #include "service_utils.h"
 #include "service_data_utils.h"
 #include "service_memory.h"
+#include "service_sort.h"
 #include "stump_train_kernel.h"
 
 namespace daal
@@ -563,6 +564,267 @@ void StumpTrainKernel<method, algorithmFPtype, cpu>::doStumpRegression(size_t n,
     delete tls;
 }
 
+/**
+ *  \brief Sort the values of the features of the training data set.
+ *  For every ordered feature the sorted unique values are stored together with
+ *  the index of the unique value of every observation, so the weighted sums
+ *  over the observations are computed without sorting in the next calls
+ *
+ *  \param n[in]        Number of observations
+ *  \param dim[in]      Number of features
+ *  \param x[in]        Input data set
+ *  \return false if memory allocation failed
+ */
+template <Method method, typename algorithmFPtype, CpuType cpu>
+bool StumpTrainKernel<method, algorithmFPtype, cpu>::sortFeatures(size_t n, size_t dim, NumericTable *x)
+{
+    _bins.reset(n * dim);
+    _binValues.reset(n * dim);
+    _nBins.reset(dim);
+    if (!_bins.get() || !_binValues.get() || !_nBins.get()) { return false; }
+
+    int *bins = _bins.get();
+    algorithmFPtype *binValues = _binValues.get();
+    size_t *nBins = _nBins.get();
+
+    /* Buffers of the indices of the observations are allocated once per thread */
+    daal::tls<int *> indicesTLS( [ = ]()-> int *
+    {
+        return daal::services::internal::service_scalable_malloc<int, cpu>(n);
+    } );
+
+    daal::threader_for( dim, dim, [ =, &indicesTLS ](size_t k)
+    {
+        nBins[k] = 0;
+        if (x->getFeatureType(k) == data_management::data_feature_utils::DAAL_CATEGORICAL) { return; }
+
+        int *indices = indicesTLS.local();
+        if (!indices) { return; }
+
+        /* Sort the values of feature k together with the indices of the observations */
+        algorithmFPtype *values = binValues + k * n;
+        BlockDescriptor<algorithmFPtype> block;
+        x->getBlockOfColumnValues( k, (size_t)0, n, readOnly, block);
+        const algorithmFPtype *x_data = block.getBlockPtr();
+        for (size_t i = 0; i < n; i++)
+        {
+            values[i] = x_data[i];
+            indices[i] = (int)i;
+        }
+        x->releaseBlockOfColumnValues( block );
+        daal::algorithms::internal::qSort<algorithmFPtype, int, cpu>(n, values, indices);
+
+        /* Keep the unique values and assign their indices to the observations */
+        int *featureBins = bins + k * n;
+        size_t nUnique = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            if (i == 0 || values[i] != values[nUnique - 1])
+            {
+                values[nUnique++] = values[i];
+            }
+            featureBins[indices[i]] = (int)(nUnique - 1);
+        }
+        nBins[k] = nUnique;
+    } );
+
+    bool isOk = true;
+    indicesTLS.reduce( [ &isOk ](int *indices)
+    {
+        if (!indices) { isOk = false; return; }
+        daal::services::internal::service_scalable_free<int, cpu>(indices);
+    } );
+    return isOk;
+}
+
+/**
+ *  \brief Fit the function f[j] by a weighted least-squares
+ *  regression of x to z with weigths w.
+ *  Process ordered feature with the sorted unique values
+ *
+ *  \param n[in]        Number of observations
+ *  \param bins[in]     Indices of the unique values of the feature for the observations
+ *  \param nBins[in]    Number of the unique values of the feature
+ *  \param binValues[in] Sorted unique values of the feature
+ *  \param hist[in]     Buffer of size 3 * nBins for the histograms of the feature
+ *  \param w[in]        Array of weights of size n
+ *  \param z[in]        Array of weights of responses of size n
+ *  \param sumW[in]     Total sum of weights
+ *  \param sumM[in]     Total sum of weighted responses
+ *  \param sumS[in]     Total sum of weighted squares of responses
+ *  \param minSPtr[out]       Value of goal function obtained for the best split
+ *  \param splitPointPtr[out] Resulting split point
+ *  \param lMeanPtr[out]      "left" average of weighted responses
+ *                            for resulting split
+ *  \param rMeanPtr[out]      "right" average of weighted responses
+ *                            for resulting split
+ */
+template <Method method, typename algorithmFPtype, CpuType cpu>
+void StumpTrainKernel<method, algorithmFPtype, cpu>::stumpRegressionSorted(size_t n, const int *bins, size_t nBins,
+                                                                           const algorithmFPtype *binValues, algorithmFPtype *hist,
+                                                                           const algorithmFPtype *w, const algorithmFPtype *z,
+                                                                           algorithmFPtype sumW, algorithmFPtype sumM, algorithmFPtype sumS,
+                                                                           algorithmFPtype *minSPtr, algorithmFPtype *splitPointPtr,
+                                                                           algorithmFPtype *lMeanPtr, algorithmFPtype *rMeanPtr)
+{
+    if (nBins < 2) { return; }
+
+    /* Histograms of weights, weighted responses and weighted squares of responses */
+    algorithmFPtype *W_per_bin = hist;
+    algorithmFPtype *M_per_bin = W_per_bin + nBins;
+    algorithmFPtype *S_per_bin = M_per_bin + nBins;
+
+    for (size_t b = 0; b < 3 * nBins; b++)
+    {
+        W_per_bin[b] = (algorithmFPtype)0.0;
+    }
+    for (size_t i = 0; i < n; i++)
+    {
+        int b = bins[i];
+        algorithmFPtype wz = w[i] * z[i];
+        W_per_bin[b] += w[i];
+        M_per_bin[b] += wz;
+        S_per_bin[b] += wz * z[i];
+    }
+
+    const algorithmFPtype THR = 1e-10;
+    const algorithmFPtype C05 = (algorithmFPtype)0.5;
+    algorithmFPtype minS = *minSPtr;
+    algorithmFPtype splitPoint = 0.0;
+    algorithmFPtype lMean = 0.0;
+    algorithmFPtype rMean = 0.0;
+
+    algorithmFPtype lw = 0.0, lM = 0.0, ls = 0.0;
+    algorithmFPtype rw = sumW, rM = sumM, rs = sumS;
+    algorithmFPtype lm, rm, lc, rc, sum;
+
+    /* Seek split point s between the neighboring unique values */
+    for (size_t b = 0; b < nBins - 1; b++)
+    {
+        lw += W_per_bin[b];
+        lM += M_per_bin[b];
+        ls += S_per_bin[b];
+        rw -= W_per_bin[b];
+        rM -= M_per_bin[b];
+        rs -= S_per_bin[b];
+
+        lm = 0.0;
+        lc = 0.0;
+        if (lw > THR)
+        {
+            lm = lM / lw;
+            lc = ls - lM * lm;
+        }
+
+        rm = 0.0;
+        rc = 0.0;
+        if (rw > THR)
+        {
+            rm = rM / rw;
+            rc = rs - rM * rm;
+        }
+        sum = lc + rc;
+
+        if ( sum < minS )
+        {
+            minS = sum;
+            splitPoint  = C05 * (binValues[b] + binValues[b + 1]);
+            lMean = lm;
+            rMean = rm;
+        }
+    }
+
+    *minSPtr = minS;
+    *splitPointPtr = splitPoint;
+    *lMeanPtr = lMean;
+    *rMeanPtr = rMean;
+}
+
+template <Method method, typename algorithmFPtype, CpuType cpu>
+void StumpTrainKernel<method, algorithmFPtype, cpu>::doStumpRegressionSorted(size_t n, size_t dim, NumericTable *x,
+                                                                             algorithmFPtype *w,
+                                                                             algorithmFPtype *z,
+                                                                             size_t *splitFeature, algorithmFPtype *splitPoint,
+                                                                             algorithmFPtype *leftValue, algorithmFPtype *rightValue)
+{
+    algorithmFPtype minS = daal::data_feature_utils::internal::MaxVal<algorithmFPtype, cpu>::get();
+    algorithmFPtype sumW, sumM, sumS;
+    computeSums(n, w, z, &sumW, &sumM, &sumS);
+
+    const int *bins = _bins.get();
+    const size_t *nBins = _nBins.get();
+    const algorithmFPtype *binValues = _binValues.get();
+
+    /* The best split of every feature is stored to choose the first feature with the best split */
+    daal::internal::TArray<algorithmFPtype, cpu> featureResultsArray(4 * dim);
+    algorithmFPtype *featureResults = featureResultsArray.get();
+    if (!featureResults) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+    /* Categorical features are processed sequentially as their kernel allocates its own buffers */
+    size_t maxBins = 0;
+    for (size_t k = 0; k < dim; k++)
+    {
+        algorithmFPtype *res = featureResults + 4 * k;
+        res[0] = daal::data_feature_utils::internal::MaxVal<algorithmFPtype, cpu>::get();
+
+        if (x->getFeatureType(k) == data_management::data_feature_utils::DAAL_CATEGORICAL)
+        {
+            /* Here if feature k is categorical */
+            size_t nCategories = x->getNumberOfCategories(k);
+            BlockDescriptor<int> block;
+            x->getBlockOfColumnValues( k, (size_t)0, n, readOnly, block);
+            stumpRegressionCategorical(n, nCategories, block.getBlockPtr(), w, z, sumW, sumM, sumS,
+                                       res, res + 1, res + 2, res + 3);
+            x->releaseBlockOfColumnValues( block );
+        }
+        else if (nBins[k] > maxBins)
+        {
+            maxBins = nBins[k];
+        }
+    }
+    if (!this->_errors->isEmpty()) { return; }
+
+    /* Histograms of the features are computed in the buffers allocated once per thread */
+    daal::tls<algorithmFPtype *> histTLS( [ = ]()-> algorithmFPtype *
+    {
+        return daal::services::internal::service_scalable_malloc<algorithmFPtype, cpu>(3 * maxBins + 1);
+    } );
+
+    daal::threader_for( dim, dim, [ =, &histTLS ](size_t k)
+    {
+        if (x->getFeatureType(k) == data_management::data_feature_utils::DAAL_CATEGORICAL) { return; }
+
+        algorithmFPtype *hist = histTLS.local();
+        if (!hist) { return; }
+
+        /* Here if feature k is not categorical */
+        algorithmFPtype *res = featureResults + 4 * k;
+        stumpRegressionSorted(n, bins + k * n, nBins[k], binValues + k * n, hist, w, z, sumW, sumM, sumS,
+                              res, res + 1, res + 2, res + 3);
+    } );
+
+    bool isOk = true;
+    histTLS.reduce( [ &isOk ](algorithmFPtype *hist)
+    {
+        if (!hist) { isOk = false; return; }
+        daal::services::internal::service_scalable_free<algorithmFPtype, cpu>(hist);
+    } );
+    if (!isOk) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+    for (size_t k = 0; k < dim; k++)
+    {
+        const algorithmFPtype *res = featureResults + 4 * k;
+        if (res[0] < minS)
+        {
+            minS = res[0];
+            *splitFeature = k;
+            *splitPoint   = res[1];
+            *leftValue    = res[2];
+            *rightValue   = res[3];
+        }
+    }
+}
+
 } // namespace daal::algorithms::stump::training::internal
 }
 }
@@ -25,9 +25,11 @@
 #define __STUMP_TRAIN_KERNEL_H__
 
 #include "stump_training_types.h"
+#include "stump_training_batch.h"
 #include "stump_model.h"
 #include "kernel.h"
 #include "numeric_table.h"
+#include "service_numeric_table.h"
 
 using namespace daal::data_management;
 
@@ -46,7 +48,10 @@ template <Method method, typename algorithmFPtype , CpuType cpu>
 class StumpTrainKernel : public Kernel
 {
 public:
-    void compute(size_t n, const NumericTable *const *a, Model *r, const Parameter *par);
+    StumpTrainKernel() : _sortedNVectors(0), _sortedNFeatures(0) {}
+
+    void compute(size_t n, const NumericTable *const *a, Model *r, const Parameter *par,
+                 const data_management::NumericTablePtr &xTable);
 
 private:
     void StumpQSort( size_t n, algorithmFPtype *x, algorithmFPtype *w, algorithmFPtype *z );
@@ -70,8 +75,44 @@ private:
                            algorithmFPtype *z,
                            size_t *splitFeature, algorithmFPtype *splitPoint,
                            algorithmFPtype *leftValue, algorithmFPtype *rightValue);
+
+    bool sortFeatures(size_t n, size_t dim, NumericTable *x);
+
+    void stumpRegressionSorted(size_t n, const int *bins, size_t nBins, const algorithmFPtype *binValues, algorithmFPtype *hist,
+                               const algorithmFPtype *w, const algorithmFPtype *z,
+                               algorithmFPtype sumW, algorithmFPtype sumM, algorithmFPtype sumS,
+                               algorithmFPtype *minSPtr, algorithmFPtype *splitPointPtr,
+                               algorithmFPtype *lMeanPtr, algorithmFPtype *rMeanPtr);
+
+    void doStumpRegressionSorted(size_t n, size_t dim, NumericTable *x, algorithmFPtype *w,
+                                 algorithmFPtype *z,
+                                 size_t *splitFeature, algorithmFPtype *splitPoint,
+                                 algorithmFPtype *leftValue, algorithmFPtype *rightValue);
+
+    /* Sorted feature values of the training data set reused between the calls of compute() */
+    data_management::NumericTablePtr _sortedTable;  /* Training data set the sorted values are computed for */
+    size_t _sortedNVectors;
+    size_t _sortedNFeatures;
+    daal::internal::TArray<int, cpu> _bins;                         /* Indices of the sorted unique values of the features */
+    daal::internal::TArray<size_t, cpu> _nBins;                     /* Numbers of the unique values of the features */
+    daal::internal::TArray<algorithmFPtype, cpu> _binValues;        /* Sorted unique values of the features */
 };
 
+/**
+ *  \brief Enable the reuse of the sorted feature values between the calls of compute()
+ *         if the weak learner training algorithm is the decision stump.
+ *         Boosting algorithms call it for their own copy of the weak learner
+ *
+ *  \param learnerTrain[in]  Weak learner training algorithm
+ */
+inline void enableSortedFeaturesReuse(weak_learner::training::Batch *learnerTrain)
+{
+    Batch<double> *doubleStump = dynamic_cast<Batch<double> *>(learnerTrain);
+    Batch<float>  *floatStump  = dynamic_cast<Batch<float>  *>(learnerTrain);
+    if (doubleStump) { doubleStump->parameter.reuseSortedFeatures = true; }
+    if (floatStump)  { floatStump->parameter.reuseSortedFeatures  = true; }
+}
+
 } // namespace daal::algorithms::stump::training::internal
 }
 }
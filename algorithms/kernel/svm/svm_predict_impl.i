@@ -27,6 +27,7 @@
 #include "service_memory.h"
 #include "service_micro_table.h"
 #include "service_numeric_table.h"
+#include "threading.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -42,81 +43,148 @@ namespace prediction
 namespace internal
 {
 
+/**
+ * Thread local data used in SVM prediction: copy of the kernel function
+ * and the buffer for the kernel function values of a block of observations
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct SVMPredictTLS
+{
+    SVMPredictTLS(const services::SharedPtr<kernel_function::KernelIface> &kernelPrototype, const NumericTablePtr &svTable,
+                  size_t bufferSize) : kernel(kernelPrototype->clone()), hasErrors(false)
+    {
+        kernel->getErrors()->setCanThrow(false);
+        kernel->inputBase->set(kernel_function::Y, svTable);
+        kernel->parameterBase->computationMode = kernel_function::matrixMatrix;
+        buf = service_scalable_malloc<algorithmFPType, cpu>(bufferSize);
+    }
+
+    ~SVMPredictTLS()
+    {
+        if (buf) { service_scalable_free<algorithmFPType, cpu>(buf); }
+    }
+
+    services::SharedPtr<kernel_function::KernelIface> kernel;
+    algorithmFPType *buf;
+    bool hasErrors;
+};
+
 template <typename algorithmFPType, CpuType cpu>
 struct SVMPredictImpl<defaultDense, algorithmFPType, cpu> : public Kernel
 {
+    static const size_t maxBlockSize           = 256;       /* Maximal number of observations in the block */
+    static const size_t maxKernelBlockElements = (1 << 18); /* Maximal number of kernel function values computed for the block */
+
     void compute(const NumericTablePtr a, const daal::algorithms::Model *m, NumericTablePtr r,
                  const daal::algorithms::Parameter *par)
     {
         algorithmFPType zero = 0.0;
         NumericTablePtr xTable = a;
-        FeatureMicroTable<algorithmFPType, writeOnly, cpu> mtR(r.get());
-        size_t nVectors = xTable->getNumberOfRows();
+        size_t nVectors  = xTable->getNumberOfRows();
+        size_t nFeatures = xTable->getNumberOfColumns();
+        bool isCSR = (xTable->getDataLayout() == NumericTableIface::csrArray);
 
         Model *model = static_cast<Model *>(const_cast<daal::algorithms::Model *>(m));
         Parameter *parameter = static_cast<Parameter *>(const_cast<daal::algorithms::Parameter *>(par));
 
-        services::SharedPtr<kernel_function::KernelIface> kernel = parameter->kernel->clone();
-        kernel->getErrors()->setCanThrow(false);
-
         NumericTablePtr svTable       = model->getSupportVectors();
         NumericTablePtr svCoeffTable  = model->getClassificationCoefficients();
         algorithmFPType bias = (algorithmFPType)model->getBias();
-
-        FeatureMicroTable<algorithmFPType, readOnly, cpu> mtSVCoeff(svCoeffTable.get());
-
-        size_t nSV = mtSVCoeff.getFullNumberOfRows();
-        algorithmFPType *svCoeff;
-
-        algorithmFPType *distance;
-        mtR.getBlockOfColumnValues(0, 0, nVectors, &distance);
+        size_t nSV = svCoeffTable->getNumberOfRows();
 
         if (nSV == 0)
         {
+            WriteOnlyRows<algorithmFPType, cpu> distanceRows(r.get(), 0, nVectors);
+            algorithmFPType *distance = distanceRows.get();
             for (size_t i = 0; i < nVectors; i++)
             {
                 distance[i] = zero;
             }
+            return;
         }
-        else
-        {
-            mtSVCoeff.getBlockOfColumnValues(0, 0, nSV, &svCoeff);
 
-            algorithmFPType *buf = (algorithmFPType *)daal::services::daal_malloc(nSV * nVectors * sizeof(algorithmFPType));
-            if (buf == NULL) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+        ReadRows<algorithmFPType, cpu> svCoeffRows(svCoeffTable.get(), 0, nSV);
+        const algorithmFPType *svCoeff = svCoeffRows.get();
 
-            NumericTablePtr shResNT(new HomogenNumericTableCPU<algorithmFPType, cpu>(buf, nSV, nVectors));
+        /* Kernel function values are computed and reduced block by block,
+           so the memory used by a thread does not depend on the number of observations */
+        size_t blockSize = maxKernelBlockElements / nSV;
+        if (blockSize > maxBlockSize) { blockSize = maxBlockSize; }
+        if (blockSize == 0)           { blockSize = 1; }
+        size_t nBlocks = nVectors / blockSize;
+        if (nBlocks * blockSize < nVectors) { nBlocks++; }
 
-            services::SharedPtr<kernel_function::Result> shRes(new kernel_function::Result());
-            shRes->set(kernel_function::values, shResNT);
+        services::SharedPtr<kernel_function::KernelIface> kernelPrototype = parameter->kernel;
+        daal::tls<SVMPredictTLS<algorithmFPType, cpu> *> tlsData([ = ]()
+        {
+            return new SVMPredictTLS<algorithmFPType, cpu>(kernelPrototype, svTable, blockSize * nSV);
+        } );
 
-            kernel->setResult(shRes);
-            kernel->inputBase->set(kernel_function::X, xTable);
-            kernel->inputBase->set(kernel_function::Y, svTable);
-            kernel->parameterBase->computationMode = kernel_function::matrixMatrix;
-            kernel->computeNoThrow();
-            if(kernel->getErrors()->size() != 0)
+        bool isOk = true;
+        daal::threader_for(nBlocks, nBlocks, [ =, &tlsData, &isOk ](size_t iBlock)
+        {
+            SVMPredictTLS<algorithmFPType, cpu> *local = tlsData.local();
+            if (!local->buf) { isOk = false; return; }
+            if (local->hasErrors) { return; }
+
+            size_t startRow = iBlock * blockSize;
+            size_t nRows    = (startRow + blockSize > nVectors ? nVectors - startRow : blockSize);
+
+            NumericTablePtr resultTable(new HomogenNumericTableCPU<algorithmFPType, cpu>(local->buf, nSV, nRows));
+            services::SharedPtr<kernel_function::Result> kernelResult(new kernel_function::Result());
+            kernelResult->set(kernel_function::values, resultTable);
+            local->kernel->setResult(kernelResult);
+
+            /* The block of observations is passed to the kernel function as a numeric table
+               that refers to the memory of the input table */
+            ReadRows<algorithmFPType, cpu> xRows;
+            ReadRowsCSR<algorithmFPType, cpu> xRowsCSR;
+            NumericTablePtr xBlockTable;
+            if (isCSR)
             {
-                mtSVCoeff.release();
-                daal::services::daal_free(buf);
-                mtR.release();
-                this->_errors->add(services::ErrorSVMinnerKernel);
-                this->_errors->add(kernel->getErrors()->getErrors());
-                return;
+                xRowsCSR.set(dynamic_cast<CSRNumericTableIface *>(xTable.get()), startRow, nRows);
+                xBlockTable = NumericTablePtr(new CSRNumericTable(const_cast<algorithmFPType *>(xRowsCSR.values()),
+                    const_cast<size_t *>(xRowsCSR.cols()), const_cast<size_t *>(xRowsCSR.rows()), nFeatures, nRows));
             }
-            for (size_t i = 0; i < nVectors; i++)
+            else
+            {
+                xBlockTable = NumericTablePtr(new HomogenNumericTableCPU<algorithmFPType, cpu>(
+                    const_cast<algorithmFPType *>(xRows.set(xTable.get(), startRow, nRows)), nFeatures, nRows));
+            }
+            local->kernel->inputBase->set(kernel_function::X, xBlockTable);
+
+            local->kernel->computeNoThrow();
+            if (local->kernel->getErrors()->size() != 0) { local->hasErrors = true; return; }
+
+            WriteOnlyRows<algorithmFPType, cpu> distanceRows(r.get(), startRow, nRows);
+            algorithmFPType *distance = distanceRows.get();
+            const algorithmFPType *buf = local->buf;
+            for (size_t i = 0; i < nRows; i++)
             {
-                distance[i] = bias;
+                algorithmFPType sum = bias;
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
                 for (size_t j = 0; j < nSV; j++)
                 {
-                    distance[i] += buf[i * nSV + j] * svCoeff[j];
+                    sum += buf[i * nSV + j] * svCoeff[j];
                 }
+                distance[i] = sum;
             }
+        } );
 
-            mtSVCoeff.release();
-            daal::services::daal_free(buf);
-        }
-        mtR.release();
+        bool hasKernelErrors = false;
+        tlsData.reduce([ =, &isOk, &hasKernelErrors ](SVMPredictTLS<algorithmFPType, cpu> *local)
+        {
+            if (local->hasErrors && !hasKernelErrors)
+            {
+                hasKernelErrors = true;
+                this->_errors->add(services::ErrorSVMinnerKernel);
+                this->_errors->add(local->kernel->getErrors()->getErrors());
+            }
+            delete local;
+        } );
+
+        if (!isOk) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
     }
 };
 
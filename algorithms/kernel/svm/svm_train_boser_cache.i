@@ -195,6 +195,13 @@ public:
     virtual void getTwoRowsBlock(size_t rowIndex1, size_t rowIndex2, size_t startColIndex, size_t blockSize,
                                  algorithmFPType **block1, algorithmFPType **block2) = 0;
 
+    /**
+     * Get diagonal element of the matrix Q (kernel(x[i], x[i]))
+     * \param[in] rowIndex      Index of the requested diagonal element
+     * \return Diagonal element of the matrix Q
+     */
+    virtual algorithmFPType getDiagonalElement(size_t rowIndex) = 0;
+
     /**
      * Get type of the cache: noCache, simpleCache or lruCache
      * \return Type of the cache
@@ -259,6 +266,11 @@ public:
         }
     }
 
+    virtual algorithmFPType getDiagonalElement(size_t rowIndex)
+    {
+        return *(this->getRowBlock(rowIndex, rowIndex, 1));
+    }
+
     bool doShrinking;               /*!< Flag that enables use of the shrinking optimization technique */
     size_t *shrinkingRowIndices;    /*!< Array of input data row indices used with shrinking technique */
 protected:
@@ -492,6 +504,229 @@ protected:
     services::SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> > _cacheTable;
 };
 
+/**
+ * LRU cache: part of the rows of kernel matrix fit into cache.
+ * The rows are identified by the indices of feature vectors in the input data set,
+ * so the rows computed before shrinking are reused after it.
+ * The least recently used row is replaced when the requested row is not in cache
+ */
+template<typename algorithmFPType, CpuType cpu>
+class SVMCache<lruCache, algorithmFPType, cpu> : public SVMCacheImpl<algorithmFPType, cpu>
+{
+    using SVMCacheImpl<algorithmFPType, cpu>::_cache;
+    using SVMCacheImpl<algorithmFPType, cpu>::_kernel;
+    using SVMCacheImpl<algorithmFPType, cpu>::_lineSize;
+    using SVMCacheImpl<algorithmFPType, cpu>::shrinkingRowIndices;
+    using SVMCacheImpl<algorithmFPType, cpu>::doShrinking;
+    using SVMCacheImpl<algorithmFPType, cpu>::rowGetter;
+public:
+    /**
+     * Constructs LRU cache
+     *
+     * \param[in] cacheSize     Size of cache in bytes, at least two rows of kernel matrix
+     * \param[in] lineSize      Number of elements in the cache line
+     * \param[in] doShrinking   Flag that enables use of the shrinking optimization technique
+     * \param[in] xTable        Input data set
+     * \param[in] kernel        Kernel function
+     * \param[in] errors        Pointer to error collection associated with SVM training algorithm
+     */
+    SVMCache(size_t cacheSize, size_t lineSize, bool doShrinking, NumericTablePtr xTable,
+             services::SharedPtr<kernel_function::KernelIface> kernel,
+             services::SharedPtr<services::KernelErrorCollection> errors) :
+        SVMCacheImpl<algorithmFPType, cpu>(lineSize, doShrinking, kernel, errors),
+        _nLines(cacheSize / (lineSize * sizeof(algorithmFPType))),
+        _lineRows(NULL), _rowLines(NULL), _prev(NULL), _next(NULL), _tmp(NULL)
+    {
+        rowGetter = NULL;
+        if (_nLines > _lineSize) { _nLines = _lineSize; }
+
+        _cache    = (algorithmFPType *)daal::services::daal_malloc(_nLines * _lineSize * sizeof(algorithmFPType));
+        _lineRows = (size_t *)daal::services::daal_malloc(_nLines * sizeof(size_t));
+        _prev     = (size_t *)daal::services::daal_malloc(_nLines * sizeof(size_t));
+        _next     = (size_t *)daal::services::daal_malloc(_nLines * sizeof(size_t));
+        _rowLines = (size_t *)daal::services::daal_malloc(_lineSize * sizeof(size_t));
+        if (doShrinking)
+        {
+            _tmp = (algorithmFPType *)daal::services::daal_malloc(_lineSize * sizeof(algorithmFPType));
+        }
+        if (!_cache || !_lineRows || !_prev || !_next || !_rowLines || (doShrinking && !_tmp))
+        { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+        /* Value _nLines marks the row that is not cached and the end of the list of lines,
+           value _lineSize marks the empty line */
+        for (size_t i = 0; i < _lineSize; i++)
+        {
+            _rowLines[i] = _nLines;
+        }
+        for (size_t l = 0; l < _nLines; l++)
+        {
+            _lineRows[l] = _lineSize;
+            _prev[l] = (l > 0 ? l - 1 : _nLines);
+            _next[l] = l + 1;
+        }
+        _head = 0;
+        _tail = _nLines - 1;
+
+        _cacheTable = services::SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> >(
+            new HomogenNumericTableCPU<algorithmFPType, cpu>(NULL, 1, lineSize));
+        services::SharedPtr<kernel_function::Result> result =
+            services::SharedPtr<kernel_function::Result>(new kernel_function::Result());
+        result->set(kernel_function::values, _cacheTable);
+        _kernel->setResult(result);
+
+        _kernel->inputBase->set(kernel_function::X, xTable);
+        _kernel->inputBase->set(kernel_function::Y, xTable);
+        _kernel->parameterBase->computationMode = kernel_function::matrixVector;
+        _kernel->parameterBase->rowIndexResult  = 0;
+    }
+
+    /**
+     * Get block of values from the row of the matrix Q (kernel(x[i], x[j]))
+     * \param[in] rowIndex      Index of the requested row
+     * \param[in] startColIndex Starting columns index of the requested block of values
+     * \param[in] blockSize     Number of requested values
+     * \return Block of values from the row of the matirx Q
+     */
+    algorithmFPType *getRowBlock(size_t rowIndex, size_t startColIndex, size_t blockSize)
+    {
+        return getLine(rowIndex) + startColIndex;
+    }
+
+    /**
+     * Get blocks of values from the two rows of the matrix Q (kernel(x[i], x[j]))
+     * \param[in] rowIndex1     Index of the first requested row
+     * \param[in] rowIndex2     Index of the second requested row
+     * \param[in] startColIndex Starting columns index of the requested blocks of values
+     * \param[in] blockSize     Number of requested values in each block
+     * \param[out] block1       Pointer to the first  block of values
+     * \param[out] block2       Pointer to the second block of values
+     */
+    void getTwoRowsBlock(size_t rowIndex1, size_t rowIndex2, size_t startColIndex, size_t blockSize,
+                         algorithmFPType **block1, algorithmFPType **block2)
+    {
+        /* The first row becomes the most recently used one and is not replaced by the second row */
+        *block1 = getLine(rowIndex1) + startColIndex;
+        *block2 = getLine(rowIndex2) + startColIndex;
+    }
+
+    /**
+     * Get diagonal element of the matrix Q (kernel(x[i], x[i])) without caching the whole row
+     * \param[in] rowIndex      Index of the requested diagonal element
+     * \return Diagonal element of the matrix Q
+     */
+    algorithmFPType getDiagonalElement(size_t rowIndex)
+    {
+        size_t dataRowIndex = this->getDataRowIndex(rowIndex);
+        size_t line = _rowLines[dataRowIndex];
+        if (line != _nLines) { return _cache[line * _lineSize + rowIndex]; }
+
+        algorithmFPType value;
+        _cacheTable->setArray(&value);
+        _kernel->parameterBase->computationMode = kernel_function::vectorVector;
+        _kernel->parameterBase->rowIndexX       = dataRowIndex;
+        _kernel->parameterBase->rowIndexY       = dataRowIndex;
+        _kernel->computeNoThrow();
+        _kernel->parameterBase->computationMode = kernel_function::matrixVector;
+        return value;
+    }
+
+    /**
+     * Get type of the cache: noCache, simpleCache or lruCache
+     * \return Type of the cache
+     */
+    SVMCacheType getType() const { return lruCache; }
+
+    /**
+     * Move the indices of the shrunk feature vector to the end of the array and
+     * re-order the columns of the cached rows accordingly
+     *
+     * \param[in] nActiveVectors Number of observations in a training data set that are used
+     *                           in sequential minimum optimization at the current iteration
+     * \param[in] I              Array of flags that describe the status of feature vectors
+     */
+    virtual void updateShrinkingRowIndices(size_t nActiveVectors, const char *I);
+
+    ~SVMCache()
+    {
+        daal::services::daal_free(_cache);
+        daal::services::daal_free(_lineRows);
+        daal::services::daal_free(_rowLines);
+        daal::services::daal_free(_prev);
+        daal::services::daal_free(_next);
+        daal::services::daal_free(_tmp);
+    }
+
+protected:
+    /**
+     * Get the row of the matrix Q, compute it in place of the least recently used row if it is not cached
+     * \param[in] rowIndex      Index of the requested row
+     * \return Row of the matrix Q
+     */
+    algorithmFPType *getLine(size_t rowIndex)
+    {
+        size_t dataRowIndex = this->getDataRowIndex(rowIndex);
+        size_t line = _rowLines[dataRowIndex];
+        if (line == _nLines)
+        {
+            line = _tail;
+            if (_lineRows[line] != _lineSize) { _rowLines[_lineRows[line]] = _nLines; }
+            _lineRows[line] = dataRowIndex;
+            _rowLines[dataRowIndex] = line;
+            computeLine(dataRowIndex, _cache + line * _lineSize);
+        }
+        moveToFront(line);
+        return _cache + line * _lineSize;
+    }
+
+    /**
+     * Compute the row of the matrix Q, the order of the columns follows the shrinking row indices
+     * \param[in]  dataRowIndex Index of the feature vector in the input data set
+     * \param[out] line         Resulting row of the matrix Q
+     */
+    void computeLine(size_t dataRowIndex, algorithmFPType *line)
+    {
+        _kernel->parameterBase->rowIndexY = dataRowIndex;
+        if (!doShrinking)
+        {
+            _cacheTable->setArray(line);
+            _kernel->computeNoThrow();
+            return;
+        }
+        _cacheTable->setArray(_tmp);
+        _kernel->computeNoThrow();
+        for (size_t j = 0; j < _lineSize; j++)
+        {
+            line[j] = _tmp[shrinkingRowIndices[j]];
+        }
+    }
+
+    /**
+     * Mark the line of cache as the most recently used one
+     * \param[in] line          Index of the line
+     */
+    void moveToFront(size_t line)
+    {
+        if (line == _head) { return; }
+        _next[_prev[line]] = _next[line];
+        if (_next[line] != _nLines) { _prev[_next[line]] = _prev[line]; }
+        else                         { _tail = _prev[line]; }
+        _prev[line] = _nLines;
+        _next[line] = _head;
+        _prev[_head] = line;
+        _head = line;
+    }
+
+    size_t _nLines;         /*!< Number of lines in cache */
+    size_t *_lineRows;      /*!< Indices of feature vectors which rows are stored in the lines of cache */
+    size_t *_rowLines;      /*!< Indices of the lines of cache that store the rows of feature vectors */
+    size_t *_prev;          /*!< Previous, more recently used, line of cache */
+    size_t *_next;          /*!< Next, less recently used, line of cache */
+    size_t _head;           /*!< Most recently used line of cache */
+    size_t _tail;           /*!< Least recently used line of cache */
+    algorithmFPType *_tmp;  /*!< Row of the matrix Q in the order of the input data set */
+    services::SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> > _cacheTable;
+};
+
 } // namespace internal
 
 } // namespace training
@@ -45,6 +45,7 @@
 #include "service_numeric_table.h"
 #include "service_utils.h"
 #include "service_data_utils.h"
+#include "threading.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -456,18 +457,49 @@ algorithmFPType SVMTrainImpl<boser, algorithmFPType, cpu>::WSSi(
             size_t nActiveVectors, const algorithmFPType *y, const algorithmFPType *grad,
             const algorithmFPType *kernelDiag, char *I, int *BiPtr)
 {
-    int Bi = -1;
-    algorithmFPType GMax = -(MaxVal<algorithmFPType, cpu>::get());  // some big negative number
+    const algorithmFPType fpMin = -(MaxVal<algorithmFPType, cpu>::get());  // some big negative number
 
-    /* Find i index of the working set (Bi) */
-    for (size_t i = 0; i < nActiveVectors; i++)
+    size_t nBlocks = nActiveVectors / kernelFunctionBlockSize;
+    if (nBlocks * kernelFunctionBlockSize < nActiveVectors) { nBlocks++; }
+
+    TArray<algorithmFPType, cpu> blockGMaxArray(nBlocks);
+    TArray<int, cpu> blockBiArray(nBlocks);
+    algorithmFPType *blockGMax = blockGMaxArray.get();
+    int *blockBi = blockBiArray.get();
+    if (!blockGMax || !blockBi) { this->_errors->add(services::ErrorMemoryAllocationFailed); *BiPtr = -1; return fpMin; }
+
+    /* Find i index of the working set (Bi) in each block of feature vectors */
+    daal::threader_for(nBlocks, nBlocks, [=](size_t iBlock)
+    {
+        size_t iStart = iBlock * kernelFunctionBlockSize;
+        size_t iEnd   = iStart + kernelFunctionBlockSize;
+        if (iEnd > nActiveVectors) { iEnd = nActiveVectors; }
+
+        int Bi = -1;
+        algorithmFPType GMax = fpMin;
+        for (size_t i = iStart; i < iEnd; i++)
+        {
+            if ((I[i] & up) != up) { continue; }
+            algorithmFPType objFunc = -y[i] * grad[i];
+            if (objFunc >= GMax)
+            {
+                GMax = objFunc;
+                Bi = i;
+            }
+        }
+        blockGMax[iBlock] = GMax;
+        blockBi[iBlock]   = Bi;
+    } );
+
+    /* Blocks are reduced in order, so the result is the same as in the sequential search */
+    int Bi = -1;
+    algorithmFPType GMax = fpMin;
+    for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
     {
-        if ((I[i] & up) != up) { continue; }
-        algorithmFPType objFunc = -y[i] * grad[i];
-        if (objFunc >= GMax)
+        if (blockBi[iBlock] != -1 && blockGMax[iBlock] >= GMax)
         {
-            GMax = objFunc;
-            Bi = i;
+            GMax = blockGMax[iBlock];
+            Bi = blockBi[iBlock];
         }
     }
     *BiPtr = Bi;
@@ -503,12 +535,7 @@ algorithmFPType SVMTrainImpl<boser, algorithmFPType, cpu>::WSSj(
             int Bi, SVMCacheIface<algorithmFPType, cpu> *cache, algorithmFPType GMax, int *BjPtr,
             algorithmFPType *deltaPtr)
 {
-    int Bj = -1;
     algorithmFPType fpMax = MaxVal<algorithmFPType, cpu>::get();
-    algorithmFPType GMin  = fpMax; // some big positive number
-    algorithmFPType GMin2 = fpMax;
-    algorithmFPType delta;
-
     algorithmFPType zero = (algorithmFPType)0.0;
     algorithmFPType two  = (algorithmFPType)2.0;
 
@@ -516,13 +543,32 @@ algorithmFPType SVMTrainImpl<boser, algorithmFPType, cpu>::WSSj(
 
     size_t nBlocks = nActiveVectors / kernelFunctionBlockSize;
     if (nBlocks * kernelFunctionBlockSize < nActiveVectors) { nBlocks++; }
-    for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+
+    TArray<algorithmFPType, cpu> blockValuesArray(3 * nBlocks);
+    TArray<int, cpu> blockBjArray(nBlocks);
+    algorithmFPType *blockGMin  = blockValuesArray.get();
+    algorithmFPType *blockGMin2 = blockGMin + nBlocks;
+    algorithmFPType *blockDelta = blockGMin + 2 * nBlocks;
+    int *blockBj = blockBjArray.get();
+    if (!blockGMin || !blockBj) { this->_errors->add(services::ErrorMemoryAllocationFailed); *BjPtr = -1; return fpMax; }
+
+    /* Cached row of the matrix Q is read by all threads,
+       otherwise the blocks of the row are computed sequentially in the buffer of the cache */
+    bool isRowCached = (cache->getType() != noCache);
+    algorithmFPType *KiRow = (isRowCached ? cache->getRowBlock(Bi, 0, nActiveVectors) : NULL);
+
+    auto findBj = [=](size_t iBlock)
     {
         size_t jStart = iBlock * kernelFunctionBlockSize;
         size_t jEnd   = jStart + kernelFunctionBlockSize;
         if (jEnd > nActiveVectors) { jEnd = nActiveVectors; }
 
-        algorithmFPType *KiBlock = cache->getRowBlock(Bi, jStart, (jEnd - jStart));
+        int Bj = -1;
+        algorithmFPType GMin  = fpMax; // some big positive number
+        algorithmFPType GMin2 = fpMax;
+        algorithmFPType delta = zero;
+
+        algorithmFPType *KiBlock = (isRowCached ? KiRow + jStart : cache->getRowBlock(Bi, jStart, (jEnd - jStart)));
         for (size_t j = jStart; j < jEnd; j++)
         {
             algorithmFPType ygrad = -y[j] * grad[j];
@@ -545,6 +591,35 @@ algorithmFPType SVMTrainImpl<boser, algorithmFPType, cpu>::WSSj(
                 delta = dt;
             }
         }
+        blockGMin [iBlock] = GMin;
+        blockGMin2[iBlock] = GMin2;
+        blockDelta[iBlock] = delta;
+        blockBj   [iBlock] = Bj;
+    };
+
+    if (isRowCached)
+    {
+        daal::threader_for(nBlocks, nBlocks, findBj);
+    }
+    else
+    {
+        for (size_t iBlock = 0; iBlock < nBlocks; iBlock++) { findBj(iBlock); }
+    }
+
+    /* Blocks are reduced in order, so the result is the same as in the sequential search */
+    int Bj = -1;
+    algorithmFPType GMin  = fpMax;
+    algorithmFPType GMin2 = fpMax;
+    algorithmFPType delta = zero;
+    for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+    {
+        if (blockGMin2[iBlock] <= GMin2) { GMin2 = blockGMin2[iBlock]; }
+        if (blockBj[iBlock] != -1 && blockGMin[iBlock] <= GMin)
+        {
+            GMin  = blockGMin[iBlock];
+            Bj    = blockBj[iBlock];
+            delta = blockDelta[iBlock];
+        }
     }
 
     *BjPtr = Bj;
@@ -588,6 +663,33 @@ void SVMTrainImpl<boser, algorithmFPType, cpu>::updateTask(
     algorithmFPType dyi = y[Bi] * newDeltai;
 
     /* Update gradient */
+    if (task.cache->getType() != noCache)
+    {
+        /* Cached rows of the matrix Q are read by all threads */
+        algorithmFPType *KiRow;
+        algorithmFPType *KjRow;
+        task.cache->getTwoRowsBlock(Bi, Bj, 0, nActiveVectors, &KiRow, &KjRow);
+
+        size_t nBlocks = nActiveVectors / kernelFunctionBlockSize;
+        if (nBlocks * kernelFunctionBlockSize < nActiveVectors) { nBlocks++; }
+
+        daal::threader_for(nBlocks, nBlocks, [=](size_t iBlock)
+        {
+            size_t tStart = iBlock * kernelFunctionBlockSize;
+            size_t tEnd   = tStart + kernelFunctionBlockSize;
+            if (tEnd > nActiveVectors) { tEnd = nActiveVectors; }
+
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t t = tStart; t < tEnd; t++)
+            {
+                grad[t] += dyi * y[t] * KiRow[t];
+                grad[t] += dyj * y[t] * KjRow[t];
+            }
+        } );
+        return;
+    }
+
     size_t blockSize = (kernelFunctionBlockSize >> 1);  // 2 rows from kernel function matrix are used
     size_t nBlocks = nActiveVectors / blockSize;
     if (nBlocks * blockSize < nActiveVectors) { nBlocks++; }
@@ -814,7 +916,7 @@ SVMTrainTask<algorithmFPType, cpu>::SVMTrainTask(
             NumericTablePtr xTable, NumericTable *yTable,
             services::SharedPtr<kernel_function::KernelIface> kernel,
             services::SharedPtr<services::KernelErrorCollection> _errors) :
-        nVectors(nVectors), _errors(_errors)
+        nVectors(nVectors), cache(NULL), _errors(_errors)
 {
     alpha      = daal::services::internal::service_calloc<algorithmFPType, cpu>(nVectors);
     I          = daal::services::internal::service_calloc<char,            cpu>(nVectors);
@@ -831,6 +933,11 @@ SVMTrainTask<algorithmFPType, cpu>::SVMTrainTask(
         cache = new SVMCache<simpleCache,  algorithmFPType, cpu>(cacheSize, nVectors,
                     doShrinking, xTable, kernel, _errors);
     }
+    else if (cacheSize >= 2 * nVectors * sizeof(algorithmFPType))
+    {
+        cache = new SVMCache<lruCache,     algorithmFPType, cpu>(cacheSize, nVectors,
+                    doShrinking, xTable, kernel, _errors);
+    }
     else
     {
         cacheSize = kernelFunctionBlockSize;
@@ -871,11 +978,9 @@ void SVMTrainTask<algorithmFPType, cpu>::init(algorithmFPType C)
         updateI(C, i);
     }
 
-    algorithmFPType *KiiPtr;
     for (size_t i = 0; i < nVectors; i++)
     {
-        KiiPtr = cache->getRowBlock(i, i, 1);
-        kernelDiag[i] = *KiiPtr;
+        kernelDiag[i] = cache->getDiagonalElement(i);
     }
 }
 
@@ -972,6 +1077,35 @@ void SVMCacheRowGetter<simpleCache, true, algorithmFPType, cpu>::updateShrinking
     }
 }
 
+/**
+ * \brief Move the indices of the shrunk feature vector to the end of the array and
+ *        re-order the columns of the cached rows accordingly
+ *
+ * \param[in] nActiveVectors Number of observations in a training data set that are used
+ *                           in sequential minimum optimization at the current iteration
+ * \param[in] I              Array of flags that describe the status of feature vectors
+ */
+template<typename algorithmFPType, CpuType cpu>
+void SVMCache<lruCache, algorithmFPType, cpu>::updateShrinkingRowIndices(size_t nActiveVectors, const char *I)
+{
+    size_t i = 0;
+    size_t j = nActiveVectors-1;
+    while(i < j)
+    {
+        while (!(I[i] & shrink) && i < nActiveVectors - 1) i++;
+        while ( (I[j] & shrink) && j > 0)                  j--;
+        if (i >= j) break;
+        daal::swap<size_t, cpu>(shrinkingRowIndices[i], shrinkingRowIndices[j]);
+        for (size_t l = 0; l < _nLines; l++)
+        {
+            if (_lineRows[l] == _lineSize) { continue; }
+            daal::swap<algorithmFPType, cpu>(_cache[l * _lineSize + i], _cache[l * _lineSize + j]);
+        }
+        i++;
+        j--;
+    }
+}
+
 } // namespace internal
 } // namespace training
 } // namespace svm
@@ -0,0 +1,105 @@
+/* file: cov_dense_missing_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of dense variance-covariance matrix and low order moments
+!    computation in the batch processing mode for the weighted data set
+!    with missing values
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-COVARIANCE_DENSE_MISSING_BATCH"></a>
+ * \example cov_dense_missing_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <limits>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+const string datasetFileName = "../data/batch/covcormoments_dense.csv";
+
+/* Every missingStep-th value of the data set is replaced with NaN */
+const size_t missingStep = 7;
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+    NumericTablePtr dataTable = dataSource.getNumericTable();
+    size_t nVectors = dataTable->getNumberOfRows();
+
+    /* Mark some of the values as missing and give every observation a frequency weight */
+    BlockDescriptor<double> block;
+    dataTable->getBlockOfRows(0, nVectors, readWrite, block);
+    double *data = block.getBlockPtr();
+    for (size_t i = 0; i < nVectors * dataTable->getNumberOfColumns(); i += missingStep)
+    {
+        data[i] = numeric_limits<double>::quiet_NaN();
+    }
+    dataTable->releaseBlockOfRows(block);
+
+    services::SharedPtr<HomogenNumericTable<double> > weightsTable(
+        new HomogenNumericTable<double>(1, nVectors, NumericTable::doAllocate));
+    double *weights = weightsTable->getArray();
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        weights[i] = (double)(1 + i % 3);
+    }
+
+    /* Create an algorithm to compute a dense variance-covariance matrix skipping the missing values */
+    covariance::Batch<> algorithm;
+    algorithm.input.set(covariance::data, dataTable);
+    algorithm.input.set(covariance::weights, weightsTable);
+    algorithm.parameter.skipMissingValues = true;
+
+    /* Compute a dense variance-covariance matrix over the pairwise complete observations */
+    algorithm.compute();
+
+    services::SharedPtr<covariance::Result> res = algorithm.getResult();
+
+    printNumericTable(res->get(covariance::covariance),              "Covariance matrix:");
+    printNumericTable(res->get(covariance::mean),                    "Mean vector:");
+    printNumericTable(res->get(covariance::nObservationsPerFeature), "Number of observations per feature:");
+
+    /* Compute the low order moments of the same data set */
+    low_order_moments::Batch<> moments;
+    moments.input.set(low_order_moments::data, dataTable);
+    moments.input.set(low_order_moments::weights, weightsTable);
+    moments.parameter.skipMissingValues = true;
+    moments.compute();
+
+    services::SharedPtr<low_order_moments::Result> momentsRes = moments.getResult();
+
+    printNumericTable(momentsRes->get(low_order_moments::mean),              "Mean:");
+    printNumericTable(momentsRes->get(low_order_moments::standardDeviation), "Standard deviation:");
+    printNumericTable(momentsRes->get(low_order_moments::minimum),           "Minimum:");
+    printNumericTable(momentsRes->get(low_order_moments::maximum),           "Maximum:");
+
+    return 0;
+}
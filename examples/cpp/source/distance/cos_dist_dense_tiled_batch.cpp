@@ -0,0 +1,84 @@
+/* file: cos_dist_dense_tiled_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of computing a cosine distance matrix by blocks of rows
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-COSINE_DISTANCE_TILED_BATCH"></a>
+ * \example cos_dist_dense_tiled_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+const string datasetFileName = "../data/batch/distance.csv";
+
+/* Number of rows of the distance matrix processed at once */
+const size_t nRowsInBlock = 4;
+
+/* Prints the blocks of rows of the distance matrix instead of storing the whole matrix */
+struct PrintRowBlock : public cosine_distance::RowBlockProcessorIface
+{
+    void operator()(size_t startRow, const NumericTablePtr &block)
+    {
+        if (startRow == 0)
+        {
+            printNumericTable(block, "First rows of the cosine distance matrix", nRowsInBlock, 15);
+        }
+    }
+};
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Create an algorithm to compute a cosine distance matrix using the tiled method */
+    cosine_distance::Batch<double, cosine_distance::tiledDense> algorithm;
+
+    /* Set input objects for the algorithm */
+    algorithm.input.set(cosine_distance::data, dataSource.getNumericTable());
+
+    /* Compute a cosine distance matrix in the packed symmetric layout */
+    algorithm.compute();
+
+    printNumericTable(algorithm.getResult()->get(cosine_distance::cosineDistance), "Cosine distance", 15);
+
+    /* Pass the cosine distance matrix to the functor by blocks of rows */
+    cosine_distance::Batch<double, cosine_distance::tiledDense> streamingAlgorithm;
+    streamingAlgorithm.input.set(cosine_distance::data, dataSource.getNumericTable());
+    streamingAlgorithm.parameter.nRowsInBlock = nRowsInBlock;
+    streamingAlgorithm.parameter.rowBlockProcessor = services::SharedPtr<cosine_distance::RowBlockProcessorIface>(new PrintRowBlock());
+
+    streamingAlgorithm.compute();
+
+    return 0;
+}
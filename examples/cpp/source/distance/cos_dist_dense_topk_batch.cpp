@@ -0,0 +1,66 @@
+/* file: cos_dist_dense_topk_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of searching the nearest neighbors by the cosine distance
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-COSINE_DISTANCE_TOPK_BATCH"></a>
+ * \example cos_dist_dense_topk_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+const string datasetFileName = "../data/batch/distance.csv";
+
+/* Number of nearest neighbors */
+const size_t k = 3;
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Create an algorithm to search the nearest neighbors of every observation among the other observations */
+    cosine_distance::Batch<double, cosine_distance::topKDense> algorithm;
+
+    /* Set input objects and parameters for the algorithm */
+    algorithm.input.set(cosine_distance::data, dataSource.getNumericTable());
+    algorithm.parameter.k = k;
+
+    /* Search the nearest neighbors without computing the whole distance matrix */
+    algorithm.compute();
+
+    printNumericTable(algorithm.getResult()->get(cosine_distance::indices), "Indices of the nearest neighbors:", 10);
+    printNumericTable(algorithm.getResult()->get(cosine_distance::distances), "Cosine distances to the nearest neighbors:", 10);
+
+    return 0;
+}
@@ -0,0 +1,125 @@
+/* file: kdtree_knn_dense_brute_force_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of k-Nearest Neighbor with the brute force search in the batch processing mode.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-KDTREE_KNN_DENSE_BRUTE_FORCE_BATCH"></a>
+ * \example kdtree_knn_dense_brute_force_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <cstdio>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+string trainDatasetFileName            = "../data/batch/k_nearest_neighbors_train.csv";
+string testDatasetFileName             = "../data/batch/k_nearest_neighbors_test.csv";
+
+size_t nFeatures = 5;
+
+services::SharedPtr<kdtree_knn_classification::training::Result> trainingResult;
+services::SharedPtr<classifier::prediction::Result> predictionResult;
+NumericTablePtr testGroundTruth;
+
+void trainModel();
+void testModel();
+void printResults();
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    trainModel();
+    testModel();
+    printResults();
+
+    return 0;
+}
+
+void trainModel()
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName,
+                                                      DataSource::notAllocateNumericTable,
+                                                      DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and labels */
+    NumericTablePtr trainData(new HomogenNumericTable<double>(nFeatures, 0, NumericTable::notAllocate));
+    NumericTablePtr trainGroundTruth(new HomogenNumericTable<double>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(trainData, trainGroundTruth));
+
+    /* Retrieve the data from the input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    /* Create an algorithm object to train the kNN model without building the KD-tree */
+    kdtree_knn_classification::training::Batch<double, kdtree_knn_classification::training::bruteForceDense> algorithm;
+
+    /* Pass the training data set and dependent values to the algorithm */
+    algorithm.input.set(classifier::training::data, trainData);
+    algorithm.input.set(classifier::training::labels, trainGroundTruth);
+
+    /* Train the kNN model */
+    algorithm.compute();
+
+    /* Retrieve the results of the training algorithm  */
+    trainingResult = algorithm.getResult();
+}
+
+void testModel()
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the test data from a .csv file */
+    FileDataSource<CSVFeatureManager> testDataSource(testDatasetFileName,
+                                                     DataSource::notAllocateNumericTable,
+                                                     DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for testing data and labels */
+    NumericTablePtr testData(new HomogenNumericTable<double>(nFeatures, 0, NumericTable::notAllocate));
+    testGroundTruth = NumericTablePtr(new HomogenNumericTable<double>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(testData, testGroundTruth));
+
+    /* Retrieve the data from input file */
+    testDataSource.loadDataBlock(mergedData.get());
+
+    /* Create algorithm objects for kNN prediction with the brute force search */
+    kdtree_knn_classification::prediction::Batch<double, kdtree_knn_classification::prediction::bruteForceDense> algorithm;
+
+    /* Pass the testing data set and trained model to the algorithm */
+    algorithm.input.set(classifier::prediction::data,  testData);
+    algorithm.input.set(classifier::prediction::model, trainingResult->get(classifier::training::model));
+
+    /* Compute prediction results */
+    algorithm.compute();
+
+    /* Retrieve algorithm results */
+    predictionResult = algorithm.getResult();
+}
+
+void printResults()
+{
+    printNumericTables<int, int>(testGroundTruth,
+                                 predictionResult->get(classifier::prediction::prediction),
+                                 "Ground truth", "Classification results",
+                                 "Brute force kNN classification results (first 20 observations):", 20);
+}
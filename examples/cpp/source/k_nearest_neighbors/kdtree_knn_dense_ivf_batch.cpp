@@ -0,0 +1,180 @@
+/* file: kdtree_knn_dense_ivf_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the approximate search of k nearest neighbors in the inverted file index
+!    in the batch processing mode. The example compares the recall and the number of
+!    queries per second with the exact search in the KD-tree on generated data.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-KDTREE_KNN_DENSE_IVF_BATCH"></a>
+ * \example kdtree_knn_dense_ivf_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Generated data set parameters */
+const size_t nFeatures       = 16;
+const size_t nClusters       = 64;
+const size_t nTrainVectors   = 100000;
+const size_t nQueryVectors   = 2000;
+const size_t nNeighbors      = 10;
+
+/* Numbers of the scanned clusters of the inverted file index */
+const size_t nProbesList[]   = { 1, 2, 4, 8, 16, 32 };
+
+NumericTablePtr generateData(size_t nVectors, const double *centers, double *labels);
+double computeRecall(NumericTablePtr exactDistances, NumericTablePtr approximateDistances);
+
+template <kdtree_knn_classification::training::Method method>
+services::SharedPtr<kdtree_knn_classification::Model> trainModel(NumericTablePtr data, NumericTablePtr labels, double &seconds);
+
+template <kdtree_knn_classification::prediction::Method method>
+NumericTablePtr findNeighbors(services::SharedPtr<kdtree_knn_classification::Model> model, NumericTablePtr queries,
+                              size_t nProbes, double &seconds);
+
+int main(int argc, char *argv[])
+{
+    /* Generate the training and query data as the noisy copies of the random centers */
+    srand(777);
+    double centers[nClusters * nFeatures];
+    for (size_t i = 0; i < nClusters * nFeatures; i++)
+    {
+        centers[i] = 10.0 * rand() / RAND_MAX;
+    }
+    double *trainLabels = new double[nTrainVectors];
+    NumericTablePtr trainData = generateData(nTrainVectors, centers, trainLabels);
+    NumericTablePtr trainGroundTruth(new HomogenNumericTable<double>(trainLabels, 1, nTrainVectors));
+    NumericTablePtr queryData = generateData(nQueryVectors, centers, NULL);
+
+    double seconds;
+
+    /* Exact search in the KD-tree */
+    services::SharedPtr<kdtree_knn_classification::Model> kdTreeModel =
+        trainModel<kdtree_knn_classification::training::defaultDense>(trainData, trainGroundTruth, seconds);
+    printf("KD-tree training:        %8.3f s\n", seconds);
+
+    NumericTablePtr exactDistances =
+        findNeighbors<kdtree_knn_classification::prediction::defaultDense>(kdTreeModel, queryData, 0, seconds);
+    printf("KD-tree search:          %8.3f s, %10.0f queries/s\n", seconds, nQueryVectors / seconds);
+
+    /* Approximate search in the inverted file index */
+    services::SharedPtr<kdtree_knn_classification::Model> ivfModel =
+        trainModel<kdtree_knn_classification::training::ivfDense>(trainData, trainGroundTruth, seconds);
+    printf("Inverted file training:  %8.3f s\n\n", seconds);
+
+    printf("nProbes    recall   queries/s\n");
+    for (size_t i = 0; i < sizeof(nProbesList) / sizeof(nProbesList[0]); i++)
+    {
+        NumericTablePtr approximateDistances =
+            findNeighbors<kdtree_knn_classification::prediction::ivfDense>(ivfModel, queryData, nProbesList[i], seconds);
+        printf("%7lu %9.4f %11.0f\n", (unsigned long)nProbesList[i], computeRecall(exactDistances, approximateDistances),
+               nQueryVectors / seconds);
+    }
+
+    delete[] trainLabels;
+    return 0;
+}
+
+NumericTablePtr generateData(size_t nVectors, const double *centers, double *labels)
+{
+    services::SharedPtr<HomogenNumericTable<double> > data(
+        new HomogenNumericTable<double>(nFeatures, nVectors, NumericTable::doAllocate));
+    double *dataArray = data->getArray();
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        const size_t cluster = rand() % nClusters;
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            dataArray[i * nFeatures + j] = centers[cluster * nFeatures + j] + 2.0 * rand() / RAND_MAX;
+        }
+        if (labels) { labels[i] = (double)(cluster % 2); }
+    }
+    return data;
+}
+
+template <kdtree_knn_classification::training::Method method>
+services::SharedPtr<kdtree_knn_classification::Model> trainModel(NumericTablePtr data, NumericTablePtr labels, double &seconds)
+{
+    /* Create an algorithm object to train the kNN model with the given method */
+    kdtree_knn_classification::training::Batch<double, method> algorithm;
+    algorithm.parameter.k = nNeighbors;
+
+    /* Pass the training data set and dependent values to the algorithm */
+    algorithm.input.set(classifier::training::data, data);
+    algorithm.input.set(classifier::training::labels, labels);
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    algorithm.compute();
+    seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    return algorithm.getResult()->get(classifier::training::model);
+}
+
+template <kdtree_knn_classification::prediction::Method method>
+NumericTablePtr findNeighbors(services::SharedPtr<kdtree_knn_classification::Model> model, NumericTablePtr queries,
+                              size_t nProbes, double &seconds)
+{
+    /* Create an algorithm object to search the nearest neighbors with the given method */
+    kdtree_knn_classification::prediction::Batch<double, method> algorithm;
+    algorithm.parameter.k = nNeighbors;
+    algorithm.parameter.resultsToCompute = kdtree_knn_classification::computeDistances;
+    if (nProbes) { algorithm.parameter.nProbes = nProbes; }
+
+    algorithm.input.set(classifier::prediction::data,  queries);
+    algorithm.input.set(classifier::prediction::model, model);
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    algorithm.compute();
+    seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    return algorithm.getResult()->get(kdtree_knn_classification::prediction::distances);
+}
+
+/* Fraction of the found neighbors that are not farther than the k-th exact nearest neighbor */
+double computeRecall(NumericTablePtr exactDistances, NumericTablePtr approximateDistances)
+{
+    BlockDescriptor<double> exactBlock, approximateBlock;
+    exactDistances->getBlockOfRows(0, nQueryVectors, readOnly, exactBlock);
+    approximateDistances->getBlockOfRows(0, nQueryVectors, readOnly, approximateBlock);
+    const double *exact = exactBlock.getBlockPtr();
+    const double *approximate = approximateBlock.getBlockPtr();
+
+    size_t nFound = 0;
+    for (size_t i = 0; i < nQueryVectors; i++)
+    {
+        const double kthDistance = exact[i * nNeighbors + nNeighbors - 1];
+        for (size_t j = 0; j < nNeighbors; j++)
+        {
+            if (approximate[i * nNeighbors + j] <= kthDistance * (1.0 + 1e-12)) { nFound++; }
+        }
+    }
+
+    exactDistances->releaseBlockOfRows(exactBlock);
+    approximateDistances->releaseBlockOfRows(approximateBlock);
+    return (double)nFound / (nQueryVectors * nNeighbors);
+}
@@ -0,0 +1,138 @@
+/* file: kdtree_knn_dense_search_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of k-Nearest Neighbor classification with distance-weighted voting
+!    that also returns the nearest neighbors in the batch processing mode.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-KDTREE_KNN_DENSE_SEARCH_BATCH"></a>
+ * \example kdtree_knn_dense_search_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <cstdio>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+string trainDatasetFileName            = "../data/batch/k_nearest_neighbors_train.csv";
+string testDatasetFileName             = "../data/batch/k_nearest_neighbors_test.csv";
+
+size_t nFeatures = 5;
+size_t nNeighbors = 3;
+
+services::SharedPtr<kdtree_knn_classification::training::Result> trainingResult;
+services::SharedPtr<kdtree_knn_classification::prediction::Result> predictionResult;
+NumericTablePtr testGroundTruth;
+
+void trainModel();
+void testModel();
+void printResults();
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    trainModel();
+    testModel();
+    printResults();
+
+    return 0;
+}
+
+void trainModel()
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName,
+                                                      DataSource::notAllocateNumericTable,
+                                                      DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and labels */
+    NumericTablePtr trainData(new HomogenNumericTable<double>(nFeatures, 0, NumericTable::notAllocate));
+    NumericTablePtr trainGroundTruth(new HomogenNumericTable<double>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(trainData, trainGroundTruth));
+
+    /* Retrieve the data from the input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    /* Create an algorithm object to train the KD-tree based kNN model */
+    kdtree_knn_classification::training::Batch<> algorithm;
+
+    /* Pass the training data set and dependent values to the algorithm */
+    algorithm.input.set(classifier::training::data, trainData);
+    algorithm.input.set(classifier::training::labels, trainGroundTruth);
+
+    /* Train the KD-tree based kNN model */
+    algorithm.compute();
+
+    /* Retrieve the results of the training algorithm  */
+    trainingResult = algorithm.getResult();
+}
+
+void testModel()
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the test data from a .csv file */
+    FileDataSource<CSVFeatureManager> testDataSource(testDatasetFileName,
+                                                     DataSource::notAllocateNumericTable,
+                                                     DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for testing data and labels */
+    NumericTablePtr testData(new HomogenNumericTable<double>(nFeatures, 0, NumericTable::notAllocate));
+    testGroundTruth = NumericTablePtr(new HomogenNumericTable<double>(1, 0, NumericTable::notAllocate));
+    NumericTablePtr mergedData(new MergedNumericTable(testData, testGroundTruth));
+
+    /* Retrieve the data from input file */
+    testDataSource.loadDataBlock(mergedData.get());
+
+    /* Create algorithm objects for KD-tree based kNN prediction with the default method */
+    kdtree_knn_classification::prediction::Batch<> algorithm;
+
+    /* Request the class labels together with the nearest neighbors, the closer neighbors have larger votes */
+    algorithm.parameter.k = nNeighbors;
+    algorithm.parameter.resultsToCompute = kdtree_knn_classification::computeClassLabels |
+                                           kdtree_knn_classification::computeIndicesOfNeighbors |
+                                           kdtree_knn_classification::computeDistances;
+    algorithm.parameter.voteWeights = kdtree_knn_classification::voteDistance;
+
+    /* Pass the testing data set and trained model to the algorithm */
+    algorithm.input.set(classifier::prediction::data,  testData);
+    algorithm.input.set(classifier::prediction::model, trainingResult->get(classifier::training::model));
+
+    /* Compute prediction results */
+    algorithm.compute();
+
+    /* Retrieve algorithm results */
+    predictionResult = algorithm.getResult();
+}
+
+void printResults()
+{
+    printNumericTables<int, int>(testGroundTruth,
+                                 predictionResult->get(classifier::prediction::prediction),
+                                 "Ground truth", "Classification results",
+                                 "KNN classification results (first 20 observations):", 20);
+    printNumericTable(predictionResult->get(kdtree_knn_classification::prediction::indices),
+                      "Indices of the nearest neighbors (first 10 observations):", 10);
+    printNumericTable(predictionResult->get(kdtree_knn_classification::prediction::distances),
+                      "Distances to the nearest neighbors (first 10 observations):", 10);
+}
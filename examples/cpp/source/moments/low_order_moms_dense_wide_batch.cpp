@@ -0,0 +1,87 @@
+/* file: low_order_moms_dense_wide_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of computing low order moments in the batch processing mode
+!    for the tables of the same size and different shapes. The example measures
+!    the computation time from the tall tables, where the rows are split across
+!    the threads, to the wide tables, where the features are split across the threads.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-LOW_ORDER_MOMENTS_DENSE_WIDE_BATCH"></a>
+ * \example low_order_moms_dense_wide_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Generated data set parameters */
+const size_t nElements      = 50000000;
+const size_t nRowsList[]    = { 1000000, 100000, 20000, 5000, 2000, 1000, 500, 200, 100 };
+const size_t nRepeats       = 3;
+
+NumericTablePtr generateData(size_t nRows, size_t nColumns);
+
+int main(int argc, char *argv[])
+{
+    printf("%10s %10s %12s\n", "nRows", "nColumns", "seconds");
+    for (size_t i = 0; i < sizeof(nRowsList) / sizeof(nRowsList[0]); i++)
+    {
+        const size_t nRows    = nRowsList[i];
+        const size_t nColumns = nElements / nRows;
+        NumericTablePtr data = generateData(nRows, nColumns);
+
+        /* Create an algorithm to compute low order moments using the default method */
+        low_order_moments::Batch<> algorithm;
+        algorithm.input.set(low_order_moments::data, data);
+
+        /* Take the best time of several runs */
+        double bestSeconds = 0.0;
+        for (size_t r = 0; r < nRepeats; r++)
+        {
+            chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            algorithm.compute();
+            double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            if (r == 0 || seconds < bestSeconds) { bestSeconds = seconds; }
+        }
+        printf("%10lu %10lu %12.4f\n", (unsigned long)nRows, (unsigned long)nColumns, bestSeconds);
+    }
+
+    return 0;
+}
+
+NumericTablePtr generateData(size_t nRows, size_t nColumns)
+{
+    services::SharedPtr<HomogenNumericTable<double> > data(
+        new HomogenNumericTable<double>(nColumns, nRows, NumericTable::doAllocate));
+    double *dataArray = data->getArray();
+    srand(777);
+    for (size_t i = 0; i < nRows * nColumns; i++)
+    {
+        dataArray[i] = 10.0 * rand() / RAND_MAX;
+    }
+    return data;
+}
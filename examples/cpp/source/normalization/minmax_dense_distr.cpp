@@ -0,0 +1,136 @@
+/* file: minmax_dense_distr.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of min-max normalization in the distributed processing mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-MINMAX_DENSE_DISTRIBUTED"></a>
+ * \example minmax_dense_distr.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::normalization;
+
+/* Input data set parameters */
+const size_t nBlocks         = 4;
+
+const string datasetFileNames[] =
+{
+    "../data/distributed/covcormoments_dense_1.csv",
+    "../data/distributed/covcormoments_dense_2.csv",
+    "../data/distributed/covcormoments_dense_3.csv",
+    "../data/distributed/covcormoments_dense_4.csv"
+};
+
+NumericTablePtr data[nBlocks];
+minmax::PartialResultPtr partialResult[nBlocks];
+services::SharedPtr<minmax::Result> minMax;
+
+void computestep1Local(size_t block);
+void computeOnMasterNode();
+void normalizeLocal(size_t block);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 4, &datasetFileNames[0], &datasetFileNames[1], &datasetFileNames[2], &datasetFileNames[3]);
+
+    for(size_t i = 0; i < nBlocks; i++)
+    {
+        computestep1Local(i);
+    }
+
+    computeOnMasterNode();
+
+    printNumericTable(minMax->get(minmax::minimum), "Minimum:");
+    printNumericTable(minMax->get(minmax::maximum), "Maximum:");
+
+    for(size_t i = 0; i < nBlocks; i++)
+    {
+        normalizeLocal(i);
+    }
+
+    return 0;
+}
+
+void computestep1Local(size_t block)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileNames[block], DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+    data[block] = dataSource.getNumericTable();
+
+    /* Create an algorithm to compute the minimums and maximums in the distributed processing mode */
+    minmax::Distributed<step1Local> algorithm;
+
+    /* Set input objects for the algorithm */
+    algorithm.input.set(minmax::data, data[block]);
+
+    /* Compute the partial minimums and maximums on the local node */
+    algorithm.compute();
+
+    /* Get the computed partial results */
+    partialResult[block] = algorithm.getPartialResult();
+}
+
+void computeOnMasterNode()
+{
+    /* Create an algorithm to compute the minimums and maximums in the distributed processing mode */
+    minmax::Distributed<step2Master> algorithm;
+
+    /* Set input objects for the algorithm */
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        algorithm.input.add(minmax::partialResults, partialResult[i]);
+    }
+
+    /* Merge the partial results computed on local nodes */
+    algorithm.compute();
+
+    /* Finalize the result in the distributed processing mode */
+    algorithm.finalizeCompute();
+
+    /* Get the minimums and maximums of the whole data set */
+    minMax = algorithm.getResult();
+}
+
+void normalizeLocal(size_t block)
+{
+    /* Pass the minimums and maximums of the whole data set to the min-max normalization in the basic statistics */
+    data[block]->basicStatistics.set(NumericTableIface::minimum, minMax->get(minmax::minimum));
+    data[block]->basicStatistics.set(NumericTableIface::maximum, minMax->get(minmax::maximum));
+
+    /* Create an algorithm to normalize the local block */
+    minmax::Batch<> algorithm;
+
+    algorithm.input.set(minmax::data, data[block]);
+
+    /* Normalize the local block */
+    algorithm.compute();
+
+    printNumericTable(algorithm.getResult()->get(minmax::normalizedData), "Normalized data (first 10 rows):", 10);
+}
@@ -0,0 +1,94 @@
+/* file: zscore_dense_lazy_online.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of z-score and min-max normalization applied on the fly
+!    and in place with the moments computed in the online processing mode.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-ZSCORE_DENSE_LAZY_ONLINE"></a>
+ * \example zscore_dense_lazy_online.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::normalization;
+
+/* Input data set parameters */
+string datasetName = "../data/batch/normalization.csv";
+const size_t nVectorsInBlock = 20;
+
+int main()
+{
+    /* Compute the moments of the data set block by block */
+    FileDataSource<CSVFeatureManager> momentsDataSource(datasetName, DataSource::doAllocateNumericTable,
+                                                        DataSource::doDictionaryFromContext);
+
+    low_order_moments::Online<> moments;
+
+    while(momentsDataSource.loadDataBlock(nVectorsInBlock) > 0)
+    {
+        moments.input.set(low_order_moments::data, momentsDataSource.getNumericTable());
+        moments.compute();
+    }
+    moments.finalizeCompute();
+
+    services::SharedPtr<low_order_moments::Result> momentsResult = moments.getResult();
+
+    /* Create a table to load the blocks of the data set into */
+    FileDataSource<CSVFeatureManager> dataSource(datasetName, DataSource::notAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    NumericTablePtr block(new HomogenNumericTable<float>(momentsResult->get(low_order_moments::mean)->getNumberOfColumns(),
+                                                         0, NumericTable::notAllocate));
+
+    /* Create the table that normalizes the values by min-max normalization when they are loaded into the block */
+    services::SharedPtr<NormalizedNumericTable> minmaxBlock =
+        NormalizedNumericTable::createMinMax(block, momentsResult->get(low_order_moments::minimum),
+                                             momentsResult->get(low_order_moments::maximum), -1.0, 1.0,
+                                             NormalizedNumericTable::normalizeOnWrite);
+
+    /* Normalize the first block of the data set on the fly */
+    dataSource.loadDataBlock(nVectorsInBlock, block.get());
+    minmaxBlock->refresh();
+
+    /* Create the table that normalizes the values of the block by z-score normalization when they are read */
+    services::SharedPtr<NormalizedNumericTable> zscoreBlock =
+        NormalizedNumericTable::createZScore(block, momentsResult->get(low_order_moments::mean),
+                                             momentsResult->get(low_order_moments::standardDeviation));
+
+    printNumericTable(block, "First 10 rows of the input data:", 10);
+    printNumericTable(zscoreBlock, "First 10 rows of the z-score normalization result:", 10);
+
+    /* Normalize the second block of the data set while it is loaded */
+    dataSource.loadDataBlock(nVectorsInBlock, minmaxBlock.get());
+    printNumericTable(block, "First 10 rows of the min-max normalization result for the second block:", 10);
+
+    /* Normalize the third block of the data set in place */
+    dataSource.loadDataBlock(nVectorsInBlock, block.get());
+    zscoreBlock->refresh();
+    zscoreBlock->normalizeInPlace();
+    printNumericTable(block, "First 10 rows of the z-score normalization result for the third block:", 10);
+
+    return 0;
+}
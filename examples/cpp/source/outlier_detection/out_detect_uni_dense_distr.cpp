@@ -0,0 +1,134 @@
+/* file: out_detect_uni_dense_distr.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of univariate outlier detection in the distributed processing
+!    mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-OUTLIER_DETECTION_UNIVARIATE_DISTRIBUTED"></a>
+ * \example out_detect_uni_dense_distr.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+const size_t nBlocks         = 4;
+
+const string datasetFileNames[] =
+{
+    "../data/distributed/covcormoments_dense_1.csv",
+    "../data/distributed/covcormoments_dense_2.csv",
+    "../data/distributed/covcormoments_dense_3.csv",
+    "../data/distributed/covcormoments_dense_4.csv"
+};
+
+NumericTablePtr data[nBlocks];
+univariate_outlier_detection::PartialResultPtr partialResult[nBlocks];
+services::SharedPtr<univariate_outlier_detection::Result> estimates;
+
+void computestep1Local(size_t block);
+void computeOnMasterNode();
+void detectOutliersLocal(size_t block);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 4, &datasetFileNames[0], &datasetFileNames[1], &datasetFileNames[2], &datasetFileNames[3]);
+
+    for(size_t i = 0; i < nBlocks; i++)
+    {
+        computestep1Local(i);
+    }
+
+    computeOnMasterNode();
+
+    printNumericTable(estimates->get(univariate_outlier_detection::locationEstimate), "Location estimate:");
+    printNumericTable(estimates->get(univariate_outlier_detection::scatterEstimate),  "Scatter estimate:");
+
+    for(size_t i = 0; i < nBlocks; i++)
+    {
+        detectOutliersLocal(i);
+    }
+
+    return 0;
+}
+
+void computestep1Local(size_t block)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileNames[block], DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+    data[block] = dataSource.getNumericTable();
+
+    /* Create an algorithm to estimate the location and scatter in the distributed processing mode */
+    univariate_outlier_detection::Distributed<step1Local> algorithm;
+
+    /* Set input objects for the algorithm */
+    algorithm.input.set(univariate_outlier_detection::data, data[block]);
+
+    /* Compute the partial estimates on the local node */
+    algorithm.compute();
+
+    /* Get the computed partial estimates */
+    partialResult[block] = algorithm.getPartialResult();
+}
+
+void computeOnMasterNode()
+{
+    /* Create an algorithm to estimate the location and scatter in the distributed processing mode */
+    univariate_outlier_detection::Distributed<step2Master> algorithm;
+
+    /* Set input objects for the algorithm */
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        algorithm.input.add(univariate_outlier_detection::partialResults, partialResult[i]);
+    }
+
+    /* Merge the partial estimates computed on local nodes */
+    algorithm.compute();
+
+    /* Finalize the estimates in the distributed processing mode */
+    algorithm.finalizeCompute();
+
+    /* Get the location and scatter estimates of the whole data set */
+    estimates = algorithm.getResult();
+}
+
+void detectOutliersLocal(size_t block)
+{
+    /* Create an algorithm to detect outliers in the local block using the estimates of the whole data set */
+    univariate_outlier_detection::Batch<> algorithm;
+
+    algorithm.input.set(univariate_outlier_detection::data,     data[block]);
+    algorithm.input.set(univariate_outlier_detection::location, estimates->get(univariate_outlier_detection::locationEstimate));
+    algorithm.input.set(univariate_outlier_detection::scatter,  estimates->get(univariate_outlier_detection::scatterEstimate));
+
+    /* Compute the weights of the observations, the threshold is defined by the initialization procedure */
+    algorithm.compute();
+
+    printNumericTable(algorithm.getResult()->get(univariate_outlier_detection::weights), "Outlier detection result (first 10 rows):", 10);
+}
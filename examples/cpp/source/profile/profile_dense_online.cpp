@@ -0,0 +1,87 @@
+/* file: profile_dense_online.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of computing the profile of the data set (minimum, maximum, moments,
+!    covariance and quantiles) in a single pass in the online processing mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-PROFILE_DENSE_ONLINE"></a>
+ * \example profile_dense_online.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+const string datasetFileName = "../data/online/covcormoments_dense.csv";
+const size_t nVectorsInBlock = 50;
+
+/* Orders of the quantiles */
+double quantileOrders[] = { 0.1, 0.25, 0.5, 0.75, 0.9 };
+const size_t nQuantileOrders = sizeof(quantileOrders) / sizeof(quantileOrders[0]);
+
+void printResults(const services::SharedPtr<profile::Result> &res);
+
+int main(int argc, char *argv[])
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Create an algorithm to compute the profile in the online processing mode using the default method */
+    profile::Online<> algorithm;
+    algorithm.parameter.resultsToCompute = profile::computeAll;
+    algorithm.parameter.quantileOrders = NumericTablePtr(new HomogenNumericTable<double>(quantileOrders, nQuantileOrders, 1));
+
+    while(dataSource.loadDataBlock(nVectorsInBlock) == nVectorsInBlock)
+    {
+        /* Set input objects for the algorithm */
+        algorithm.input.set(profile::data, dataSource.getNumericTable());
+
+        /* Update the partial profile with the block of data */
+        algorithm.compute();
+    }
+
+    /* Finalize the result in the online processing mode */
+    algorithm.finalizeCompute();
+
+    /* Get the computed profile */
+    services::SharedPtr<profile::Result> res = algorithm.getResult();
+
+    printResults(res);
+
+    return 0;
+}
+
+void printResults(const services::SharedPtr<profile::Result> &res)
+{
+    printNumericTable(res->get(profile::minimum),           "Minimum:");
+    printNumericTable(res->get(profile::maximum),           "Maximum:");
+    printNumericTable(res->get(profile::sum),               "Sum:");
+    printNumericTable(res->get(profile::mean),              "Mean:");
+    printNumericTable(res->get(profile::variance),          "Variance:");
+    printNumericTable(res->get(profile::standardDeviation), "Standard deviation:");
+    printNumericTable(res->get(profile::covariance),        "Covariance matrix (upper left, 10x10):", 10, 10);
+    printNumericTable(res->get(profile::quantiles),         "Quantiles:");
+}
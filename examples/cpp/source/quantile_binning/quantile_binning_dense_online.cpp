@@ -0,0 +1,83 @@
+/* file: quantile_binning_dense_online.cpp */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of computing the bin borders of the features from their quantile sketches
+!    in the online processing mode and replacing the blocks of the data set with the indices
+!    of the bins
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-QUANTILE_BINNING_DENSE_ONLINE"></a>
+ * \example quantile_binning_dense_online.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+const string datasetFileName = "../data/online/covcormoments_dense.csv";
+const size_t nVectorsInBlock = 50;
+
+/* Maximal number of bins of every feature */
+const size_t maxBins = 8;
+
+int main(int argc, char *argv[])
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Create an algorithm to compute the bin borders in the online processing mode using the sketch method */
+    quantile_binning::Online<> algorithm;
+    algorithm.parameter.maxBins = maxBins;
+
+    while(dataSource.loadDataBlock(nVectorsInBlock) == nVectorsInBlock)
+    {
+        /* Set input objects for the algorithm */
+        algorithm.input.set(quantile_binning::data, dataSource.getNumericTable());
+
+        /* Update the quantile sketches with the block of data */
+        algorithm.compute();
+    }
+
+    /* Finalize the bin borders in the online processing mode */
+    algorithm.finalizeCompute();
+
+    NumericTablePtr binBorders = algorithm.getResult()->get(quantile_binning::binBorders);
+    printNumericTable(binBorders, "Bin borders (first 10 features):", 10);
+
+    /* Replace the values of the first block of the data set with the indices of the bins */
+    FileDataSource<CSVFeatureManager> blockSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                  DataSource::doDictionaryFromContext);
+    blockSource.loadDataBlock(nVectorsInBlock);
+
+    quantile_binning::Batch<> binning;
+    binning.parameter.maxBins = maxBins;
+    binning.input.set(quantile_binning::data, blockSource.getNumericTable());
+    binning.input.set(quantile_binning::inputBinBorders, binBorders);
+    binning.compute();
+
+    printNumericTable(binning.getResult()->get(quantile_binning::binnedData), "Indices of the bins (first 10 observations):", 10);
+
+    return 0;
+}
@@ -164,6 +164,12 @@ public:
     DECLARE_SERIALIZABLE();
     Result();
 
+    /**
+     * Constructs the result of the classification algorithm with additional elements
+     * \param[in] nElements Number of elements in the result
+     */
+    Result(const size_t nElements);
+
     /**
      * Returns the prediction result of the classification algorithm
      * \param[in] id   Identifier of the prediction result, \ref ResultId
@@ -65,7 +65,9 @@ enum Method
  */
 enum InputId
 {
-    data = 0                /*!< %Input data table */
+    data    = 0,            /*!< %Input data table */
+    weights = 1             /*!< Optional weights of observations, numeric table of size nObservations x 1.
+                                 The weights are treated as frequency weights */
 };
 
 /**
@@ -74,9 +76,18 @@ enum InputId
  */
 enum PartialResultId
 {
-    nObservations = 0,      /*!< Number of observations processed so far */
-    crossProduct  = 1,      /*!< Cross-product matrix computed so far */
-    sum           = 2       /*!< Vector of sums computed so far */
+    nObservations               = 0,    /*!< Number of observations processed so far */
+    crossProduct                = 1,    /*!< Cross-product matrix computed so far */
+    sum                         = 2,    /*!< Vector of sums computed so far */
+    pairwiseNObservations       = 3,    /*!< Optional p x p matrix, the element (j, k) is the number of the observations
+                                             with non-missing values of the features j and k, the sum of their weights
+                                             if the weights are provided. Computed if the weights are provided
+                                             or the missing values are skipped */
+    pairwiseSum                 = 4,    /*!< Optional p x p matrix, the element (j, k) is the sum of the feature j
+                                             over the observations with non-missing values of the features j and k */
+    pairwiseSumSquaresCentered  = 5     /*!< Optional p x p matrix, the element (j, k) is the sum of squared differences
+                                             of the feature j from its mean over the observations
+                                             with non-missing values of the features j and k */
 };
 
 /**
@@ -85,9 +96,11 @@ enum PartialResultId
  */
 enum ResultId
 {
-    covariance      = 0,    /*!< Variance-covariance matrix */
-    correlation     = 0,    /*!< Correlation matrix */
-    mean            = 1     /*!< Vector of means */
+    covariance              = 0,    /*!< Variance-covariance matrix */
+    correlation             = 0,    /*!< Correlation matrix */
+    mean                    = 1,    /*!< Vector of means */
+    nObservationsPerFeature = 2     /*!< Vector of the numbers of non-missing observations of every feature,
+                                         the sums of their weights if the weights are provided */
 };
 
 /**
@@ -100,6 +113,17 @@ enum OutputMatrixType
     correlationMatrix = 1           /*!< Correlation matrix */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__COVARIANCE__OUTPUTMATRIXLAYOUT"></a>
+ * Available storage layouts of the computed matrix and of the cross-product partial result
+ */
+enum OutputMatrixLayout
+{
+    fullMatrix   = 0,               /*!< Full square matrix stored in HomogenNumericTable */
+    packedMatrix = 1                /*!< Lower triangle of the symmetric matrix stored in PackedSymmetricMatrix
+                                         with the lowerPackedSymmetricMatrix layout */
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__COVARIANCE__MASTERINPUTID"></a>
  * \brief Available identifiers of master node input arguments of the Covariance algorithm
@@ -226,7 +250,7 @@ public:
 
 protected:
 
-    void checkImpl(size_t nFeatures) const;
+    void checkImpl(size_t nFeatures, bool isPairwiseRequired) const;
 
     /** \private */
     template<typename Archive, bool onDeserialize>
@@ -251,6 +275,10 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     /** Default constructor */
     Parameter();
     OutputMatrixType outputMatrixType;      /*!< Type of the computed matrix */
+    OutputMatrixLayout outputMatrixLayout;  /*!< Storage layout of the computed matrix and of the cross-product partial result */
+    bool skipMissingValues;                 /*!< If true, the values of the features equal to NaN are treated as missing.
+                                                 Every element of the matrix is computed over the observations
+                                                 with non-missing values of both its features */
 };
 
 /**
@@ -102,6 +102,8 @@ public:
     {
         initialize();
         input.set(data, other.input.get(data));
+        input.set(referenceData, other.input.get(referenceData));
+        parameter = other.parameter;
     }
 
     /**
@@ -148,7 +150,7 @@ protected:
 
     virtual void allocateResult() DAAL_C11_OVERRIDE
     {
-        _result->allocate<algorithmFPType>(&input, NULL, (int) method);
+        _result->allocate<algorithmFPType>(&input, &parameter, (int) method);
         _res = _result.get();
     }
 
@@ -156,11 +158,13 @@ protected:
     {
         Analysis<batch>::_ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
         _in = &input;
+        _par = &parameter;
         _result = services::SharedPtr<Result>(new Result());
     }
 
 public:
     Input input;         /*!< %Input objects of the algorithm */
+    Parameter parameter; /*!< Parameters of the algorithm */
 
 private:
     services::SharedPtr<Result> _result;
@@ -52,7 +52,11 @@ namespace cosine_distance
  */
 enum Method
 {
-    defaultDense = 0       /*!< Default: performance-oriented method. */
+    defaultDense = 0,      /*!< Default: performance-oriented method. */
+    tiledDense   = 1,      /*!< Tiles of the lower triangle of the matrix are evenly distributed among threads;
+                                supports processing of the matrix by blocks of rows */
+    topKDense    = 2       /*!< Search of k nearest neighbors: tiles of the distance matrix are computed by threads
+                                and immediately reduced to the nearest neighbors of every observation */
 };
 
 /**
@@ -61,7 +65,9 @@ enum Method
  */
 enum InputId
 {
-    data = 0           /*!< %Input data table */
+    data          = 0, /*!< %Input data table */
+    referenceData = 1  /*!< topKDense only. Optional table of the reference observations to search the neighbors among.
+                            If not set, the neighbors of every observation of data are searched among the other observations of data */
 };
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__COSINE_DISTANCE__RESULTID"></a>
@@ -69,7 +75,9 @@ enum InputId
  */
 enum ResultId
 {
-    cosineDistance = 0          /*!< Table to store the result.*/
+    cosineDistance = 0,         /*!< Table to store the result.*/
+    indices   = 1,              /*!< topKDense only. Indices of the k nearest neighbors of every observation sorted by the distance */
+    distances = 2               /*!< topKDense only. Distances to the k nearest neighbors of every observation */
 };
 
 /**
@@ -77,6 +85,38 @@ enum ResultId
  */
 namespace interface1
 {
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__COSINE_DISTANCE__ROWBLOCKPROCESSORIFACE"></a>
+ * \brief Abstract interface class for processing of the cosine distance matrix by blocks of rows
+ */
+struct DAAL_EXPORT RowBlockProcessorIface : public Base
+{
+    /**
+     * Processes the block of rows of the cosine distance matrix
+     * \param[in] startRow  Index of the first row of the block in the distance matrix
+     * \param[in] block     Numeric table with the rows of the block, valid only during the call
+     */
+    virtual void operator()(size_t startRow, const data_management::NumericTablePtr &block) = 0;
+};
+
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__COSINE_DISTANCE__PARAMETER"></a>
+ * \brief Parameters of the cosine distance algorithm
+ */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    /** Constructs default parameters of the cosine distance algorithm */
+    Parameter();
+
+    size_t k;               /*!< topKDense only. Number of nearest neighbors to search */
+    size_t nRowsInBlock;    /*!< tiledDense only. Number of rows of the distance matrix passed to rowBlockProcessor at once */
+    services::SharedPtr<RowBlockProcessorIface> rowBlockProcessor;  /*!< tiledDense only. If set, the distance matrix
+                                                                         is not stored in the result: its blocks of rows
+                                                                         are passed to this functor in the increasing order */
+
+    void check() const DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__COSINE_DISTANCE__INPUT"></a>
  * \brief %Input objects for the cosine distance algorithm
@@ -169,6 +209,8 @@ protected:
 };
 /** @} */
 } // namespace interface1
+using interface1::RowBlockProcessorIface;
+using interface1::Parameter;
 using interface1::Input;
 using interface1::Result;
 
@@ -0,0 +1,270 @@
+/* file: gbt_model.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class defining the gradient boosted trees model
+//--
+*/
+
+#ifndef __GBT_MODEL_H__
+#define __GBT_MODEL_H__
+
+#include "data_management/data/homogen_numeric_table.h"
+#include "algorithms/model.h"
+#include "algorithms/classifier/classifier_model.h"
+#include "services/daal_strings.h"
+
+namespace daal
+{
+namespace algorithms
+{
+/**
+ * @defgroup gbt Gradient Boosted Trees
+ * \copydoc daal::algorithms::gbt
+ * @ingroup classification
+ * @{
+ */
+/**
+ * \brief Contains classes of the gradient boosted trees algorithm
+ */
+namespace gbt
+{
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__LOSSFUNCTION"></a>
+ * \brief Loss functions minimized by the gradient boosted trees algorithm
+ */
+enum LossFunction
+{
+    crossEntropy = 0, /*!< Cross-entropy loss for classification: logistic loss for two classes and softmax loss for more classes.
+                           The labels are the class indices from 0 to nClasses - 1 */
+    squared      = 1  /*!< Squared loss for regression. The labels are the dependent variable, the prediction is its estimate */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__GROWTHPOLICY"></a>
+ * \brief Order in which the nodes of the tree are split
+ */
+enum GrowthPolicy
+{
+    depthWise = 0, /*!< The nodes are split level by level */
+    leafWise  = 1  /*!< The leaf with the largest loss reduction is split first */
+};
+
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__GBT__PARAMETER"></a>
+ * \brief Parameters of the gradient boosted trees algorithm
+ *
+ * \snippet gradient_boosted_trees/gbt_model.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public classifier::Parameter
+{
+    /**
+     *  Main constructor
+     *  \param[in] nClasses         Number of classes
+     *  \param[in] lossFunction     Loss function minimized by the algorithm
+     *  \param[in] maxIterations    Number of boosting iterations
+     */
+    Parameter(size_t nClasses = 2, LossFunction lossFunction = crossEntropy, size_t maxIterations = 50) :
+        classifier::Parameter(nClasses), lossFunction(lossFunction), growthPolicy(depthWise), maxIterations(maxIterations),
+        maxTreeDepth(6), maxLeaves(0), maxBins(256), minObservationsInLeaf(5), learningRate(0.1), lambda(1.0), minSplitLoss(0.0)
+    {}
+
+    /**
+     * Checks the parameters of the gradient boosted trees algorithm
+     */
+    void check() const DAAL_C11_OVERRIDE
+    {
+        classifier::Parameter::check();
+        if(this->_errors->size() != 0) { return; }
+
+        DAAL_CHECK_EX(lossFunction == squared || nClasses >= 2, services::ErrorIncorrectParameter, services::ParameterName, nClassesStr());
+        DAAL_CHECK_EX(maxIterations > 0, services::ErrorIncorrectParameter, services::ParameterName, maxIterationsStr());
+        DAAL_CHECK_EX(maxTreeDepth > 0 || maxLeaves > 0, services::ErrorIncorrectParameter, services::ParameterName, maxTreeDepthStr());
+        DAAL_CHECK_EX(maxLeaves != 1, services::ErrorIncorrectParameter, services::ParameterName, maxLeavesStr());
+        DAAL_CHECK_EX(maxBins >= 2 && maxBins <= 65536, services::ErrorIncorrectParameter, services::ParameterName, maxBinsStr());
+        DAAL_CHECK_EX(minObservationsInLeaf > 0, services::ErrorIncorrectParameter, services::ParameterName, minObservationsInLeafStr());
+        DAAL_CHECK_EX(learningRate > 0, services::ErrorIncorrectParameter, services::ParameterName, learningRateStr());
+        DAAL_CHECK_EX(lambda >= 0, services::ErrorIncorrectParameter, services::ParameterName, lambdaStr());
+        DAAL_CHECK_EX(minSplitLoss >= 0, services::ErrorIncorrectParameter, services::ParameterName, minSplitLossStr());
+    }
+
+    LossFunction lossFunction;      /*!< Loss function minimized by the algorithm, \ref LossFunction */
+    GrowthPolicy growthPolicy;      /*!< Order in which the nodes of the tree are split, \ref GrowthPolicy */
+    size_t maxIterations;           /*!< Number of boosting iterations. Every iteration adds one tree,
+                                         or nClasses trees for the cross-entropy loss with more than two classes */
+    size_t maxTreeDepth;            /*!< Maximal depth of the tree. If zero, the depth is limited by maxLeaves only */
+    size_t maxLeaves;               /*!< Maximal number of leaves in the tree. If zero, the number of leaves is limited by maxTreeDepth only */
+    size_t maxBins;                 /*!< Maximal number of bins the values of every feature are quantized to.
+                                         The bin borders are the quantiles of the feature values in the training data set */
+    size_t minObservationsInLeaf;   /*!< Minimal number of observations in the leaf */
+    double learningRate;            /*!< Shrinkage applied to the responses of the leaves */
+    double lambda;                  /*!< L2 regularization of the responses of the leaves */
+    double minSplitLoss;            /*!< Minimal loss reduction required to split the node */
+};
+/* [Parameter source code] */
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__MODEL"></a>
+ * \brief %Model of the gradient boosted trees trained by the gbt::training::Batch algorithm
+ *
+ * The nodes of all trees are stored in three tables with one column and the row per node:
+ * the index of the split feature or -1 for the leaf, the split value or the response of the leaf,
+ * and the index of the left child in the tree, the right child follows the left one.
+ * An observation goes to the left child if the value of the split feature is not greater than the split value.
+ * The trees of the iteration are stored one after another, the trees of one iteration belong to the different classes.
+ *
+ * \par References
+ *      - Parameter class
+ *      - \ref training::interface1::Batch "training::Batch" class
+ *      - \ref prediction::interface1::Batch "prediction::Batch" class
+ */
+class DAAL_EXPORT Model : public classifier::Model
+{
+public:
+    DECLARE_SERIALIZABLE();
+    DAAL_DOWN_CAST_OPERATOR(Model, classifier::Model)
+
+    /**
+     * Constructs the gradient boosted trees model
+     * \tparam modelFPType  Data type to store the gradient boosted trees model data, double or float
+     * \param[in] dummy     Dummy variable for the templated constructor
+     */
+    template<typename modelFPType>
+    Model(modelFPType dummy) : classifier::Model(), _lossFunction(crossEntropy), _nTreesPerIteration(1)
+    {
+        _splitFeatures  = data_management::NumericTablePtr(new data_management::HomogenNumericTable<int>(NULL, 1));
+        _nodeValues     = data_management::NumericTablePtr(new data_management::HomogenNumericTable<modelFPType>(NULL, 1));
+        _leftChildren   = data_management::NumericTablePtr(new data_management::HomogenNumericTable<int>(NULL, 1));
+        _treeOffsets    = data_management::NumericTablePtr(new data_management::HomogenNumericTable<int>(NULL, 1));
+        _initialScores  = data_management::NumericTablePtr(new data_management::HomogenNumericTable<modelFPType>(NULL, 1));
+    }
+
+    /**
+     * Empty constructor for deserialization
+     */
+    Model() : classifier::Model(), _lossFunction(crossEntropy), _nTreesPerIteration(1) {}
+
+    virtual ~Model() {}
+
+    /**
+     * Returns the indices of the split features of the nodes, -1 for the leaves
+     * \return Table of size nNodes x 1
+     */
+    data_management::NumericTablePtr getSplitFeatures() const { return _splitFeatures; }
+
+    /**
+     * Returns the split values of the nodes and the responses of the leaves
+     * \return Table of size nNodes x 1
+     */
+    data_management::NumericTablePtr getNodeValues() const { return _nodeValues; }
+
+    /**
+     * Returns the indices of the left children of the nodes relative to the first node of the tree
+     * \return Table of size nNodes x 1
+     */
+    data_management::NumericTablePtr getLeftChildren() const { return _leftChildren; }
+
+    /**
+     * Returns the indices of the first nodes of the trees, the last element is the total number of nodes
+     * \return Table of size (nTrees + 1) x 1
+     */
+    data_management::NumericTablePtr getTreeOffsets() const { return _treeOffsets; }
+
+    /**
+     * Returns the initial scores the responses of the trees are added to
+     * \return Table of size nTreesPerIteration x 1
+     */
+    data_management::NumericTablePtr getInitialScores() const { return _initialScores; }
+
+    /**
+     * Returns the number of trees in the model
+     * \return Number of trees
+     */
+    size_t getNumberOfTrees() const
+    {
+        return (_treeOffsets && _treeOffsets->getNumberOfRows()) ? _treeOffsets->getNumberOfRows() - 1 : 0;
+    }
+
+    /**
+     * Returns the number of trees added at every boosting iteration
+     * \return nClasses for the cross-entropy loss with more than two classes, 1 otherwise
+     */
+    size_t getNumberOfTreesPerIteration() const { return _nTreesPerIteration; }
+
+    /**
+     * Returns the loss function the model is trained with
+     * \return Loss function
+     */
+    LossFunction getLossFunction() const { return (LossFunction)_lossFunction; }
+
+    /**
+     * Sets the loss function and the number of trees added at every boosting iteration
+     * \param[in] lossFunction          Loss function the model is trained with
+     * \param[in] nTreesPerIteration    Number of trees added at every boosting iteration
+     */
+    void setLossFunction(LossFunction lossFunction, size_t nTreesPerIteration)
+    {
+        _lossFunction = (int)lossFunction;
+        _nTreesPerIteration = nTreesPerIteration;
+    }
+
+protected:
+    data_management::NumericTablePtr _splitFeatures;    /*!< \private Indices of the split features */
+    data_management::NumericTablePtr _nodeValues;       /*!< \private Split values and responses of the leaves */
+    data_management::NumericTablePtr _leftChildren;     /*!< \private Indices of the left children */
+    data_management::NumericTablePtr _treeOffsets;      /*!< \private Indices of the first nodes of the trees */
+    data_management::NumericTablePtr _initialScores;    /*!< \private Initial scores */
+    int _lossFunction;                                  /*!< \private Loss function */
+    size_t _nTreesPerIteration;                         /*!< \private Number of trees added at every boosting iteration */
+
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        classifier::Model::serialImpl<Archive, onDeserialize>(arch);
+        arch->setSharedPtrObj(_splitFeatures);
+        arch->setSharedPtrObj(_nodeValues);
+        arch->setSharedPtrObj(_leftChildren);
+        arch->setSharedPtrObj(_treeOffsets);
+        arch->setSharedPtrObj(_initialScores);
+        arch->set(_lossFunction);
+        arch->set(_nTreesPerIteration);
+    }
+
+    void serializeImpl(data_management::InputDataArchive *archive) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(archive);}
+
+    void deserializeImpl(data_management::OutputDataArchive *archive) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(archive);}
+};
+} // namespace interface1
+using interface1::Parameter;
+using interface1::Model;
+
+} // namespace gbt
+/** @} */
+} // namespace algorithms
+} // namespace daal
+#endif
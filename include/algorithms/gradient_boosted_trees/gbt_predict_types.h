@@ -0,0 +1,117 @@
+/* file: gbt_predict_types.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the gradient boosted trees prediction algorithm interface
+//--
+*/
+
+#ifndef __GBT_PREDICT_TYPES_H__
+#define __GBT_PREDICT_TYPES_H__
+
+#include "algorithms/classifier/classifier_predict_types.h"
+#include "algorithms/gradient_boosted_trees/gbt_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+/**
+ * @defgroup gbt_prediction Prediction
+ * \copydoc daal::algorithms::gbt::prediction
+ * @ingroup gbt
+ * @{
+ */
+/**
+ * \brief Contains classes to make predictions based on the gradient boosted trees model
+ */
+namespace prediction
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__PREDICTION__METHOD"></a>
+ * Available methods to make predictions based on the gradient boosted trees model
+ */
+enum Method
+{
+    defaultDense = 0          /*!< Default gradient boosted trees model-based prediction method */
+};
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__PREDICTION__INPUT"></a>
+ * \brief Input objects in the prediction stage of the gradient boosted trees algorithm
+ */
+class DAAL_EXPORT Input : public classifier::prediction::Input
+{
+public:
+    Input();
+    virtual ~Input() {}
+
+    /**
+     * Returns the input Numeric Table object in the prediction stage of the gradient boosted trees algorithm
+     * \param[in] id    Identifier of the input NumericTable object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(classifier::prediction::NumericTableInputId id) const;
+
+    /**
+     * Returns the input Model object in the prediction stage of the gradient boosted trees algorithm
+     * \param[in] id    Identifier of the input Model object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    services::SharedPtr<gbt::Model> get(classifier::prediction::ModelInputId id) const;
+
+    /**
+     * Sets the input NumericTable object in the prediction stage of the gradient boosted trees algorithm
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the input object
+     */
+    void set(classifier::prediction::NumericTableInputId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Sets the input Model object in the prediction stage of the gradient boosted trees algorithm
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the input object
+     */
+    void set(classifier::prediction::ModelInputId id, const services::SharedPtr<gbt::Model> &ptr);
+
+    /**
+     * Checks the correctness of the input object
+     * \param[in] parameter Pointer to the structure of the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+};
+
+}
+
+using interface1::Input;
+
+} // namespace prediction
+/** @} */
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -0,0 +1,191 @@
+/* file: gbt_training_batch.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the gradient boosted trees training in the batch processing mode
+//--
+*/
+
+#ifndef __GBT_TRAINING_BATCH_H__
+#define __GBT_TRAINING_BATCH_H__
+
+#include "algorithms/algorithm.h"
+#include "algorithms/gradient_boosted_trees/gbt_training_types.h"
+#include "algorithms/classifier/classifier_training_batch.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace training
+{
+
+namespace interface1
+{
+/**
+ * @defgroup gbt_training_batch Batch
+ * @ingroup gbt_training
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__TRAINING__BATCHCONTAINER"></a>
+ *  \brief Class containing methods to compute results of the gradient boosted trees training
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the gradient boosted trees training, double or float
+ * \tparam method           Gradient boosted trees training method, \ref daal::algorithms::gbt::training::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT BatchContainer : public TrainingContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for the gradient boosted trees training with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~BatchContainer();
+    /**
+     * Computes the result of the gradient boosted trees training in the batch processing mode
+     */
+    void compute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__TRAINING__BATCH"></a>
+ *  \brief %Algorithm class to train the gradient boosted trees model for classification or regression
+ *
+ *  \tparam algorithmFPType  Data type to use in intermediate computations of the gradient boosted trees training, double or float
+ *  \tparam method           Gradient boosted trees training method, \ref Method
+ *
+ *  \par Enumerations
+ *      - \ref classifier::training::InputId Identifiers of the gradient boosted trees training input objects
+ *      - \ref classifier::training::ResultId Identifiers of the gradient boosted trees training results
+ *      - \ref Method   Gradient boosted trees training methods
+ *
+ * \par References
+ *      - \ref interface1::Parameter "Parameter" class
+ *      - \ref interface1::Model "Model" class
+ */
+template<typename algorithmFPType = double, Method method = defaultDense>
+class DAAL_EXPORT Batch : public classifier::training::Batch
+{
+public:
+    /**
+     * Default constructor
+     * \param nClasses  Number of classes, ignored for the squared loss
+     */
+    Batch(size_t nClasses = 2) : parameter(nClasses)
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs a gradient boosted trees training algorithm by copying input objects and parameters
+     * of another gradient boosted trees training algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> &other) : classifier::training::Batch(other)
+    {
+        initialize();
+        parameter = other.parameter;
+    }
+
+    virtual ~Batch() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Registers user-allocated memory to store results of the gradient boosted trees training
+     * \param[in] result    Structure to store results of the gradient boosted trees training
+     */
+    void setResult(const services::SharedPtr<Result>& result)
+    {
+        DAAL_CHECK(result, ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns structure that contains computed results of the gradient boosted trees training
+     * \return Structure that contains computed results of the gradient boosted trees training
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return services::staticPointerCast<Result, classifier::training::Result>(_result);
+    }
+
+    /**
+     * Resets the training results of the gradient boosted trees algorithm
+     */
+    void resetResult() DAAL_C11_OVERRIDE
+    {
+        _result = services::SharedPtr<Result>(new Result());
+        _res = NULL;
+    }
+
+    /**
+     * Returns a pointer to the newly allocated gradient boosted trees training algorithm with a copy of input objects
+     * and parameters of this gradient boosted trees training algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl());
+    }
+
+    Parameter parameter;        /*!< \ref interface1::Parameter "Parameters" of the algorithm */
+
+protected:
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Batch<algorithmFPType, method>(*this);
+    }
+
+    void allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::SharedPtr<Result> res = services::staticPointerCast<Result, classifier::training::Result>(_result);
+        res->template allocate<algorithmFPType>(&input, _par, (int) method);
+        _res = _result.get();
+    }
+
+    void initialize()
+    {
+        _ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _par = &parameter;
+        _result = services::SharedPtr<Result>(new Result());
+    }
+};
+/** @} */
+} // namespace interface1
+using interface1::BatchContainer;
+using interface1::Batch;
+
+} // namespace training
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -0,0 +1,116 @@
+/* file: gbt_training_types.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the gradient boosted trees training algorithm interface
+//--
+*/
+
+#ifndef __GBT_TRAINING_TYPES_H__
+#define __GBT_TRAINING_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "algorithms/gradient_boosted_trees/gbt_model.h"
+#include "algorithms/classifier/classifier_training_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+/**
+ * @defgroup gbt_training Training
+ * \copydoc daal::algorithms::gbt::training
+ * @ingroup gbt
+ * @{
+ */
+/**
+ * \brief Contains classes to train the gradient boosted trees model
+ */
+namespace training
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__TRAINING__METHOD"></a>
+ * Available methods to train the gradient boosted trees model
+ */
+enum Method
+{
+    hist         = 0,   /*!< The trees are grown on the histograms of the gradients over the quantized feature values */
+    defaultDense = 0    /*!< Default method */
+};
+
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__TRAINING__RESULT"></a>
+ * \brief Provides methods to access final results obtained with the compute() method of the
+ *        gradient boosted trees training algorithm in the batch processing mode
+ */
+class DAAL_EXPORT Result : public classifier::training::Result
+{
+public:
+    DECLARE_SERIALIZABLE();
+    Result();
+
+    virtual ~Result() {}
+
+    /**
+     * Returns the model trained with the gradient boosted trees algorithm
+     * \param[in] id    Identifier of the result, \ref classifier::training::ResultId
+     * \return          Model trained with the gradient boosted trees algorithm
+     */
+    services::SharedPtr<daal::algorithms::gbt::Model> get(classifier::training::ResultId id) const;
+
+    /**
+     * Allocates memory for storing the results of the gradient boosted trees training
+     * \param[in] input     Pointer to input structure
+     * \param[in] parameter Pointer to parameter structure
+     * \param[in] method    Algorithm method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    void check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+};
+} // namespace interface1
+using interface1::Result;
+
+} // namespace training
+/** @} */
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -0,0 +1,30 @@
+/* file: gbt_types.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the gradient boosted trees algorithm interface
+//--
+*/
+
+#ifndef __GBT_TYPES_H__
+#define __GBT_TYPES_H__
+
+#include "algorithms/gradient_boosted_trees/gbt_training_types.h"
+#include "algorithms/gradient_boosted_trees/gbt_predict_types.h"
+
+#endif
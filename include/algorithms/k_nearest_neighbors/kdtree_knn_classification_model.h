@@ -58,6 +58,30 @@ enum DataUseInModel
     doUse    = 1  /*!< The input data and labels will be the component of the trained kNN model */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__VOTEWEIGHTS"></a>
+ * \brief Weights of the nearest neighbors in the prediction
+ */
+enum VoteWeights
+{
+    voteUniform  = 0, /*!< All the nearest neighbors have the same weight */
+    voteDistance = 1  /*!< The weight of the neighbor is inversely proportional to the distance to it.
+                           If some neighbors coincide with the observation, only these neighbors are used */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__RESULTTOCOMPUTEID"></a>
+ * Available identifiers to specify the results of the kNN prediction
+ */
+enum ResultToComputeId
+{
+    computeClassLabels        = 0x00000001ULL, /*!< Compute the class labels by voting of the nearest neighbors */
+    computeResponses          = 0x00000002ULL, /*!< Compute the responses of the kNN regression: the weighted mean of
+                                                    the labels of the nearest neighbors */
+    computeIndicesOfNeighbors = 0x00000004ULL, /*!< Compute the indices of the nearest neighbors */
+    computeDistances          = 0x00000008ULL  /*!< Compute the distances to the nearest neighbors */
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -79,12 +103,19 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
      *  \param[in] nNeighbors           Number of neighbors
      *  \param[in] randomSeed           Seed for random choosing elements from training dataset
      *  \param[in] dataUse              The option to enable/disable an usage of the input dataset in kNN model
+     *  \param[in] resultsToCompute     64 bit integer flag that indicates the results of the prediction, \ref ResultToComputeId
+     *  \param[in] voteWeights          Weights of the nearest neighbors in the prediction
      */
-    Parameter(size_t nClasses = 2, size_t nNeighbors = 1, int randomSeed = 777, DataUseInModel dataUse = doNotUse)
+    Parameter(size_t nClasses = 2, size_t nNeighbors = 1, int randomSeed = 777, DataUseInModel dataUse = doNotUse,
+              DAAL_UINT64 resultsToCompute = computeClassLabels, VoteWeights voteWeights = voteUniform)
         : daal::algorithms::classifier::Parameter(nClasses),
           k(nNeighbors),
           seed(randomSeed),
-          dataUseInModel(dataUse)
+          dataUseInModel(dataUse),
+          resultsToCompute(resultsToCompute),
+          voteWeights(voteWeights),
+          nLists(0),
+          nProbes(8)
     {}
 
     /**
@@ -96,11 +127,21 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
         daal::algorithms::classifier::Parameter::check();
 
         DAAL_CHECK_EX(k >= 1, services::ErrorIncorrectParameter, services::ParameterName, kStr());
+        DAAL_CHECK_EX(resultsToCompute != 0 && (~resultsToCompute & (computeClassLabels | computeResponses)) != 0,
+                      services::ErrorIncorrectParameter, services::ParameterName, resultsToComputeStr());
+        DAAL_CHECK_EX(nProbes >= 1, services::ErrorIncorrectParameter, services::ParameterName, nProbesStr());
     }
 
     size_t k;                      /*!< Number of neighbors */
     int seed;                      /*!< Seed for random choosing elements from training dataset */
     DataUseInModel dataUseInModel; /*!< The option to enable/disable an usage of the input dataset in kNN model */
+    DAAL_UINT64 resultsToCompute;  /*!< 64 bit integer flag that indicates the results of the prediction.
+                                        The class labels and the responses can not be computed together */
+    VoteWeights voteWeights;       /*!< Weights of the nearest neighbors in the prediction */
+    size_t nLists;                 /*!< Number of the clusters of the inverted file index built by the training::ivfDense method.
+                                        If zero, the square root of the number of training observations is used */
+    size_t nProbes;                /*!< Number of the clusters scanned by the prediction::ivfDense method for every observation.
+                                        Larger values increase the recall of the approximate search and the search time */
 };
 /* [Parameter source code] */
 
@@ -116,6 +116,26 @@ public:
     */
     virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
 
+    /**
+     * Returns the structure that contains the results of the KD-tree based kNN model-based prediction
+     * \return Structure that contains the results of the KD-tree based kNN model-based prediction
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return services::staticPointerCast<Result, classifier::prediction::Result>(_result);
+    }
+
+    /**
+     * Registers user-allocated memory to store the results of the KD-tree based kNN model-based prediction
+     * \param[in] result  Structure to store the results of the KD-tree based kNN model-based prediction
+     */
+    void setResult(const services::SharedPtr<Result> &result)
+    {
+        DAAL_CHECK(result, ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+    }
+
     /**
      * Returns a pointer to the newly allocated KD-tree based kNN prediction algorithm with a copy of input objects
      * of this KD-tree based kNN prediction algorithm
@@ -134,12 +154,13 @@ protected:
 
     void allocateResult() DAAL_C11_OVERRIDE
     {
-        _result->allocate<algorithmFPType>(inputBase, &parameter, (int)method);
+        getResult()->template allocate<algorithmFPType>(inputBase, &parameter, (int)method);
         _res = _result.get();
     }
 
     void initialize()
     {
+        _result = services::SharedPtr<Result>(new Result());
         inputBase = &input;
         _in = &input;
         _ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
@@ -58,7 +58,25 @@ namespace prediction
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense    = 0, /*!< Default method: search of the nearest neighbors in the KD-tree */
+    bruteForceDense = 1, /*!< Brute force search: the distances between blocks of the input and training observations are computed
+                              with matrix multiplication, the blocks of input observations are processed in parallel */
+    autoDense       = 2, /*!< Uses the KD-tree search if the model contains the KD-tree and the search is expected to be faster
+                              than the brute force one for the given number of features and observations, otherwise the brute force search */
+    ivfDense        = 3  /*!< Approximate search in the inverted file index: only the training observations of the clusters with
+                              the nearest centroids are scanned, the number of the scanned clusters is set by Parameter::nProbes */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__PREDICTION__RESULTID"></a>
+ * \brief Available identifiers of the results of the KD-tree based kNN model-based prediction
+ *        in addition to classifier::prediction::ResultId
+ */
+enum ResultId
+{
+    indices   = 1, /*!< Numeric table of size n x k with the indices of the nearest neighbors in the input training data set.
+                        The neighbors are sorted by the distance */
+    distances = 2  /*!< Numeric table of size n x k with the Euclidean distances to the nearest neighbors */
 };
 
 /**
@@ -108,9 +126,64 @@ public:
     void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__PREDICTION__RESULT"></a>
+ * \brief Provides methods to access the results of the KD-tree based kNN model-based prediction
+ */
+class DAAL_EXPORT Result : public classifier::prediction::Result
+{
+public:
+    DECLARE_SERIALIZABLE();
+    Result();
+
+    using classifier::prediction::Result::get;
+    using classifier::prediction::Result::set;
+
+    /**
+     * Returns the result of the KD-tree based kNN model-based prediction
+     * \param[in] id   Identifier of the result
+     * \return         Result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultId id) const;
+
+    /**
+     * Sets the result of the KD-tree based kNN model-based prediction
+     * \param[in] id       Identifier of the result
+     * \param[in] value    Pointer to the result
+     */
+    void set(ResultId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Allocates memory to store the results of the KD-tree based kNN model-based prediction
+     * \param[in] input       Pointer to the input objects of the algorithm
+     * \param[in] parameter   Pointer to the parameters of the algorithm
+     * \param[in] method      Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Checks the results of the KD-tree based kNN model-based prediction
+     * \param[in] input       Pointer to the input objects of the algorithm
+     * \param[in] parameter   Pointer to the parameters of the algorithm
+     * \param[in] method      Computation method
+     */
+    void check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch) { classifier::prediction::Result::serialImpl<Archive, onDeserialize>(arch); }
+
+    void serializeImpl(data_management::InputDataArchive   *arch) DAAL_C11_OVERRIDE { serialImpl<data_management::InputDataArchive, false>(arch); }
+
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE { serialImpl<data_management::OutputDataArchive, true>(arch); }
+};
+
 } // namespace interface1
 
 using interface1::Input;
+using interface1::Result;
 
 } // namespace prediction
 /** @} */
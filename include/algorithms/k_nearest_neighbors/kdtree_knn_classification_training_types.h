@@ -58,7 +58,12 @@ namespace training
  */
 enum Method
 {
-    defaultDense = 0 /*!< Default method */
+    defaultDense    = 0, /*!< Default method: builds the KD-tree */
+    bruteForceDense = 1, /*!< Stores the training data without building the KD-tree, for the brute force search */
+    autoDense       = 2, /*!< Builds the KD-tree only if the KD-tree search is expected to be faster than the brute force one
+                              for the given number of features and observations */
+    ivfDense        = 3  /*!< Builds the inverted file index for the approximate search: the training observations are clustered
+                              with K-Means and stored grouped by the nearest centroid */
 };
 
 /**
@@ -275,6 +275,10 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
                                                    See section (3.3) of [2] */
     size_t nRounds;            /*!< Kmeans|| only. Number of rounds for k-means||. (oversamplingFactor*nRounds) > 1 is a requirement.
                                                    See section (3.3) of [2] */
+    size_t nTrials;            /*!< Kmeans++ only. Number of candidates evaluated for each new centroid: the candidate that
+                                                   reduces the goal function most is chosen. Value 1 stands for the standard kmeans++,
+                                                   greater values (2 + log(nClusters) is a common choice) give greedy kmeans++.
+                                                   Batch processing only: the distributed kmeans++ and kmeans|| methods require value 1 */
 
     void check() const DAAL_C11_OVERRIDE;
 };
@@ -50,7 +50,9 @@ enum Method
 {
     lloydDense = 0,     /*!< Default: performance-oriented method, synonym of defaultDense */
     defaultDense = 0,   /*!< Default: performance-oriented method, synonym of lloydDense */
-    lloydCSR = 1        /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    lloydCSR = 1,       /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    miniBatchDense = 2, /*!< Mini-batch method with per-centroid learning rates for dense numeric tables */
+    miniBatchCSR = 3    /*!< Mini-batch method with per-centroid learning rates for CSR numeric tables */
 };
 
 /**
@@ -90,7 +92,8 @@ enum PartialResultId
     nObservations       = 0,  /*!< Table containing the number of observations assigned to centroids */
     partialSums         = 1,  /*!< Table containing the sum of observations assigned to centroids */
     partialGoalFunction = 2,  /*!< Table containing a goal function value */
-    partialAssignments  = 3   /*!< Table containing assignments of observations to particular clusters */
+    partialAssignments  = 3,  /*!< Table containing assignments of observations to particular clusters */
+    nMiniBatches        = 4   /*!< Table containing the number of processed mini-batches, used by the mini-batch methods only */
 };
 
 /**
@@ -140,6 +143,7 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     double gamma;                                          /*!< Weight used in distance computation for categorical features */
     DistanceType distanceType;                             /*!< Distance used in the algorithm */
     bool assignFlag;                                       /*!< Do data points assignment */
+    size_t batchSize;                                      /*!< Number of observations in a mini-batch, used by the mini-batch methods only */
 
     void check() const DAAL_C11_OVERRIDE;
 };
@@ -253,6 +257,16 @@ public:
      */
     void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
 
+    /**
+     * Initializes partial results of the K-Means algorithm in the online processing mode:
+     * copies the initial centroids into the table of partial sums,
+     * resets the numbers of observations, the goal function and the number of processed mini-batches
+     * \param[in] input   %Input object of the algorithm
+     * \param[in] par     Algorithm parameter
+     * \param[in] method  Computation method
+     */
+    void initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method);
+
 protected:
     /** \private */
     template<typename Archive, bool onDeserialize>
@@ -76,10 +76,12 @@ enum EstimatesToCompute
  */
 enum InputId
 {
-    data = 0                    /*!< %Input data table */
+    data    = 0,                /*!< %Input data table */
+    weights = 1                 /*!< Optional weights of observations, numeric table of size nObservations x 1.
+                                     The weights are treated as frequency weights */
 };
 
-const size_t nResults = 10;
+const size_t nResults = 11;
 
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__LOW_ORDER_MOMENTS__RESULTID"></a>
@@ -87,19 +89,21 @@ const size_t nResults = 10;
  */
 enum ResultId
 {
-    minimum              = 0,   /*!< Minimum */
-    maximum              = 1,   /*!< Maximum */
-    sum                  = 2,   /*!< Sum */
-    sumSquares           = 3,   /*!< Sum of squares */
-    sumSquaresCentered   = 4,   /*!< Sum of squared difference from the means */
-    mean                 = 5,   /*!< Mean */
-    secondOrderRawMoment = 6,   /*!< Second raw order moment */
-    variance             = 7,   /*!< Variance */
-    standardDeviation    = 8,   /*!< Standard deviation */
-    variation            = 9    /*!< Variation */
+    minimum                 = 0,    /*!< Minimum */
+    maximum                 = 1,    /*!< Maximum */
+    sum                     = 2,    /*!< Sum */
+    sumSquares              = 3,    /*!< Sum of squares */
+    sumSquaresCentered      = 4,    /*!< Sum of squared difference from the means */
+    mean                    = 5,    /*!< Mean */
+    secondOrderRawMoment    = 6,    /*!< Second raw order moment */
+    variance                = 7,    /*!< Variance */
+    standardDeviation       = 8,    /*!< Standard deviation */
+    variation               = 9,    /*!< Variation */
+    nObservationsPerFeature = 10    /*!< Number of non-missing observations of every feature,
+                                         the sum of their weights if the weights are provided */
 };
 
-const size_t nPartialResults = 6;
+const size_t nPartialResults = 7;
 
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__LOW_ORDER_MOMENTS__PARTIALRESULTID"></a>
@@ -107,12 +111,15 @@ const size_t nPartialResults = 6;
  */
 enum PartialResultId
 {
-    nObservations               = 0,    /*!< Number of observations processed so far */
-    partialMinimum              = 1,    /*!< Partial minimum */
-    partialMaximum              = 2,    /*!< Partial maximum */
-    partialSum                  = 3,    /*!< Partial sum */
-    partialSumSquares           = 4,    /*!< Partial sum of squares */
-    partialSumSquaresCentered   = 5     /*!< Partial sum of squared difference from the means */
+    nObservations                   = 0,    /*!< Number of observations processed so far */
+    partialMinimum                  = 1,    /*!< Partial minimum */
+    partialMaximum                  = 2,    /*!< Partial maximum */
+    partialSum                      = 3,    /*!< Partial sum */
+    partialSumSquares               = 4,    /*!< Partial sum of squares */
+    partialSumSquaresCentered       = 5,    /*!< Partial sum of squared difference from the means */
+    partialNObservationsPerFeature  = 6     /*!< Partial number of non-missing observations of every feature,
+                                                 the sum of their weights if the weights are provided.
+                                                 Set to nObservations if the initialization procedure does not set it */
 };
 
 /**
@@ -294,6 +301,8 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     Parameter(EstimatesToCompute  _estimatesToCompute = estimatesAll);
 
     EstimatesToCompute  estimatesToCompute;       /*!< Estimates to be computed by the algorithm  */
+    bool skipMissingValues;                       /*!< If true, the values of the features equal to NaN are treated as missing
+                                                       and excluded from the estimates of these features */
 
     services::SharedPtr<PartialResultsInitIface> initializationProcedure;     /**< Functor for partial results initialization */
 
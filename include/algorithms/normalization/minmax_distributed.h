@@ -0,0 +1,414 @@
+/* file: minmax_distributed.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the min-max normalization algorithm
+//  in the distributed processing mode
+//--
+*/
+
+#ifndef __MINMAX_DISTRIBUTED_H__
+#define __MINMAX_DISTRIBUTED_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/normalization/minmax_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace normalization
+{
+namespace minmax
+{
+
+namespace interface1
+{
+/** @defgroup minmax_distributed Distributed
+ * @ingroup minmax
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__MINMAX__DISTRIBUTEDCONTAINER"></a>
+ * \brief Provides methods to run implementations of the min-max normalization algorithm in the distributed processing mode.
+ *        It is associated with the daal::algorithms::normalization::minmax::Distributed class
+ *
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the min-max normalization algorithms, double or float
+ * \tparam method           Min-max normalization computation method, daal::algorithms::normalization::minmax::Method
+ */
+template<ComputeStep step, typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer
+{};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__MINMAX__DISTRIBUTEDCONTAINER_STEP1LOCAL"></a>
+ * \brief Provides methods to run implementations of the first step of the min-max normalization algorithm
+ *        in the distributed processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the min-max normalization algorithms, double or float
+ * \tparam method           Min-max normalization computation method, daal::algorithms::normalization::minmax::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step1Local, algorithmFPType, method, cpu> :
+    public daal::algorithms::AnalysisContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for the min-max normalization algorithm with a specified environment
+     * in the first step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+
+    virtual ~DistributedContainer();
+
+    /**
+     * Computes the partial result of the min-max normalization algorithm on the local node
+     */
+    virtual void compute() DAAL_C11_OVERRIDE;
+
+    /**
+     * Computes the minimums and maximums of the data set processed on the local node
+     */
+    virtual void finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__MINMAX__DISTRIBUTEDCONTAINER_STEP2MASTER"></a>
+ * \brief Provides methods to run implementations of the second step of the min-max normalization algorithm
+ *        in the distributed processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the min-max normalization algorithms, double or float
+ * \tparam method           Min-max normalization computation method, daal::algorithms::normalization::minmax::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step2Master, algorithmFPType, method, cpu> :
+    public daal::algorithms::AnalysisContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for the min-max normalization algorithm with a specified environment
+     * in the second step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+
+    virtual ~DistributedContainer();
+
+    /**
+     * Merges the partial results computed on local nodes
+     */
+    virtual void compute() DAAL_C11_OVERRIDE;
+
+    /**
+     * Computes the minimums and maximums of the whole data set
+     */
+    virtual void finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__MINMAX__DISTRIBUTED"></a>
+ * \brief Computes the minimums and maximums of the features for the min-max normalization in the distributed processing mode
+ *
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the min-max normalization, double or float
+ * \tparam method           Min-max normalization computation method, daal::algorithms::normalization::minmax::Method
+ */
+template<ComputeStep step, typename algorithmFPType = double, Method method = defaultDense>
+class DAAL_EXPORT Distributed {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__MINMAX__DISTRIBUTED_STEP1LOCAL"></a>
+ * \brief Computes partial results of the min-max normalization algorithm on local nodes
+ *        in the first step of the distributed processing mode.
+ *        The minimums and maximums computed on the master node are set to the basic statistics
+ *        of the local blocks of the data set that are normalized with the Batch algorithm
+ * \n<a href="DAAL-REF-MINMAX-ALGORITHM">Min-max normalization algorithm description and usage models</a>
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the min-max normalization, double or float
+ * \tparam method           Min-max normalization computation method, daal::algorithms::normalization::minmax::Method
+ *
+ * \par Enumerations
+ *      - daal::algorithms::normalization::minmax::Method           Min-max normalization computation methods
+ *      - daal::algorithms::normalization::minmax::InputId          Identifiers of min-max normalization input objects
+ *      - daal::algorithms::normalization::minmax::PartialResultId  Identifiers of min-max normalization partial results
+ *      - daal::algorithms::normalization::minmax::ResultId         Identifiers of min-max normalization results
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step1Local, algorithmFPType, method> : public daal::algorithms::Analysis<distributed>
+{
+public:
+    DistributedInput<step1Local> input;  /*!< %input data structure */
+
+    /** Default constructor */
+    Distributed()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs min-max normalization algorithm by copying input objects
+     * of another min-max normalization algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects of the algorithm
+     */
+    Distributed(const Distributed<step1Local, algorithmFPType, method> &other)
+    {
+        initialize();
+        input.set(data, other.input.get(data));
+    }
+
+    virtual ~Distributed() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains the minimums and maximums computed by the min-max normalization algorithm
+     * \return Structure that contains the minimums and maximums
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store results of the min-max normalization algorithms
+     * \param[in] result Structure to store results of the min-max normalization algorithms
+     */
+    void setResult(const services::SharedPtr<Result> &result)
+    {
+        DAAL_CHECK(result, ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains partial results of the min-max normalization algorithm
+     * \return Structure that contains partial results
+     */
+    PartialResultPtr getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store partial results of the min-max normalization algorithm
+     * \param[in] partialResult Structure to store partial results
+     * \param[in] initFlag      Flag that specifies whether the partial results are initialized
+     */
+    void setPartialResult(const PartialResultPtr &partialResult, bool initFlag = false)
+    {
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        setInitFlag(initFlag);
+    }
+
+    /**
+     * Returns a pointer to the newly allocated min-max normalization algorithm
+     * with a copy of input objects of this min-max normalization algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step1Local, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step1Local, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step1Local, algorithmFPType, method> *cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step1Local, algorithmFPType, method>(*this);
+    }
+
+    virtual void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(_pres, method);
+        _res = _result.get();
+    }
+
+    virtual void allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->allocate<algorithmFPType>(&input, method);
+        _pres = _partialResult.get();
+    }
+
+    virtual void initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->initialize();
+    }
+
+    void initialize()
+    {
+        Analysis<distributed>::_ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step1Local, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _result = services::SharedPtr<Result>(new Result());
+        _partialResult = PartialResultPtr(new PartialResult());
+    }
+
+    PartialResultPtr _partialResult;
+    services::SharedPtr<Result> _result;
+
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__MINMAX__DISTRIBUTED_STEP2MASTER"></a>
+ * \brief Merges the partial results computed on local nodes and computes the minimums and maximums
+ *        of the whole data set in the second step of the distributed processing mode
+ * \n<a href="DAAL-REF-MINMAX-ALGORITHM">Min-max normalization algorithm description and usage models</a>
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the min-max normalization, double or float
+ * \tparam method           Min-max normalization computation method, daal::algorithms::normalization::minmax::Method
+ *
+ * \par Enumerations
+ *      - daal::algorithms::normalization::minmax::Method           Min-max normalization computation methods
+ *      - daal::algorithms::normalization::minmax::MasterInputId    Identifiers of min-max normalization input objects
+ *      - daal::algorithms::normalization::minmax::PartialResultId  Identifiers of min-max normalization partial results
+ *      - daal::algorithms::normalization::minmax::ResultId         Identifiers of min-max normalization results
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step2Master, algorithmFPType, method> : public daal::algorithms::Analysis<distributed>
+{
+public:
+    DistributedInput<step2Master> input;  /*!< %input data structure */
+
+    /** Default constructor */
+    Distributed()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs min-max normalization algorithm by copying input objects
+     * of another min-max normalization algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects of the algorithm
+     */
+    Distributed(const Distributed<step2Master, algorithmFPType, method> &other)
+    {
+        initialize();
+        input.set(partialResults, other.input.get(partialResults));
+    }
+
+    virtual ~Distributed() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains the minimums and maximums computed by the min-max normalization algorithm
+     * \return Structure that contains the minimums and maximums
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store results of the min-max normalization algorithms
+     * \param[in] result Structure to store results of the min-max normalization algorithms
+     */
+    void setResult(const services::SharedPtr<Result> &result)
+    {
+        DAAL_CHECK(result, ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains partial results of the min-max normalization algorithm
+     * \return Structure that contains partial results
+     */
+    PartialResultPtr getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store partial results of the min-max normalization algorithm
+     * \param[in] partialResult Structure to store partial results
+     * \param[in] initFlag      Flag that specifies whether the partial results are initialized
+     */
+    void setPartialResult(const PartialResultPtr &partialResult, bool initFlag = false)
+    {
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        setInitFlag(initFlag);
+    }
+
+    /**
+     * Returns a pointer to the newly allocated min-max normalization algorithm
+     * with a copy of input objects of this min-max normalization algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step2Master, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step2Master, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step2Master, algorithmFPType, method> *cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step2Master, algorithmFPType, method>(*this);
+    }
+
+    virtual void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(_pres, method);
+        _res = _result.get();
+    }
+
+    virtual void allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->allocate<algorithmFPType>(&input, method);
+        _pres = _partialResult.get();
+    }
+
+    virtual void initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->initialize();
+    }
+
+    void initialize()
+    {
+        Analysis<distributed>::_ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step2Master, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _result = services::SharedPtr<Result>(new Result());
+        _partialResult = PartialResultPtr(new PartialResult());
+    }
+
+    PartialResultPtr _partialResult;
+    services::SharedPtr<Result> _result;
+
+};
+/** @} */
+} // namespace interface1
+using interface1::DistributedContainer;
+using interface1::Distributed;
+
+} // namespace minmax
+} // namespace normalization
+} // namespace algorithms
+} // namespace daal
+#endif
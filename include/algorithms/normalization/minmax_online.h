@@ -0,0 +1,223 @@
+/* file: minmax_online.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the min-max normalization algorithm
+//  in the online processing mode
+//--
+*/
+
+#ifndef __MINMAX_ONLINE_H__
+#define __MINMAX_ONLINE_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/normalization/minmax_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace normalization
+{
+namespace minmax
+{
+
+namespace interface1
+{
+/** @defgroup minmax_online Online
+ * @ingroup minmax
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__MINMAX__ONLINECONTAINER"></a>
+ * \brief Provides methods to run implementations of the min-max normalization algorithm.
+ *        It is associated with the daal::algorithms::normalization::minmax::Online class
+ *        and supports methods of min-max normalization computation in the online processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the min-max normalization algorithms, double or float
+ * \tparam method           Min-max normalization computation method, daal::algorithms::normalization::minmax::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT OnlineContainer : public daal::algorithms::AnalysisContainerIface<online>
+{
+public:
+    /**
+     * Constructs a container for the min-max normalization algorithm with a specified environment
+     * in the online processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    OnlineContainer(daal::services::Environment::env *daalEnv);
+
+    virtual ~OnlineContainer();
+
+    /**
+     * Computes the partial result of the min-max normalization algorithm in the online processing mode
+     */
+    virtual void compute() DAAL_C11_OVERRIDE;
+
+    /**
+     * Computes the minimums and maximums of the min-max normalization algorithm in the online processing mode
+     */
+    virtual void finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__MINMAX__ONLINE"></a>
+ * \brief Computes the minimums and maximums of the features for the min-max normalization in the online processing mode.
+ *        The minimums and maximums are set to the basic statistics of the blocks of the data set
+ *        that are normalized with the Batch algorithm
+ * \n<a href="DAAL-REF-MINMAX-ALGORITHM">Min-max normalization algorithm description and usage models</a>
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the min-max normalization, double or float
+ * \tparam method           Min-max normalization computation method, daal::algorithms::normalization::minmax::Method
+ *
+ * \par Enumerations
+ *      - daal::algorithms::normalization::minmax::Method           Min-max normalization computation methods
+ *      - daal::algorithms::normalization::minmax::InputId          Identifiers of min-max normalization input objects
+ *      - daal::algorithms::normalization::minmax::PartialResultId  Identifiers of min-max normalization partial results
+ *      - daal::algorithms::normalization::minmax::ResultId         Identifiers of min-max normalization results
+ */
+template<typename algorithmFPType = double, Method method = defaultDense>
+class DAAL_EXPORT Online : public daal::algorithms::Analysis<online>
+{
+public:
+    Input input;          /*!< %input data structure */
+
+    /** Default constructor */
+    Online()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs min-max normalization algorithm by copying input objects
+     * of another min-max normalization algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects of the algorithm
+     */
+    Online(const Online<algorithmFPType, method> &other)
+    {
+        initialize();
+        input.set(data, other.input.get(data));
+    }
+
+    virtual ~Online() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains the minimums and maximums computed by the min-max normalization algorithm
+     * \return Structure that contains the minimums and maximums
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store results of the min-max normalization algorithms
+     * \param[in] result Structure to store results of the min-max normalization algorithms
+     */
+    void setResult(const services::SharedPtr<Result> &result)
+    {
+        DAAL_CHECK(result, ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains partial results of the min-max normalization algorithm
+     * \return Structure that contains partial results
+     */
+    PartialResultPtr getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store partial results of the min-max normalization algorithm
+     * \param[in] partialResult Structure to store partial results
+     * \param[in] initFlag      Flag that specifies whether the partial results are initialized
+     */
+    void setPartialResult(const PartialResultPtr &partialResult, bool initFlag = false)
+    {
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        setInitFlag(initFlag);
+    }
+
+    /**
+     * Returns a pointer to the newly allocated min-max normalization algorithm
+     * with a copy of input objects of this min-max normalization algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Online<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Online<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Online<algorithmFPType, method> *cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Online<algorithmFPType, method>(*this);
+    }
+
+    virtual void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(_pres, method);
+        _res = _result.get();
+    }
+
+    virtual void allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->allocate<algorithmFPType>(&input, method);
+        _pres = _partialResult.get();
+    }
+
+    virtual void initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->initialize();
+    }
+
+    void initialize()
+    {
+        Analysis<online>::_ac = new __DAAL_ALGORITHM_CONTAINER(online, OnlineContainer, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _result = services::SharedPtr<Result>(new Result());
+        _partialResult = PartialResultPtr(new PartialResult());
+    }
+
+    PartialResultPtr _partialResult;
+    services::SharedPtr<Result> _result;
+
+};
+/** @} */
+} // namespace interface1
+using interface1::OnlineContainer;
+using interface1::Online;
+
+} // namespace minmax
+} // namespace normalization
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -83,7 +83,31 @@ enum InputId
  */
 enum ResultId
 {
-    normalizedData = 0       /*!< min-max normalization results */
+    normalizedData = 0,      /*!< min-max normalization results */
+    minimum        = 1,      /*!< Minimums of the features computed in the online or distributed processing mode, table of size 1 x p */
+    maximum        = 2       /*!< Maximums of the features computed in the online or distributed processing mode, table of size 1 x p */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__NORMALIZATION__MINMAX__MASTERINPUTID"></a>
+ * Available identifiers of input objects for the min-max normalization algorithm on the master node
+ * @ingroup minmax
+ */
+enum MasterInputId
+{
+    partialResults = 0       /*!< Collection of partial results computed on local nodes */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__NORMALIZATION__MINMAX__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the min-max normalization algorithm
+ * @ingroup minmax
+ */
+enum PartialResultId
+{
+    nObservations  = 0,      /*!< Number of processed observations, table of size 1 x 1 */
+    partialMinimum = 1,      /*!< Minimums of the features of the processed observations, table of size 1 x p */
+    partialMaximum = 2       /*!< Maximums of the features of the processed observations, table of size 1 x p */
 };
 
 /**
@@ -128,11 +152,29 @@ public:
     Parameter(double lowerBound, double upperBound, const services::SharedPtr<low_order_moments::BatchIface> &momentsForParameter);
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__MINMAX__INPUTIFACE"></a>
+ * \brief Abstract class that specifies the interface of the input objects of the min-max normalization algorithm
+ */
+class DAAL_EXPORT InputIface : public daal::algorithms::Input
+{
+public:
+    InputIface(size_t nElements) : daal::algorithms::Input(nElements) {}
+
+    virtual ~InputIface() {}
+
+    /**
+     * Returns the number of columns in the input data set
+     * \return Number of columns in the input data set
+     */
+    virtual size_t getNumberOfColumns() const = 0;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__MINMAX__INPUT"></a>
  * \brief %Input objects for the min-max normalization algorithm
  */
-class DAAL_EXPORT Input : public daal::algorithms::Input
+class DAAL_EXPORT Input : public InputIface
 {
 public:
     /** Default constructor */
@@ -140,6 +182,12 @@ public:
 
     virtual ~Input() {}
 
+    /**
+     * Returns the number of columns in the input data set
+     * \return Number of columns in the input data set
+     */
+    size_t getNumberOfColumns() const DAAL_C11_OVERRIDE;
+
     /**
      * Returns an input object for the min-max normalization algorithm
      * \param[in] id    Identifier of the %input object
@@ -162,10 +210,93 @@ public:
     void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__MINMAX__PARTIALRESULT"></a>
+ * \brief Provides methods to access partial results obtained with the compute() method of the
+ *        min-max normalization algorithm in the online or distributed processing mode
+ */
+class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DAAL_CAST_OPERATOR(PartialResult);
+
+    DECLARE_SERIALIZABLE();
+    PartialResult();
+
+    virtual ~PartialResult() {};
+
+    /**
+     * Allocates memory to store partial results of the min-max normalization algorithm
+     * \param[in] input     Input objects for the min-max normalization algorithm
+     * \param[in] method    Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT void allocate(const daal::algorithms::Input *input, int method);
+
+    /**
+     * Sets the partial results of the min-max normalization algorithm to the values of the empty data set
+     */
+    void initialize();
+
+    /**
+     * Returns the number of columns in the partial result of the min-max normalization algorithm
+     * \return Number of columns in the partial result
+     */
+    size_t getNumberOfColumns() const;
+
+    /**
+     * Returns the partial result of the min-max normalization algorithm
+     * \param[in] id   Identifier of the partial result, daal::algorithms::normalization::minmax::PartialResultId
+     * \return         Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(PartialResultId id) const;
+
+    /**
+     * Sets the partial result of the min-max normalization algorithm
+     * \param[in] id        Identifier of the partial result
+     * \param[in] value     Pointer to the partial result
+     */
+    void set(PartialResultId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Checks the correctness of the partial result
+     * \param[in] in     Pointer to the input object
+     * \param[in] par    Pointer to the parameter object
+     * \param[in] method Algorithm computation method
+     */
+    void check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the correctness of the partial result
+     * \param[in] par    Pointer to the parameter object
+     * \param[in] method Algorithm computation method
+     */
+    void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+
+    void checkImpl(size_t nFeatures) const;
+};
+
+typedef services::SharedPtr<PartialResult> PartialResultPtr;
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__MINMAX__RESULT"></a>
  * \brief Provides methods to access final results obtained with the compute() method of the
  *        min-max normalization algorithm in the batch processing mode
+ *        or with the finalizeCompute() method in the online or distributed processing mode
  */
 class DAAL_EXPORT Result : public daal::algorithms::Result
 {
@@ -183,6 +314,15 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT void allocate(const daal::algorithms::Input *input, int method);
 
+    /**
+     * Allocates memory to store the minimums and maximums computed by the min-max normalization algorithm
+     * in the online or distributed processing mode
+     * \param[in] partialResult Partial results of the min-max normalization algorithm
+     * \param[in] method        Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT void allocate(const daal::algorithms::PartialResult *partialResult, int method);
+
     /**
      * Returns the final result of the min-max normalization algorithm
      * \param[in] id   Identifier of the final result, daal::algorithms::normalization::minmax::ResultId
@@ -205,6 +345,14 @@ public:
      */
     void check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
 
+    /**
+     * Checks the minimums and maximums computed in the online or distributed processing mode
+     * \param[in] partialResult Pointer to the partial results
+     * \param[in] par           Pointer to the parameter object
+     * \param[in] method        Algorithm computation method
+     */
+    void check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
 protected:
     /** \private */
     template<typename Archive, bool onDeserialize>
@@ -219,13 +367,86 @@ protected:
     void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
     {serialImpl<data_management::OutputDataArchive, true>(arch);}
 };
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__MINMAX__DISTRIBUTEDINPUT"></a>
+ * \brief %Input objects of the min-max normalization algorithm in the distributed processing mode
+ *
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ */
+template<ComputeStep step>
+class DistributedInput {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__MINMAX__DISTRIBUTEDINPUT_STEP1LOCAL"></a>
+ * \brief %Input objects of the min-max normalization algorithm on local nodes in the distributed processing mode
+ */
+template<>
+class DAAL_EXPORT DistributedInput<step1Local> : public Input
+{
+public:
+    DistributedInput() : Input() {}
+
+    virtual ~DistributedInput() {}
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__MINMAX__DISTRIBUTEDINPUT_STEP2MASTER"></a>
+ * \brief %Input objects of the min-max normalization algorithm on the master node in the distributed processing mode
+ */
+template<>
+class DAAL_EXPORT DistributedInput<step2Master> : public InputIface
+{
+public:
+    DistributedInput();
+
+    virtual ~DistributedInput() {}
+
+    /**
+     * Returns the number of columns in the input data set
+     * \return Number of columns in the input data set
+     */
+    size_t getNumberOfColumns() const DAAL_C11_OVERRIDE;
+
+    /**
+     * Adds the partial result computed on a local node to the collection of input objects
+     * \param[in] id            Identifier of the input object
+     * \param[in] partialResult Partial result obtained in the first step of the distributed algorithm
+     */
+    void add(MasterInputId id, const PartialResultPtr &partialResult);
+
+    /**
+     * Sets the input object of the min-max normalization algorithm on the master node
+     * \param[in] id  Identifier of the input object
+     * \param[in] ptr Pointer to the input object
+     */
+    void set(MasterInputId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Returns the collection of input objects
+     * \param[in] id   Identifier of the input object, \ref MasterInputId
+     * \return Collection of partial results
+     */
+    data_management::DataCollectionPtr get(MasterInputId id) const;
+
+    /**
+     * Checks the input objects of the min-max normalization algorithm on the master node
+     * \param[in] par       Algorithm parameter
+     * \param[in] method    Algorithm computation method
+     */
+    void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+};
 /** @} */
 /** @} */
 } // namespace interface1
 using interface1::ParameterBase;
 using interface1::Parameter;
+using interface1::InputIface;
 using interface1::Input;
+using interface1::PartialResult;
+using interface1::PartialResultPtr;
 using interface1::Result;
+using interface1::DistributedInput;
 
 } // namespace minmax
 } // namespace normalization
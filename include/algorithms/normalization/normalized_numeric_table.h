@@ -0,0 +1,606 @@
+/* file: normalized_numeric_table.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the numeric table that normalizes the values of another table
+//  on access or in place
+//--
+*/
+
+#ifndef __NORMALIZED_NUMERIC_TABLE_H__
+#define __NORMALIZED_NUMERIC_TABLE_H__
+
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace normalization
+{
+
+namespace interface1
+{
+/**
+ * @ingroup normalization
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__NORMALIZEDNUMERICTABLE"></a>
+ * \brief Numeric table that presents the values of another table normalized feature by feature, y = x * scale + shift.
+ *        The scale and shift factors are fitted once from the precomputed moments of the data,
+ *        for example, from the results of the low order moments algorithm in the batch, online or distributed processing mode.
+ *
+ * In the normalizeOnRead mode the values are normalized on the fly in getBlockOfRows() and getBlockOfColumnValues(),
+ * so no normalized copy of the data is stored, and the values written through the table are converted back.
+ * In the normalizeOnWrite mode the values of the blocks requested with the writeOnly flag are normalized
+ * before they are stored in the wrapped table, so passing the table to DataSource::loadDataBlock() stores
+ * the normalized data set without a separate pass over it. The blocks requested with the readWrite flag
+ * are read as the normalized values stored in the wrapped table and are written back unchanged,
+ * so reading and writing a block leaves its values as they are. Alternatively, normalizeInPlace() overwrites
+ * the values of the wrapped table with the normalized values and switches the table to the normalizeOnWrite mode.
+ *
+ * The number of rows follows the wrapped table when the table is resized, allocated or normalized in place
+ * through the normalized table. When the rows are loaded into the wrapped table directly, for example,
+ * with DataSource::loadDataBlock(), call refresh() before the rows are read through the normalized table.
+ *
+ * \par References
+ *      - \ref zscore::interface1::Batch "zscore::Batch" class
+ *      - \ref minmax::interface1::Batch "minmax::Batch" class
+ */
+class NormalizedNumericTable : public data_management::NumericTable
+{
+public:
+    /**
+     * <a name="DAAL-ENUM-ALGORITHMS__NORMALIZATION__NORMALIZEDNUMERICTABLE__MODE"></a>
+     * \brief Defines when the values of the table are normalized
+     */
+    enum Mode
+    {
+        normalizeOnRead  = 0,   /*!< The wrapped table stores the original values, the values are normalized when they are read */
+        normalizeOnWrite = 1    /*!< The values are normalized when they are written, the wrapped table stores the normalized values */
+    };
+
+    /**
+     *  Constructor for an empty normalized numeric table, used for deserialization
+     */
+    NormalizedNumericTable() : NumericTable(0, 0), _mode(normalizeOnRead) {}
+
+    /**
+     *  Constructs the table that normalizes the values of the table with the given factors
+     *  \param[in] table    Table to normalize
+     *  \param[in] scale    Table of size 1 x p with the scale factors of the features
+     *  \param[in] shift    Table of size 1 x p with the shift factors of the features
+     *  \param[in] mode     Mode of the normalization, \ref Mode
+     */
+    NormalizedNumericTable(const data_management::NumericTablePtr &table,
+                           const data_management::NumericTablePtr &scale, const data_management::NumericTablePtr &shift,
+                           Mode mode = normalizeOnRead) :
+        NumericTable(0, 0), _table(table), _mode(mode)
+    {
+        if(!initialize(scale)) { return; }
+        double *coefficients = getCoefficients();
+        size_t nFeatures = getNumberOfColumns();
+        if(!readFactors(scale, coefficients + scaleRow * nFeatures) ||
+           !readFactors(shift, coefficients + shiftRow * nFeatures)) { return; }
+
+        for(size_t j = 0; j < nFeatures; j++)
+        {
+            double s = coefficients[scaleRow * nFeatures + j];
+            double invScale = (s != 0.0 ? 1.0 / s : 0.0);
+            coefficients[inverseScaleRow * nFeatures + j] = invScale;
+            coefficients[inverseShiftRow * nFeatures + j] = (s != 0.0 ? -coefficients[shiftRow * nFeatures + j] * invScale : 0.0);
+        }
+    }
+
+    /**
+     *  Constructs the table that normalizes the values of the table by z-score normalization, y = (x - mean) / sigma.
+     *  Features with zero standard deviation are normalized to zero
+     *  \param[in] table                Table to normalize
+     *  \param[in] mean                 Table of size 1 x p with the means of the features
+     *  \param[in] standardDeviation    Table of size 1 x p with the standard deviations of the features
+     *  \param[in] mode                 Mode of the normalization, \ref Mode
+     *  \return Pointer to the normalized table
+     */
+    static services::SharedPtr<NormalizedNumericTable> createZScore(const data_management::NumericTablePtr &table,
+                                                                    const data_management::NumericTablePtr &mean,
+                                                                    const data_management::NumericTablePtr &standardDeviation,
+                                                                    Mode mode = normalizeOnRead)
+    {
+        services::SharedPtr<NormalizedNumericTable> result(new NormalizedNumericTable());
+        NormalizedNumericTable &nt = *result;
+        nt._table = table;
+        nt._mode = mode;
+        if(!nt.initialize(mean)) { return result; }
+
+        size_t nFeatures = nt.getNumberOfColumns();
+        double *coefficients = nt.getCoefficients();
+        double *meanArray  = coefficients + inverseShiftRow * nFeatures;
+        double *sigmaArray = coefficients + inverseScaleRow * nFeatures;
+        if(!nt.readFactors(mean, meanArray) || !nt.readFactors(standardDeviation, sigmaArray)) { return result; }
+
+        for(size_t j = 0; j < nFeatures; j++)
+        {
+            double invSigma = (sigmaArray[j] > 0.0 ? 1.0 / sigmaArray[j] : 0.0);
+            coefficients[scaleRow * nFeatures + j] = invSigma;
+            coefficients[shiftRow * nFeatures + j] = -meanArray[j] * invSigma;
+        }
+        nt.setNormalizationFlag(NumericTable::standardScoreNormalized);
+        return result;
+    }
+
+    /**
+     *  Constructs the table that normalizes the values of the table by min-max normalization,
+     *  y = lowerBound + (upperBound - lowerBound) * (x - minimum) / (maximum - minimum).
+     *  Features with equal minimum and maximum are normalized to the lower bound
+     *  \param[in] table        Table to normalize
+     *  \param[in] minimum      Table of size 1 x p with the minimums of the features
+     *  \param[in] maximum      Table of size 1 x p with the maximums of the features
+     *  \param[in] lowerBound   Lower bound of the normalized values
+     *  \param[in] upperBound   Upper bound of the normalized values
+     *  \param[in] mode         Mode of the normalization, \ref Mode
+     *  \return Pointer to the normalized table
+     */
+    static services::SharedPtr<NormalizedNumericTable> createMinMax(const data_management::NumericTablePtr &table,
+                                                                    const data_management::NumericTablePtr &minimum,
+                                                                    const data_management::NumericTablePtr &maximum,
+                                                                    double lowerBound = 0.0, double upperBound = 1.0,
+                                                                    Mode mode = normalizeOnRead)
+    {
+        services::SharedPtr<NormalizedNumericTable> result(new NormalizedNumericTable());
+        NormalizedNumericTable &nt = *result;
+        nt._table = table;
+        nt._mode = mode;
+        if(lowerBound >= upperBound) { nt._errors->add(services::ErrorLowerBoundGreaterThanOrEqualToUpperBound); return result; }
+        if(!nt.initialize(minimum)) { return result; }
+
+        size_t nFeatures = nt.getNumberOfColumns();
+        double *coefficients = nt.getCoefficients();
+        double *minArray = coefficients + inverseShiftRow * nFeatures;
+        double *maxArray = coefficients + inverseScaleRow * nFeatures;
+        if(!nt.readFactors(minimum, minArray) || !nt.readFactors(maximum, maxArray)) { return result; }
+
+        const double delta = upperBound - lowerBound;
+        for(size_t j = 0; j < nFeatures; j++)
+        {
+            double range = maxArray[j] - minArray[j];
+            double scale = (range > 0.0 ? delta / range : 0.0);
+            coefficients[scaleRow * nFeatures + j] = scale;
+            coefficients[shiftRow * nFeatures + j] = lowerBound - minArray[j] * scale;
+            maxArray[j] = (range > 0.0 ? range / delta : 0.0);
+            minArray[j] = (range > 0.0 ? minArray[j] - lowerBound * maxArray[j] : minArray[j]);
+        }
+        return result;
+    }
+
+    /**
+     *  Returns the wrapped table that stores the values
+     *  \return Pointer to the wrapped table
+     */
+    data_management::NumericTablePtr getNumericTable() const { return _table; }
+
+    /**
+     *  Returns the mode of the normalization
+     *  \return Mode of the normalization, \ref Mode
+     */
+    Mode getMode() const { return (Mode)_mode; }
+
+    /**
+     *  Updates the number of rows of the table with the number of rows of the wrapped table,
+     *  for example, after the block of the data set is loaded into the wrapped table directly
+     */
+    void refresh()
+    {
+        if(!_table) { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+        syncNumberOfRows();
+    }
+
+    /**
+     *  Overwrites the original values of the wrapped table in the range of rows with the normalized values,
+     *  for example, after the block of the data set is loaded into the wrapped table.
+     *  The table is switched to the normalizeOnWrite mode, so the normalized values are then read
+     *  from the wrapped table as they are, and the values written through the table are normalized
+     *  \param[in] startRow     Index of the first row to normalize
+     *  \param[in] nRows        Number of rows to normalize, all rows starting from startRow by default
+     */
+    void normalizeInPlace(size_t startRow = 0, size_t nRows = (size_t)-1)
+    {
+        if(!_table || !_coefficients) { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+        refresh();
+
+        const size_t nObservations = getNumberOfRows();
+        if(startRow >= nObservations) { return; }
+        const size_t endRow = (nRows < nObservations - startRow ? startRow + nRows : nObservations);
+
+        const size_t nFeatures = getNumberOfColumns();
+        const double *scale = getCoefficients() + scaleRow * nFeatures;
+        const double *shift = getCoefficients() + shiftRow * nFeatures;
+
+        data_management::BlockDescriptor<double> block;
+        for(size_t i = startRow; i < endRow; i += blockSize)
+        {
+            size_t nBlockRows = (endRow - i < blockSize ? endRow - i : blockSize);
+            _table->getBlockOfRows(i, nBlockRows, data_management::readWrite, block);
+            double *values = block.getBlockPtr();
+            if(!values) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+            for(size_t k = 0; k < nBlockRows; k++)
+            {
+                for(size_t j = 0; j < nFeatures; j++)
+                {
+                    values[k * nFeatures + j] = values[k * nFeatures + j] * scale[j] + shift[j];
+                }
+            }
+            _table->releaseBlockOfRows(block);
+        }
+        _table->setNormalizationFlag(this->_normalizationFlag);
+        _mode = normalizeOnWrite;
+    }
+
+    void setNumberOfRows(size_t nrow) DAAL_C11_OVERRIDE
+    {
+        if(_table) { _table->setNumberOfRows(nrow); }
+        NumericTable::setNumberOfRows(nrow);
+    }
+
+    void allocateDataMemory(daal::MemType type = daal::dram) DAAL_C11_OVERRIDE
+    {
+        if(!_table) { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+        _table->allocateDataMemory(type);
+        syncNumberOfRows();
+    }
+
+    void freeDataMemory() DAAL_C11_OVERRIDE
+    {
+        if(_table) { _table->freeDataMemory(); }
+        syncNumberOfRows();
+    }
+
+    MemoryStatus getDataMemoryStatus() const DAAL_C11_OVERRIDE
+    {
+        return (_table ? _table->getDataMemoryStatus() : notAllocated);
+    }
+
+    virtual int getSerializationTag() DAAL_C11_OVERRIDE
+    {
+        return SERIALIZATION_NORMALIZED_NT_ID;
+    }
+
+    void serializeImpl(data_management::InputDataArchive *archive) DAAL_C11_OVERRIDE
+    {
+        serialImpl<data_management::InputDataArchive, false>( archive );
+    }
+
+    void deserializeImpl(data_management::OutputDataArchive *archive) DAAL_C11_OVERRIDE
+    {
+        serialImpl<data_management::OutputDataArchive, true>( archive );
+    }
+
+    void getBlockOfRows(size_t vector_idx, size_t vector_num,
+                        data_management::ReadWriteMode rwflag, data_management::BlockDescriptor<double>& block) DAAL_C11_OVERRIDE
+    {
+        getTBlock<double>(vector_idx, vector_num, rwflag, block);
+    }
+    void getBlockOfRows(size_t vector_idx, size_t vector_num,
+                        data_management::ReadWriteMode rwflag, data_management::BlockDescriptor<float>& block) DAAL_C11_OVERRIDE
+    {
+        getTBlock<float>(vector_idx, vector_num, rwflag, block);
+    }
+    void getBlockOfRows(size_t vector_idx, size_t vector_num,
+                        data_management::ReadWriteMode rwflag, data_management::BlockDescriptor<int>& block) DAAL_C11_OVERRIDE
+    {
+        getTBlock<int>(vector_idx, vector_num, rwflag, block);
+    }
+
+    void releaseBlockOfRows(data_management::BlockDescriptor<double>& block) DAAL_C11_OVERRIDE
+    {
+        releaseTBlock<double>(block);
+    }
+    void releaseBlockOfRows(data_management::BlockDescriptor<float>& block) DAAL_C11_OVERRIDE
+    {
+        releaseTBlock<float>(block);
+    }
+    void releaseBlockOfRows(data_management::BlockDescriptor<int>& block) DAAL_C11_OVERRIDE
+    {
+        releaseTBlock<int>(block);
+    }
+
+    void getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                data_management::ReadWriteMode rwflag, data_management::BlockDescriptor<double>& block) DAAL_C11_OVERRIDE
+    {
+        getTFeature<double>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    void getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                data_management::ReadWriteMode rwflag, data_management::BlockDescriptor<float>& block) DAAL_C11_OVERRIDE
+    {
+        getTFeature<float>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    void getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                data_management::ReadWriteMode rwflag, data_management::BlockDescriptor<int>& block) DAAL_C11_OVERRIDE
+    {
+        getTFeature<int>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+
+    void releaseBlockOfColumnValues(data_management::BlockDescriptor<double>& block) DAAL_C11_OVERRIDE
+    {
+        releaseTFeature<double>(block);
+    }
+    void releaseBlockOfColumnValues(data_management::BlockDescriptor<float>& block) DAAL_C11_OVERRIDE
+    {
+        releaseTFeature<float>(block);
+    }
+    void releaseBlockOfColumnValues(data_management::BlockDescriptor<int>& block) DAAL_C11_OVERRIDE
+    {
+        releaseTFeature<int>(block);
+    }
+
+protected:
+    /** Rows of the table of coefficients */
+    enum CoefficientsRow
+    {
+        scaleRow        = 0,    /*!< Scale factors of the normalization */
+        shiftRow        = 1,    /*!< Shift factors of the normalization */
+        inverseScaleRow = 2,    /*!< Scale factors of the inverse transform */
+        inverseShiftRow = 3,    /*!< Shift factors of the inverse transform */
+        nCoefficientsRows = 4
+    };
+
+    static const size_t blockSize = 256;    /*!< Number of rows normalized at once in normalizeInPlace() */
+
+    template<typename Archive, bool onDeserialize>
+    void serialImpl( Archive *arch )
+    {
+        NumericTable::serialImpl<Archive, onDeserialize>( arch );
+
+        arch->setSharedPtrObj(_table);
+        arch->setSharedPtrObj(_coefficients);
+        arch->set(_mode);
+    }
+
+    bool initialize(const data_management::NumericTablePtr &factors)
+    {
+        if(!_table || !factors) { this->_errors->add(services::ErrorNullInputNumericTable); return false; }
+
+        const size_t nFeatures = factors->getNumberOfColumns();
+        if(nFeatures == 0 || (_table->getNumberOfColumns() != 0 && _table->getNumberOfColumns() != nFeatures))
+        {
+            this->_errors->add(services::ErrorIncorrectNumberOfFeatures);
+            return false;
+        }
+        if(_table->getNumberOfColumns() == 0) { _table->setNumberOfColumns(nFeatures); }
+
+        NumericTable::setNumberOfColumns(nFeatures);
+        data_management::NumericTableDictionary *dict = _table->getDictionary();
+        for(size_t i = 0; dict && i < nFeatures; i++)
+        {
+            _ddict->setFeature((*dict)[i], i);
+        }
+        syncNumberOfRows();
+
+        _coefficients = data_management::NumericTablePtr(
+            new data_management::HomogenNumericTable<double>(nFeatures, nCoefficientsRows, NumericTable::doAllocate));
+        if(!getCoefficients()) { this->_errors->add(services::ErrorMemoryAllocationFailed); return false; }
+        return true;
+    }
+
+    bool readFactors(const data_management::NumericTablePtr &factors, double *dst)
+    {
+        const size_t nFeatures = getNumberOfColumns();
+        if(!factors) { this->_errors->add(services::ErrorNullInputNumericTable); return false; }
+        if(factors->getNumberOfColumns() != nFeatures || factors->getNumberOfRows() != 1)
+        {
+            this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable);
+            return false;
+        }
+
+        data_management::BlockDescriptor<double> block;
+        factors->getBlockOfRows(0, 1, data_management::readOnly, block);
+        const double *src = block.getBlockPtr();
+        if(src)
+        {
+            for(size_t j = 0; j < nFeatures; j++) { dst[j] = src[j]; }
+        }
+        factors->releaseBlockOfRows(block);
+        if(!src) { this->_errors->add(services::ErrorIncorrectInputNumericTable); }
+        return (src != 0);
+    }
+
+    double *getCoefficients() const
+    {
+        return static_cast<data_management::HomogenNumericTable<double> *>(_coefficients.get())->getArray();
+    }
+
+    /* The rows can be added to or removed from the wrapped table directly, e.g. by the data source.
+       Called from the entry points that modify the table only, so the concurrent reads do not write to it */
+    void syncNumberOfRows()
+    {
+        NumericTable::setNumberOfRows(getNumberOfTableRows());
+    }
+
+    size_t getNumberOfTableRows() const
+    {
+        return (_table ? _table->getNumberOfRows() : 0);
+    }
+
+    /* The values written in the normalizeOnRead mode are converted back to the original values.
+       In the normalizeOnWrite mode only the values of the writeOnly blocks are normalized: the readWrite blocks
+       are read as the stored normalized values, so they are written back unchanged */
+    bool isTransformedOnRelease(int rwFlag) const
+    {
+        return (_mode == normalizeOnRead || !(rwFlag & (int)data_management::readOnly));
+    }
+
+    template <typename T>
+    void getTBlock(size_t idx, size_t nrows, int rwFlag, data_management::BlockDescriptor<T>& block)
+    {
+        size_t ncols = getNumberOfColumns();
+        size_t nobs = getNumberOfTableRows();
+        block.setDetails( 0, idx, rwFlag );
+
+        if (idx >= nobs || !_coefficients)
+        {
+            block.resizeBuffer( ncols, 0 );
+            return;
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        if( !block.resizeBuffer( ncols, nrows ) )
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+
+        if( rwFlag & (int)data_management::readOnly )
+        {
+            data_management::BlockDescriptor<double> innerBlock;
+            _table->getBlockOfRows(idx, nrows, data_management::readOnly, innerBlock);
+            const double *src = innerBlock.getBlockPtr();
+            T *dst = block.getBlockPtr();
+            if(_mode == normalizeOnRead)
+            {
+                const double *scale = getCoefficients() + scaleRow * ncols;
+                const double *shift = getCoefficients() + shiftRow * ncols;
+                for(size_t i = 0; i < nrows; i++)
+                {
+                    for(size_t j = 0; j < ncols; j++)
+                    {
+                        dst[i * ncols + j] = (T)(src[i * ncols + j] * scale[j] + shift[j]);
+                    }
+                }
+            }
+            else
+            {
+                for(size_t i = 0; i < nrows * ncols; i++) { dst[i] = (T)src[i]; }
+            }
+            _table->releaseBlockOfRows(innerBlock);
+        }
+    }
+
+    template <typename T>
+    void releaseTBlock(data_management::BlockDescriptor<T>& block)
+    {
+        if((block.getRWFlag() & (int)data_management::writeOnly) && block.getNumberOfRows())
+        {
+            size_t ncols = getNumberOfColumns();
+            size_t nrows = block.getNumberOfRows();
+            data_management::BlockDescriptor<double> innerBlock;
+            _table->getBlockOfRows(block.getRowsOffset(), nrows, data_management::writeOnly, innerBlock);
+            const T *src = block.getBlockPtr();
+            double *dst = innerBlock.getBlockPtr();
+            if(isTransformedOnRelease(block.getRWFlag()))
+            {
+                const double *scale = getCoefficients() + (_mode == normalizeOnRead ? inverseScaleRow : scaleRow) * ncols;
+                const double *shift = getCoefficients() + (_mode == normalizeOnRead ? inverseShiftRow : shiftRow) * ncols;
+                for(size_t i = 0; i < nrows; i++)
+                {
+                    for(size_t j = 0; j < ncols; j++)
+                    {
+                        dst[i * ncols + j] = (double)src[i * ncols + j] * scale[j] + shift[j];
+                    }
+                }
+            }
+            else
+            {
+                for(size_t i = 0; i < nrows * ncols; i++) { dst[i] = (double)src[i]; }
+            }
+            _table->releaseBlockOfRows(innerBlock);
+            if(_mode == normalizeOnWrite) { _table->setNormalizationFlag(this->_normalizationFlag); }
+        }
+        block.setDetails( 0, 0, 0 );
+    }
+
+    template <typename T>
+    void getTFeature(size_t feat_idx, size_t idx, size_t nrows, int rwFlag, data_management::BlockDescriptor<T>& block)
+    {
+        size_t ncols = getNumberOfColumns();
+        size_t nobs = getNumberOfTableRows();
+        block.setDetails( feat_idx, idx, rwFlag );
+
+        if (idx >= nobs || feat_idx >= ncols || !_coefficients)
+        {
+            block.resizeBuffer( 1, 0 );
+            return;
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+        if( !block.resizeBuffer( 1, nrows ) )
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+
+        if( rwFlag & (int)data_management::readOnly )
+        {
+            const double scale = (_mode == normalizeOnRead ? getCoefficients()[scaleRow * ncols + feat_idx] : 1.0);
+            const double shift = (_mode == normalizeOnRead ? getCoefficients()[shiftRow * ncols + feat_idx] : 0.0);
+
+            data_management::BlockDescriptor<double> innerBlock;
+            _table->getBlockOfColumnValues(feat_idx, idx, nrows, data_management::readOnly, innerBlock);
+            const double *src = innerBlock.getBlockPtr();
+            T *dst = block.getBlockPtr();
+            for(size_t i = 0; i < nrows; i++)
+            {
+                dst[i] = (T)(src[i] * scale + shift);
+            }
+            _table->releaseBlockOfColumnValues(innerBlock);
+        }
+    }
+
+    template <typename T>
+    void releaseTFeature(data_management::BlockDescriptor<T>& block)
+    {
+        if ((block.getRWFlag() & (int)data_management::writeOnly) && block.getNumberOfRows())
+        {
+            size_t ncols = getNumberOfColumns();
+            size_t feat_idx = block.getColumnsOffset();
+            size_t nrows = block.getNumberOfRows();
+            const bool transform = isTransformedOnRelease(block.getRWFlag());
+            const double scale = (transform ? getCoefficients()[(_mode == normalizeOnRead ? inverseScaleRow : scaleRow) * ncols + feat_idx] : 1.0);
+            const double shift = (transform ? getCoefficients()[(_mode == normalizeOnRead ? inverseShiftRow : shiftRow) * ncols + feat_idx] : 0.0);
+
+            data_management::BlockDescriptor<double> innerBlock;
+            _table->getBlockOfColumnValues(feat_idx, block.getRowsOffset(), nrows, data_management::writeOnly, innerBlock);
+            const T *src = block.getBlockPtr();
+            double *dst = innerBlock.getBlockPtr();
+            for(size_t i = 0; i < nrows; i++)
+            {
+                dst[i] = (double)src[i] * scale + shift;
+            }
+            _table->releaseBlockOfColumnValues(innerBlock);
+            if(_mode == normalizeOnWrite) { _table->setNormalizationFlag(this->_normalizationFlag); }
+        }
+        block.setDetails( 0, 0, 0 );
+    }
+
+protected:
+    data_management::NumericTablePtr _table;           /*!< Wrapped table that stores the values */
+    data_management::NumericTablePtr _coefficients;    /*!< Table of size 4 x p with the factors of the normalization and of its inverse */
+    int _mode;                                         /*!< Mode of the normalization */
+};
+/** @} */
+} // namespace interface1
+using interface1::NormalizedNumericTable;
+
+} // namespace normalization
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -75,7 +75,9 @@ enum Method
  */
 enum InputId
 {
-    data = 0            /*!< %Input data table */
+    data    = 0,        /*!< %Input data table */
+    weights = 1         /*!< Optional weights of observations, numeric table of size nObservations x 1.
+                             Supported by the defaultDense method only */
 };
 
 /**
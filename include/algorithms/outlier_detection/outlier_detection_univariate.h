@@ -104,6 +104,9 @@ public:
     {
         initialize();
         input.set(data, other.input.get(data));
+        input.set(location, other.input.get(location));
+        input.set(scatter, other.input.get(scatter));
+        input.set(threshold, other.input.get(threshold));
         parameter = other.parameter;
     }
 
@@ -0,0 +1,413 @@
+/* file: outlier_detection_univariate_distributed.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the univariate outlier detection algorithm
+//  in the distributed processing mode
+//--
+*/
+
+#ifndef __OUTLIERDETECTION_UNIVARIATE_DISTRIBUTED_H__
+#define __OUTLIERDETECTION_UNIVARIATE_DISTRIBUTED_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "outlier_detection_univariate_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace univariate_outlier_detection
+{
+
+namespace interface1
+{
+/**
+ * @defgroup univariate_outlier_detection_distributed Distributed
+ * @ingroup univariate_outlier_detection
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__UNIVARIATE_OUTLIER_DETECTION__DISTRIBUTEDCONTAINER"></a>
+ * \brief Provides methods to run implementations of the univariate outlier detection algorithm in the distributed processing mode.
+ *        It is associated with the daal::algorithms::univariate_outlier_detection::Distributed class
+ *
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the univariate outlier detection algorithm, double or float
+ * \tparam method           Univariate outlier detection computation method, \ref daal::algorithms::univariate_outlier_detection::Method
+ */
+template<ComputeStep step, typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer
+{};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__UNIVARIATE_OUTLIER_DETECTION__DISTRIBUTEDCONTAINER_STEP1LOCAL"></a>
+ * \brief Provides methods to run implementations of the first step of the univariate outlier detection algorithm
+ *        on local nodes in the distributed processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the univariate outlier detection algorithm, double or float
+ * \tparam method           Univariate outlier detection computation method, \ref daal::algorithms::univariate_outlier_detection::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step1Local, algorithmFPType, method, cpu> :
+    public daal::algorithms::AnalysisContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for the univariate outlier detection algorithm with a specified environment
+     * in the first step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~DistributedContainer();
+    /**
+     * Computes a partial result of the univariate outlier detection algorithm on the local node
+     */
+    virtual void compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the location and scatter estimates of the data set processed on the local node
+     */
+    virtual void finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__UNIVARIATE_OUTLIER_DETECTION__DISTRIBUTEDCONTAINER_STEP2MASTER"></a>
+ * \brief Provides methods to run implementations of the second step of the univariate outlier detection algorithm
+ *        on the master node in the distributed processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the univariate outlier detection algorithm, double or float
+ * \tparam method           Univariate outlier detection computation method, \ref daal::algorithms::univariate_outlier_detection::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step2Master, algorithmFPType, method, cpu> :
+    public daal::algorithms::AnalysisContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for the univariate outlier detection algorithm with a specified environment
+     * in the second step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~DistributedContainer();
+    /**
+     * Merges the partial results computed on local nodes
+     */
+    virtual void compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the location and scatter estimates of the whole data set
+     */
+    virtual void finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__UNIVARIATE_OUTLIER_DETECTION__DISTRIBUTED"></a>
+ * \brief Estimates the location and scatter of the features for the univariate outlier detection algorithm
+ *        in the distributed processing mode
+ *
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the univariate outlier detection algorithm, double or float
+ * \tparam method           Univariate outlier detection computation method, \ref daal::algorithms::univariate_outlier_detection::Method
+ */
+template<ComputeStep step, typename algorithmFPType = double, Method method = defaultDense>
+class DAAL_EXPORT Distributed {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__UNIVARIATE_OUTLIER_DETECTION__DISTRIBUTED_STEP1LOCAL"></a>
+ * \brief Computes partial results of the univariate outlier detection algorithm on local nodes
+ *        in the first step of the distributed processing mode.
+ *        The estimates computed on the master node are passed to the location and scatter inputs
+ *        of the Batch algorithm that computes the weights of the observations of every local block.
+ * \n<a href="DAAL-REF-UNIVARIATE_OUTLIER_DETECTION-ALGORITHM">univariate outlier detection algorithm description and usage models</a>
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the univariate outlier detection algorithm, double or float
+ * \tparam method           Univariate outlier detection computation method, \ref daal::algorithms::univariate_outlier_detection::Method
+ *
+ * \par Enumerations
+ *      - \ref Method           Computation methods
+ *      - \ref InputId          Identifiers of input objects
+ *      - \ref PartialResultId  Identifiers of partial results
+ *      - \ref ResultId         Identifiers of results
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step1Local, algorithmFPType, method> : public daal::algorithms::Analysis<distributed>
+{
+public:
+    DistributedInput<step1Local> input;     /*!< %Input data structure */
+    Parameter parameter;                    /*!< Parameters of the algorithm */
+
+    /** Default constructor */
+    Distributed()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs an algorithm for the univariate outlier detection by copying input objects and parameters
+     * of another algorithm for the univariate outlier detection
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step1Local, algorithmFPType, method> &other)
+    {
+        initialize();
+        input.set(data, other.input.get(data));
+        parameter = other.parameter;
+    }
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int) method; }
+
+    /**
+     * Returns the structure that contains the estimates of the univariate outlier detection algorithm
+     * \return Structure that contains the estimates
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store the estimates of the univariate outlier detection algorithm
+     * \param[in] result  Structure to store the estimates
+     */
+    void setResult(const services::SharedPtr<Result>& result)
+    {
+        DAAL_CHECK(result, ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains partial results of the univariate outlier detection algorithm
+     * \return Structure that contains partial results
+     */
+    PartialResultPtr getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store partial results of the univariate outlier detection algorithm
+     * \param[in] partialResult  Structure to store partial results
+     * \param[in] initFlag       Flag that specifies whether the partial results are initialized
+     */
+    void setPartialResult(const PartialResultPtr& partialResult, bool initFlag = false)
+    {
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        setInitFlag(initFlag);
+    }
+
+    /**
+     * Returns a pointer to the newly allocated algorithm for the univariate outlier detection
+     * with a copy of input objects and parameters of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step1Local, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step1Local, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step1Local, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step1Local, algorithmFPType, method>(*this);
+    }
+
+    virtual void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(_pres, &parameter, (int) method);
+        _res = _result.get();
+    }
+
+    virtual void allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->allocate<algorithmFPType>(&input, &parameter, (int) method);
+        _pres = _partialResult.get();
+    }
+
+    virtual void initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->initialize();
+    }
+
+    void initialize()
+    {
+        Analysis<distributed>::_ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step1Local, algorithmFPType, method)(&_env);
+        _in = &input;
+        _par = &parameter;
+        _result = services::SharedPtr<Result>(new Result());
+        _partialResult = PartialResultPtr(new PartialResult());
+    }
+
+private:
+    PartialResultPtr _partialResult;
+    services::SharedPtr<Result> _result;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__UNIVARIATE_OUTLIER_DETECTION__DISTRIBUTED_STEP2MASTER"></a>
+ * \brief Merges the partial results computed on local nodes and computes the location and scatter estimates
+ *        of the whole data set in the second step of the distributed processing mode
+ * \n<a href="DAAL-REF-UNIVARIATE_OUTLIER_DETECTION-ALGORITHM">univariate outlier detection algorithm description and usage models</a>
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the univariate outlier detection algorithm, double or float
+ * \tparam method           Univariate outlier detection computation method, \ref daal::algorithms::univariate_outlier_detection::Method
+ *
+ * \par Enumerations
+ *      - \ref Method           Computation methods
+ *      - \ref MasterInputId    Identifiers of input objects
+ *      - \ref PartialResultId  Identifiers of partial results
+ *      - \ref ResultId         Identifiers of results
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step2Master, algorithmFPType, method> : public daal::algorithms::Analysis<distributed>
+{
+public:
+    DistributedInput<step2Master> input;    /*!< %Input data structure */
+    Parameter parameter;                    /*!< Parameters of the algorithm */
+
+    /** Default constructor */
+    Distributed()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs an algorithm for the univariate outlier detection by copying input objects and parameters
+     * of another algorithm for the univariate outlier detection
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step2Master, algorithmFPType, method> &other)
+    {
+        initialize();
+        input.set(partialResults, other.input.get(partialResults));
+        parameter = other.parameter;
+    }
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int) method; }
+
+    /**
+     * Returns the structure that contains the estimates of the univariate outlier detection algorithm
+     * \return Structure that contains the estimates
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store the estimates of the univariate outlier detection algorithm
+     * \param[in] result  Structure to store the estimates
+     */
+    void setResult(const services::SharedPtr<Result>& result)
+    {
+        DAAL_CHECK(result, ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains partial results of the univariate outlier detection algorithm
+     * \return Structure that contains partial results
+     */
+    PartialResultPtr getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store partial results of the univariate outlier detection algorithm
+     * \param[in] partialResult  Structure to store partial results
+     * \param[in] initFlag       Flag that specifies whether the partial results are initialized
+     */
+    void setPartialResult(const PartialResultPtr& partialResult, bool initFlag = false)
+    {
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        setInitFlag(initFlag);
+    }
+
+    /**
+     * Returns a pointer to the newly allocated algorithm for the univariate outlier detection
+     * with a copy of input objects and parameters of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step2Master, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step2Master, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step2Master, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step2Master, algorithmFPType, method>(*this);
+    }
+
+    virtual void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(_pres, &parameter, (int) method);
+        _res = _result.get();
+    }
+
+    virtual void allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->allocate<algorithmFPType>(&input, &parameter, (int) method);
+        _pres = _partialResult.get();
+    }
+
+    virtual void initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->initialize();
+    }
+
+    void initialize()
+    {
+        Analysis<distributed>::_ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step2Master, algorithmFPType, method)(&_env);
+        _in = &input;
+        _par = &parameter;
+        _result = services::SharedPtr<Result>(new Result());
+        _partialResult = PartialResultPtr(new PartialResult());
+    }
+
+private:
+    PartialResultPtr _partialResult;
+    services::SharedPtr<Result> _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::DistributedContainer;
+using interface1::Distributed;
+
+} // namespace univariate_outlier_detection
+} // namespace algorithm
+} // namespace daal
+#endif
@@ -0,0 +1,223 @@
+/* file: outlier_detection_univariate_online.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the univariate outlier detection algorithm
+//  in the online processing mode
+//--
+*/
+
+#ifndef __OUTLIERDETECTION_UNIVARIATE_ONLINE_H__
+#define __OUTLIERDETECTION_UNIVARIATE_ONLINE_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "outlier_detection_univariate_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace univariate_outlier_detection
+{
+
+namespace interface1
+{
+/**
+ * @defgroup univariate_outlier_detection_online Online
+ * @ingroup univariate_outlier_detection
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__UNIVARIATE_OUTLIER_DETECTION__ONLINECONTAINER"></a>
+ * \brief Provides methods to run implementations of the univariate outlier detection algorithm.
+ *        It is associated with the daal::algorithms::univariate_outlier_detection::Online class
+ *        and supports the methods of the univariate outlier detection in the %online processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the univariate outlier detection algorithm, double or float
+ * \tparam method           Univariate outlier detection computation method, \ref daal::algorithms::univariate_outlier_detection::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT OnlineContainer : public daal::algorithms::AnalysisContainerIface<online>
+{
+public:
+    /**
+     * Constructs a container for the univariate outlier detection algorithm with a specified environment
+     * in the online processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    OnlineContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~OnlineContainer();
+    /**
+     * Computes a partial result of the univariate outlier detection algorithm in the online processing mode
+     */
+    virtual void compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the location and scatter estimates of the univariate outlier detection algorithm
+     * in the online processing mode
+     */
+    virtual void finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__UNIVARIATE_OUTLIER_DETECTION__ONLINE"></a>
+ * \brief Estimates the location and scatter of the features for the univariate outlier detection algorithm
+ *        in the online processing mode.
+ *        The estimates are passed to the location and scatter inputs of the Batch algorithm
+ *        that computes the weights of the observations of every block of the data set.
+ * \n<a href="DAAL-REF-UNIVARIATE_OUTLIER_DETECTION-ALGORITHM">univariate outlier detection algorithm description and usage models</a>
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the univariate outlier detection algorithm, double or float
+ * \tparam method           univariate outlier detection computation method, \ref daal::algorithms::univariate_outlier_detection::Method
+ *
+ * \par Enumerations
+ *      - \ref Method           Computation methods
+ *      - \ref InputId          Identifiers of input objects
+ *      - \ref PartialResultId  Identifiers of partial results
+ *      - \ref ResultId         Identifiers of results
+ */
+template<typename algorithmFPType = double, Method method = defaultDense>
+class DAAL_EXPORT Online : public daal::algorithms::Analysis<online>
+{
+public:
+    Input input;            /*!< %Input data structure */
+    Parameter parameter;    /*!< Parameters of the algorithm */
+
+    /** Default constructor */
+    Online()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs an algorithm for the univariate outlier detection by copying input objects and parameters
+     * of another algorithm for the univariate outlier detection
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Online(const Online<algorithmFPType, method> &other)
+    {
+        initialize();
+        input.set(data, other.input.get(data));
+        parameter = other.parameter;
+    }
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int) method; }
+
+    /**
+     * Returns the structure that contains the estimates of the univariate outlier detection algorithm
+     * \return Structure that contains the estimates
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store the estimates of the univariate outlier detection algorithm
+     * \param[in] result  Structure to store the estimates
+     */
+    void setResult(const services::SharedPtr<Result>& result)
+    {
+        DAAL_CHECK(result, ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains partial results of the univariate outlier detection algorithm
+     * \return Structure that contains partial results
+     */
+    PartialResultPtr getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store partial results of the univariate outlier detection algorithm
+     * \param[in] partialResult  Structure to store partial results
+     * \param[in] initFlag       Flag that specifies whether the partial results are initialized
+     */
+    void setPartialResult(const PartialResultPtr& partialResult, bool initFlag = false)
+    {
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        setInitFlag(initFlag);
+    }
+
+    /**
+     * Returns a pointer to the newly allocated algorithm for the univariate outlier detection
+     * with a copy of input objects and parameters of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Online<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Online<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Online<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Online<algorithmFPType, method>(*this);
+    }
+
+    virtual void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(_pres, &parameter, (int) method);
+        _res = _result.get();
+    }
+
+    virtual void allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->allocate<algorithmFPType>(&input, &parameter, (int) method);
+        _pres = _partialResult.get();
+    }
+
+    virtual void initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->initialize();
+    }
+
+    void initialize()
+    {
+        Analysis<online>::_ac = new __DAAL_ALGORITHM_CONTAINER(online, OnlineContainer, algorithmFPType, method)(&_env);
+        _in = &input;
+        _par = &parameter;
+        _result = services::SharedPtr<Result>(new Result());
+        _partialResult = PartialResultPtr(new PartialResult());
+    }
+
+private:
+    PartialResultPtr _partialResult;
+    services::SharedPtr<Result> _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::OnlineContainer;
+using interface1::Online;
+
+} // namespace univariate_outlier_detection
+} // namespace algorithm
+} // namespace daal
+#endif
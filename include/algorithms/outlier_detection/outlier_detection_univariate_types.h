@@ -57,7 +57,32 @@ enum Method
  */
 enum InputId
 {
-    data = 0            /*!< %Input data table */
+    data      = 0,      /*!< %Input data table */
+    location  = 1,      /*!< Optional. Vector of mean estimates of size 1 x p, overrides the initialization procedure */
+    scatter   = 2,      /*!< Optional. Measure of spread, the array of standard deviations of size 1 x p,
+                             overrides the initialization procedure */
+    threshold = 3       /*!< Optional. Limit that defines the outlier region, the array of non-negative numbers of size 1 x p,
+                             overrides the initialization procedure */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__UNIVARIATE_OUTLIER_DETECTION__MASTERINPUTID"></a>
+ * Available identifiers of input objects of the univariate outlier detection algorithm on the master node
+ */
+enum MasterInputId
+{
+    partialResults = 0  /*!< Collection of partial results computed on local nodes */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__UNIVARIATE_OUTLIER_DETECTION__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the univariate outlier detection algorithm
+ */
+enum PartialResultId
+{
+    nObservations = 0,  /*!< Number of processed observations, table of size 1 x 1 */
+    sketchItems   = 1,  /*!< Items of the quantile sketches of the processed observations, one row per feature */
+    sketchLevels  = 2   /*!< Boundaries of the levels of the quantile sketches, one row per feature */
 };
 
 /**
@@ -66,7 +91,10 @@ enum InputId
  */
 enum ResultId
 {
-    weights = 0          /*!< Table with results */
+    weights          = 0,   /*!< Table with results */
+    locationEstimate = 1,   /*!< Medians of the features estimated in the online or distributed processing mode, table of size 1 x p */
+    scatterEstimate  = 2    /*!< Interquartile ranges of the features divided by 1.349, the estimates of the standard deviations
+                                 robust to outliers, computed in the online or distributed processing mode, table of size 1 x p */
 };
 
 /**
@@ -132,17 +160,41 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 };
 /* [Parameter source code] */
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__UNIVARIATE_OUTLIER_DETECTION__INPUTIFACE"></a>
+ * \brief Abstract class that specifies the interface of the input objects of the univariate outlier detection algorithm
+ */
+class DAAL_EXPORT InputIface : public daal::algorithms::Input
+{
+public:
+    InputIface(size_t nElements) : daal::algorithms::Input(nElements) {}
+
+    virtual ~InputIface() {}
+
+    /**
+     * Returns the number of columns in the input data set
+     * \return Number of columns in the input data set
+     */
+    virtual size_t getNumberOfColumns() const = 0;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__UNIVARIATE_OUTLIER_DETECTION__INPUT"></a>
  * \brief %Input objects for the univariate outlier detection algorithm
  */
-class DAAL_EXPORT Input : public daal::algorithms::Input
+class DAAL_EXPORT Input : public InputIface
 {
 public:
     Input();
 
     virtual ~Input() {}
 
+    /**
+     * Returns the number of columns in the input data set
+     * \return Number of columns in the input data set
+     */
+    size_t getNumberOfColumns() const DAAL_C11_OVERRIDE;
+
     /**
      * Returns an input object for the univariate outlier detection algorithm
      * \param[in] id    Identifier of the %input object
@@ -165,9 +217,94 @@ public:
     void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__UNIVARIATE_OUTLIER_DETECTION__PARTIALRESULT"></a>
+ * \brief Partial results obtained with the compute() method of the univariate outlier detection algorithm
+ *        in the online or distributed processing mode.
+ *        The partial results of different blocks of the data set are merged by merging their quantile sketches
+ */
+class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DAAL_CAST_OPERATOR(PartialResult);
+
+    DECLARE_SERIALIZABLE();
+    PartialResult();
+
+    virtual ~PartialResult() {}
+
+    /**
+     * Allocates memory to store partial results of the univariate outlier detection algorithm
+     * \param[in] input     Pointer to the structure with input objects
+     * \param[in] parameter Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Sets the partial results of the univariate outlier detection algorithm to the values of the empty data set
+     */
+    void initialize();
+
+    /**
+     * Returns the number of columns in the partial result of the univariate outlier detection algorithm
+     * \return Number of columns in the partial result
+     */
+    size_t getNumberOfColumns() const;
+
+    /**
+     * Returns a partial result of the univariate outlier detection algorithm
+     * \param[in] id   Identifier of the partial result, \ref PartialResultId
+     * \return         Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(PartialResultId id) const;
+
+    /**
+     * Sets a partial result of the univariate outlier detection algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(PartialResultId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Checks the partial result of the univariate outlier detection algorithm
+     * \param[in] input     Pointer to the structure with input objects
+     * \param[in] parameter Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     */
+    void check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the partial result of the univariate outlier detection algorithm
+     * \param[in] parameter Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     */
+    void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+
+    void checkImpl(size_t nFeatures) const;
+};
+
+typedef services::SharedPtr<PartialResult> PartialResultPtr;
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__UNIVARIATE_OUTLIER_DETECTION__RESULT"></a>
  * \brief Results obtained with the compute() method of the univariate outlier detection algorithm in the %batch processing mode
+ *        or with the finalizeCompute() method in the online or distributed processing mode
  */
 class DAAL_EXPORT Result : public daal::algorithms::Result
 {
@@ -186,6 +323,16 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
 
+    /**
+     * Allocates memory to store the estimates of the univariate outlier detection algorithm
+     * in the online or distributed processing mode
+     * \param[in] partialResult Pointer to the partial results of the algorithm
+     * \param[in] parameter     Pointer to the parameters of the algorithm
+     * \param[in] method        univariate outlier detection computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT void allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method);
+
     /**
      * Returns a result of the univariate outlier detection algorithm
      * \param[in] id   Identifier of the result
@@ -209,6 +356,14 @@ public:
      */
     void check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
 
+    /**
+     * Checks the estimates of the univariate outlier detection algorithm in the online or distributed processing mode
+     * \param[in] partialResult Pointer to the partial results of the algorithm
+     * \param[in] par           Pointer to the parameters of the algorithm
+     * \param[in] method        univariate outlier detection computation method
+     */
+    void check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
 protected:
     /** \private */
     template<typename Archive, bool onDeserialize>
@@ -223,13 +378,86 @@ protected:
     void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
     {serialImpl<data_management::OutputDataArchive, true>(arch);}
 };
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__UNIVARIATE_OUTLIER_DETECTION__DISTRIBUTEDINPUT"></a>
+ * \brief %Input objects of the univariate outlier detection algorithm in the distributed processing mode
+ *
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ */
+template<ComputeStep step>
+class DistributedInput {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__UNIVARIATE_OUTLIER_DETECTION__DISTRIBUTEDINPUT_STEP1LOCAL"></a>
+ * \brief %Input objects of the univariate outlier detection algorithm on local nodes in the distributed processing mode
+ */
+template<>
+class DAAL_EXPORT DistributedInput<step1Local> : public Input
+{
+public:
+    DistributedInput() : Input() {}
+
+    virtual ~DistributedInput() {}
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__UNIVARIATE_OUTLIER_DETECTION__DISTRIBUTEDINPUT_STEP2MASTER"></a>
+ * \brief %Input objects of the univariate outlier detection algorithm on the master node in the distributed processing mode
+ */
+template<>
+class DAAL_EXPORT DistributedInput<step2Master> : public InputIface
+{
+public:
+    DistributedInput();
+
+    virtual ~DistributedInput() {}
+
+    /**
+     * Returns the number of columns in the input data set
+     * \return Number of columns in the input data set
+     */
+    size_t getNumberOfColumns() const DAAL_C11_OVERRIDE;
+
+    /**
+     * Adds the partial result computed on a local node to the collection of input objects
+     * \param[in] id            Identifier of the input object
+     * \param[in] partialResult Partial result obtained in the first step of the distributed algorithm
+     */
+    void add(MasterInputId id, const PartialResultPtr &partialResult);
+
+    /**
+     * Sets the input object of the univariate outlier detection algorithm on the master node
+     * \param[in] id  Identifier of the input object
+     * \param[in] ptr Pointer to the input object
+     */
+    void set(MasterInputId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Returns the collection of input objects
+     * \param[in] id   Identifier of the input object, \ref MasterInputId
+     * \return Collection of partial results
+     */
+    data_management::DataCollectionPtr get(MasterInputId id) const;
+
+    /**
+     * Checks the input objects of the univariate outlier detection algorithm on the master node
+     * \param[in] parameter Pointer to the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+};
 /** @} */
 } // namespace interface1
 using interface1::InitIface;
 using interface1::DefaultInit;
 using interface1::Parameter;
+using interface1::InputIface;
 using interface1::Input;
+using interface1::PartialResult;
+using interface1::PartialResultPtr;
 using interface1::Result;
+using interface1::DistributedInput;
 
 } // namespace univariate_outlier_detection
 } // namespace algorithm
@@ -0,0 +1,180 @@
+/* file: profile_batch.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the profile algorithm in the batch processing mode
+//--
+*/
+
+#ifndef __PROFILE_BATCH_H__
+#define __PROFILE_BATCH_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/profile/profile_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace profile
+{
+
+namespace interface1
+{
+/**
+ * @defgroup profile_batch Batch
+ * @ingroup profile
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PROFILE__BATCHCONTAINER"></a>
+ * \brief Provides methods to run implementations of the profile algorithm.
+ *        It is associated with the daal::algorithms::profile::Batch class
+ *        and supports methods of the profile computation in the batch processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the profile algorithm, double or float
+ * \tparam method           Profile computation method, \ref daal::algorithms::profile::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT BatchContainer : public daal::algorithms::AnalysisContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for the profile algorithm with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~BatchContainer();
+    /**
+     * Computes the result of the profile algorithm in the batch processing mode
+     */
+    virtual void compute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PROFILE__BATCH"></a>
+ * \brief Computes the statistics of the features in a single pass over the data set in the batch processing mode.
+ * \n<a href="DAAL-REF-PROFILE-ALGORITHM">Profile algorithm description and usage models</a>
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the profile algorithm, double or float
+ * \tparam method           Profile computation method, \ref daal::algorithms::profile::Method
+ *
+ * \par Enumerations
+ *      - \ref Method   Profile computation methods
+ *      - \ref InputId  Identifiers of input objects for the profile algorithm
+ *      - \ref ResultId Identifiers of results of the profile algorithm
+ */
+template<typename algorithmFPType = double, Method method = defaultDense>
+class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
+{
+public:
+    Input input;                    /*!< %input data structure */
+    Parameter parameter;            /*!< Profile parameters structure */
+
+    /** Default constructor     */
+    Batch()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs algorithm that computes the profile by copying input objects and parameters
+     * of another algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> &other)
+    {
+        initialize();
+        input.set(data, other.input.get(data));
+        parameter = other.parameter;
+    }
+
+    virtual ~Batch() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains computed results of the profile algorithm
+     * \return Structure that contains computed results of the profile algorithm
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store results of the profile algorithm
+     * \param[in] result Structure to store results of the profile algorithm
+     */
+    void setResult(const services::SharedPtr<Result> &result)
+    {
+        DAAL_CHECK(result, ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated algorithm that computes the profile
+     * with a copy of input objects and parameters of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Batch<algorithmFPType, method>(*this);
+    }
+
+    virtual void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(&input, &parameter, method);
+        _res = _result.get();
+    }
+
+    void initialize()
+    {
+        Analysis<batch>::_ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = &parameter;
+        _result = services::SharedPtr<Result>(new Result());
+    }
+
+    services::SharedPtr<Result> _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::BatchContainer;
+using interface1::Batch;
+
+} // namespace daal::algorithms::profile
+} // namespace daal::algorithms
+} // namespace daal
+#endif
@@ -0,0 +1,222 @@
+/* file: profile_online.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the profile algorithm in the
+//  online processing mode
+//--
+*/
+
+#ifndef __PROFILE_ONLINE_H__
+#define __PROFILE_ONLINE_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/profile/profile_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace profile
+{
+
+namespace interface1
+{
+/**
+ * @defgroup profile_online Online
+ * @ingroup profile
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PROFILE__ONLINECONTAINER"></a>
+ * \brief Provides methods to run implementations of the profile algorithm.
+ *        This class is associated with daal::algorithms::profile::Online class
+
+ *
+ * \tparam method           Computation method for the profile algorithm, \ref daal::algorithms::profile::Method
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the profile algorithm, double or float
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT OnlineContainer : public daal::algorithms::AnalysisContainerIface<online>
+{
+public:
+    /**
+     * Constructs a container for the profile algorithm with a specified environment
+     * in the online processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    OnlineContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~OnlineContainer();
+    /**
+     * Computes a partial result of the profile algorithm
+     * in the online processing mode
+     */
+    virtual void compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the result of the profile algorithm
+     * in the online processing mode
+     */
+    virtual void finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PROFILE__ONLINE"></a>
+ * \brief Computes the statistics of the features in the online processing mode.
+ * \n<a href="DAAL-REF-PROFILE-ALGORITHM">Profile algorithm description and usage models</a>
+ *
+ * \tparam method           Computation method for the profile algorithm, \ref daal::algorithms::profile::Method
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the profile algorithm, double or float
+ *
+ * \par Enumerations
+ *      - \ref Method           Computation methods for the profile algorithm
+ *      - \ref InputId          Identifiers of input objects for the profile algorithm
+ *      - \ref PartialResultId  Identifiers of partial result of the profile algorithm
+ *      - \ref ResultId         Identifiers of the results of the profile algorithm
+ */
+template<typename algorithmFPType = double, Method method = defaultDense>
+class DAAL_EXPORT Online : public daal::algorithms::Analysis<online>
+{
+public:
+    Input input;            /*!< %Input data structure */
+    Parameter parameter;    /*!< %Parameters structure */
+
+    /** Default constructor */
+    Online()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs an algorithm that computes the profile by copying input objects and parameters
+     * of another algorithm that computes the profile
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Online(const Online<algorithmFPType, method> &other)
+    {
+        initialize();
+        input.set(data,  other.input.get(data));
+        parameter = other.parameter;
+    }
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains the results of the profile algorithm
+     * \return Structure that contains the results
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store final results of the profile algorithm
+     * \param[in] result    Structure for storing the results of the profile algorithm
+     */
+    void setResult(const services::SharedPtr<Result> &result)
+    {
+        DAAL_CHECK(result, ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains partial results of the profile algorithm
+     * \return Structure that contains partial results
+     */
+    services::SharedPtr<PartialResult> getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store partial results of the profile algorithm
+     * \param[in] partialResult    Structure for storing partial results of the profile algorithm
+     * \param[in] _initFlag        Flag that specifies whether the partial results are initialized
+     */
+    void setPartialResult(const services::SharedPtr<PartialResult> &partialResult, bool _initFlag = false)
+    {
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        setInitFlag(_initFlag);
+    }
+
+    /**
+     * Returns a pointer to the newly allocated algorithm that computes the profile
+     * with a copy of input objects of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Online<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Online<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Online<algorithmFPType, method> *cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Online<algorithmFPType, method>(*this);
+    }
+
+    virtual void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(_partialResult.get(), &parameter, method);
+        _res    = _result.get();
+        _pres   = _partialResult.get();
+    }
+
+    virtual void allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->allocate<algorithmFPType>(_in, &parameter, method);
+        _pres   = _partialResult.get();
+    }
+
+    virtual void initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->initialize(_in, &parameter, method);
+    }
+
+    void initialize()
+    {
+        Analysis<online>::_ac = new __DAAL_ALGORITHM_CONTAINER(online, OnlineContainer, algorithmFPType, method)(&_env);
+        _in     = &input;
+        _par    = &parameter;
+        _result = services::SharedPtr<Result>(new Result());
+        _partialResult = services::SharedPtr<PartialResult>(new PartialResult());
+    }
+
+private:
+    services::SharedPtr<PartialResult> _partialResult;
+    services::SharedPtr<Result> _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::OnlineContainer;
+using interface1::Online;
+
+} // namespace daal::algorithms::profile
+}
+}
+#endif
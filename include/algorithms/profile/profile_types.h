@@ -0,0 +1,473 @@
+/* file: profile_types.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Definition of common types of the profile algorithm.
+//--
+*/
+
+#ifndef __PROFILE_TYPES_H__
+#define __PROFILE_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/data_collection.h"
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+/**
+* @defgroup profile Profile
+* \copydoc daal::algorithms::profile
+* @ingroup analysis
+* @{
+*/
+/**
+ * \brief Contains classes to compute the statistics of the features in a single pass over the data set:
+ *        the minimum and maximum, the low order moments, the covariance matrix and the quantiles
+ */
+namespace profile
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__PROFILE__METHOD"></a>
+ * Available methods for the profile computation
+ */
+enum Method
+{
+    defaultDense = 0    /*!< Default: single pass over the blocks of observations of the dense data set.
+                             The quantiles are approximated with the mergeable quantile sketch */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__PROFILE__RESULTTOCOMPUTEID"></a>
+ * Available identifiers of the statistics computed by the profile algorithm
+ */
+enum ResultToComputeId
+{
+    computeMinMax     = 0x00000001ULL, /*!< Compute the minimum and maximum of every feature */
+    computeMoments    = 0x00000002ULL, /*!< Compute the sum, mean, variance and standard deviation of every feature */
+    computeCovariance = 0x00000004ULL, /*!< Compute the covariance matrix of the features */
+    computeQuantiles  = 0x00000008ULL, /*!< Compute the approximate quantiles of every feature */
+    computeAll        = 0x0000000FULL  /*!< Compute all statistics */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__PROFILE__INPUTID"></a>
+ * Available identifiers of input objects for the profile algorithm
+ */
+enum InputId
+{
+    data = 0            /*!< %Input data table */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__PROFILE__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the profile algorithm.
+ * Only the partial results required by the requested statistics are allocated
+ */
+enum PartialResultId
+{
+    nObservations             = 0,  /*!< Number of observations processed so far */
+    partialMinimum            = 1,  /*!< Minimum of every feature */
+    partialMaximum            = 2,  /*!< Maximum of every feature */
+    partialSum                = 3,  /*!< Sum of every feature */
+    partialSumSquaresCentered = 4,  /*!< Sum of squared differences from the mean of every feature */
+    partialCrossProduct       = 5,  /*!< Cross product of the features centered at their means */
+    sketchItems               = 6,  /*!< Items of the quantile sketches, one row per feature */
+    sketchLevels              = 7   /*!< Boundaries of the levels of the quantile sketches, one row per feature */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__PROFILE__RESULTID"></a>
+ * Available identifiers of results of the profile algorithm.
+ * Only the results that correspond to the requested statistics are allocated
+ */
+enum ResultId
+{
+    minimum           = 0,  /*!< Minimum of every feature */
+    maximum           = 1,  /*!< Maximum of every feature */
+    sum               = 2,  /*!< Sum of every feature */
+    mean              = 3,  /*!< Mean of every feature */
+    variance          = 4,  /*!< Variance of every feature */
+    standardDeviation = 5,  /*!< Standard deviation of every feature */
+    covariance        = 6,  /*!< Covariance matrix of the features */
+    quantiles         = 7   /*!< Quantiles of every feature, one row per feature */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__PROFILE__MASTERINPUTID"></a>
+ * Available identifiers of input objects for the profile algorithm on the second step in the distributed processing mode
+ */
+enum MasterInputId
+{
+    partialResults = 0  /*!< Collection of partial results computed on local nodes */
+};
+
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__PROFILE__PARAMETER"></a>
+ * \brief Parameters of the profile algorithm
+ *
+ * \snippet profile/profile_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    /**
+     *  Main constructor
+     *  \param[in] resultsToCompute 64 bit integer flag that indicates the statistics to compute, \ref ResultToComputeId
+     *  \param[in] quantileOrders   Numeric table of size 1 x nOrders with the orders of the quantiles
+     *  \param[in] epsilon          Bound of the rank error of the quantiles relative to the number of observations
+     */
+    Parameter(DAAL_UINT64 resultsToCompute = computeAll,
+              const data_management::NumericTablePtr quantileOrders = data_management::NumericTablePtr(), double epsilon = 0.01);
+
+    DAAL_UINT64 resultsToCompute;                       /*!< 64 bit integer flag that indicates the statistics to compute */
+    data_management::NumericTablePtr quantileOrders;    /*!< Numeric table with quantile orders. Default value is 0.5 (median) */
+    double epsilon;                                     /*!< Bound of the rank error of the quantiles relative to the number of observations.
+                                                             The sketch size is inversely proportional to epsilon */
+
+    /**
+     * Checks the parameters of the profile algorithm
+     */
+    void check() const DAAL_C11_OVERRIDE;
+};
+/* [Parameter source code] */
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PROFILE__INPUTIFACE"></a>
+ * \brief Abstract class that specifies interface for classes that declare input of the profile algorithm
+ */
+class InputIface : public daal::algorithms::Input
+{
+public:
+    InputIface(size_t nElements) : daal::algorithms::Input(nElements) {}
+    virtual ~InputIface() {}
+
+    /**
+     * Returns the number of features in the input data set
+     * \return Number of features
+     */
+    virtual size_t getNumberOfColumns() const = 0;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PROFILE__INPUT"></a>
+ * \brief %Input objects for the profile algorithm
+ */
+class DAAL_EXPORT Input : public InputIface
+{
+public:
+    Input();
+
+    virtual ~Input() {}
+
+    /**
+     * Returns the number of features in the input data set
+     * \return Number of features
+     */
+    size_t getNumberOfColumns() const DAAL_C11_OVERRIDE;
+
+    /**
+     * Returns an input object for the profile algorithm
+     * \param[in] id    Identifier of the %input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(InputId id) const;
+
+    /**
+     * Sets the input object of the profile algorithm
+     * \param[in] id    Identifier of the %input object
+     * \param[in] ptr   Pointer to the input object
+     */
+    void set(InputId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Checks the correctness of the %Input object
+     * \param[in] parameter Pointer to the parameters structure
+     * \param[in] method    Algorithm computation method
+     */
+    void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PROFILE__PARTIALRESULT"></a>
+ * \brief Provides methods to access the partial results of the profile algorithm
+ *        in the online and distributed processing modes
+ *
+ * The sums of squares and the cross product are centered at the means of the processed observations,
+ * so the partial results are merged without the loss of precision. Only the lower triangle of the
+ * cross product is updated by the algorithm, the upper triangle is filled by the symmetry
+ * when the partial result is computed.
+ * The quantile sketches have the same layout as the sketches of the quantiles::sketchDense method.
+ */
+class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE();
+    DAAL_CAST_OPERATOR(PartialResult);
+
+    PartialResult();
+
+    virtual ~PartialResult() {}
+
+    /**
+     * Allocates memory to store the partial results of the profile algorithm
+     * \param[in] input     Input objects for the profile algorithm
+     * \param[in] parameter Parameters of the profile algorithm
+     * \param[in] method    Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Initializes the partial results that correspond to the empty set of observations
+     * \param[in] input     Input objects for the profile algorithm
+     * \param[in] parameter Parameters of the profile algorithm
+     * \param[in] method    Algorithm computation method
+     */
+    void initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns the number of features in the input data set
+     * \return Number of features
+     */
+    size_t getNumberOfColumns() const;
+
+    /**
+     * Returns the partial result of the profile algorithm
+     * \param[in] id   Identifier of the partial result, \ref PartialResultId
+     * \return         Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(PartialResultId id) const;
+
+    /**
+     * Sets the partial result of the profile algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(PartialResultId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Checks the correctness of the partial result
+     * \param[in] input     Pointer to the input objects
+     * \param[in] parameter Pointer to the parameters structure
+     * \param[in] method    Algorithm computation method
+     */
+    void check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the correctness of the partial result
+     * \param[in] parameter Pointer to the parameters structure
+     * \param[in] method    Algorithm computation method
+     */
+    void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the correctness of the partial result
+     * \param[in] nFeatures         Number of features
+     * \param[in] resultsToCompute  64 bit integer flag that indicates the statistics to compute
+     * \param[in] errors            Collection the detected errors are added to
+     */
+    bool checkImpl(size_t nFeatures, DAAL_UINT64 resultsToCompute, services::ErrorCollection *errors) const;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+};
+typedef services::SharedPtr<PartialResult> PartialResultPtr;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PROFILE__RESULT"></a>
+ * \brief Provides methods to access final results obtained with the compute() method of the
+ *        profile algorithm in the batch processing mode or finalizeCompute() method in the online
+ *        and distributed processing modes
+ */
+class DAAL_EXPORT Result : public daal::algorithms::Result
+{
+public:
+    DECLARE_SERIALIZABLE();
+    Result();
+
+    virtual ~Result() {};
+
+    /**
+     * Allocates memory to store final results of the profile algorithm
+     * \param[in] input     Input objects for the profile algorithm
+     * \param[in] parameter Parameters of the profile algorithm
+     * \param[in] method    Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Allocates memory to store final results of the profile algorithm in the online and distributed processing modes
+     * \param[in] partialResult Partial results of the profile algorithm
+     * \param[in] parameter     Parameters of the profile algorithm
+     * \param[in] method        Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT void allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter,
+                              const int method);
+
+    /**
+     * Returns the final result of the profile algorithm
+     * \param[in] id   Identifier of the final result, \ref ResultId
+     * \return         Final result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultId id) const;
+
+    /**
+     * Sets the Result object of the profile algorithm
+     * \param[in] id        Identifier of the Result object
+     * \param[in] value     Pointer to the Result object
+     */
+    void set(ResultId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Checks the correctness of the Result object
+     * \param[in] in     Pointer to the object
+     * \param[in] par    Pointer to the parameters structure
+     * \param[in] method Algorithm computation method
+     */
+    void check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the correctness of the Result object in the online and distributed processing modes
+     * \param[in] pres   Pointer to the partial results
+     * \param[in] par    Pointer to the parameters structure
+     * \param[in] method Algorithm computation method
+     */
+    void check(const daal::algorithms::PartialResult *pres, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    template <typename algorithmFPType>
+    void allocateImpl(size_t nFeatures, const Parameter *parameter);
+
+    void checkImpl(size_t nFeatures, const Parameter *parameter) const;
+
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+};
+typedef services::SharedPtr<Result> ResultPtr;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PROFILE__DISTRIBUTEDINPUT"></a>
+ * \brief %Input objects for the profile algorithm in the distributed processing mode
+ */
+template<ComputeStep step>
+class DistributedInput {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PROFILE__DISTRIBUTEDINPUT_STEP1LOCAL"></a>
+ * \brief %Input objects for the profile algorithm on the first step in the distributed processing mode
+ */
+template<>
+class DAAL_EXPORT DistributedInput<step1Local> : public Input
+{
+public:
+    DistributedInput() : Input() {}
+    virtual ~DistributedInput() {}
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PROFILE__DISTRIBUTEDINPUT_STEP2MASTER"></a>
+ * \brief %Input objects for the profile algorithm on the second step in the distributed processing mode
+ */
+template<>
+class DAAL_EXPORT DistributedInput<step2Master> : public InputIface
+{
+public:
+    DistributedInput();
+    virtual ~DistributedInput() {}
+
+    /**
+     * Returns the number of features in the input data set
+     * \return Number of features
+     */
+    size_t getNumberOfColumns() const DAAL_C11_OVERRIDE;
+
+    /**
+     * Adds the partial result computed on a local node to the collection of input objects
+     * \param[in] id            Identifier of the input object
+     * \param[in] partialResult Partial result of the first step
+     */
+    void add(MasterInputId id, const services::SharedPtr<PartialResult> &partialResult);
+
+    /**
+     * Sets the collection of input objects
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the collection of partial results
+     */
+    void set(MasterInputId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Returns the collection of input objects
+     * \param[in] id    Identifier of the input object
+     * \return          Collection of partial results
+     */
+    data_management::DataCollectionPtr get(MasterInputId id) const;
+
+    /**
+     * Checks the correctness of the input objects
+     * \param[in] parameter Pointer to the parameters structure
+     * \param[in] method    Algorithm computation method
+     */
+    void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+};
+/** @} */
+} // namespace interface1
+using interface1::Parameter;
+using interface1::InputIface;
+using interface1::Input;
+using interface1::PartialResult;
+using interface1::PartialResultPtr;
+using interface1::Result;
+using interface1::ResultPtr;
+using interface1::DistributedInput;
+
+} // namespace daal::algorithms::profile
+} // namespace daal::algorithms
+} // namespace daal
+#endif
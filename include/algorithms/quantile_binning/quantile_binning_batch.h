@@ -0,0 +1,182 @@
+/* file: quantile_binning_batch.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the quantile binning algorithm in the batch processing mode
+//--
+*/
+
+#ifndef __QUANTILE_BINNING_BATCH_H__
+#define __QUANTILE_BINNING_BATCH_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/quantile_binning/quantile_binning_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantile_binning
+{
+
+namespace interface1
+{
+/**
+ * @defgroup quantile_binning_batch Batch
+ * @ingroup quantile_binning
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILE_BINNING__BATCHCONTAINER"></a>
+ * \brief Provides methods to run implementations of the quantile binning algorithm.
+ *        It is associated with the daal::algorithms::quantile_binning::Batch class
+ *        and supports methods of the quantile binning in the batch processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the quantile binning algorithm, double or float
+ * \tparam method           Computation method of the quantile binning algorithm, \ref daal::algorithms::quantile_binning::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT BatchContainer : public daal::algorithms::AnalysisContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for the quantile binning algorithm with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~BatchContainer();
+    /**
+     * Computes the result of the quantile binning algorithm in the batch processing mode
+     */
+    virtual void compute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILE_BINNING__BATCH"></a>
+ * \brief Computes the bin borders of the features from their quantiles and replaces the values of the features
+ *        with the indices of the bins in the batch processing mode.
+ * \n<a href="DAAL-REF-QUANTILE_BINNING-ALGORITHM">Quantile binning algorithm description and usage models</a>
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the quantile binning algorithm, double or float
+ * \tparam method           Computation method of the quantile binning algorithm, \ref daal::algorithms::quantile_binning::Method
+ *
+ * \par Enumerations
+ *      - \ref Method   Computation methods of the quantile binning algorithm
+ *      - \ref InputId  Identifiers of input objects of the quantile binning algorithm
+ *      - \ref ResultId Identifiers of results of the quantile binning algorithm
+ */
+template<typename algorithmFPType = double, Method method = defaultDense>
+class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
+{
+public:
+    Input input;                    /*!< %Input data structure */
+    Parameter parameter;            /*!< Parameters of the quantile binning algorithm */
+
+    /** Default constructor */
+    Batch()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs the quantile binning algorithm by copying input objects and parameters
+     * of another quantile binning algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> &other)
+    {
+        initialize();
+        input.set(data, other.input.get(data));
+        input.set(inputBinBorders, other.input.get(inputBinBorders));
+        parameter = other.parameter;
+    }
+
+    virtual ~Batch() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains the results of the quantile binning algorithm
+     * \return Structure that contains the results of the quantile binning algorithm
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store the results of the quantile binning algorithm
+     * \param[in] result Structure to store the results of the quantile binning algorithm
+     */
+    void setResult(const services::SharedPtr<Result> &result)
+    {
+        DAAL_CHECK(result, ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated quantile binning algorithm
+     * with a copy of input objects and parameters of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Batch<algorithmFPType, method>(*this);
+    }
+
+    virtual void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(&input, &parameter, method);
+        _res = _result.get();
+    }
+
+    void initialize()
+    {
+        Analysis<batch>::_ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = &parameter;
+        _result = services::SharedPtr<Result>(new Result());
+    }
+
+    services::SharedPtr<Result> _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::BatchContainer;
+using interface1::Batch;
+
+} // namespace daal::algorithms::quantile_binning
+} // namespace daal::algorithms
+} // namespace daal
+#endif
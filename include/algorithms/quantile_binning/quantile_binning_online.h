@@ -0,0 +1,224 @@
+/* file: quantile_binning_online.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the quantile binning algorithm in the
+//  online processing mode
+//--
+*/
+
+#ifndef __QUANTILE_BINNING_ONLINE_H__
+#define __QUANTILE_BINNING_ONLINE_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/quantile_binning/quantile_binning_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantile_binning
+{
+
+namespace interface1
+{
+/**
+ * @defgroup quantile_binning_online Online
+ * @ingroup quantile_binning
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILE_BINNING__ONLINECONTAINER"></a>
+ * \brief Provides methods to run implementations of the quantile binning algorithm.
+ *        This class is associated with daal::algorithms::quantile_binning::Online class
+
+ *
+ * \tparam method           Computation method of the quantile binning algorithm, \ref daal::algorithms::quantile_binning::Method
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the quantile binning algorithm, double or float
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT OnlineContainer : public daal::algorithms::AnalysisContainerIface<online>
+{
+public:
+    /**
+     * Constructs a container for the quantile binning algorithm with a specified environment
+     * in the online processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    OnlineContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~OnlineContainer();
+    /**
+     * Computes a partial result of the quantile binning algorithm
+     * in the online processing mode
+     */
+    virtual void compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the result of the quantile binning algorithm
+     * in the online processing mode
+     */
+    virtual void finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILE_BINNING__ONLINE"></a>
+ * \brief Computes the bin borders of the features from the quantile sketches updated with the blocks of the data set
+ *        in the online processing mode. The blocks are replaced with the indices of the bins by the Batch algorithm
+ *        with the computed borders set as the inputBinBorders input.
+ * \n<a href="DAAL-REF-QUANTILE_BINNING-ALGORITHM">Quantile binning algorithm description and usage models</a>
+ *
+ * \tparam method           Computation method of the quantile binning algorithm, \ref daal::algorithms::quantile_binning::Method
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the quantile binning algorithm, double or float
+ *
+ * \par Enumerations
+ *      - \ref Method           Computation methods of the quantile binning algorithm
+ *      - \ref InputId          Identifiers of input objects of the quantile binning algorithm
+ *      - \ref PartialResultId  Identifiers of partial results of the quantile binning algorithm
+ *      - \ref ResultId         Identifiers of results of the quantile binning algorithm
+ */
+template<typename algorithmFPType = double, Method method = sketchDense>
+class DAAL_EXPORT Online : public daal::algorithms::Analysis<online>
+{
+public:
+    Input input;            /*!< %Input data structure */
+    Parameter parameter;    /*!< %Parameters structure */
+
+    /** Default constructor */
+    Online()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs an algorithm that computes the bin borders by copying input objects and parameters
+     * of another algorithm that computes the bin borders
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Online(const Online<algorithmFPType, method> &other)
+    {
+        initialize();
+        input.set(data,  other.input.get(data));
+        parameter = other.parameter;
+    }
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains the results of the quantile binning algorithm
+     * \return Structure that contains the results
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store final results of the quantile binning algorithm
+     * \param[in] result    Structure for storing the results of the quantile binning algorithm
+     */
+    void setResult(const services::SharedPtr<Result> &result)
+    {
+        DAAL_CHECK(result, ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains partial results of the quantile binning algorithm
+     * \return Structure that contains partial results
+     */
+    services::SharedPtr<PartialResult> getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store partial results of the quantile binning algorithm
+     * \param[in] partialResult    Structure for storing partial results of the quantile binning algorithm
+     * \param[in] _initFlag        Flag that specifies whether the partial results are initialized
+     */
+    void setPartialResult(const services::SharedPtr<PartialResult> &partialResult, bool _initFlag = false)
+    {
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        setInitFlag(_initFlag);
+    }
+
+    /**
+     * Returns a pointer to the newly allocated algorithm that computes the bin borders
+     * with a copy of input objects of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Online<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Online<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Online<algorithmFPType, method> *cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Online<algorithmFPType, method>(*this);
+    }
+
+    virtual void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(_partialResult.get(), &parameter, method);
+        _res    = _result.get();
+        _pres   = _partialResult.get();
+    }
+
+    virtual void allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->allocate<algorithmFPType>(_in, &parameter, method);
+        _pres   = _partialResult.get();
+    }
+
+    virtual void initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->initialize(_in, &parameter, method);
+    }
+
+    void initialize()
+    {
+        Analysis<online>::_ac = new __DAAL_ALGORITHM_CONTAINER(online, OnlineContainer, algorithmFPType, method)(&_env);
+        _in     = &input;
+        _par    = &parameter;
+        _result = services::SharedPtr<Result>(new Result());
+        _partialResult = services::SharedPtr<PartialResult>(new PartialResult());
+    }
+
+private:
+    services::SharedPtr<PartialResult> _partialResult;
+    services::SharedPtr<Result> _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::OnlineContainer;
+using interface1::Online;
+
+} // namespace daal::algorithms::quantile_binning
+}
+}
+#endif
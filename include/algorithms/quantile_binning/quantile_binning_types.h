@@ -0,0 +1,347 @@
+/* file: quantile_binning_types.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Definition of common types of the quantile binning algorithm.
+//--
+*/
+
+#ifndef __QUANTILE_BINNING_TYPES_H__
+#define __QUANTILE_BINNING_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+/**
+* @defgroup quantile_binning Quantile Binning
+* \copydoc daal::algorithms::quantile_binning
+* @ingroup analysis
+* @{
+*/
+/**
+ * \brief Contains classes to discretize the features by replacing their values with the indices of the bins
+ *        bounded by the quantiles of the features
+ */
+namespace quantile_binning
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__QUANTILE_BINNING__METHOD"></a>
+ * Available methods for the quantile binning
+ */
+enum Method
+{
+    defaultDense = 0,   /*!< Default: the bin borders are the exact quantiles of the sorted values of every feature.
+                             Supports the batch processing mode */
+    sketchDense  = 1    /*!< The bin borders are the approximate quantiles computed from the mergeable quantile sketch of every feature.
+                             Supports the batch and online processing modes */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__QUANTILE_BINNING__INPUTID"></a>
+ * Available identifiers of input objects for the quantile binning algorithm
+ */
+enum InputId
+{
+    data            = 0,    /*!< %Input data table */
+    inputBinBorders = 1     /*!< Optional bin borders of size nFeatures x (maxBins - 1) computed earlier, for example,
+                                 by the algorithm in the online processing mode. If set, the borders are not computed
+                                 and the batch algorithm only replaces the values with the indices of the bins */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__QUANTILE_BINNING__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the quantile binning algorithm
+ */
+enum PartialResultId
+{
+    nObservations = 0,  /*!< Number of observations processed so far */
+    sketchItems   = 1,  /*!< Items of the quantile sketches, one row per feature */
+    sketchLevels  = 2   /*!< Boundaries of the levels of the quantile sketches, one row per feature */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__QUANTILE_BINNING__RESULTID"></a>
+ * Available identifiers of results of the quantile binning algorithm
+ */
+enum ResultId
+{
+    binBorders = 0,     /*!< Upper borders of the bins of every feature except the last bin, which is not bounded,
+                             numeric table of size nFeatures x (maxBins - 1). The borders of the feature are sorted
+                             in the ascending order, the unused entries are equal to the largest value of the floating-point type */
+    binnedData = 1      /*!< Indices of the bins of the values of the input data set, numeric table of size nObservations x nFeatures.
+                             The table stores unsigned char values if maxBins does not exceed 256 and unsigned short values otherwise.
+                             Computed in the batch processing mode only */
+};
+
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__QUANTILE_BINNING__PARAMETER"></a>
+ * \brief Parameters of the quantile binning algorithm
+ *
+ * The value x of the feature falls into the bin b equal to the number of the borders of the feature that are less than x,
+ * so the bin b holds the values greater than the border b - 1 and not greater than the border b. The values equal to NaN
+ * fall into the first bin and are skipped by the defaultDense method when the borders are computed. If the feature has
+ * not more distinct values than maxBins, every distinct value gets its own bin.
+ *
+ * \snippet quantile_binning/quantile_binning_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    /**
+     *  Main constructor
+     *  \param[in] maxBins  Maximal number of bins of every feature
+     *  \param[in] epsilon  Bound of the rank error of the bin borders computed by the sketchDense method
+     */
+    Parameter(size_t maxBins = 256, double epsilon = 0.001);
+
+    size_t maxBins;     /*!< Maximal number of bins of every feature, from 2 to 65536 */
+    double epsilon;     /*!< Bound of the rank error of the bin borders computed by the sketchDense method relative to the number
+                             of observations. The sketch size is inversely proportional to epsilon */
+
+    /**
+     * Checks the parameters of the quantile binning algorithm
+     */
+    void check() const DAAL_C11_OVERRIDE;
+};
+/* [Parameter source code] */
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILE_BINNING__INPUT"></a>
+ * \brief %Input objects for the quantile binning algorithm
+ */
+class DAAL_EXPORT Input : public daal::algorithms::Input
+{
+public:
+    Input();
+
+    virtual ~Input() {}
+
+    /**
+     * Returns the number of features in the input data set
+     * \return Number of features
+     */
+    size_t getNumberOfColumns() const;
+
+    /**
+     * Returns an input object for the quantile binning algorithm
+     * \param[in] id    Identifier of the %input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(InputId id) const;
+
+    /**
+     * Sets the input object of the quantile binning algorithm
+     * \param[in] id    Identifier of the %input object
+     * \param[in] ptr   Pointer to the input object
+     */
+    void set(InputId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Checks the correctness of the %Input object
+     * \param[in] parameter Pointer to the parameters structure
+     * \param[in] method    Algorithm computation method
+     */
+    void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILE_BINNING__PARTIALRESULT"></a>
+ * \brief Provides methods to access the quantile sketches computed with the sketchDense method
+ *        in the online processing mode
+ *
+ * The quantile sketches have the same layout as the sketches of the quantiles::sketchDense method.
+ */
+class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE();
+    DAAL_CAST_OPERATOR(PartialResult);
+
+    PartialResult();
+
+    virtual ~PartialResult() {}
+
+    /**
+     * Allocates memory to store the partial results of the quantile binning algorithm
+     * \param[in] input     Input objects for the quantile binning algorithm
+     * \param[in] parameter Parameters of the quantile binning algorithm
+     * \param[in] method    Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Initializes the partial results with the empty sketches
+     * \param[in] input     Input objects for the quantile binning algorithm
+     * \param[in] parameter Parameters of the quantile binning algorithm
+     * \param[in] method    Algorithm computation method
+     */
+    void initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns the number of features in the input data set
+     * \return Number of features
+     */
+    size_t getNumberOfColumns() const;
+
+    /**
+     * Returns the partial result of the quantile binning algorithm
+     * \param[in] id   Identifier of the partial result, \ref PartialResultId
+     * \return         Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(PartialResultId id) const;
+
+    /**
+     * Sets the partial result of the quantile binning algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(PartialResultId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Checks the correctness of the partial result
+     * \param[in] input     Pointer to the input objects
+     * \param[in] parameter Pointer to the parameters structure
+     * \param[in] method    Algorithm computation method
+     */
+    void check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the correctness of the partial result
+     * \param[in] parameter Pointer to the parameters structure
+     * \param[in] method    Algorithm computation method
+     */
+    void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+};
+typedef services::SharedPtr<PartialResult> PartialResultPtr;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILE_BINNING__RESULT"></a>
+ * \brief Provides methods to access final results obtained with the compute() method of the
+ *        quantile binning algorithm in the batch processing mode or finalizeCompute() method
+ *        in the online processing mode
+ */
+class DAAL_EXPORT Result : public daal::algorithms::Result
+{
+public:
+    DECLARE_SERIALIZABLE();
+    Result();
+
+    virtual ~Result() {};
+
+    /**
+     * Allocates memory to store final results of the quantile binning algorithm
+     * \param[in] input     Input objects for the quantile binning algorithm
+     * \param[in] parameter Parameters of the quantile binning algorithm
+     * \param[in] method    Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Allocates memory to store final results of the quantile binning algorithm in the online processing mode
+     * \param[in] partialResult Partial results of the quantile binning algorithm
+     * \param[in] parameter     Parameters of the quantile binning algorithm
+     * \param[in] method        Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT void allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter,
+                              const int method);
+
+    /**
+     * Returns the final result of the quantile binning algorithm
+     * \param[in] id   Identifier of the final result, \ref ResultId
+     * \return         Final result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(ResultId id) const;
+
+    /**
+     * Sets the Result object of the quantile binning algorithm
+     * \param[in] id        Identifier of the Result object
+     * \param[in] value     Pointer to the Result object
+     */
+    void set(ResultId id, const data_management::NumericTablePtr &value);
+
+    /**
+     * Checks the correctness of the Result object
+     * \param[in] in     Pointer to the object
+     * \param[in] par    Pointer to the parameters structure
+     * \param[in] method Algorithm computation method
+     */
+    void check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the correctness of the Result object in the online processing mode
+     * \param[in] pres   Pointer to the partial results
+     * \param[in] par    Pointer to the parameters structure
+     * \param[in] method Algorithm computation method
+     */
+    void check(const daal::algorithms::PartialResult *pres, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+};
+typedef services::SharedPtr<Result> ResultPtr;
+/** @} */
+} // namespace interface1
+using interface1::Parameter;
+using interface1::Input;
+using interface1::PartialResult;
+using interface1::PartialResultPtr;
+using interface1::Result;
+using interface1::ResultPtr;
+
+} // namespace daal::algorithms::quantile_binning
+} // namespace daal::algorithms
+} // namespace daal
+#endif
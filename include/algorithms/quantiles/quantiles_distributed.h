@@ -0,0 +1,429 @@
+/* file: quantiles_distributed.h */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the quantiles algorithm in the
+//  distributed processing mode
+//--
+*/
+
+#ifndef __QUANTILES_DISTRIBUTED_H__
+#define __QUANTILES_DISTRIBUTED_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/quantiles/quantiles_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+
+namespace interface1
+{
+/**
+ * @defgroup quantiles_distributed Distributed
+ * @ingroup quantiles
+ * @{
+ */
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTEDCONTAINER_STEP_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Provides methods to run implementations of the quantiles algorithm in the distributed processing mode.
+ *        This class is associated with daal::algorithms::quantiles::Distributed class
+ *
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations of quantiles, double or float
+ * \tparam method           Computation method, \ref daal::algorithms::quantiles::Method
+ *
+ */
+template<ComputeStep step, typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer
+{};
+
+/**
+ * \brief Provides methods to run implementations of the first step of the quantiles algorithm
+ *        in the distributed processing mode.
+ *        This class is associated with daal::algorithms::quantiles::Distributed class.
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of quantiles, double or float
+ * \tparam method           Computation method, \ref daal::algorithms::quantiles::Method
+ *
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step1Local, algorithmFPType, method, cpu> :
+    public daal::algorithms::AnalysisContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for the quantiles algorithm with a specified environment
+     * in the first step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~DistributedContainer();
+    /**
+     * Computes a partial result of the quantiles algorithm
+     * in the first step of the distributed processing mode
+     */
+    virtual void compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the result of the quantiles algorithm
+     * in the first step of the distributed processing mode
+     */
+    virtual void finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * \brief Provides methods to run implementations of the second step of the quantiles algorithm
+ *        in the distributed processing mode.
+ *        This class is associated with daal::algorithms::quantiles::Distributed class
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of quantiles, double or float
+ * \tparam method           Computation method, \ref daal::algorithms::quantiles::Method
+ *
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step2Master, algorithmFPType, method, cpu> :
+    public daal::algorithms::AnalysisContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for the quantiles algorithm with a specified environment
+     * in the second step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~DistributedContainer();
+    /**
+     * Computes a partial result of the quantiles algorithm
+     * in the second step of the distributed processing mode
+     */
+    virtual void compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the result of the quantiles algorithm
+     * in the second step of the distributed processing mode
+     */
+    virtual void finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTED"></a>
+ * \brief Computes approximate values of quantiles in the distributed processing mode.
+ * \n<a href="DAAL-REF-QUANTILES-ALGORITHM">Quantiles algorithm description and usage models</a>
+ *
+ * \tparam step            Step of distributed processing, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations of quantiles, double or float
+ * \tparam method           Computation method, \ref daal::algorithms::quantiles::Method
+ *
+ * \par Enumerations
+ *      - \ref Method           Computation methods for the quantiles algorithm
+ *      - \ref InputId          Identifiers of input objects for the quantiles algorithm
+ *      - \ref PartialResultId  Identifiers of partial results of the quantiles algorithm
+ *      - \ref ResultId         Identifiers of the results of the quantiles algorithm
+ * \par References
+ *      - Input class
+ *      - PartialResult class
+ *      - Result class
+ */
+template<ComputeStep step, typename algorithmFPType = double, Method method = sketchDense>
+class DAAL_EXPORT Distributed : public daal::algorithms::Analysis<distributed> {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTED_STEP1LOCAL_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Computes the result of the first step of the quantiles algorithm
+ *        in the distributed processing mode.
+ * \n<a href="DAAL-REF-QUANTILES-ALGORITHM">Quantiles algorithm description and usage models</a>
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of quantiles, double or float
+ * \tparam method           Computation method, \ref daal::algorithms::quantiles::Method
+ *
+ * \par Enumerations
+ *      - \ref Method           Computation methods for the quantiles algorithm
+ *      - \ref InputId          Identifiers of input objects for the quantiles algorithm
+ *      - \ref PartialResultId  Identifiers of partial results of the quantiles algorithm
+ *      - \ref ResultId         Identifiers of the results of the quantiles algorithm
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step1Local, algorithmFPType, method> : public daal::algorithms::Analysis<distributed>
+{
+public:
+    DistributedInput<step1Local> input;  /*!< Input data structure */
+    Parameter parameter;                 /*!< %Parameters structure */
+
+    /** Default constructor */
+    Distributed()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs an algorithm that computes quantiles by copying input objects
+     * of another algorithm that computes quantiles
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step1Local, algorithmFPType, method> &other)
+    {
+        initialize();
+        parameter = other.parameter;
+        input.set(data,  other.input.get(data));
+    }
+
+    /**
+     * Returns method of the algorithm
+     * \return Method of the algorithm
+     */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns structure that contains final results of the quantiles algorithm
+     * \return Structure that contains final results of the quantiles algorithm
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store final results of the quantiles algorithm
+     * \param[in] result    Structure for storing the results of the quantiles algorithm
+     */
+    void setResult(const services::SharedPtr<Result> &result)
+    {
+        DAAL_CHECK(result, ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains partial results of the quantiles algorithm
+     * \return Structure that contains partial results
+     */
+    services::SharedPtr<PartialResult> getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store partial results of the quantiles algorithm
+     * \param[in] partialResult    Structure for storing partial results of the quantiles algorithm
+     * \param[in] initFlag         Flag that specifies whether the partial results are initialized
+     */
+    void setPartialResult(const services::SharedPtr<PartialResult> &partialResult, bool initFlag = false)
+    {
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        setInitFlag(initFlag);
+    }
+
+    /**
+     * Returns a pointer to the newly allocated algorithm that computes quantiles
+     * with a copy of input objects of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step1Local, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step1Local, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step1Local, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step1Local, algorithmFPType, method>(*this);
+    }
+
+    virtual void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(_pres, &parameter, method);
+        _res    = _result.get();
+    }
+
+    virtual void allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->allocate<algorithmFPType>(_in, &parameter, method);
+        _pres   = _partialResult.get();
+    }
+
+    virtual void initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->initialize(_in, &parameter, method);
+    }
+
+    void initialize()
+    {
+        Analysis<distributed>::_ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step1Local, algorithmFPType, method)(&_env);
+        _in = &input;
+        _par = &parameter;
+        _result = services::SharedPtr<Result>(new Result());
+        _partialResult = services::SharedPtr<PartialResult>(new PartialResult());
+    }
+
+private:
+    services::SharedPtr<PartialResult> _partialResult;
+    services::SharedPtr<Result> _result;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTED_STEP2MASTER_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Computes the result of the second step of the quantiles algorithm
+ *        in the distributed processing mode.
+ * \n<a href="DAAL-REF-QUANTILES-ALGORITHM">Quantiles algorithm description and usage models</a>
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of quantiles, double or float
+ * \tparam method           Computation method, \ref daal::algorithms::quantiles::Method
+ *
+ * \par Enumerations
+ *      - \ref Method           Computation methods for the quantiles algorithm
+ *      - \ref InputId          Identifiers of input objects for the quantiles algorithm
+ *      - \ref PartialResultId  Identifiers of partial results of the quantiles algorithm
+ *      - \ref ResultId         Identifiers of the results of the quantiles algorithm
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step2Master, algorithmFPType, method> : public daal::algorithms::Analysis<distributed>
+{
+public:
+    DistributedInput<step2Master> input;  /*!< Input data structure */
+    Parameter parameter;                  /*!< %Parameters structure */
+
+    /** Default constructor */
+    Distributed()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs an algorithm that computes quantiles by copying input objects
+     * of another algorithm that computes quantiles
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step2Master, algorithmFPType, method> &other)
+    {
+        initialize();
+        parameter = other.parameter;
+        input.set(partialResults, other.input.get(partialResults));
+    }
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns structure that contains final results of the quantiles algorithm
+     * \return Structure that contains final results of the quantiles algorithm
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store final results of the quantiles algorithm
+     * \param[in] result    Structure for storing the results of the quantiles algorithm
+     */
+    void setResult(const services::SharedPtr<Result> &result)
+    {
+        DAAL_CHECK(result, ErrorNullResult)
+        _result = result;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains partial results of the quantiles algorithm
+     * \return Structure that contains partial results
+     */
+    services::SharedPtr<PartialResult> getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store partial results of the quantiles algorithm
+     * \param[in] partialResult    Structure for storing partial results of the quantiles algorithm
+     * \param[in] initFlag         Flag that specifies whether the partial results are initialized
+     */
+    void setPartialResult(const services::SharedPtr<PartialResult> &partialResult, bool initFlag = false)
+    {
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        setInitFlag(initFlag);
+    }
+
+    /**
+     * Returns a pointer to the newly allocated algorithm that computes quantiles
+     * with a copy of input objects of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step2Master, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step2Master, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step2Master, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step2Master, algorithmFPType, method>(*this);
+    }
+
+    virtual void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(_pres, &parameter, method);
+        _res    = _result.get();
+    }
+
+    virtual void allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->allocate<algorithmFPType>(_in, &parameter, method);
+        _pres   = _partialResult.get();
+    }
+
+    virtual void initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->initialize(_in, &parameter, method);
+    }
+
+    void initialize()
+    {
+        Analysis<distributed>::_ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step2Master, algorithmFPType, method)(&_env);
+        _in = &input;
+        _par = &parameter;
+        _result = services::SharedPtr<Result>(new Result());
+        _partialResult = services::SharedPtr<PartialResult>(new PartialResult());
+    }
+
+private:
+    services::SharedPtr<PartialResult> _partialResult;
+    services::SharedPtr<Result> _result;
+};
+/** @} */
+} // namespace interface1
+using interface1::DistributedContainer;
+using interface1::Distributed;
+
+} // namespace daal::algorithms::quantiles
+}
+}
+#endif
@@ -47,7 +47,9 @@ namespace quantiles
  */
 enum Method
 {
-    defaultDense = 0    /*!< Default: performance-oriented method. Works with all types of input numeric tables */
+    defaultDense = 0,   /*!< Default: performance-oriented method. Works with all types of input numeric tables */
+    sketchDense  = 1    /*!< Approximate method based on the mergeable quantile sketch of every feature.
+                             Supports the batch, online and distributed processing modes */
 };
 
 /**
@@ -68,6 +70,27 @@ enum ResultId
     quantiles = 0       /*!< Values of quantiles */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__QUANTILES__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the quantiles algorithm
+ */
+enum PartialResultId
+{
+    nObservations = 0,  /*!< Number of observations processed so far */
+    sketchItems   = 1,  /*!< Items of the quantile sketches, one row per feature */
+    sketchLevels  = 2   /*!< Boundaries of the levels of the sketches in the rows of sketchItems
+                             followed by the number of the sketch compactions, one row per feature */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__QUANTILES__MASTERINPUTID"></a>
+ * Available identifiers of input objects for the quantiles algorithm on the second step in the distributed processing mode
+ */
+enum MasterInputId
+{
+    partialResults = 0  /*!< Collection of partial results computed on local nodes */
+};
+
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -79,21 +102,52 @@ namespace interface1
  */
 struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
 {
-    Parameter(const data_management::NumericTablePtr quantileOrders = data_management::NumericTablePtr());
+    Parameter(const data_management::NumericTablePtr quantileOrders = data_management::NumericTablePtr(), double epsilon = 0.01);
     data_management::NumericTablePtr quantileOrders;    /*!< Numeric table with quantile orders. Default value is 0.5 (median) */
+    double epsilon;                                     /*!< Bound of the rank error of the quantiles computed by the sketchDense method
+                                                             relative to the number of observations. The sketch size is inversely
+                                                             proportional to epsilon */
+
+    /**
+     * Checks the parameters of the quantiles algorithm
+     */
+    void check() const DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__INPUTIFACE"></a>
+ * \brief Abstract class that specifies interface for classes that declare input of the quantiles algorithm
+ */
+class InputIface : public daal::algorithms::Input
+{
+public:
+    InputIface(size_t nElements) : daal::algorithms::Input(nElements) {}
+    virtual ~InputIface() {}
+
+    /**
+     * Returns the number of features in the input data set
+     * \return Number of features
+     */
+    virtual size_t getNumberOfColumns() const = 0;
 };
 
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__INPUT"></a>
  * \brief %Input objects for the quantiles algorithm
  */
-class DAAL_EXPORT Input : public daal::algorithms::Input
+class DAAL_EXPORT Input : public InputIface
 {
 public:
     Input();
 
     virtual ~Input() {}
 
+    /**
+     * Returns the number of features in the input data set
+     * \return Number of features
+     */
+    size_t getNumberOfColumns() const DAAL_C11_OVERRIDE;
+
     /**
      * Returns an input object for the quantiles algorithm
      * \param[in] id    Identifier of the %input object
@@ -116,10 +170,99 @@ public:
     void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__PARTIALRESULT"></a>
+ * \brief Provides methods to access the quantile sketches computed with the sketchDense method
+ *        in the online and distributed processing modes
+ *
+ * Every row of the sketchItems table holds the sketch of one feature. The items of the level h of the sketch
+ * represent 2^h observations each, the items of every level except the level 0 are sorted.
+ * The level h occupies the columns from sketchLevels[h] to sketchLevels[h + 1] - 1 of the row,
+ * the columns before sketchLevels[0] are free.
+ */
+class DAAL_EXPORT PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DECLARE_SERIALIZABLE();
+    DAAL_CAST_OPERATOR(PartialResult);
+
+    PartialResult();
+
+    virtual ~PartialResult() {}
+
+    /**
+     * Allocates memory to store the partial results of the quantiles algorithm
+     * \param[in] input     Input objects for the quantiles algorithm
+     * \param[in] parameter Parameters of the quantiles algorithm
+     * \param[in] method    Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Initializes the partial results with the empty sketches
+     * \param[in] input     Input objects for the quantiles algorithm
+     * \param[in] parameter Parameters of the quantiles algorithm
+     * \param[in] method    Algorithm computation method
+     */
+    void initialize(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Returns the number of features in the input data set
+     * \return Number of features
+     */
+    size_t getNumberOfColumns() const;
+
+    /**
+     * Returns the partial result of the quantiles algorithm
+     * \param[in] id   Identifier of the partial result, \ref PartialResultId
+     * \return         Partial result that corresponds to the given identifier
+     */
+    data_management::NumericTablePtr get(PartialResultId id) const;
+
+    /**
+     * Sets the partial result of the quantiles algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(PartialResultId id, const data_management::NumericTablePtr &ptr);
+
+    /**
+     * Checks the correctness of the partial result
+     * \param[in] input     Pointer to the input objects
+     * \param[in] parameter Pointer to the parameters structure
+     * \param[in] method    Algorithm computation method
+     */
+    void check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+    /**
+     * Checks the correctness of the partial result
+     * \param[in] parameter Pointer to the parameters structure
+     * \param[in] method    Algorithm computation method
+     */
+    void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+};
+typedef services::SharedPtr<PartialResult> PartialResultPtr;
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__RESULT"></a>
  * \brief Provides methods to access final results obtained with the compute() method of the
- *        quantiles algorithm in the batch processing mode
+ *        quantiles algorithm in the batch processing mode or finalizeCompute() method in the online
+ *        and distributed processing modes
  */
 class DAAL_EXPORT Result : public daal::algorithms::Result
 {
@@ -138,6 +281,16 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
 
+    /**
+     * Allocates memory to store final results of the quantile algorithms in the online and distributed processing modes
+     * \param[in] partialResult Partial results of the quantiles algorithm
+     * \param[in] parameter     Parameters of the quantiles algorithm
+     * \param[in] method        Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT void allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter,
+                              const int method);
+
     /**
      * Returns the final result of the quantiles algorithm
      * \param[in] id   Identifier of the final result, \ref ResultId
@@ -160,7 +313,17 @@ public:
      */
     void check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
 
+    /**
+     * Checks the correctness of the Result object in the online and distributed processing modes
+     * \param[in] pres   Pointer to the partial results
+     * \param[in] par    Pointer to the parameters structure
+     * \param[in] method Algorithm computation method
+     */
+    void check(const daal::algorithms::PartialResult *pres, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
+
 protected:
+    void checkImpl(size_t nFeatures, const Parameter *parameter) const;
+
     /** \private */
     template<typename Archive, bool onDeserialize>
     void serialImpl(Archive *arch)
@@ -174,11 +337,80 @@ protected:
     void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
     {serialImpl<data_management::OutputDataArchive, true>(arch);}
 };
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTEDINPUT"></a>
+ * \brief %Input objects for the quantiles algorithm in the distributed processing mode
+ */
+template<ComputeStep step>
+class DistributedInput {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTEDINPUT_STEP1LOCAL"></a>
+ * \brief %Input objects for the quantiles algorithm on the first step in the distributed processing mode
+ */
+template<>
+class DAAL_EXPORT DistributedInput<step1Local> : public Input
+{
+public:
+    DistributedInput() : Input() {}
+    virtual ~DistributedInput() {}
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTEDINPUT_STEP2MASTER"></a>
+ * \brief %Input objects for the quantiles algorithm on the second step in the distributed processing mode
+ */
+template<>
+class DAAL_EXPORT DistributedInput<step2Master> : public InputIface
+{
+public:
+    DistributedInput();
+    virtual ~DistributedInput() {}
+
+    /**
+     * Returns the number of features in the input data set
+     * \return Number of features
+     */
+    size_t getNumberOfColumns() const DAAL_C11_OVERRIDE;
+
+    /**
+     * Adds the partial result computed on a local node to the collection of input objects
+     * \param[in] id            Identifier of the input object
+     * \param[in] partialResult Partial result of the first step
+     */
+    void add(MasterInputId id, const services::SharedPtr<PartialResult> &partialResult);
+
+    /**
+     * Sets the collection of input objects
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the collection of partial results
+     */
+    void set(MasterInputId id, const data_management::DataCollectionPtr &ptr);
+
+    /**
+     * Returns the collection of input objects
+     * \param[in] id    Identifier of the input object
+     * \return          Collection of partial results
+     */
+    data_management::DataCollectionPtr get(MasterInputId id) const;
+
+    /**
+     * Checks the correctness of the input objects
+     * \param[in] parameter Pointer to the parameters structure
+     * \param[in] method    Algorithm computation method
+     */
+    void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE;
+};
 /** @} */
 } // namespace interface1
 using interface1::Parameter;
+using interface1::InputIface;
 using interface1::Input;
+using interface1::PartialResult;
+using interface1::PartialResultPtr;
 using interface1::Result;
+using interface1::DistributedInput;
 
 } // namespace daal::algorithms::quantiles
 } // namespace daal::algorithms
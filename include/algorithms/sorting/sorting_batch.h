@@ -88,7 +88,8 @@ template<typename algorithmFPType = double, Method method = defaultDense>
 class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
 {
 public:
-    Input input; /*!< %input data structure */
+    Input input;            /*!< %input data structure */
+    Parameter parameter;    /*!< Sorting parameters structure */
 
     /** Default constructor     */
     Batch()
@@ -106,6 +107,7 @@ public:
     {
         initialize();
         input.set(data, other.input.get(data));
+        parameter = other.parameter;
     }
 
     virtual ~Batch() {}
@@ -154,7 +156,7 @@ protected:
 
     virtual void allocateResult() DAAL_C11_OVERRIDE
     {
-        _result->allocate<algorithmFPType>(&input, method);
+        _result->allocate<algorithmFPType>(&input, &parameter, method);
         _res = _result.get();
     }
 
@@ -162,6 +164,7 @@ protected:
     {
         Analysis<batch>::_ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
         _in  = &input;
+        _par = &parameter;
         _result = services::SharedPtr<Result>(new Result());
     }
 
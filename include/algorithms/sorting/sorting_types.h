@@ -65,7 +65,19 @@ enum InputId
  */
 enum ResultId
 {
-    sortedData = 0       /*!< observation sorting results */
+    sortedData    = 0,   /*!< observation sorting results */
+    sortedIndices = 1    /*!< Indices of the observations in the order of the sorted values of every feature */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__SORTING__RESULTTOCOMPUTEID"></a>
+ * Available identifiers to specify the results of the sorting algorithm
+ */
+enum ResultToComputeId
+{
+    computeSortedData    = 0x00000001ULL, /*!< Compute the sorted values of every feature */
+    computeSortedIndices = 0x00000002ULL  /*!< Compute the permutation of the observations that sorts every feature.
+                                               The observations with equal values keep their original order */
 };
 
 /**
@@ -73,6 +85,30 @@ enum ResultId
  */
 namespace interface1
 {
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__SORTING__PARAMETER"></a>
+ * \brief Parameters of the sorting algorithm
+ *
+ * \snippet sorting/sorting_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
+{
+    /**
+     *  Main constructor
+     *  \param[in] resultsToCompute     64 bit integer flag that indicates the results to compute, \ref ResultToComputeId
+     */
+    Parameter(DAAL_UINT64 resultsToCompute = computeSortedData) : resultsToCompute(resultsToCompute) {}
+
+    /**
+     * Checks the parameters of the sorting algorithm
+     */
+    void check() const DAAL_C11_OVERRIDE;
+
+    DAAL_UINT64 resultsToCompute;   /*!< 64 bit integer flag that indicates the results to compute */
+};
+/* [Parameter source code] */
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__SORTING__INPUT"></a>
  * \brief %Input objects for the sorting algorithm
@@ -103,7 +139,7 @@ public:
      * \param[in] method    Algorithm computation method
      * \param[in] par       Pointer to the parameters of the algorithm
      */
-    void check(const Parameter *par, int method) const DAAL_C11_OVERRIDE;
+    void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
 };
 
 /**
@@ -127,6 +163,15 @@ public:
     template <typename algorithmFPType>
     DAAL_EXPORT void allocate(const daal::algorithms::Input *input, const int method);
 
+    /**
+     * Allocates memory to store the results of the sorting algorithms specified by the parameter
+     * \param[in] input     Input objects for the sorting algorithm
+     * \param[in] parameter Parameters of the sorting algorithm
+     * \param[in] method    Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    DAAL_EXPORT void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
     /**
      * Returns the final result of the sorting algorithm
      * \param[in] id   Identifier of the final result, \ref ResultId
@@ -147,7 +192,7 @@ public:
      * \param[in] par     %Parameter of algorithm
      * \param[in] method Algorithm computation method
      */
-    void check(const daal::algorithms::Input *in, const Parameter *par, int method) const DAAL_C11_OVERRIDE;
+    void check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE;
 
 protected:
     /** \private */
@@ -165,6 +210,7 @@ protected:
 };
 /** @} */
 } // namespace interface1
+using interface1::Parameter;
 using interface1::Input;
 using interface1::Result;
 
@@ -92,7 +92,7 @@ template<typename algorithmFPType = double, Method method = defaultDense>
 class DAAL_EXPORT Batch : public weak_learner::training::Batch
 {
 public:
-    classifier::Parameter parameter;                /*!< \ref classifier::interface1::Parameter "Parameters" of the algorithm */
+    Parameter parameter;                            /*!< \ref interface1::Parameter "Parameters" of the algorithm */
 
     Batch()
     {
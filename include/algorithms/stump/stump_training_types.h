@@ -63,6 +63,29 @@ enum Method
  */
 namespace interface1
 {
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__STUMP__TRAINING__PARAMETER"></a>
+ * \brief Parameters of the decision stump training algorithm
+ *
+ * \snippet stump/stump_training_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public classifier::Parameter
+{
+    /**
+     *  Main constructor
+     *  \param[in] reuseSortedFeatures_  Flag that enables the reuse of the sorted feature values between the calls of compute()
+     */
+    Parameter(bool reuseSortedFeatures_ = false) : classifier::Parameter(2), reuseSortedFeatures(reuseSortedFeatures_) {}
+
+    bool reuseSortedFeatures;   /*!< If true, the order of the values of every feature is computed once and reused
+                                     by the next calls of compute() with the same training data set.
+                                     The flag is intended for the boosting algorithms that train the decision stump
+                                     many times on the same data with the new weights, the data set must not be
+                                     modified between the calls */
+};
+/* [Parameter source code] */
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__STUMP__TRAINING__RESULT"></a>
  * \brief Provides methods to access final results obtained with the compute() method of the decision stump training algorithm
@@ -123,6 +146,7 @@ protected:
     {serialImpl<data_management::OutputDataArchive, true>(arch);}
 };
 } // namespace interface1
+using interface1::Parameter;
 using interface1::Result;
 
 } // namespace daal::algorithms::stump::training
@@ -84,7 +84,8 @@ struct Parameter : public classifier::Parameter
     double tau;                 /*!< Tau parameter of the working set selection scheme */
     size_t maxIterations;       /*!< Maximal number of iterations for the algorithm */
     size_t cacheSize;           /*!< Size of cache in bytes to store values of the kernel matrix.
-                                     A non-zero value enables use of a cache optimization technique */
+                                     A non-zero value enables use of a cache optimization technique.
+                                     If the kernel matrix does not fit into the cache, the least recently used rows are replaced */
     bool doShrinking;           /*!< Flag that enables use of the shrinking optimization technique */
     size_t shrinkingStep;       /*!< Number of iterations between the steps of shrinking optimization technique */
     services::SharedPtr<kernel_function::KernelIface> kernel;   /*!< Kernel function */
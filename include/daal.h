@@ -60,6 +60,7 @@
 #include "algorithms/kmeans/kmeans_types.h"
 #include "algorithms/kmeans/kmeans_batch.h"
 #include "algorithms/kmeans/kmeans_distributed.h"
+#include "algorithms/kmeans/kmeans_online.h"
 #include "algorithms/kmeans/kmeans_init_types.h"
 #include "algorithms/kmeans/kmeans_init_batch.h"
 #include "algorithms/kmeans/kmeans_init_distributed.h"
@@ -134,6 +135,8 @@
 #include "algorithms/outlier_detection/outlier_detection_multivariate.h"
 #include "algorithms/outlier_detection/outlier_detection_univariate_types.h"
 #include "algorithms/outlier_detection/outlier_detection_univariate.h"
+#include "algorithms/outlier_detection/outlier_detection_univariate_online.h"
+#include "algorithms/outlier_detection/outlier_detection_univariate_distributed.h"
 #include "algorithms/multi_class_classifier/multi_class_classifier_model.h"
 #include "algorithms/multi_class_classifier/multi_class_classifier_types.h"
 #include "algorithms/multi_class_classifier/multi_class_classifier_train.h"
@@ -172,6 +175,15 @@
 #include "algorithms/boosting/boosting_training_batch.h"
 #include "algorithms/quantiles/quantiles_types.h"
 #include "algorithms/quantiles/quantiles_batch.h"
+#include "algorithms/quantiles/quantiles_online.h"
+#include "algorithms/quantiles/quantiles_distributed.h"
+#include "algorithms/profile/profile_types.h"
+#include "algorithms/profile/profile_batch.h"
+#include "algorithms/profile/profile_online.h"
+#include "algorithms/profile/profile_distributed.h"
+#include "algorithms/quantile_binning/quantile_binning_types.h"
+#include "algorithms/quantile_binning/quantile_binning_batch.h"
+#include "algorithms/quantile_binning/quantile_binning_online.h"
 #include "algorithms/implicit_als/implicit_als_model.h"
 #include "algorithms/implicit_als/implicit_als_predict_ratings_batch.h"
 #include "algorithms/implicit_als/implicit_als_predict_ratings_distributed.h"
@@ -301,6 +313,9 @@
 #include "algorithms/normalization/zscore_types.h"
 #include "algorithms/normalization/minmax.h"
 #include "algorithms/normalization/minmax_types.h"
+#include "algorithms/normalization/minmax_online.h"
+#include "algorithms/normalization/minmax_distributed.h"
+#include "algorithms/normalization/normalized_numeric_table.h"
 #include "algorithms/ridge_regression/ridge_regression_model.h"
 #include "algorithms/ridge_regression/ridge_regression_ne_model.h"
 #include "algorithms/ridge_regression/ridge_regression_predict.h"
@@ -314,5 +329,11 @@
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_predict.h"
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_training_batch.h"
 #include "algorithms/k_nearest_neighbors/kdtree_knn_classification_types.h"
+#include "algorithms/gradient_boosted_trees/gbt_model.h"
+#include "algorithms/gradient_boosted_trees/gbt_training_types.h"
+#include "algorithms/gradient_boosted_trees/gbt_training_batch.h"
+#include "algorithms/gradient_boosted_trees/gbt_predict_types.h"
+#include "algorithms/gradient_boosted_trees/gbt_predict.h"
+#include "algorithms/gradient_boosted_trees/gbt_types.h"
 
 #endif /* #ifndef __DAAL_H__ */
@@ -329,6 +329,29 @@ public:
 
         if( onDeserialize )
         {
+            /* The table restored from the archive may have the number of columns different from the constructed one */
+            freeDataMemory();
+            if( _arrays != 0 )
+            {
+                daal::services::daal_free(_arrays);
+                _arrays = NULL;
+            }
+
+            size_t ncol = _ddict->getNumberOfFeatures();
+            if( ncol != 0 )
+            {
+                _arrays = (void **)daal::services::daal_malloc(sizeof(void *)*ncol);
+                if( _arrays == 0 )
+                {
+                    this->_errors->add(services::ErrorMemoryAllocationFailed);
+                    return;
+                }
+                for(size_t i = 0; i < ncol; i++)
+                {
+                    _arrays[i] = 0;
+                }
+            }
+
             allocateDataMemory();
         }
 
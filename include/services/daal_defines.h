@@ -135,6 +135,7 @@ const int SERIALIZATION_PACKEDSYMMETRIC_NT_ID
 const int SERIALIZATION_PACKEDTRIANGULAR_NT_ID                                                 = 12000;
 const int SERIALIZATION_MERGE_NT_ID                                                            = 13000;
 const int SERIALIZATION_ROWMERGE_NT_ID                                                         = 14000;
+const int SERIALIZATION_NORMALIZED_NT_ID                                                       = 15000;
 
 const int SERIALIZATION_HOMOGEN_TENSOR_ID                                                      = 20000;
 const int SERIALIZATION_TENSOR_OFFSET_LAYOUT_ID                                                = 22000;
@@ -225,6 +226,7 @@ const int SERIALIZATION_KERNEL_FUNCTION_RESULT_ID
 
 const int SERIALIZATION_OUTLIER_DETECTION_MULTIVARIATE_RESULT_ID                               = 102200;
 const int SERIALIZATION_OUTLIER_DETECTION_UNIVARIATE_RESULT_ID                                 = 102210;
+const int SERIALIZATION_OUTLIER_DETECTION_UNIVARIATE_PARTIAL_RESULT_ID                         = 102220;
 
 const int SERIALIZATION_PIVOTED_QR_RESULT_ID                                                   = 102300;
 
@@ -234,6 +236,7 @@ const int SERIALIZATION_QR_DISTRIBUTED_PARTIAL_RESULT_ID
 const int SERIALIZATION_QR_DISTRIBUTED_PARTIAL_RESULT_STEP3_ID                                 = 102430;
 
 const int SERIALIZATION_QUANTILES_RESULT_ID                                                    = 102500;
+const int SERIALIZATION_QUANTILES_PARTIAL_RESULT_ID                                            = 102510;
 
 const int SERIALIZATION_WEAK_LEARNER_RESULT_ID                                                 = 102600;
 
@@ -261,6 +264,7 @@ const int SERIALIZATION_SGD_RESULT_ID
 
 const int SERIALIZATION_NORMALIZATION_ZSCORE_RESULT_ID                                         = 103900;
 const int SERIALIZATION_NORMALIZATION_MINMAX_RESULT_ID                                         = 103910;
+const int SERIALIZATION_NORMALIZATION_MINMAX_PARTIAL_RESULT_ID                                 = 103920;
 
 const int SERIALIZATION_NEURAL_NETWORKS_TRAINING_MODEL_ID                                      = 104000;
 const int SERIALIZATION_NEURAL_NETWORKS_PREDICTION_MODEL_ID                                    = 104010;
@@ -344,6 +348,16 @@ const int SERIALIZATION_RIDGE_REGRESSION_PREDICTION_RESULT_ID
 
 const int SERIALIZATION_K_NEAREST_NEIGHBOR_MODEL_ID                                            = 106000;
 const int SERIALIZATION_K_NEAREST_NEIGHBOR_TRAINING_RESULT_ID                                  = 106010;
+const int SERIALIZATION_K_NEAREST_NEIGHBOR_PREDICTION_RESULT_ID                                = 106020;
+
+const int SERIALIZATION_GBT_MODEL_ID                                                           = 107000;
+const int SERIALIZATION_GBT_TRAINING_RESULT_ID                                                 = 107010;
+
+const int SERIALIZATION_PROFILE_RESULT_ID                                                      = 108000;
+const int SERIALIZATION_PROFILE_PARTIAL_RESULT_ID                                              = 108010;
+
+const int SERIALIZATION_QUANTILE_BINNING_RESULT_ID                                             = 109000;
+const int SERIALIZATION_QUANTILE_BINNING_PARTIAL_RESULT_ID                                     = 109010;
 
 
 };
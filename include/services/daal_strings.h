@@ -67,6 +67,9 @@
     DECLARE_DAAL_STRING_CONST(dataDimension                      ) \
     DECLARE_DAAL_STRING_CONST(correlationDistance                ) \
     DECLARE_DAAL_STRING_CONST(cosineDistance                     ) \
+    DECLARE_DAAL_STRING_CONST(nRowsInBlock                       ) \
+    DECLARE_DAAL_STRING_CONST(referenceData                      ) \
+    DECLARE_DAAL_STRING_CONST(distances                          ) \
     DECLARE_DAAL_STRING_CONST(quantiles                          ) \
     DECLARE_DAAL_STRING_CONST(quantileOrders                     ) \
     DECLARE_DAAL_STRING_CONST(covariance                         ) \
@@ -245,6 +248,23 @@
     DECLARE_DAAL_STRING_CONST(retainRatio                        ) \
     DECLARE_DAAL_STRING_CONST(k                                  ) \
     DECLARE_DAAL_STRING_CONST(kdTreeTable                        ) \
+    DECLARE_DAAL_STRING_CONST(resultsToCompute                   ) \
+    DECLARE_DAAL_STRING_CONST(nProbes                            ) \
+    DECLARE_DAAL_STRING_CONST(ivfCentroids                       ) \
+    DECLARE_DAAL_STRING_CONST(ivfListOffsets                     ) \
+    DECLARE_DAAL_STRING_CONST(maxTreeDepth                       ) \
+    DECLARE_DAAL_STRING_CONST(maxLeaves                          ) \
+    DECLARE_DAAL_STRING_CONST(maxBins                            ) \
+    DECLARE_DAAL_STRING_CONST(minObservationsInLeaf              ) \
+    DECLARE_DAAL_STRING_CONST(minSplitLoss                       ) \
+    DECLARE_DAAL_STRING_CONST(splitFeatures                      ) \
+    DECLARE_DAAL_STRING_CONST(nodeValues                         ) \
+    DECLARE_DAAL_STRING_CONST(leftChildren                       ) \
+    DECLARE_DAAL_STRING_CONST(treeOffsets                        ) \
+    DECLARE_DAAL_STRING_CONST(initialScores                      ) \
+    DECLARE_DAAL_STRING_CONST(sketchItems                        ) \
+    DECLARE_DAAL_STRING_CONST(sketchLevels                       ) \
+    DECLARE_DAAL_STRING_CONST(sortedIndices                      ) \
     DECLARE_DAAL_STRING_CONST(auxRetainMask                      ) \
     DECLARE_DAAL_STRING_CONST(auxValue                           ) \
     DECLARE_DAAL_STRING_CONST(auxSmBeta                          ) \
@@ -257,7 +277,21 @@
     DECLARE_DAAL_STRING_CONST(a                                  ) \
     DECLARE_DAAL_STRING_CONST(sigma                              ) \
     DECLARE_DAAL_STRING_CONST(conservativeSequence               ) \
-    DECLARE_DAAL_STRING_CONST(pastUpdateVector                   )
+    DECLARE_DAAL_STRING_CONST(pastUpdateVector                   ) \
+    DECLARE_DAAL_STRING_CONST(location                           ) \
+    DECLARE_DAAL_STRING_CONST(scatter                            ) \
+    DECLARE_DAAL_STRING_CONST(threshold                          ) \
+    DECLARE_DAAL_STRING_CONST(locationEstimate                   ) \
+    DECLARE_DAAL_STRING_CONST(scatterEstimate                    ) \
+    DECLARE_DAAL_STRING_CONST(nObservationsPerFeature            ) \
+    DECLARE_DAAL_STRING_CONST(partialNObservationsPerFeature     ) \
+    DECLARE_DAAL_STRING_CONST(pairwiseNObservations              ) \
+    DECLARE_DAAL_STRING_CONST(pairwiseSum                        ) \
+    DECLARE_DAAL_STRING_CONST(pairwiseSumSquaresCentered         ) \
+    DECLARE_DAAL_STRING_CONST(binBorders                         ) \
+    DECLARE_DAAL_STRING_CONST(inputBinBorders                    ) \
+    DECLARE_DAAL_STRING_CONST(binnedData                         ) \
+    DECLARE_DAAL_STRING_CONST(nMiniBatches                       )
 
 
 /**
@@ -62,6 +62,22 @@ public class Parameter extends com.intel.daal.algorithms.Parameter {
         return id;
     }
 
+    /**
+     * Sets the flag that specifies whether the values equal to NaN are skipped as missing
+     * @param skipMissingValues Flag that specifies whether the values equal to NaN are skipped as missing
+     */
+    public void setSkipMissingValues(boolean skipMissingValues) {
+        cSetSkipMissingValues(this.cObject, skipMissingValues);
+    }
+
+    /**
+     * Gets the flag that specifies whether the values equal to NaN are skipped as missing
+     * @return  Flag that specifies whether the values equal to NaN are skipped as missing
+     */
+    public boolean getSkipMissingValues() {
+        return cGetSkipMissingValues(this.cObject);
+    }
+
     public void setCParameter(long cParameter) {
         this.cObject = cParameter;
         cSetCParameterObject(this.cObject, this.cAlgorithm);
@@ -71,6 +87,10 @@ public class Parameter extends com.intel.daal.algorithms.Parameter {
 
     private native int cGetOutputDataType(long parAddr);
 
+    private native void cSetSkipMissingValues(long parAddr, boolean skipMissingValues);
+
+    private native boolean cGetSkipMissingValues(long parAddr);
+
     private native void cSetCParameterObject(long parameterAddr, long algAddr);
 }
 /** @} */
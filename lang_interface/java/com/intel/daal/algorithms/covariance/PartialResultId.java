@@ -39,6 +39,9 @@ public final class PartialResultId {
     private static final int nObservationsValue = 0;
     private static final int crossProductValue  = 1;
     private static final int sumValue           = 2;
+    private static final int pairwiseNObservationsValue      = 3;
+    private static final int pairwiseSumValue                = 4;
+    private static final int pairwiseSumSquaresCenteredValue = 5;
 
     /** Number of observations processed so far */
     public static final PartialResultId nObservations = new PartialResultId(nObservationsValue);
@@ -46,5 +49,11 @@ public final class PartialResultId {
     public static final PartialResultId crossProduct  = new PartialResultId(crossProductValue);
     /** Vector of sums computed so far */
     public static final PartialResultId sum           = new PartialResultId(sumValue);
+    /** Numbers of observations in which both features of the pair are not missing */
+    public static final PartialResultId pairwiseNObservations      = new PartialResultId(pairwiseNObservationsValue);
+    /** Sums of the features over the observations in which both features of the pair are not missing */
+    public static final PartialResultId pairwiseSum                = new PartialResultId(pairwiseSumValue);
+    /** Sums of squared differences from the means over the observations in which both features of the pair are not missing */
+    public static final PartialResultId pairwiseSumSquaresCentered = new PartialResultId(pairwiseSumSquaresCenteredValue);
 }
 /** @} */
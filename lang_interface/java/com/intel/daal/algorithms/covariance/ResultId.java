@@ -38,9 +38,12 @@ public final class ResultId {
 
     private static final int covarianceValue = 0;
     private static final int meanValue       = 1;
+    private static final int nObservationsPerFeatureValue = 2;
 
     public static final ResultId covariance  = new ResultId(covarianceValue);  /*!< Variance-Covariance matrix */
     public static final ResultId correlation = new ResultId(covarianceValue);  /*!< Correlation matrix */
     public static final ResultId mean        = new ResultId(meanValue);        /*!< Vector of means */
+    /** Number of non-missing observations of every feature */
+    public static final ResultId nObservationsPerFeature = new ResultId(nObservationsPerFeatureValue);
 }
 /** @} */
@@ -86,12 +86,84 @@ public class Parameter extends com.intel.daal.algorithms.Parameter {
         return new DataUseInModelId(cGetDataUseInModel(this.cObject));
     }
 
+    /**
+     * Sets the 64 bit integer flag that indicates the results of the prediction, @ref ResultsToComputeId
+     * @param resultsToCompute   64 bit integer flag that indicates the results of the prediction
+     */
+    public void setResultsToCompute(long resultsToCompute) {
+        cSetResultsToCompute(this.cObject, resultsToCompute);
+    }
+
+    /**
+     * Returns the 64 bit integer flag that indicates the results of the prediction, @ref ResultsToComputeId
+     * @return 64 bit integer flag that indicates the results of the prediction
+     */
+    public long getResultsToCompute() {
+        return cGetResultsToCompute(this.cObject);
+    }
+
+    /**
+     * Sets the weights of the nearest neighbors in the prediction
+     * @param voteWeights   Weights of the nearest neighbors in the prediction
+     */
+    public void setVoteWeights(VoteWeightsId voteWeights) {
+        cSetVoteWeights(this.cObject, voteWeights.getValue());
+    }
+
+    /**
+     * Returns the weights of the nearest neighbors in the prediction
+     * @return Weights of the nearest neighbors in the prediction
+     */
+    public VoteWeightsId getVoteWeights() {
+        return new VoteWeightsId(cGetVoteWeights(this.cObject));
+    }
+
+    /**
+     * Sets the number of the clusters of the inverted file index built by the TrainingMethod.ivfDense method
+     * @param nLists    Number of the clusters. If zero, the square root of the number of training observations is used
+     */
+    public void setNLists(long nLists) {
+        cSetNLists(this.cObject, nLists);
+    }
+
+    /**
+     * Returns the number of the clusters of the inverted file index built by the TrainingMethod.ivfDense method
+     * @return Number of the clusters
+     */
+    public long getNLists() {
+        return cGetNLists(this.cObject);
+    }
+
+    /**
+     * Sets the number of the clusters scanned by the PredictionMethod.ivfDense method for every observation
+     * @param nProbes   Number of the scanned clusters. Larger values increase the recall and the search time
+     */
+    public void setNProbes(long nProbes) {
+        cSetNProbes(this.cObject, nProbes);
+    }
+
+    /**
+     * Returns the number of the clusters scanned by the PredictionMethod.ivfDense method for every observation
+     * @return Number of the scanned clusters
+     */
+    public long getNProbes() {
+        return cGetNProbes(this.cObject);
+    }
+
     private native void cSetK(long algAddr, long k);
     private native void cSetSeed(long algAddr, int seed);
     private native void cSetDataUseInModel(long algAddr, int flag);
+    private native void cSetResultsToCompute(long algAddr, long resultsToCompute);
+    private native void cSetVoteWeights(long algAddr, int voteWeights);
+    private native void cSetNLists(long algAddr, long nLists);
+    private native void cSetNProbes(long algAddr, long nProbes);
 
     private native long cGetK(long algAddr);
     private native int cGetSeed(long algAddr);
     private native int cGetDataUseInModel(long algAddr);
+    private native long cGetResultsToCompute(long algAddr);
+    private native int cGetVoteWeights(long algAddr);
+    private native long cGetNLists(long algAddr);
+    private native long cGetNProbes(long algAddr);
 }
 /** @} */
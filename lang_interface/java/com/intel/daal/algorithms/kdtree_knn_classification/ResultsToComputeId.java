@@ -0,0 +1,34 @@
+/* file: DataUseInModelId.java */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/**
+ * @ingroup kdtree_knn_classification
+ * @{
+ */
+package com.intel.daal.algorithms.kdtree_knn_classification;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__RESULTSTOCOMPUTEID"></a>
+ * @brief Available identifiers to specify the results of the k nearest neighbors prediction
+ */
+public final class ResultsToComputeId {
+
+    public static final long computeClassLabels        = 0x0000000000000001L; /*!< Class labels obtained by voting of the nearest neighbors */
+    public static final long computeResponses          = 0x0000000000000002L; /*!< Responses of the kNN regression */
+    public static final long computeIndicesOfNeighbors = 0x0000000000000004L; /*!< Indices of the nearest neighbors */
+    public static final long computeDistances          = 0x0000000000000008L; /*!< Distances to the nearest neighbors */
+}
+/** @} */
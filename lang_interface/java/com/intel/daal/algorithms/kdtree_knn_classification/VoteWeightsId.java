@@ -0,0 +1,51 @@
+/* file: DataUseInModelId.java */
+/*******************************************************************************
+* Copyright 2014-2017 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+/**
+ * @ingroup kdtree_knn_classification
+ * @{
+ */
+package com.intel.daal.algorithms.kdtree_knn_classification;
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KDTREE_KNN_CLASSIFICATION__VOTEWEIGHTSID"></a>
+ * @brief Weights of the nearest neighbors in the k nearest neighbors prediction
+ */
+public final class VoteWeightsId {
+    /** @private */
+    static {
+        System.loadLibrary("JavaAPI");
+    }
+
+    private int _value;
+
+    public VoteWeightsId(int value) {
+        _value = value;
+    }
+
+    public int getValue() {
+        return _value;
+    }
+
+    private static final int voteUniformId  = 0;
+    private static final int voteDistanceId = 1;
+
+    public static final VoteWeightsId voteUniform  = new VoteWeightsId(voteUniformId);
+        /*!< All the nearest neighbors have the same weight */
+    public static final VoteWeightsId voteDistance = new VoteWeightsId(voteDistanceId);
+        /*!< The weight of the neighbor is inversely proportional to the distance to it */
+}
+/** @} */
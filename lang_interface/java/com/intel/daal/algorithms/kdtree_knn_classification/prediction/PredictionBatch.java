@@ -86,7 +86,8 @@ public class PredictionBatch extends com.intel.daal.algorithms.classifier.predic
             throw new IllegalArgumentException("type unsupported");
         }
 
-        if (this.method != PredictionMethod.defaultDense) {
+        if (this.method != PredictionMethod.defaultDense && this.method != PredictionMethod.bruteForceDense
+                && this.method != PredictionMethod.autoDense && this.method != PredictionMethod.ivfDense) {
             throw new IllegalArgumentException("method unsupported");
         }
 
@@ -37,8 +37,14 @@ public final class PredictionMethod {
         return _value;
     }
 
-    private static final int defaultDenseValue = 0;
+    private static final int defaultDenseValue    = 0;
+    private static final int bruteForceDenseValue = 1;
+    private static final int autoDenseValue       = 2;
+    private static final int ivfDenseValue        = 3;
 
-    public static final PredictionMethod defaultDense = new PredictionMethod(defaultDenseValue); /*!< Default method */
+    public static final PredictionMethod defaultDense    = new PredictionMethod(defaultDenseValue);    /*!< Default method */
+    public static final PredictionMethod bruteForceDense = new PredictionMethod(bruteForceDenseValue); /*!< Brute force search of the nearest neighbors */
+    public static final PredictionMethod autoDense       = new PredictionMethod(autoDenseValue);       /*!< Automatic choice between the KD-tree and brute force search */
+    public static final PredictionMethod ivfDense        = new PredictionMethod(ivfDenseValue);        /*!< Approximate search in the inverted file index */
 }
 /** @} */
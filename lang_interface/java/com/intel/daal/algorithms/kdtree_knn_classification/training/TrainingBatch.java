@@ -72,7 +72,8 @@ public class TrainingBatch extends com.intel.daal.algorithms.classifier.training
         super(context);
 
         this.method = method;
-        if (this.method != TrainingMethod.defaultDense) {
+        if (this.method != TrainingMethod.defaultDense && this.method != TrainingMethod.bruteForceDense
+                && this.method != TrainingMethod.autoDense && this.method != TrainingMethod.ivfDense) {
             throw new IllegalArgumentException("method unsupported");
         }
 
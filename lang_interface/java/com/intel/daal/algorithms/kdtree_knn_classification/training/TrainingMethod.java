@@ -50,8 +50,14 @@ public final class TrainingMethod {
         return _value;
     }
 
-    private static final int defaultDenseValue = 0;
-
-    public static final TrainingMethod defaultDense = new TrainingMethod(defaultDenseValue);   /*!< Default method */
+    private static final int defaultDenseValue    = 0;
+    private static final int bruteForceDenseValue = 1;
+    private static final int autoDenseValue       = 2;
+    private static final int ivfDenseValue        = 3;
+
+    public static final TrainingMethod defaultDense    = new TrainingMethod(defaultDenseValue);    /*!< Default method */
+    public static final TrainingMethod bruteForceDense = new TrainingMethod(bruteForceDenseValue); /*!< Brute force search of the nearest neighbors */
+    public static final TrainingMethod autoDense       = new TrainingMethod(autoDenseValue);       /*!< Automatic choice between the KD-tree and brute force search */
+    public static final TrainingMethod ivfDense        = new TrainingMethod(ivfDenseValue);        /*!< Approximate search in the inverted file index */
 }
 /** @} */
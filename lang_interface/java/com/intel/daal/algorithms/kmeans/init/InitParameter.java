@@ -107,6 +107,15 @@ public class InitParameter extends com.intel.daal.algorithms.Parameter {
         return cGetNRounds(this.cObject);
     }
 
+    /**
+     * Kmeans++ only. Retrieves the number of candidates evaluated for each new centroid.
+     * Value 1 stands for the standard kmeans++, greater values give greedy kmeans++.
+     * @return Number of candidates per centroid
+     */
+    public long getNTrials() {
+        return cGetNTrials(this.cObject);
+    }
+
     /**
     * Sets the number of clusters
     * @param nClusters Number of clusters
@@ -149,6 +158,15 @@ public class InitParameter extends com.intel.daal.algorithms.Parameter {
         cSetNRounds(this.cObject, nRounds);
     }
 
+    /**
+     * Kmeans++ only. Sets the number of candidates evaluated for each new centroid.
+     * Value 1 stands for the standard kmeans++, greater values give greedy kmeans++.
+     * @param nTrials Number of candidates per centroid
+     */
+    public void setNTrials(long nTrials) {
+        cSetNTrials(this.cObject, nTrials);
+    }
+
 
     private native long init(long nClusters, long maxIterations);
 
@@ -162,6 +180,8 @@ public class InitParameter extends com.intel.daal.algorithms.Parameter {
 
     private native long cGetNRounds(long parameterAddress);
 
+    private native long cGetNTrials(long parameterAddress);
+
     private native void cSetNClusters(long parameterAddress, long nClusters);
 
     private native void cSetNRowsTotal(long parameterAddress, long nClusters);
@@ -171,5 +191,7 @@ public class InitParameter extends com.intel.daal.algorithms.Parameter {
     private native void cSetOversamplingFactor(long parameterAddress, double factor);
 
     private native void cSetNRounds(long parameterAddress, long nRounds);
+
+    private native void cSetNTrials(long parameterAddress, long nTrials);
 }
 /** @} */
@@ -74,7 +74,7 @@ public class Input extends com.intel.daal.algorithms.Input {
      * @param val   The input object
      */
     public void set(InputId id, NumericTable val) {
-        if (id == InputId.data) {
+        if (id == InputId.data || id == InputId.weights) {
             cSetInput(cObject, id.getValue(), val.getCObject());
         }
         else {
@@ -88,7 +88,7 @@ public class Input extends com.intel.daal.algorithms.Input {
      * @return   %Input object that corresponds to the given identifier
      */
     public NumericTable get(InputId id) {
-        if (id == InputId.data) {
+        if (id == InputId.data || id == InputId.weights) {
             return (NumericTable)Factory.instance().createObject(getContext(), cGetInputTable(cObject, id.getValue()));
         }
         else {
@@ -37,8 +37,12 @@ public final class InputId {
     }
 
     private static final int DefaultInputId = 0;
+    private static final int WeightsId      = 1;
 
     /** %Input data table */
     public static final InputId data = new InputId(DefaultInputId);
+
+    /** Optional weights of observations */
+    public static final InputId weights = new InputId(WeightsId);
 }
 /** @} */
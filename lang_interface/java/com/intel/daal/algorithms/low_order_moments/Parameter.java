@@ -74,6 +74,21 @@ public class Parameter extends com.intel.daal.algorithms.Parameter {
         return id;
     }
 
+    /**
+     * Sets the flag that specifies whether the values equal to NaN are skipped as missing
+     * @param skipMissingValues Flag that specifies whether the values equal to NaN are skipped as missing
+     */
+    public void setSkipMissingValues(boolean skipMissingValues) {
+        cSetSkipMissingValues(this.cObject, skipMissingValues);
+    }
+
+    /**
+     * Gets the flag that specifies whether the values equal to NaN are skipped as missing
+     * @return  Flag that specifies whether the values equal to NaN are skipped as missing
+     */
+    public boolean getSkipMissingValues() {
+        return cGetSkipMissingValues(this.cObject);
+    }
 
     private InitializationProcedureIface _initializationProcedure;
 
@@ -83,5 +98,9 @@ public class Parameter extends com.intel.daal.algorithms.Parameter {
 
     private native int cGetEstimatesToCompute(long parAddr);
 
+    private native void cSetSkipMissingValues(long parAddr, boolean skipMissingValues);
+
+    private native boolean cGetSkipMissingValues(long parAddr);
+
 }
 /** @} */
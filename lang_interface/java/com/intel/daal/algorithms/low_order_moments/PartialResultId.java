@@ -42,6 +42,7 @@ public final class PartialResultId {
     private static final int PartialSum                = 3;
     private static final int PartialSumSquares         = 4;
     private static final int PartialSumSquaresCentered = 5;
+    private static final int PartialNObservationsPerFeature = 6;
 
     /**< Number of rows processed so far */
     public static final PartialResultId nObservations = new PartialResultId(NObservations);
@@ -60,5 +61,8 @@ public final class PartialResultId {
 
     /**< Partial sum of squared difference from the means */
     public static final PartialResultId partialSumSquaresCentered = new PartialResultId(PartialSumSquaresCentered);
+
+    /**< Partial number of non-missing observations of every feature */
+    public static final PartialResultId partialNObservationsPerFeature = new PartialResultId(PartialNObservationsPerFeature);
 }
 /** @} */
@@ -46,6 +46,7 @@ public final class ResultId {
     private static final int Variance             = 7;
     private static final int StandardDeviation    = 8;
     private static final int Variation            = 9;
+    private static final int NObservationsPerFeature = 10;
 
     public static final ResultId minimum              = new ResultId(Minimum);           /*!< Minimum */
     public static final ResultId maximum              = new ResultId(Maximum);           /*!< Maximum */
@@ -59,5 +60,7 @@ public final class ResultId {
     public static final ResultId variance             = new ResultId(Variance);          /*!< Variance */
     public static final ResultId standardDeviation    = new ResultId(StandardDeviation); /*!< Standard deviation */
     public static final ResultId variation            = new ResultId(Variation);         /*!< Variation */
+    public static final ResultId nObservationsPerFeature = new ResultId(
+            NObservationsPerFeature);                                                    /*!< Number of non-missing observations of every feature */
 }
 /** @} */
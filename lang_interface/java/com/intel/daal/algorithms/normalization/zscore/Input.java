@@ -49,7 +49,7 @@ public final class Input extends com.intel.daal.algorithms.Input {
      * @param val   Value of the input object
      */
     public void set(InputId id, NumericTable val) {
-        if (id == InputId.data) {
+        if (id == InputId.data || id == InputId.weights) {
             cSetInput(cObject, id.getValue(), val.getCObject());
         }
         else {
@@ -63,7 +63,7 @@ public final class Input extends com.intel.daal.algorithms.Input {
      * @return   Input object that corresponds to the given identifier
      */
     public NumericTable get(InputId id) {
-        if (id == InputId.data) {
+        if (id == InputId.data || id == InputId.weights) {
             return (NumericTable)Factory.instance().createObject(getContext(), cGetInputTable(cObject, id.getValue()));
         }
         else {
@@ -50,7 +50,9 @@ public final class InputId {
     }
 
     private static final int InputDataId = 0;
+    private static final int WeightsId   = 1;
 
-    public static final InputId data = new InputId(InputDataId); /*!< %Input data table */
+    public static final InputId data    = new InputId(InputDataId); /*!< %Input data table */
+    public static final InputId weights = new InputId(WeightsId);   /*!< Optional weights of observations */
 }
 /** @} */
@@ -52,6 +52,23 @@ JNIEXPORT jint JNICALL Java_com_intel_daal_algorithms_covariance_Parameter_cGetO
     return(jint)(*(covariance::Parameter *)parAddr).outputMatrixType;
 }
 
+/*
+ * Class:     com_intel_daal_algorithms_covariance_Parameter
+ * Method:    cSetSkipMissingValues
+ * Signature: (JZ)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_covariance_Parameter_cSetSkipMissingValues
+(JNIEnv *env, jobject thisObj, jlong parAddr, jboolean skipMissingValues)
+{
+    (*(covariance::Parameter *)parAddr).skipMissingValues = skipMissingValues;
+}
+
+JNIEXPORT jboolean JNICALL Java_com_intel_daal_algorithms_covariance_Parameter_cGetSkipMissingValues
+(JNIEnv *env, jobject thisObj, jlong parAddr)
+{
+    return (*(covariance::Parameter *)parAddr).skipMissingValues;
+}
+
 /*
  * Class:     com_intel_daal_algorithms_covariance_Parameter
  * Method:    cSetCParameterObject
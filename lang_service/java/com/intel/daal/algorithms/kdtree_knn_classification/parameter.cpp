@@ -87,3 +87,91 @@ JNIEXPORT jint JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classificatio
 {
     return (jint)((*(kdtree_knn_classification::Parameter *)parAddr).dataUseInModel);
 }
+
+/*
+ * Class:     com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter
+ * Method:    cSetResultsToCompute
+ * Signature:(JJ)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter_cSetResultsToCompute
+(JNIEnv *env, jobject thisObj, jlong parAddr, jlong resultsToCompute)
+{
+    (*(kdtree_knn_classification::Parameter *)parAddr).resultsToCompute = resultsToCompute;
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter
+ * Method:    cGetResultsToCompute
+ * Signature:(J)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter_cGetResultsToCompute
+(JNIEnv *env, jobject thisObj, jlong parAddr)
+{
+    return (jlong)((*(kdtree_knn_classification::Parameter *)parAddr).resultsToCompute);
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter
+ * Method:    cSetVoteWeights
+ * Signature:(JI)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter_cSetVoteWeights
+(JNIEnv *env, jobject thisObj, jlong parAddr, jint voteWeights)
+{
+    (*(kdtree_knn_classification::Parameter *)parAddr).voteWeights = (kdtree_knn_classification::VoteWeights)voteWeights;
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter
+ * Method:    cGetVoteWeights
+ * Signature:(J)I
+ */
+JNIEXPORT jint JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter_cGetVoteWeights
+(JNIEnv *env, jobject thisObj, jlong parAddr)
+{
+    return (jint)((*(kdtree_knn_classification::Parameter *)parAddr).voteWeights);
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter
+ * Method:    cSetNLists
+ * Signature:(JJ)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter_cSetNLists
+(JNIEnv *env, jobject thisObj, jlong parAddr, jlong nLists)
+{
+    (*(kdtree_knn_classification::Parameter *)parAddr).nLists = nLists;
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter
+ * Method:    cGetNLists
+ * Signature:(J)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter_cGetNLists
+(JNIEnv *env, jobject thisObj, jlong parAddr)
+{
+    return (jlong)((*(kdtree_knn_classification::Parameter *)parAddr).nLists);
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter
+ * Method:    cSetNProbes
+ * Signature:(JJ)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter_cSetNProbes
+(JNIEnv *env, jobject thisObj, jlong parAddr, jlong nProbes)
+{
+    (*(kdtree_knn_classification::Parameter *)parAddr).nProbes = nProbes;
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter
+ * Method:    cGetNProbes
+ * Signature:(J)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_Parameter_cGetNProbes
+(JNIEnv *env, jobject thisObj, jlong parAddr)
+{
+    return (jlong)((*(kdtree_knn_classification::Parameter *)parAddr).nProbes);
+}
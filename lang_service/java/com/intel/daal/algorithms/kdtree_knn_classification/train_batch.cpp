@@ -23,6 +23,9 @@
 #include "common_helpers.h"
 
 #define defaultDense com_intel_daal_algorithms_kdtree_knn_classification_training_TrainingMethod_defaultDenseValue
+#define bruteForceDense com_intel_daal_algorithms_kdtree_knn_classification_training_TrainingMethod_bruteForceDenseValue
+#define autoDense com_intel_daal_algorithms_kdtree_knn_classification_training_TrainingMethod_autoDenseValue
+#define ivfDense com_intel_daal_algorithms_kdtree_knn_classification_training_TrainingMethod_ivfDenseValue
 
 USING_COMMON_NAMESPACES();
 using namespace daal::algorithms::kdtree_knn_classification::training;
@@ -35,7 +38,7 @@ using namespace daal::algorithms::kdtree_knn_classification::training;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_training_TrainingBatch_cInit
 (JNIEnv *env, jobject thisObj, jint prec, jint method)
 {
-    return jniBatch<kdtree_knn_classification::training::Method, Batch, defaultDense>::newObj(prec, method);
+    return jniBatch<kdtree_knn_classification::training::Method, Batch, defaultDense, bruteForceDense, autoDense, ivfDense>::newObj(prec, method);
 }
 
 /*
@@ -46,7 +49,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classificati
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_training_TrainingBatch_cInitParameter
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<kdtree_knn_classification::training::Method, Batch, defaultDense>::getParameter(prec, method, algAddr);
+    return jniBatch<kdtree_knn_classification::training::Method, Batch, defaultDense, bruteForceDense, autoDense, ivfDense>::getParameter(prec, method, algAddr);
 }
 
 /*
@@ -57,7 +60,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classificati
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_training_TrainingBatch_cGetInput
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<kdtree_knn_classification::training::Method, Batch, defaultDense>::getInput(prec, method, algAddr);
+    return jniBatch<kdtree_knn_classification::training::Method, Batch, defaultDense, bruteForceDense, autoDense, ivfDense>::getInput(prec, method, algAddr);
 }
 
 /*
@@ -68,7 +71,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classificati
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_training_TrainingBatch_cGetResult
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<kdtree_knn_classification::training::Method, Batch, defaultDense>::getResult(prec, method, algAddr);
+    return jniBatch<kdtree_knn_classification::training::Method, Batch, defaultDense, bruteForceDense, autoDense, ivfDense>::getResult(prec, method, algAddr);
 }
 
 /*
@@ -79,5 +82,5 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classificati
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kdtree_1knn_1classification_training_TrainingBatch_cClone
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<kdtree_knn_classification::training::Method, Batch, defaultDense>::getClone(prec, method, algAddr);
+    return jniBatch<kdtree_knn_classification::training::Method, Batch, defaultDense, bruteForceDense, autoDense, ivfDense>::getClone(prec, method, algAddr);
 }
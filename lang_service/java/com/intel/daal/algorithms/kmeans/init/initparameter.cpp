@@ -83,6 +83,17 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitParameter
     return((kmeans::init::Parameter *)parameterAddress)->nRounds;
 }
 
+/*
+* Class:     com_intel_daal_algorithms_kmeans_init_InitParameter
+* Method:    cGetNTrials
+* Signature: (J)J
+*/
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitParameter_cGetNTrials
+(JNIEnv *, jobject, jlong parameterAddress)
+{
+    return((kmeans::init::Parameter *)parameterAddress)->nTrials;
+}
+
 
 /*
  * Class:     com_intel_daal_algorithms_kmeans_Parameter
@@ -134,6 +145,17 @@ JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitParameter_
     ((kmeans::init::Parameter *)parameterAddress)->nRounds = nRounds;
 }
 
+/*
+* Class:     com_intel_daal_algorithms_kmeans_init_InitParameter
+* Method:    cSetNTrials
+* Signature: (JJ)V
+*/
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitParameter_cSetNTrials
+(JNIEnv *, jobject, jlong parameterAddress, jlong nTrials)
+{
+    ((kmeans::init::Parameter *)parameterAddress)->nTrials = nTrials;
+}
+
 /////////////////////////////////////// plusPlus methods ///////////////////////////////////////////////////////
 ///////////////////////////////////////   step2Local     ///////////////////////////////////////////////////////
 /*
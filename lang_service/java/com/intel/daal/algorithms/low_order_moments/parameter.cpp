@@ -82,3 +82,27 @@ JNIEXPORT jint JNICALL Java_com_intel_daal_algorithms_low_1order_1moments_Parame
     return (jint)(parameterAddr->estimatesToCompute);
 
 }
+
+/*
+ * Class:     com_intel_daal_algorithms_low_order_moments_Parameter
+ * Method:    cSetSkipMissingValues
+ * Signature: (JZ)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_low_1order_1moments_Parameter_cSetSkipMissingValues
+  (JNIEnv *env, jobject thisObj, jlong parAddr, jboolean skipMissingValues)
+{
+    using namespace daal::algorithms;
+    ((low_order_moments::Parameter *)parAddr)->skipMissingValues = skipMissingValues;
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_low_order_moments_Parameter
+ * Method:    cGetSkipMissingValues
+ * Signature: (J)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_intel_daal_algorithms_low_1order_1moments_Parameter_cGetSkipMissingValues
+  (JNIEnv *env, jobject thisObj, jlong parAddr)
+{
+    using namespace daal::algorithms;
+    return ((low_order_moments::Parameter *)parAddr)->skipMissingValues;
+}